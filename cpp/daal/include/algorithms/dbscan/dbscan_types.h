@@ -54,7 +54,9 @@ const int undefined = -2;
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default: performance-oriented method */
+    defaultDense      = 0, /*!< Default: performance-oriented method */
+    spatialIndexDense = 1  /*!< Method that builds a kd-tree over the observations to answer the neighborhood queries.
+                                Neighborhoods are always streamed, so Parameter::memorySavingMode is ignored */
 };
 
 /**
@@ -110,6 +110,29 @@ enum ResultCovariancesId
     lastResultCovariancesId = covariances
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__EM_GMM__PARTIALRESULTID"></a>
+ * Available identifiers of partial results of the EM for GMM algorithm in the online processing mode
+ */
+enum PartialResultId
+{
+    partialWeights,      /*!< Weights of the model fitted to the blocks processed so far */
+    partialMeans,        /*!< Means of the model fitted to the blocks processed so far */
+    partialGoalFunction, /*!< Table containing log-likelihood value of the last processed block */
+    partialNBlocks,      /*!< Table containing the number of processed blocks */
+    lastPartialResultId = partialNBlocks
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__EM_GMM__PARTIALRESULTCOVARIANCESID"></a>
+ * Available identifiers of partial covariances of the EM for GMM algorithm in the online processing mode
+ */
+enum PartialResultCovariancesId
+{
+    partialCovariances             = lastPartialResultId + 1, /*!< %Collection of covariances of the model fitted to the blocks processed so far */
+    lastPartialResultCovariancesId = partialCovariances
+};
+
 /**
  * \brief Contains version 1.0 of the Intel(R) oneAPI Data Analytics Library interface.
  */
@@ -132,9 +155,11 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
      * \param[in] accuracyThreshold        Threshold for the termination of the algorithm
      * \param[in] regularizationFactor     Factor for covariance regularization in case of ill-conditional data
      * \param[in] covarianceStorage        Type of covariance in the Gaussian mixture model.
+     * \param[in] stepSizeDecay            Decay rate of the step size of the online processing mode
      */
     Parameter(const size_t nComponents, const services::SharedPtr<covariance::BatchImpl> & covariance, const size_t maxIterations = 10,
-              const double accuracyThreshold = 1.0e-04, const double regularizationFactor = 0.01, const CovarianceStorageId covarianceStorage = full);
+              const double accuracyThreshold = 1.0e-04, const double regularizationFactor = 0.01, const CovarianceStorageId covarianceStorage = full,
+              const double stepSizeDecay = 0.7);
 
     Parameter(const Parameter & other);
 
@@ -151,6 +176,9 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
     services::SharedPtr<covariance::BatchImpl> covariance; /*!< Pointer to the algorithm that computes the covariance */
     double regularizationFactor;                           /*!< Factor for covariance regularization in case of ill-conditional data */
     CovarianceStorageId covarianceStorage;                 /*!< Type of covariance in the Gaussian mixture model. */
+    double stepSizeDecay;                                  /*!< Decay rate kappa of the step size of the online processing mode:
+                                                                the statistics of the block t are blended into the model with
+                                                                the weight (t + 1)^(-kappa). Must be in the interval (0.5, 1] */
 };
 /* [Parameter source code] */
 
@@ -242,6 +270,16 @@ public:
     template <typename algorithmFPType>
     DAAL_EXPORT services::Status allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, const int method);
 
+    /**
+     * Allocates memory for storing results of the EM for GMM algorithm in the online processing mode
+     * \param[in] partialResult Pointer to the partial result structure
+     * \param[in] parameter     Pointer to the parameter structure
+     * \param[in] method        Computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::PartialResult * partialResult, const daal::algorithms::Parameter * parameter,
+                                          const int method);
+
     /**
      * Sets the result of the EM for GMM algorithm
      * \param[in] id    %Result identifier
@@ -286,8 +324,17 @@ public:
     */
     services::Status check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par, int method) const DAAL_C11_OVERRIDE;
 
+    /**
+    * Checks the result parameter of the EM for GMM algorithm in the online processing mode
+    * \param[in] partialResult %Partial result of the algorithm
+    * \param[in] par           %Parameter of algorithm
+    * \param[in] method        Computation method
+    */
+    services::Status check(const daal::algorithms::PartialResult * partialResult, const daal::algorithms::Parameter * par,
+                           int method) const DAAL_C11_OVERRIDE;
+
 protected:
-    using daal::algorithms::interface1::Result::check;
+    services::Status checkImpl(size_t nFeatures, const daal::algorithms::Parameter * par) const;
 
     /** \private */
     template <typename Archive, bool onDeserialize>
@@ -297,12 +344,116 @@ protected:
     }
 };
 typedef services::SharedPtr<Result> ResultPtr;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__EM_GMM__PARTIALRESULT"></a>
+ * \brief Provides methods to access partial results obtained with the compute() method of the EM for GMM algorithm
+ *        in the online processing mode. The partial result holds the model fitted to the blocks processed so far
+ */
+class DAAL_EXPORT PartialResult : public daal::algorithms::PartialResult
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(PartialResult)
+    /** Default constructor */
+    PartialResult();
+
+    virtual ~PartialResult() {};
+
+    /**
+     * Allocates memory for storing partial results of the EM for GMM algorithm
+     * \param[in] input     Pointer to the input structure
+     * \param[in] parameter Pointer to the parameter structure
+     * \param[in] method    Computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, const int method);
+
+    /**
+     * Initializes partial results of the EM for GMM algorithm with the empty model
+     * \param[in] input     Pointer to the input structure
+     * \param[in] parameter Pointer to the parameter structure
+     * \param[in] method    Computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status initialize(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, const int method);
+
+    /**
+     * Returns the number of features in the partial result of the EM for GMM algorithm
+     * \param[out] nFeatures Number of features
+     * \return Status of the call
+     */
+    services::Status getNumberOfFeatures(size_t & nFeatures) const;
+
+    /**
+     * Sets the partial result of the EM for GMM algorithm
+     * \param[in] id    %Partial result identifier
+     * \param[in] ptr   Pointer to the numeric table with the partial result
+     */
+    void set(PartialResultId id, const data_management::NumericTablePtr & ptr);
+
+    /**
+     * Sets the collection of partial covariances for the EM for GMM algorithm
+     * \param[in] id    Identifier of the collection of partial covariances
+     * \param[in] ptr   Pointer to the collection of partial covariances
+     */
+    void set(PartialResultCovariancesId id, const data_management::DataCollectionPtr & ptr);
+
+    /**
+     * Returns the partial result of the EM for GMM algorithm
+     * \param[in] id   %Partial result identifier
+     * \return         %Partial result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(PartialResultId id) const;
+
+    /**
+     * Returns the collection of partial covariances of the EM for GMM algorithm
+     * \param[in] id   Identifier of the collection of partial covariances
+     * \return         Collection of partial covariances that corresponds to the given identifier
+     */
+    data_management::DataCollectionPtr get(PartialResultCovariancesId id) const;
+
+    /**
+     * Returns the covariance with a given index from the collection of partial covariances
+     * \param[in] id    Identifier of the collection of partial covariances
+     * \param[in] index Index of the covariance to be returned
+     * \return          Pointer to the table with the partial covariance
+     */
+    data_management::NumericTablePtr get(PartialResultCovariancesId id, size_t index) const;
+
+    /**
+     * Checks the partial result of the EM for GMM algorithm
+     * \param[in] input     %Input of the algorithm
+     * \param[in] parameter %Parameter of algorithm
+     * \param[in] method    Computation method
+     */
+    services::Status check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Checks the partial result of the EM for GMM algorithm
+     * \param[in] parameter %Parameter of algorithm
+     * \param[in] method    Computation method
+     */
+    services::Status check(const daal::algorithms::Parameter * parameter, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    services::Status checkImpl(size_t nFeatures, const daal::algorithms::Parameter * parameter) const;
+
+    /** \private */
+    template <typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive * arch)
+    {
+        return daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<PartialResult> PartialResultPtr;
 /** @} */
 } // namespace interface1
 using interface1::Parameter;
 using interface1::Input;
 using interface1::Result;
 using interface1::ResultPtr;
+using interface1::PartialResult;
+using interface1::PartialResultPtr;
 
 } // namespace em_gmm
 } // namespace algorithms
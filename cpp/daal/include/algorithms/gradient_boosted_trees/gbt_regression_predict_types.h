@@ -57,7 +57,9 @@ namespace prediction
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default method */
+    defaultDense     = 0, /*!< Default method */
+    quickScorerDense = 1  /*!< QuickScorer method: trees are converted once into bitvectors of leaves grouped by feature
+                               and tiles of rows are scored by the bitwise operations */
 };
 
 /**
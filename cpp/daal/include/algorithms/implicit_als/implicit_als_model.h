@@ -42,6 +42,17 @@ namespace algorithms
  */
 namespace implicit_als
 {
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__IMPLICIT_ALS__SOLVERMETHOD"></a>
+ * Available methods for solving the systems of normal equations for the users and items factors
+ */
+enum SolverMethod
+{
+    choleskySolver          = 0, /*!< Default: direct solution by the Cholesky decomposition of the system matrix formed for each row */
+    conjugateGradientSolver = 1  /*!< A few iterations of the conjugate gradient method started from the current factors
+                                      that do not form the system matrix for each row */
+};
+
 /**
  * \brief Contains version 1.0 of the Intel(R) oneAPI Data Analytics Library interface
  */
@@ -78,6 +89,37 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
 };
 /* [Parameter source code] */
 
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__IMPLICIT_ALS__TRAINPARAMETER"></a>
+ * \brief Parameters for the compute() method of the implicit ALS training algorithm
+ *        that also define the method for solving the systems of normal equations
+ *
+ * \snippet implicit_als/implicit_als_model.h TrainParameter source code
+ */
+/* [TrainParameter source code] */
+struct DAAL_EXPORT TrainParameter : public Parameter
+{
+    /**
+     * Constructs parameters of the implicit ALS training algorithm
+     * \param[in] nFactors            Number of factors
+     * \param[in] maxIterations       Maximum number of iterations of the implicit ALS training algorithm
+     * \param[in] alpha               Confidence parameter of the implicit ALS training algorithm
+     * \param[in] lambda              Regularization parameter
+     * \param[in] preferenceThreshold Threshold used to define preference values
+     * \param[in] solverMethod        Method for solving the systems of normal equations
+     * \param[in] nCGIterations       Number of iterations of the conjugate gradient method per row of factors
+     */
+    TrainParameter(size_t nFactors = 10, size_t maxIterations = 5, double alpha = 40.0, double lambda = 0.01, double preferenceThreshold = 0.0,
+                   SolverMethod solverMethod = choleskySolver, size_t nCGIterations = 3);
+
+    SolverMethod solverMethod; /*!< Method for solving the systems of normal equations for the users and items factors */
+    size_t nCGIterations;      /*!< Number of iterations of the conjugate gradient method per row of factors,
+                                    used with the conjugateGradientSolver method only */
+
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+/* [TrainParameter source code] */
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__IMPLICIT_ALS__MODEL"></a>
  * \brief Model trained by the implicit ALS algorithm in the batch processing mode
@@ -282,6 +324,7 @@ private:
 typedef services::SharedPtr<PartialModel> PartialModelPtr;
 } // namespace interface1
 using interface1::Parameter;
+using interface1::TrainParameter;
 using interface1::ModelPtr;
 using interface1::Model;
 using interface1::PartialModelPtr;
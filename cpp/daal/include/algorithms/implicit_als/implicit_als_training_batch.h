@@ -82,11 +82,11 @@ class DAAL_EXPORT Batch : public daal::algorithms::Training<batch>
 {
 public:
     typedef algorithms::implicit_als::training::Input InputType;
-    typedef algorithms::implicit_als::Parameter ParameterType;
+    typedef algorithms::implicit_als::TrainParameter ParameterType;
     typedef algorithms::implicit_als::training::Result ResultType;
 
     InputType input;         /*!< %Input data structure */
-    ParameterType parameter; /*!< %Algorithm \ref implicit_als::interface1::Parameter "parameter" */
+    ParameterType parameter; /*!< %Algorithm \ref implicit_als::interface1::TrainParameter "parameter" */
 
     /** Default constructor */
     Batch() { initialize(); }
@@ -525,12 +525,12 @@ class DAAL_EXPORT Distributed<step4Local, algorithmFPType, method> : public Trai
 {
 public:
     typedef algorithms::implicit_als::training::DistributedInput<step4Local> InputType;
-    typedef algorithms::implicit_als::Parameter ParameterType;
+    typedef algorithms::implicit_als::TrainParameter ParameterType;
     typedef algorithms::implicit_als::training::Result ResultType;
     typedef algorithms::implicit_als::training::DistributedPartialResultStep4 PartialResultType;
 
     DistributedInput<step4Local> input; /*!< %Input data structure */
-    ParameterType parameter;            /*!< %Training \ref implicit_als::interface1::Parameter "parameters" */
+    ParameterType parameter;            /*!< %Training \ref implicit_als::interface1::TrainParameter "parameters" */
 
     /** Default constructor */
     Distributed() { initialize(); }
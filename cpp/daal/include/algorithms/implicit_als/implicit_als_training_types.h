@@ -190,6 +190,19 @@ enum Step4LocalNumericTableInputId
     lastStep4LocalNumericTableInputId = inputOfStep4FromStep2
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__IMPLICIT_ALS__TRAINING__STEP4LOCALPARTIALMODELINPUTID"></a>
+ * Available identifiers of optional input partial model objects for the implicit ALS training algorithm in the fourth step
+ * of the distributed processing mode
+ */
+enum Step4LocalPartialModelInputId
+{
+    inputOfStep4FromStep4 = lastStep4LocalNumericTableInputId + 1, /*!< Optional partial model computed on this node in the fourth step
+                                                                         of the previous iteration. Its factors are the initial solution
+                                                                         of the conjugateGradientSolver method */
+    lastStep4LocalPartialModelInputId = inputOfStep4FromStep4
+};
+
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__IMPLICIT_ALS__TRAINING__PARTIALRESULTID"></a>
  * Available types of partial results of the implicit ALS training algorithm in the fourth step
@@ -680,6 +693,13 @@ public:
      */
     data_management::NumericTablePtr get(Step4LocalNumericTableInputId id) const;
 
+    /**
+     * Returns an input partial model object for the implicit ALS training algorithm
+     * \param[in] id    Identifier of the input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    PartialModelPtr get(Step4LocalPartialModelInputId id) const;
+
     /**
      * Sets an input key-value data collection object for the implicit ALS training algorithm
      * \param[in] id    Identifier of the input object
@@ -694,6 +714,13 @@ public:
      */
     void set(Step4LocalNumericTableInputId id, const data_management::NumericTablePtr & ptr);
 
+    /**
+     * Sets an input partial model object for the implicit ALS training algorithm
+     * \param[in] id    Identifier of the input object
+     * \param[in] ptr   Pointer to the new input object value
+     */
+    void set(Step4LocalPartialModelInputId id, const PartialModelPtr & ptr);
+
     /**
      * Returns the number of rows in the partial matrix of users factors/items factors
      * \return Number of rows in the partial matrix of factors
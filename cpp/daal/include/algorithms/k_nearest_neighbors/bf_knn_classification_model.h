@@ -72,6 +72,19 @@ enum VoteWeights
                            than neighbors that are further away */
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__BF_KNN_CLASSIFICATION__DISTANCEMETRIC"></a>
+ * \brief Distance metric used to search for the nearest neighbors, defaultDense method only
+ */
+enum DistanceMetric
+{
+    euclidean = 0, /*!< Euclidean distance */
+    minkowski = 1, /*!< Minkowski distance of the power minkowskiPower */
+    chebyshev = 2, /*!< Chebyshev distance, the largest absolute difference of the features */
+    cosine    = 3, /*!< Cosine distance, one minus the cosine of the angle between the observations */
+    hamming   = 4  /*!< Hamming distance on binary data, the number of features that are non-zero in exactly one of the observations */
+};
+
 /**
  * \brief Contains version 1.0 of the Intel(R) oneAPI Data Analytics Library interface.
  */
@@ -79,11 +92,11 @@ namespace interface1
 {
 /**
  * <a name="DAAL-STRUCT-ALGORITHMS__BF_KNN_CLASSIFICATION__PARAMETER"></a>
- * \brief BF kNN algorithm parameters
+ * \brief BF kNN algorithm parameters   \DAAL_DEPRECATED
  *
  * \snippet k_nearest_neighbors/bf_knn_classification_model.h Parameter source code
  */
-/* [Parameter source code] */
+/* [interface1::Parameter source code] */
 struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
 {
     /**
@@ -152,7 +165,119 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
     VoteWeights voteWeights;       /*!< Weight function used in prediction */
     engines::EnginePtr engine;     /*!< Engine for random choosing elements from training dataset */
 };
+/* [interface1::Parameter source code] */
+} // namespace interface1
+
+/**
+ * \brief Contains version 2.0 of the Intel(R) oneAPI Data Analytics Library interface.
+ */
+namespace interface2
+{
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__BF_KNN_CLASSIFICATION__PARAMETER"></a>
+ * \brief BF kNN algorithm parameters
+ *
+ * \snippet k_nearest_neighbors/bf_knn_classification_model.h Parameter source code
+ */
 /* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
+{
+    /**
+     *  Parameter constructor
+     *  \param[in] nClasses             Number of classes
+     *  \param[in] nNeighbors           Number of neighbors
+     *  \param[in] dataUse              The option to enable/disable an usage of the input dataset in kNN model
+     *  \param[in] resToCompute         64 bit integer flag that indicates the results to compute
+     *  \param[in] resToEvaluate        64 bit integer flag that indicates the results to evaluate
+     *  \param[in] vote                 The option to select voting method
+     */
+    Parameter(size_t nClasses = 2, size_t nNeighbors = 1, DataUseInModel dataUse = doNotUse, DAAL_UINT64 resToCompute = 0,
+              DAAL_UINT64 resToEvaluate = daal::algorithms::classifier::computeClassLabels, VoteWeights vote = voteUniform)
+        : daal::algorithms::classifier::Parameter(nClasses),
+          k(nNeighbors),
+          dataUseInModel(dataUse),
+          resultsToCompute(resToCompute),
+          voteWeights(vote),
+          engine(engines::mcg59::Batch<>::create()),
+          maxDegree(16),
+          efConstruction(200),
+          efSearch(64),
+          metric(euclidean),
+          minkowskiPower(2.0)
+    {
+        this->resultsToEvaluate = resToEvaluate;
+    }
+
+    /**
+     *  Parameter copy constructor
+     *  \param[in] other             Object to copy
+     */
+    Parameter(const Parameter & other)
+        : daal::algorithms::classifier::Parameter(other.nClasses),
+          k(other.k),
+          dataUseInModel(other.dataUseInModel),
+          resultsToCompute(other.resultsToCompute),
+          voteWeights(other.voteWeights),
+          engine(other.engine->clone()),
+          maxDegree(other.maxDegree),
+          efConstruction(other.efConstruction),
+          efSearch(other.efSearch),
+          metric(other.metric),
+          minkowskiPower(other.minkowskiPower)
+    {
+        this->resultsToEvaluate = other.resultsToEvaluate;
+    }
+
+    /**
+     *  Parameter copy constructor
+     *  \param[in] other             Object to copy
+     */
+    Parameter & operator=(const Parameter & other)
+    {
+        if (this != &other)
+        {
+            daal::algorithms::classifier::Parameter::operator=(other);
+            k                                                = other.k;
+            dataUseInModel                                   = other.dataUseInModel;
+            engine                                           = other.engine->clone();
+            voteWeights                                      = other.voteWeights;
+            resultsToCompute                                 = other.resultsToCompute;
+            this->resultsToEvaluate                          = other.resultsToEvaluate;
+            maxDegree                                        = other.maxDegree;
+            efConstruction                                   = other.efConstruction;
+            efSearch                                         = other.efSearch;
+            metric                                           = other.metric;
+            minkowskiPower                                   = other.minkowskiPower;
+        }
+        return *this;
+    }
+
+    /**
+     * Checks a parameter of the BF kNN algorithm
+     */
+    services::Status check() const DAAL_C11_OVERRIDE;
+
+    size_t k;                      /*!< Number of neighbors */
+    DataUseInModel dataUseInModel; /*!< The option to enable/disable an usage of the input dataset in kNN model */
+    DAAL_UINT64 resultsToCompute;  /*!< 64 bit integer flag that indicates the results to compute */
+    VoteWeights voteWeights;       /*!< Weight function used in prediction */
+    engines::EnginePtr engine;     /*!< Engine for random choosing elements from training dataset */
+    size_t maxDegree;              /*!< Maximal number of neighbors of a node on the upper levels of the HNSW graph, hnswDense method only.
+                                        The bottom level keeps up to 2 * maxDegree neighbors */
+    size_t efConstruction;         /*!< Size of the dynamic list of candidates used to build the HNSW graph, hnswDense method only */
+    size_t efSearch;               /*!< Size of the dynamic list of candidates used to search the HNSW graph, hnswDense method only.
+                                        Larger values give more accurate neighbors at the cost of the search time */
+    DistanceMetric metric;         /*!< Distance metric used to search for the nearest neighbors, defaultDense method only */
+    double minkowskiPower;         /*!< Power of the Minkowski distance, not less than 1, minkowski metric only */
+};
+/* [Parameter source code] */
+} // namespace interface2
+
+/**
+ * \brief Contains version 1.0 of the Intel(R) oneAPI Data Analytics Library interface.
+ */
+namespace interface1
+{
 
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__BF_KNN_CLASSIFICATION__MODEL"></a>
@@ -213,7 +338,7 @@ private:
 typedef services::SharedPtr<Model> ModelPtr;
 } // namespace interface1
 
-using interface1::Parameter;
+using interface2::Parameter;
 using interface1::Model;
 using interface1::ModelPtr;
 
@@ -55,7 +55,8 @@ namespace prediction
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default method */
+    defaultDense = 0, /*!< Default method */
+    hnswDense    = 1  /*!< Approximate search of the nearest neighbors over the HNSW graph of the model */
 };
 
 /**
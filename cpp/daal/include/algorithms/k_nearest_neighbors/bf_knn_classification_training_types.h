@@ -55,7 +55,8 @@ namespace training
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default method */
+    defaultDense = 0, /*!< Default method */
+    hnswDense    = 1  /*!< Builds the hierarchical navigable small world (HNSW) graph over the training set for approximate search */
 };
 
 /**
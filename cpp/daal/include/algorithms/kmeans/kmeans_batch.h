@@ -88,7 +88,7 @@ class DAAL_EXPORT Batch : public daal::algorithms::Analysis<batch>
 {
 public:
     typedef algorithms::kmeans::Input InputType;
-    typedef algorithms::kmeans::Parameter ParameterType;
+    typedef typename algorithms::kmeans::MethodParameter<method>::Type ParameterType;
     typedef algorithms::kmeans::Result ResultType;
 
     /**
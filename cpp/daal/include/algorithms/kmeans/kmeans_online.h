@@ -0,0 +1,227 @@
+/* file: kmeans_online.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for K-Means algorithm in the online
+//  processing mode
+//--
+*/
+
+#ifndef __KMEANS_ONLINE_H__
+#define __KMEANS_ONLINE_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "algorithms/kmeans/kmeans_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace interface2
+{
+/**
+ * @defgroup kmeans_online Online
+ * @ingroup kmeans_compute
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__KMEANS__ONLINECONTAINER"></a>
+ * \brief Provides methods to run implementations of K-Means algorithm.
+ *        This class is associated with the daal::algorithms::kmeans::Online class
+ *        and supports the method of K-Means computation in the online processing mode
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of K-Means, double or float
+ * \tparam method           Computation method of the algorithm, \ref daal::algorithms::kmeans::Method
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+class OnlineContainer : public daal::algorithms::AnalysisContainerIface<online>
+{
+public:
+    /**
+     * Constructs a container for K-Means algorithm with a specified environment
+     * in the online processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    OnlineContainer(daal::services::Environment::env * daalEnv);
+    /** Default destructor */
+    virtual ~OnlineContainer();
+    /**
+     * Updates the partial results of K-Means algorithm with a block of observations in the online processing mode
+     */
+    virtual services::Status compute() DAAL_C11_OVERRIDE;
+    /**
+     * Computes the results of K-Means algorithm in the online processing mode
+     */
+    virtual services::Status finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__KMEANS__ONLINE"></a>
+ * \brief Computes the results of K-Means algorithm in the online processing mode.
+ *        Every call of compute() consumes the next block of observations as a sequence of mini-batches
+ *        of MiniBatchParameter::batchSize rows. The initial centroids are taken from the input of the first call.
+ * <!-- \n<a href="DAAL-REF-KMEANS-ALGORITHM">K-Means algorithm description and usage models</a> -->
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of K-Means, double or float
+ * \tparam method           Computation method of the algorithm, \ref Method
+ *
+ * \par Enumerations
+ *      - \ref Method           Computation methods for K-Means algorithm
+ *      - \ref InputId          Identifiers of input objects for K-Means algorithm
+ *      - \ref PartialResultId  Identifiers of partial results of K-Means algorithm
+ *      - \ref ResultId         Identifiers of results of K-Means algorithm
+ */
+template <typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = miniBatchDense>
+class DAAL_EXPORT Online : public daal::algorithms::Analysis<online>
+{
+public:
+    typedef algorithms::kmeans::Input InputType;
+    typedef algorithms::kmeans::MiniBatchParameter ParameterType;
+    typedef algorithms::kmeans::Result ResultType;
+    typedef algorithms::kmeans::PartialResult PartialResultType;
+
+    /**
+     *  Main constructor
+     *  \param[in] nClusters   Number of clusters
+     */
+    Online(size_t nClusters);
+
+    /**
+     * Constructs K-Means algorithm by copying input objects and parameters
+     * of another K-Means algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Online(const Online<algorithmFPType, method> & other);
+
+    /**
+    * Returns the method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return (int)method; }
+
+    /**
+     * Returns the structure that contains the results of K-Means algorithm
+     * \return Structure that contains the results of K-Means algorithm
+     */
+    ResultPtr getResult() { return _result; }
+
+    /**
+     * Registers user-allocated memory to store the results of K-Means algorithm
+     * \param[in] result  Structure to store the results of K-Means algorithm
+     */
+    services::Status setResult(const ResultPtr & result)
+    {
+        DAAL_CHECK(result, services::ErrorNullResult)
+        _result = result;
+        _res    = _result.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns the structure that contains the partial results of K-Means algorithm
+     * \return Structure that contains the partial results
+     */
+    PartialResultPtr getPartialResult() { return _partialResult; }
+
+    /**
+     * Registers user-allocated memory to store the partial results of K-Means algorithm
+     * \param[in] partialResult  Structure to store the partial results
+     * \param[in] initFlag       Flag that specifies whether the partial results are initialized
+     */
+    services::Status setPartialResult(const PartialResultPtr & partialResult, bool initFlag = false)
+    {
+        DAAL_CHECK(partialResult, services::ErrorNullPartialResult);
+        _partialResult = partialResult;
+        _pres          = _partialResult.get();
+        setInitFlag(initFlag);
+        return services::Status();
+    }
+
+    /**
+     * Returns a pointer to the newly allocated K-Means algorithm with a copy of input objects
+     * and parameters of this K-Means algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Online<algorithmFPType, method> > clone() const { return services::SharedPtr<Online<algorithmFPType, method> >(cloneImpl()); }
+
+    /**
+    * Gets parameter of the algorithm
+    * \return parameter of the algorithm
+    */
+    ParameterType & parameter() { return *static_cast<ParameterType *>(_par); }
+
+    /**
+    * Gets parameter of the algorithm
+    * \return parameter of the algorithm
+    */
+    const ParameterType & parameter() const { return *static_cast<const ParameterType *>(_par); }
+
+protected:
+    virtual Online<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE { return new Online<algorithmFPType, method>(*this); }
+
+    virtual services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        _result.reset(new ResultType());
+        services::Status s = _result->allocate<algorithmFPType>(_pres, _par, (int)method);
+        _res               = _result.get();
+        return s;
+    }
+
+    virtual services::Status allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult.reset(new PartialResultType());
+        services::Status s = _partialResult->allocate<algorithmFPType>(&input, _par, (int)method);
+        _pres              = _partialResult.get();
+        return s;
+    }
+
+    virtual services::Status initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        return _partialResult->initialize<algorithmFPType>(&input, _par, (int)method);
+    }
+
+    void initialize()
+    {
+        Analysis<online>::_ac = new __DAAL_ALGORITHM_CONTAINER(online, OnlineContainer, algorithmFPType, method)(&_env);
+        _in                   = &input;
+    }
+
+public:
+    InputType input; /*!< %Input data structure */
+
+private:
+    PartialResultPtr _partialResult;
+    ResultPtr _result;
+
+    Online & operator=(const Online &);
+};
+/** @} */
+} // namespace interface2
+
+using interface2::OnlineContainer;
+using interface2::Online;
+
+} // namespace kmeans
+} // namespace algorithms
+} // namespace daal
+#endif
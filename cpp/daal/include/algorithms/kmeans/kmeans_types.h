@@ -28,6 +28,7 @@
 #include "data_management/data/numeric_table.h"
 #include "data_management/data/homogen_numeric_table.h"
 #include "services/daal_defines.h"
+#include "algorithms/engines/mt19937/mt19937.h"
 
 namespace daal
 {
@@ -48,9 +49,10 @@ namespace kmeans
  */
 enum Method
 {
-    lloydDense   = 0, /*!< Default: performance-oriented method, synonym of defaultDense */
-    defaultDense = 0, /*!< Default: performance-oriented method, synonym of lloydDense */
-    lloydCSR     = 1  /*!< Implementation of the Lloyd algorithm for CSR numeric tables */
+    lloydDense     = 0, /*!< Default: performance-oriented method, synonym of defaultDense */
+    defaultDense   = 0, /*!< Default: performance-oriented method, synonym of lloydDense */
+    lloydCSR       = 1, /*!< Implementation of the Lloyd algorithm for CSR numeric tables */
+    miniBatchDense = 2  /*!< Mini-batch K-Means: centroids are updated from sampled batches of observations */
 };
 
 /**
@@ -199,6 +201,16 @@ public:
     template <typename algorithmFPType>
     DAAL_EXPORT services::Status allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, const int method);
 
+    /**
+     * Initializes partial results of K-Means algorithm in the online processing mode
+     * with the initial centroids from the input
+     * \param[in] input        Pointer to the structure of the input objects
+     * \param[in] parameter    Pointer to the structure of the algorithm parameters
+     * \param[in] method       Computation method of the algorithm
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status initialize(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, const int method);
+
     /**
      * Returns a partial result of K-Means algorithm
      * \param[in] id   Identifier of the partial result
@@ -407,9 +419,58 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
 };
 /* [Parameter source code] */
 
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__KMEANS__MINIBATCHPARAMETER"></a>
+ * \brief Parameters for K-Means algorithm with the miniBatchDense method
+ *
+ * \snippet kmeans/kmeans_types.h MiniBatchParameter source code
+ */
+/* [MiniBatchParameter source code] */
+struct DAAL_EXPORT MiniBatchParameter : public Parameter
+{
+    /**
+     *  Constructs parameters of K-Means algorithm with the miniBatchDense method
+     *  \param[in] _nClusters   Number of clusters
+     *  \param[in] _maxIterations Number of iterations
+     */
+    MiniBatchParameter(size_t _nClusters, size_t _maxIterations);
+
+    /**
+     *  Constructs parameters of K-Means algorithm with the miniBatchDense method by copying another parameters
+     *  \param[in] other    Parameters of K-Means algorithm with the miniBatchDense method
+     */
+    MiniBatchParameter(const MiniBatchParameter & other);
+
+    size_t batchSize;          /*!< Number of observations in a mini-batch */
+    engines::EnginePtr engine; /*!< Engine to be used for sampling of mini-batches */
+
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+/* [MiniBatchParameter source code] */
+
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__KMEANS__METHODPARAMETER"></a>
+ * \brief Type of the parameters of K-Means algorithm used by the computation method
+ *
+ * \tparam method  Computation method of the algorithm, \ref Method
+ */
+template <Method method>
+struct MethodParameter
+{
+    typedef Parameter Type;
+};
+
+template <>
+struct MethodParameter<miniBatchDense>
+{
+    typedef MiniBatchParameter Type;
+};
+
 } // namespace interface2
 
 using interface2::Parameter;
+using interface2::MiniBatchParameter;
+using interface2::MethodParameter;
 using interface1::InputIface;
 using interface1::Input;
 using interface1::PartialResult;
@@ -51,7 +51,8 @@ namespace prediction
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default method */
+    defaultDense = 0, /*!< Default method */
+    fastCSR      = 1  /*!< Method for the input data in the compressed sparse row (CSR) format */
 };
 
 /**
@@ -52,7 +52,8 @@ namespace training
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default training method */
+    defaultDense = 0, /*!< Default training method */
+    fastCSR      = 1  /*!< Training method for the input data in the compressed sparse row (CSR) format */
 };
 
 /**
@@ -56,7 +56,8 @@ enum Method
 {
     defaultDense = 0, /*!< Default: Required gradient is computed using only one term of objective function */
     miniBatch    = 1, /*!< Required gradient is computed using batchSize terms of objective function  */
-    momentum     = 2  /*!< Required gradient is computed using batchSize terms of objective function, perform momentum update rule  */
+    momentum     = 2, /*!< Required gradient is computed using batchSize terms of objective function, perform momentum update rule  */
+    hogwild      = 3  /*!< Threads compute gradients on independent mini-batches of batchSize terms and update the argument without locks */
 };
 
 /**
@@ -544,6 +545,57 @@ struct DAAL_EXPORT Parameter<momentum> : public BaseParameter
 /* [ParameterMomentum source code] */
 /** @} */
 
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__OPTIMIZATION_SOLVER__SGD__PARAMETER_HOGWILD"></a>
+ * \brief %Parameter for the parallel lock-free (Hogwild) Stochastic gradient descent algorithm
+ *
+ * Every thread draws its mini-batches from its own stream of random numbers, so the result depends on the number
+ * of threads even if averageUpdates is true. Resuming the computation with the lastIteration input continues
+ * the streams only if the number of threads is the same as in the previous run.
+ *
+ * \snippet optimization_solver/sgd/sgd_types.h ParameterHogwild source code
+ */
+/* [ParameterHogwild source code] */
+template <>
+struct DAAL_EXPORT Parameter<hogwild> : public BaseParameter
+{
+    /**
+     * Constructs the parameter class of the Stochastic gradient descent algorithm
+     * \param[in] function             Objective function represented as sum of functions
+     * \param[in] nIterations          Maximal number of iterations of the algorithm. On every iteration each thread performs
+                                       innerNIterations steps
+     * \param[in] accuracyThreshold    Accuracy of the algorithm. The algorithm terminates when this accuracy is achieved
+     * \param[in] batchSize            Number of terms of the objective function used by a thread to compute the stochastic gradient.
+                                       If batchSize is equal to the number of terms in objective function then no random sampling is performed
+     * \param[in] innerNIterations     Number of steps performed by every thread between two synchronization points
+     * \param[in] averageUpdates       If true, every thread updates its own copy of the argument and the copies are averaged
+                                       at the synchronization points. Otherwise the threads update the shared argument without locks
+     * \param[in] learningRateSequence Numeric table that contains values of the learning rate sequence
+     * \param[in] seed                 Seed for random generation of 32 bit integer indices of terms in the objective function. \DAAL_DEPRECATED_USE{ engine }
+     */
+    Parameter(const sum_of_functions::BatchPtr & function, size_t nIterations = 100, double accuracyThreshold = 1.0e-05, size_t batchSize = 128,
+              size_t innerNIterations = 10, bool averageUpdates = false,
+              data_management::NumericTablePtr learningRateSequence = data_management::NumericTablePtr(
+                  new data_management::HomogenNumericTable<double>(1, 1, data_management::NumericTableIface::doAllocate, 1.0)),
+              size_t seed = 777);
+
+    /**
+     * Checks the correctness of the parameter
+     *
+     * \return Status of computations
+     */
+    virtual services::Status check() const;
+
+    virtual ~Parameter() {}
+
+    size_t innerNIterations; /*!< Number of steps performed by every thread between two synchronization points */
+    bool averageUpdates;     /*!< If true, the threads update their own copies of the argument that are averaged at the synchronization points.
+                                  The result does not depend on the scheduling of the threads then, but it still depends
+                                  on the number of threads */
+};
+/* [ParameterHogwild source code] */
+/** @} */
+
 /**
 * <a name="DAAL-STRUCT-ALGORITHMS__OPTIMIZATION_SOLVER__SGD__INPUT"></a>
 * \brief %Input for the Stochastic gradient descent algorithm
@@ -32,6 +32,7 @@
 #include "algorithms/covariance/covariance_online.h"
 #include "algorithms/covariance/covariance_distributed.h"
 #include "algorithms/normalization/zscore.h"
+#include "algorithms/engines/mt19937/mt19937.h"
 
 namespace daal
 {
@@ -56,7 +57,8 @@ enum Method
 {
     correlationDense = 0, /*!< PCA Correlation method */
     defaultDense     = 0, /*!< PCA Default method */
-    svdDense         = 1  /*!< PCA SVD method */
+    svdDense         = 1, /*!< PCA SVD method */
+    randomizedDense  = 2  /*!< PCA randomized SVD method that computes the leading components of the data sketched with a random projection */
 };
 
 /**
@@ -726,6 +728,31 @@ public:
     services::Status check() const DAAL_C11_OVERRIDE;
 };
 
+/**
+* <a name="DAAL-CLASS-ALGORITHMS__PCA__BATCHPARAMETER_ALGORITHMFPTYPE_RANDOMIZEDDENSE"></a>
+* \brief Class that specifies the parameters of the PCA randomized SVD algorithm in the batch computing mode
+*/
+template <typename algorithmFPType>
+class DAAL_EXPORT BatchParameter<algorithmFPType, randomizedDense> : public BaseBatchParameter
+{
+public:
+    /** Constructs PCA parameters */
+    BatchParameter(const services::SharedPtr<normalization::zscore::BatchImpl> & normalizationForBatchParameter =
+                       services::SharedPtr<normalization::zscore::Batch<algorithmFPType, normalization::zscore::defaultDense> >(
+                           new normalization::zscore::Batch<algorithmFPType, normalization::zscore::defaultDense>()));
+
+    services::SharedPtr<normalization::zscore::BatchImpl> normalization; /*!< Pointer to batch normalization */
+    size_t nOversamples;       /*!< Number of extra vectors in the sketch of the range of the normalized data set */
+    size_t nPowerIterations;   /*!< Number of power iterations that refine the sketch of the range of the normalized data set */
+    engines::EnginePtr engine; /*!< Engine for the random numbers generator that fills the sketch */
+
+    /**
+    * Checks batch parameter of the PCA randomized SVD algorithm
+    * \return Errors detected while checking
+    */
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+
 /**
     * <a name="DAAL-CLASS-ALGORITHMS__PCA__RESULT"></a>
     * \brief Provides methods to access results obtained with the PCA algorithm
@@ -0,0 +1,213 @@
+/* file: quantiles_online.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for the quantiles algorithm in the
+//  online processing mode
+//--
+*/
+
+#ifndef __QUANTILES_ONLINE_H__
+#define __QUANTILES_ONLINE_H__
+
+#include "algorithms/algorithm.h"
+#include "services/daal_defines.h"
+#include "algorithms/quantiles/quantiles_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace interface1
+{
+/**
+ * @defgroup quantiles_online Online
+ * @ingroup quantiles
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__ONLINECONTAINER"></a>
+ * \brief Provides methods to run implementations of the quantiles algorithm.
+ *        This class is associated with daal::algorithms::quantiles::Online class
+
+ *
+ * \tparam method           Computation method for the quantiles algorithm, \ref daal::algorithms::quantiles::Method
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the quantiles, double or float
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+class OnlineContainer : public daal::algorithms::AnalysisContainerIface<online>
+{
+public:
+    /**
+     * Constructs a container for the quantiles algorithm with a specified environment
+     * in the online processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    OnlineContainer(daal::services::Environment::env * daalEnv);
+    /** Default destructor */
+    virtual ~OnlineContainer();
+    /**
+     * Computes a partial result of the quantiles algorithm
+     * in the online processing mode
+     */
+    virtual services::Status compute() DAAL_C11_OVERRIDE;
+    /**
+     * Computes the result of the quantiles algorithm
+     * in the online processing mode
+     */
+    virtual services::Status finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__ONLINE"></a>
+ * \brief Computes approximate values of quantiles in the online processing mode.
+ * <!-- \n<a href="DAAL-REF-QUANTILES-ALGORITHM">Quantiles algorithm description and usage models</a> -->
+ *
+ * \tparam method           Computation method for the quantiles algorithm, only \ref sketchDense is supported in this mode
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the quantiles, double or float
+ *
+ * \par Enumerations
+ *      - \ref Method           Computation methods for the quantiles algorithm
+ *      - \ref InputId          Identifiers of input objects for the quantiles algorithm
+ *      - \ref PartialResultId  Identifiers of partial result of the quantiles algorithm
+ *      - \ref ResultId         Identifiers of the results of the quantiles algorithm
+ */
+template <typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = sketchDense>
+class DAAL_EXPORT Online : public daal::algorithms::Analysis<online>
+{
+public:
+    typedef algorithms::quantiles::Input InputType;
+    typedef algorithms::quantiles::Parameter ParameterType;
+    typedef algorithms::quantiles::Result ResultType;
+    typedef algorithms::quantiles::PartialResult PartialResultType;
+
+    InputType input;         /*!< %Input data structure */
+    ParameterType parameter; /*!< %Parameters structure */
+
+    /** Default constructor */
+    Online() { initialize(); }
+
+    /**
+     * Constructs and algorithm that computes quantiles by copying input objects and parameters
+     * of another algorithm that computes quantiles
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Online(const Online<algorithmFPType, method> & other) : input(other.input), parameter(other.parameter) { initialize(); }
+
+    /**
+    * Returns method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return (int)method; }
+
+    /**
+     * Returns the structure that contains the results of the quantiles algorithm
+     * \return Structure that contains the results
+     */
+    ResultPtr getResult() { return _result; }
+
+    /**
+     * Registers user-allocated memory to store final results of the quantiles algorithm
+     * \param[in] result    Structure for storing the results of the quantiles algorithm
+     */
+    services::Status setResult(const ResultPtr & result)
+    {
+        DAAL_CHECK(result, services::ErrorNullResult)
+        _result = result;
+        _res    = _result.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns the structure that contains partial results of the quantiles algorithm
+     * \return Structure that contains partial results
+     */
+    PartialResultPtr getPartialResult() { return _partialResult; }
+
+    /**
+     * Registers user-allocated memory to store partial results of the quantiles algorithm
+     * \param[in] partialResult    Structure for storing partial results of the quantiles algorithm
+     * \param[in] initFlag        Flag that specifies whether the partial results are initialized
+     */
+    services::Status setPartialResult(const PartialResultPtr & partialResult, bool initFlag = false)
+    {
+        _partialResult = partialResult;
+        _pres          = _partialResult.get();
+        setInitFlag(initFlag);
+        return services::Status();
+    }
+
+    /**
+     * Returns a pointer to the newly allocated algorithm that computes quantiles
+     * with a copy of input objects of this algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Online<algorithmFPType, method> > clone() const { return services::SharedPtr<Online<algorithmFPType, method> >(cloneImpl()); }
+
+protected:
+    virtual Online<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE { return new Online<algorithmFPType, method>(*this); }
+
+    virtual services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _result->allocate<algorithmFPType>(_pres, &parameter, (int)method);
+        _res               = _result.get();
+        _pres              = _partialResult.get();
+        return s;
+    }
+
+    virtual services::Status allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _partialResult->allocate<algorithmFPType>(_in, &parameter, (int)method);
+        _pres              = _partialResult.get();
+        return s;
+    }
+
+    virtual services::Status initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _partialResult->initialize<algorithmFPType>(_in, &parameter, (int)method);
+        _pres              = _partialResult.get();
+        return s;
+    }
+
+    void initialize()
+    {
+        Analysis<online>::_ac = new __DAAL_ALGORITHM_CONTAINER(online, OnlineContainer, algorithmFPType, method)(&_env);
+        _in                   = &input;
+        _par                  = &parameter;
+        _result.reset(new ResultType());
+        _partialResult.reset(new PartialResultType());
+    }
+
+private:
+    PartialResultPtr _partialResult;
+    ResultPtr _result;
+
+    Online & operator=(const Online &);
+};
+/** @} */
+} // namespace interface1
+using interface1::OnlineContainer;
+using interface1::Online;
+
+} // namespace quantiles
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -84,7 +84,7 @@ class DAAL_EXPORT Batch : public daal::algorithms::Analysis<batch>
 {
 public:
     typedef algorithms::svd::Input InputType;
-    typedef algorithms::svd::Parameter ParameterType;
+    typedef typename algorithms::svd::MethodParameter<method>::Type ParameterType;
     typedef algorithms::svd::Result ResultType;
 
     InputType input;         /*!< %Input data structure */
@@ -136,7 +136,7 @@ protected:
     virtual services::Status allocateResult() DAAL_C11_OVERRIDE
     {
         _result.reset(new ResultType());
-        services::Status s = _result->allocate<algorithmFPType>(_in, 0, 0);
+        services::Status s = _result->allocate<algorithmFPType>(_in, &parameter, (int)method);
         _res               = _result.get();
         return s;
     }
@@ -222,7 +222,7 @@ class DAAL_EXPORT Distributed<step2Master, algorithmFPType, method> : public daa
 {
 public:
     typedef algorithms::svd::DistributedStep2Input InputType;
-    typedef algorithms::svd::Parameter ParameterType;
+    typedef typename algorithms::svd::MethodParameter<method>::Type ParameterType;
     typedef algorithms::svd::Result ResultType;
     typedef algorithms::svd::DistributedPartialResult PartialResultType;
 
@@ -299,7 +299,7 @@ protected:
     virtual services::Status allocatePartialResult() DAAL_C11_OVERRIDE
     {
         _partialResult.reset(new PartialResultType());
-        services::Status s = _partialResult->allocate<algorithmFPType>(_in, 0, 0);
+        services::Status s = _partialResult->allocate<algorithmFPType>(_in, &parameter, (int)method);
         _pres              = _partialResult.get();
         return s;
     }
@@ -339,7 +339,7 @@ class DAAL_EXPORT Distributed<step3Local, algorithmFPType, method> : public daal
 {
 public:
     typedef algorithms::svd::DistributedStep3Input InputType;
-    typedef algorithms::svd::Parameter ParameterType;
+    typedef typename algorithms::svd::MethodParameter<method>::Type ParameterType;
     typedef algorithms::svd::Result ResultType;
     typedef algorithms::svd::DistributedPartialResultStep3 PartialResultType;
 
@@ -426,8 +426,9 @@ protected:
         if (!s) return s;
 
         data_management::DataCollectionPtr qCollection = input.get(inputOfStep3FromStep1);
+        data_management::DataCollectionPtr rCollection = input.get(inputOfStep3FromStep2);
 
-        s = _partialResult->setPartialResultStorage<algorithmFPType>(qCollection.get());
+        s = _partialResult->setPartialResultStorage<algorithmFPType>(qCollection.get(), rCollection.get());
 
         _pres = _partialResult.get();
         return s;
@@ -93,7 +93,7 @@ public:
     typedef OnlinePartialResultPtr PartialResultPtr;
 
     typedef algorithms::svd::Input InputType;
-    typedef algorithms::svd::Parameter ParameterType;
+    typedef typename algorithms::svd::MethodParameter<method>::Type ParameterType;
     typedef algorithms::svd::Result ResultType;
     typedef algorithms::svd::OnlinePartialResult PartialResultType;
 
@@ -187,7 +187,7 @@ protected:
     virtual services::Status allocateResult() DAAL_C11_OVERRIDE
     {
         _result.reset(new ResultType());
-        services::Status s = _result->allocate<algorithmFPType>(_pres, 0, 0);
+        services::Status s = _result->allocate<algorithmFPType>(_pres, &parameter, (int)method);
         _res               = _result.get();
         return s;
     }
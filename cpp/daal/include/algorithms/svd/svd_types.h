@@ -28,6 +28,7 @@
 #include "data_management/data/numeric_table.h"
 #include "data_management/data/homogen_numeric_table.h"
 #include "services/daal_defines.h"
+#include "algorithms/engines/mt19937/mt19937.h"
 
 namespace daal
 {
@@ -48,7 +49,9 @@ namespace svd
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default method */
+    defaultDense    = 0, /*!< Default method */
+    randomizedDense = 1  /*!< Randomized method that computes the leading singular values and vectors
+                              with the range finder based on the Gaussian sketch and power iterations */
 };
 
 /**
@@ -176,6 +179,49 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
     SVDResultFormat rightSingularMatrix; /*!< Format of the matrix of right singular vectors >*/
 };
 
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__SVD__RANDOMIZEDPARAMETER"></a>
+ * \brief Parameters for the randomizedDense computation method of the SVD algorithm
+ */
+struct DAAL_EXPORT RandomizedParameter : public Parameter
+{
+    /**
+     *  Default constructor
+     *  \param[in] _leftSingularMatrix  Format of the matrix of left singular vectors
+     *  \param[in] _rightSingularMatrix Format of the matrix of right singular vectors
+     */
+    RandomizedParameter(SVDResultFormat _leftSingularMatrix = requiredInPackedForm, SVDResultFormat _rightSingularMatrix = requiredInPackedForm);
+
+    size_t nComponents;        /*!< Number of the leading singular values and vectors to compute, 0 means all of them */
+    size_t nOversamples;       /*!< Number of extra vectors in the sketch of the range of the input data set */
+    size_t nPowerIterations;   /*!< Number of power iterations that refine the sketch of the range of the input data set */
+    engines::EnginePtr engine; /*!< Engine for the random numbers generator that fills the sketch */
+
+    /**
+     * Checks the correctness of the parameter
+     * \return Errors detected while checking
+     */
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__SVD__METHODPARAMETER"></a>
+ * \brief Type of the parameters of the SVD algorithm used by the computation method
+ *
+ * \tparam method  Computation method of the algorithm, \ref Method
+ */
+template <Method method>
+struct MethodParameter
+{
+    typedef Parameter Type;
+};
+
+template <>
+struct MethodParameter<randomizedDense>
+{
+    typedef RandomizedParameter Type;
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__SVD__INPUT"></a>
  * \brief Input objects for the SVD algorithm in the batch processing and online processing modes, and the first step in the distributed
@@ -357,6 +403,18 @@ public:
     template <typename algorithmFPType>
     DAAL_EXPORT services::Status addPartialResultStorage(size_t m, size_t n, Parameter & par);
 
+    /**
+     * Allocates additional memory to store partial results of the randomizedDense method of the SVD algorithm
+     * for each subsequent compute() method
+     * \tparam     algorithmFPType    Data type to use for storage in the resulting HomogenNumericTable
+     * \param[in]  m    Number of columns in the input data set
+     * \param[in]  n    Number of rows in the input data set
+     * \param[in]  l    Number of vectors in the sketch of the range of the input data set
+     * \param[in]  par  Reference to the object with the algorithm parameters
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status addPartialResultStorage(size_t m, size_t n, size_t l, Parameter & par);
+
     /**
      * Returns partial results of the SVD algorithm
      * \param[in] id    Identifier of the partial result
@@ -472,6 +530,17 @@ public:
     template <typename algorithmFPType>
     DAAL_EXPORT services::Status allocateImpl(size_t m, size_t n);
 
+    /**
+     * Allocates memory to store the leading singular values and vectors computed by the SVD algorithm
+     * \tparam     algorithmFPType  Data type to use for storage in the resulting HomogenNumericTable
+     * \param[in]  m            Number of columns in the input data set
+     * \param[in]  n            Number of rows in the input data set
+     * \param[in]  nComponents  Number of singular values and vectors to store
+     * \return Status of allocation
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocateImpl(size_t m, size_t n, size_t nComponents);
+
 protected:
     /** \private */
     template <typename Archive, bool onDeserialize>
@@ -479,6 +548,7 @@ protected:
     {
         return daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
     }
+    services::Status checkImpl(const Parameter * svdPar, int method, size_t nFeatures, size_t nVectors) const;
 };
 typedef services::SharedPtr<Result> ResultPtr;
 
@@ -516,6 +586,19 @@ public:
     template <typename algorithmFPType>
     DAAL_EXPORT services::Status setPartialResultStorage(data_management::KeyValueDataCollection * inCollection, size_t & nBlocks);
 
+    /**
+     * Allocates memory to store partial results of the randomizedDense method of the SVD algorithm based on the known structure
+     * of partial results from step 1 in the distributed processing mode.
+     * \tparam     algorithmFPType Data type to use for storage in the resulting HomogenNumericTable
+     * \param[in]  inCollection    KeyValueDataCollection of all partial results from the first step of the SVD algorithm in the distributed
+     *                             processing mode
+     * \param[out] nBlocks         Number of rows in the input data set
+     * \param[in]  nComponents     Number of the leading singular values and vectors to compute, 0 means all of them
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status setPartialResultStorage(data_management::KeyValueDataCollection * inCollection, size_t & nBlocks,
+                                                         size_t nComponents);
+
     /**
      * Returns partial results of the SVD algorithm.
      * KeyValueDataCollection under outputOfStep2ForStep3 id is structured the same as KeyValueDataCollection under
@@ -613,6 +696,16 @@ public:
     template <typename algorithmFPType>
     DAAL_EXPORT services::Status setPartialResultStorage(data_management::DataCollection * qCollection);
 
+    /**
+     * Allocates memory to store partial results of the SVD algorithm obtained in the third step in the distributed processing mode
+     * \tparam     algorithmFPType  Data type to use for storage in the resulting HomogenNumericTable
+     * \param[in]  qCollection  DataCollection of all partial results from step 1 of the SVD algorithm in the distributed processing mode
+     * \param[in]  rCollection  DataCollection of all partial results from step 2 of the SVD algorithm in the distributed processing mode
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status setPartialResultStorage(data_management::DataCollection * qCollection,
+                                                         data_management::DataCollection * rCollection);
+
     /**
      * Returns results of the SVD algorithm with singular values and the left orthogonal matrix calculated
      * \param[in] id    Identifier of the parameter
@@ -656,6 +749,8 @@ typedef services::SharedPtr<DistributedPartialResultStep3> DistributedPartialRes
 /** @} */
 } // namespace interface1
 using interface1::Parameter;
+using interface1::RandomizedParameter;
+using interface1::MethodParameter;
 using interface1::Input;
 using interface1::DistributedStep2Input;
 using interface1::DistributedStep3Input;
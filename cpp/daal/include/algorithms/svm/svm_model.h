@@ -137,6 +137,26 @@ struct DAAL_EXPORT Parameter : public classifier::Parameter
     services::Status check() const DAAL_C11_OVERRIDE;
 };
 /* [Parameter source code] */
+
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__SVM__TRAINPARAMETER"></a>
+ * \brief Optional parameters of the SVM training algorithm
+ *
+ * \snippet svm/svm_model.h TrainParameter source code
+ */
+/* [TrainParameter source code] */
+struct DAAL_EXPORT TrainParameter : public Parameter
+{
+    TrainParameter(const services::SharedPtr<kernel_function::KernelIface> & kernelForParameter =
+                       services::SharedPtr<kernel_function::KernelIface>(new kernel_function::linear::Batch<>()),
+                   double C = 1.0, double accuracyThreshold = 0.001, double tau = 1.0e-6, size_t maxIterations = 1000000,
+                   size_t cacheSize = 8000000, bool doShrinking = true, size_t shrinkingStep = 1000, bool useLruCache = false);
+
+    bool useLruCache; /*!< Flag that enables the cache of the least recently used rows of the kernel matrix in the Boser method
+                           when the whole matrix does not fit into cacheSize. If the flag is not set, the rows that do not fit
+                           are computed on each request */
+};
+/* [TrainParameter source code] */
 } // namespace interface2
 
 namespace interface1
@@ -280,6 +300,7 @@ typedef services::SharedPtr<Model> ModelPtr;
 /** @} */
 } // namespace interface1
 using interface2::Parameter;
+using interface2::TrainParameter;
 using interface1::Model;
 using interface1::ModelPtr;
 
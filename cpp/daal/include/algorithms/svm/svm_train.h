@@ -239,10 +239,10 @@ public:
     typedef classifier::training::Batch super;
 
     typedef typename super::InputType InputType;
-    typedef algorithms::svm::Parameter ParameterType;
+    typedef algorithms::svm::TrainParameter ParameterType;
     typedef algorithms::svm::training::Result ResultType;
 
-    ParameterType parameter; /*!< \ref interface1::Parameter "Parameters" of the algorithm */
+    ParameterType parameter; /*!< \ref interface2::TrainParameter "Parameters" of the algorithm */
     InputType input;         /*!< %Input objects of the algorithm */
 
     /** Default constructor */
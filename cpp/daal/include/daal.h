@@ -22,6 +22,7 @@
 #include "services/base.h"
 #include "services/env_detect.h"
 #include "services/library_version_info.h"
+#include "services/task_arena.h"
 #include "data_management/compression/bzip2compression.h"
 #include "data_management/compression/compression.h"
 #include "data_management/compression/compression_stream.h"
@@ -62,6 +63,7 @@
 #include "algorithms/kmeans/kmeans_types.h"
 #include "algorithms/kmeans/kmeans_batch.h"
 #include "algorithms/kmeans/kmeans_distributed.h"
+#include "algorithms/kmeans/kmeans_online.h"
 #include "algorithms/kmeans/kmeans_init_types.h"
 #include "algorithms/kmeans/kmeans_init_batch.h"
 #include "algorithms/kmeans/kmeans_init_distributed.h"
@@ -139,6 +141,7 @@
 #include "algorithms/svm/svm_quality_metric_set_batch.h"
 #include "algorithms/svm/svm_quality_metric_set_types.h"
 #include "algorithms/em/em_gmm.h"
+#include "algorithms/em/em_gmm_online.h"
 #include "algorithms/em/em_gmm_types.h"
 #include "algorithms/em/em_gmm_init_batch.h"
 #include "algorithms/em/em_gmm_init_types.h"
@@ -186,6 +189,8 @@
 #include "algorithms/boosting/boosting_training_batch.h"
 #include "algorithms/quantiles/quantiles_types.h"
 #include "algorithms/quantiles/quantiles_batch.h"
+#include "algorithms/quantiles/quantiles_online.h"
+#include "algorithms/quantiles/quantiles_distributed.h"
 #include "algorithms/implicit_als/implicit_als_model.h"
 #include "algorithms/implicit_als/implicit_als_predict_ratings_batch.h"
 #include "algorithms/implicit_als/implicit_als_predict_ratings_distributed.h"
@@ -40,6 +40,7 @@
 #include "services/base.h"
 #include "services/env_detect.h"
 #include "services/library_version_info.h"
+#include "services/task_arena.h"
 #include "data_management/compression/bzip2compression.h"
 #include "data_management/compression/compression.h"
 #include "data_management/compression/compression_stream.h"
@@ -79,6 +80,7 @@
 #include "algorithms/kmeans/kmeans_types.h"
 #include "algorithms/kmeans/kmeans_batch.h"
 #include "algorithms/kmeans/kmeans_distributed.h"
+#include "algorithms/kmeans/kmeans_online.h"
 #include "algorithms/kmeans/kmeans_init_types.h"
 #include "algorithms/kmeans/kmeans_init_batch.h"
 #include "algorithms/kmeans/kmeans_init_distributed.h"
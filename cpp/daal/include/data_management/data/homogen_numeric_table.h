@@ -791,7 +791,9 @@ protected:
                                                                 services::ErrorIncorrectNumberOfObservations);
         }
 
-        _ptr = services::SharedPtr<byte>((byte *)daal::services::daal_malloc(size * sizeof(DataType)), services::ServiceDeleter());
+        _ptr = services::SharedPtr<byte>(
+            (byte *)daal::services::internal::daal_malloc_rows(getNumberOfRows(), getNumberOfColumns() * sizeof(DataType)),
+            services::ServiceDeleter());
 
         if (!_ptr) return services::Status(services::ErrorMemoryAllocationFailed);
 
@@ -171,6 +171,18 @@ enum MemType
     mcdram = 1  /*!< Multi-Channel DRAM */
 };
 
+/**
+ * <a name="DAAL-ENUM-MEMORYPLACEMENT"></a>
+ * Describes policies of placing the memory of numeric tables on NUMA nodes
+ */
+enum MemoryPlacement
+{
+    defaultPlacement     = 0, /*!< Memory pages are placed on the NUMA node of the thread that writes them first, usually the data loader */
+    firstTouchPlacement  = 1, /*!< Memory is initialized in parallel at allocation by blocks of rows, with the same partitioning
+                                   of the blocks over the threads as in the parallel loops of the algorithms */
+    interleavedPlacement = 2  /*!< Memory pages are distributed over the NUMA nodes in the round-robin manner */
+};
+
 typedef unsigned char byte;
 
 /**
@@ -311,8 +323,9 @@ const int SERIALIZATION_CHOLESKY_RESULT_ID = 101800;
 const int SERIALIZATION_CORRELATION_DISTANCE_RESULT_ID = 101900;
 const int SERIALIZATION_COSINE_DISTANCE_RESULT_ID      = 101910;
 
-const int SERIALIZATION_EM_GMM_INIT_RESULT_ID = 102000;
-const int SERIALIZATION_EM_GMM_RESULT_ID      = 102010;
+const int SERIALIZATION_EM_GMM_INIT_RESULT_ID    = 102000;
+const int SERIALIZATION_EM_GMM_RESULT_ID         = 102010;
+const int SERIALIZATION_EM_GMM_PARTIAL_RESULT_ID = 102020;
 
 const int SERIALIZATION_KERNEL_FUNCTION_RESULT_ID = 102100;
 
@@ -327,7 +340,8 @@ const int SERIALIZATION_QR_ONLINE_PARTIAL_RESULT_ID            = 102410;
 const int SERIALIZATION_QR_DISTRIBUTED_PARTIAL_RESULT_ID       = 102420;
 const int SERIALIZATION_QR_DISTRIBUTED_PARTIAL_RESULT_STEP3_ID = 102430;
 
-const int SERIALIZATION_QUANTILES_RESULT_ID = 102500;
+const int SERIALIZATION_QUANTILES_RESULT_ID         = 102500;
+const int SERIALIZATION_QUANTILES_PARTIAL_RESULT_ID = 102510;
 
 const int SERIALIZATION_WEAK_LEARNER_RESULT_ID = 102600;
 
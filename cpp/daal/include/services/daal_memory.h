@@ -81,6 +81,28 @@ namespace internal
 * \return Status of memory copy, memory copy is successful if zero is returned
 */
 DAAL_EXPORT int daal_memcpy_s(void * dest, size_t destSize, const void * src, size_t srcSize);
+
+/**
+ * Allocates the memory for the rows of a numeric table and places it on NUMA nodes
+ * according to the memory placement policy of the library, see Environment::setMemoryPlacement()
+ * \param[in] nRows      Number of rows
+ * \param[in] rowSize    Size of a row in bytes
+ * \param[in] alignment  Alignment of the allocated memory
+ * \return Pointer to the allocated memory
+ */
+DAAL_EXPORT void * daal_malloc_rows(size_t nRows, size_t rowSize, size_t alignment = DAAL_MALLOC_DEFAULT_ALIGNMENT);
+
+/**
+ * Sets the policy of placing the memory allocated by daal_malloc_rows() on NUMA nodes
+ * \param[in] placement  Memory placement policy
+ */
+DAAL_EXPORT void setMemoryPlacement(MemoryPlacement placement);
+
+/**
+ * Returns the policy of placing the memory allocated by daal_malloc_rows() on NUMA nodes
+ * \return Memory placement policy
+ */
+DAAL_EXPORT MemoryPlacement getMemoryPlacement();
 } // namespace internal
 
 /**
@@ -166,6 +166,19 @@ public:
      */
     int setMemoryLimit(MemType type, size_t limit);
 
+    /**
+     * Sets the policy of placing the memory of numeric tables allocated by the library on NUMA nodes.
+     * Placement of the memory on the nodes is preserved when the threads are pinned, see enableThreadPinning()
+     * \param[in] placement  Memory placement policy
+     */
+    void setMemoryPlacement(MemoryPlacement placement);
+
+    /**
+     * Returns the policy of placing the memory of numeric tables on NUMA nodes
+     * \return Memory placement policy
+     */
+    MemoryPlacement getMemoryPlacement() const;
+
     /**
      *  Sets execution context globally for all algorithms.
      *  After this method is called, all computations inside algorithms are performed
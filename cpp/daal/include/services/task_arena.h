@@ -0,0 +1,129 @@
+/* file: task_arena.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the class that confines computations to an isolated set of threads.
+//--
+*/
+
+#ifndef __TASK_ARENA_H__
+#define __TASK_ARENA_H__
+
+#include "services/base.h"
+
+namespace daal
+{
+namespace services
+{
+namespace interface1
+{
+/**
+ * @ingroup services
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-SERVICES__TASKARENA"></a>
+ * \brief Isolated set of threads that runs the computations of the algorithms.
+ *        Algorithms computed inside the arena use at most the number of threads of the arena
+ *        and do not share the work with the computations running in other arenas.
+ *        Threads of the arena can be bound to the logical processors of one NUMA node.
+ *
+ * \par Example
+ * \code
+ * TaskArena arena(8, 0);
+ * arena.execute([&]() { algorithm.compute(); });
+ * \endcode
+ */
+class DAAL_EXPORT TaskArena : public Base
+{
+public:
+    /**
+     * Constructs the task arena
+     * \param[in] nThreads  Maximal number of threads in the arena.
+     *                      If zero, the number of logical processors of the NUMA node is used when the node is given,
+     *                      otherwise the default number of threads is used
+     * \param[in] numaNode  Index of the NUMA node to bind the threads of the arena to, -1 if the threads are not bound.
+     *                      NUMA nodes are identified with the processor packages detected in the system
+     */
+    TaskArena(size_t nThreads = 0, int numaNode = -1);
+
+    virtual ~TaskArena();
+
+    /**
+     * Returns the maximal number of threads that run the computations in the arena
+     * \return Number of threads in the arena
+     */
+    size_t getNumberOfThreads() const;
+
+    /**
+     * Returns the index of the NUMA node the threads of the arena are bound to
+     * \return Index of the NUMA node, -1 if the threads are not bound
+     */
+    int getNumaNode() const;
+
+    /**
+     * Returns the number of NUMA nodes available for the binding
+     * \return Number of NUMA nodes, 0 if the topology of the system can not be detected
+     */
+    static size_t getNumberOfNumaNodes();
+
+    /**
+     * Runs the functor in the arena and waits for its completion
+     * \param[in] func  Functor without arguments, for example the lambda that computes the algorithm
+     */
+    template <typename Func>
+    void execute(const Func & func)
+    {
+        FunctorImpl<Func> f(func);
+        executeImpl(f);
+    }
+
+private:
+    struct Functor
+    {
+        virtual ~Functor() {}
+        virtual void run() const = 0;
+    };
+
+    template <typename Func>
+    struct FunctorImpl : public Functor
+    {
+        FunctorImpl(const Func & func) : _func(func) {}
+        virtual void run() const DAAL_C11_OVERRIDE { _func(); }
+        const Func & _func;
+    };
+
+    void executeImpl(const Functor & f);
+    static void runFunctor(const void * a);
+
+    TaskArena(const TaskArena &);
+    TaskArena & operator=(const TaskArena &);
+
+    void * _impl;
+    size_t _nThreads;
+    int _numaNode;
+};
+/** @} */
+} // namespace interface1
+
+using interface1::TaskArena;
+
+} // namespace services
+} // namespace daal
+
+#endif
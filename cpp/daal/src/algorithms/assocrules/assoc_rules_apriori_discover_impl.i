@@ -26,6 +26,9 @@
 #define __ASSOC_RULES_APRIORI_DISCOVER_IMPL_I__
 
 #include "src/externals/service_memory.h"
+#include "src/threading/threading.h"
+#include "src/algorithms/service_threading.h"
+#include "src/algorithms/service_error_handling.h"
 #include "src/algorithms/assocrules/assoc_rules_apriori_types.i"
 
 namespace daal
@@ -41,22 +44,15 @@ namespace internal
  *
  *  \param items_size[in]   item set size
  *  \param items[in]        item set (array of items)
- *  \param L_cur[in]        list of the item sets to search for item set
+ *  \param L_cur[in]        index of the item sets to search for item set
  *
  *  \return Pointer to the found item set. NULL if no item set was found
  */
 template <typename algorithmFPType, CpuType cpu>
 const assocrules_itemset<cpu> * AssociationRulesKernel<apriori, algorithmFPType, cpu>::findItemSet(size_t items_size, const size_t * items,
-                                                                                                   const ItemSetList<cpu> & L_cur)
+                                                                                                   const ItemSetIndex<cpu> & L_cur)
 {
-    for (auto current = L_cur.start; current; current = current->next())
-    {
-        if (!assocrules_memcmp<cpu>(items, current->itemSet()->items, items_size))
-        {
-            return current->itemSet();
-        }
-    }
-    return NULL;
+    return L_cur.find(items_size, items);
 }
 
 /**
@@ -104,7 +100,7 @@ void AssociationRulesKernel<apriori, algorithmFPType, cpu>::setIntersection(cons
  *  Generate those rules from the items of an input item set
  *
  *  \param minConfidence[in]    minimum confidence
- *  \param L[in]                structure containing "large" item sets
+ *  \param L[in]                indices of "large" item sets
  *  \param itemSetSize[in]      number of items in the input item set
  *  \param items[in]            array of items of the input item set
  *  \param itemsSupport[in]     input item set support
@@ -117,13 +113,13 @@ void AssociationRulesKernel<apriori, algorithmFPType, cpu>::setIntersection(cons
  *
   */
 template <typename algorithmFPType, CpuType cpu>
-services::Status AssociationRulesKernel<apriori, algorithmFPType, cpu>::firstPass(double minConfidence, ItemSetList<cpu> * L, size_t itemSetSize,
-                                                                                  const size_t * items, size_t itemsSupport, size_t * leftItems,
-                                                                                  AssocRule<cpu> * R, size_t & numRules, size_t & numLeft,
-                                                                                  size_t & numRight, size_t & numRulesFound)
+services::Status AssociationRulesKernel<apriori, algorithmFPType, cpu>::firstPass(double minConfidence, const ItemSetIndex<cpu> * L,
+                                                                                  size_t itemSetSize, const size_t * items, size_t itemsSupport,
+                                                                                  size_t * leftItems, AssocRule<cpu> * R, size_t & numRules,
+                                                                                  size_t & numLeft, size_t & numRight, size_t & numRulesFound)
 {
-    const ItemSetList<cpu> & L_0    = L[0];
-    const ItemSetList<cpu> & L_prev = L[itemSetSize - 1];
+    const ItemSetIndex<cpu> & L_0    = L[0];
+    const ItemSetIndex<cpu> & L_prev = L[itemSetSize - 1];
     size_t oldNumRules              = numRules;
 
     for (size_t i = 0; i <= itemSetSize; ++i)
@@ -161,7 +157,7 @@ services::Status AssociationRulesKernel<apriori, algorithmFPType, cpu>::firstPas
  *  Generate rules that have k+1 items on the right from the rules that have k items on the right.
  *
  *  \param minConfidence[in]    minimum confidence
- *  \param L[in]                structure containing "large" item sets
+ *  \param L[in]                indices of "large" item sets
  *  \param right_size[in]       number of items in the right part of the rules (k)
  *  \param itemsSupport[in]     support of the item set superset that contains items of the left
  *                              and right parts of the generated rules
@@ -175,7 +171,7 @@ services::Status AssociationRulesKernel<apriori, algorithmFPType, cpu>::firstPas
  *
   */
 template <typename algorithmFPType, CpuType cpu>
-services::Status AssociationRulesKernel<apriori, algorithmFPType, cpu>::nextPass(double minConfidence, ItemSetList<cpu> * L, size_t right_size,
+services::Status AssociationRulesKernel<apriori, algorithmFPType, cpu>::nextPass(double minConfidence, const ItemSetIndex<cpu> * L, size_t right_size,
                                                                                  size_t itemsSupport, size_t * leftItems, AssocRule<cpu> * R,
                                                                                  size_t & numRules, size_t & numLeft, size_t & numRight,
                                                                                  size_t & numRulesFound, bool & found)
@@ -212,6 +208,7 @@ services::Status AssociationRulesKernel<apriori, algorithmFPType, cpu>::nextPass
             DAAL_CHECK_STATUS_OK(iset.ok(), iset.getLastStatus());
 
             const assocrules_itemset<cpu> * right_iset = findItemSet(right_size, iset.items, L[right_size - 1]);
+            DAAL_CHECK(right_iset, services::ErrorNullInput);
             first_items                                = R[firstIdx].left->items;
             second_items                               = R[secondIdx].left->items;
 
@@ -223,6 +220,7 @@ services::Status AssociationRulesKernel<apriori, algorithmFPType, cpu>::nextPass
             }
 
             const assocrules_itemset<cpu> * left_iset = findItemSet(left_size, leftItems, L[left_size - 1]);
+            DAAL_CHECK(left_iset, services::ErrorNullInput);
 
             double confidence = (double)itemsSupport / (double)(left_iset->support.get());
             if (confidence >= minConfidence)
@@ -239,7 +237,11 @@ services::Status AssociationRulesKernel<apriori, algorithmFPType, cpu>::nextPass
 }
 
 /**
- *  Generate association rules from "large" item sets
+ *  Generate association rules from "large" item sets.
+ *  The item sets are split into blocks that are processed in parallel. The rules of each item set
+ *  are written into its own range of R bounded by the number of its non-empty proper subsets,
+ *  then the ranges are compacted in the order of the item sets in L. The sorted indices are used
+ *  only to look up the subsets of the item sets.
  *
  *  \param minConfidence[in]    minimum confidence
  *  \param L_size[in]           length of the array L
@@ -253,48 +255,127 @@ services::Status AssociationRulesKernel<apriori, algorithmFPType, cpu>::nextPass
  */
 template <typename algorithmFPType, CpuType cpu>
 services::Status AssociationRulesKernel<apriori, algorithmFPType, cpu>::generateRules(double minConfidence, size_t minItemsetSize, size_t L_size,
-                                                                                      ItemSetList<cpu> * L, AssocRule<cpu> * R, size_t & numRules,
-                                                                                      size_t & numLeft, size_t & numRight)
+                                                                                      ItemSetList<cpu> * L, TArray<AssocRule<cpu>, cpu> & R,
+                                                                                      size_t & numRules, size_t & numLeft, size_t & numRight)
 {
     numRules = 0;
     numLeft  = 0;
     numRight = 0;
 
-    TArray<size_t, cpu> leftItemsAr(L_size);
-    size_t * leftItems = leftItemsAr.get();
-    if (!leftItems) return services::ErrorMemoryAllocationFailed;
+    /* Index the "large" item sets to search them by binary search, the rules follow the order of L */
+    TArray<ItemSetIndex<cpu>, cpu> indexAr(L_size);
+    ItemSetIndex<cpu> * index = indexAr.get();
+    DAAL_CHECK_MALLOC(index);
+    {
+        SafeStatus safeStat;
+        daal::threader_for(L_size, L_size, [&](size_t i) {
+            services::Status s = index[i].build(L[i]);
+            DAAL_CHECK_STATUS_THR(s);
+        });
+        DAAL_CHECK_SAFE_STATUS();
+    }
 
-    /* Generate all association rules */
     size_t startItemsetSize = 1;
     if (minItemsetSize > startItemsetSize)
     {
         startItemsetSize = minItemsetSize - 1;
     }
+    if (startItemsetSize >= L_size) return services::Status();
+
+    /* Offsets of the item sets of each size in the sequence of the item sets that produce rules */
+    TArray<size_t, cpu> levelOffsetAr(L_size + 1);
+    size_t * levelOffset = levelOffsetAr.get();
+    DAAL_CHECK_MALLOC(levelOffset);
+    levelOffset[startItemsetSize] = 0;
     for (size_t iset_size = startItemsetSize; iset_size < L_size; ++iset_size)
     {
-        ItemSetList<cpu> & L_cur = L[iset_size];
+        DAAL_CHECK(iset_size + 1 < sizeof(size_t) * 8, services::ErrorBufferSizeIntegerOverflow);
+        levelOffset[iset_size + 1] = levelOffset[iset_size] + index[iset_size].size;
+    }
+    const size_t nItemsets = levelOffset[L_size];
+
+    const size_t blockSize = 64;
+    const size_t nBlocks   = nItemsets / blockSize + !!(nItemsets % blockSize);
 
-        for (const auto * current = L_cur.start; current != nullptr; current = current->next())
+    /* Item set of iset_size + 1 items produces at most 2^(iset_size + 1) - 2 rules */
+    TArray<size_t, cpu> blockOffsetAr(nBlocks + 1);
+    size_t * blockOffset = blockOffsetAr.get();
+    DAAL_CHECK_MALLOC(blockOffset);
+    blockOffset[0] = 0;
+    for (size_t iBlock = 0, iset_size = startItemsetSize; iBlock < nBlocks; iBlock++)
+    {
+        const size_t iEnd    = (iBlock + 1) * blockSize < nItemsets ? (iBlock + 1) * blockSize : nItemsets;
+        size_t blockNumRules = 0;
+        for (size_t i = iBlock * blockSize; i < iEnd; i++)
         {
-            const size_t * items = current->itemSet()->items;
-            size_t itemsSupport  = current->itemSet()->support.get();
-            size_t n_rules_prev  = 0;
+            while (i >= levelOffset[iset_size + 1]) iset_size++;
+            const size_t maxRulesNum = ((size_t)1 << (iset_size + 1)) - (size_t)2;
+            DAAL_OVERFLOW_CHECK_BY_ADDING(size_t, blockNumRules, maxRulesNum);
+            blockNumRules += maxRulesNum;
+        }
+        DAAL_OVERFLOW_CHECK_BY_ADDING(size_t, blockOffset[iBlock], blockNumRules);
+        blockOffset[iBlock + 1] = blockOffset[iBlock] + blockNumRules;
+    }
+
+    DAAL_CHECK_MALLOC(R.reset(blockOffset[nBlocks]));
+
+    /* Number of rules, left and right items found in each block */
+    TArray<size_t, cpu> blockCountsAr(3 * nBlocks);
+    size_t * blockCounts = blockCountsAr.get();
+    DAAL_CHECK_MALLOC(blockCounts);
+
+    TlsMem<size_t, cpu> tlsLeftItems(L_size);
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        size_t * leftItems = tlsLeftItems.local();
+        DAAL_CHECK_MALLOC_THR(leftItems);
+
+        AssocRule<cpu> * blockR = R.get() + blockOffset[iBlock];
+        size_t blockNumRules    = 0;
+        size_t blockNumLeft     = 0;
+        size_t blockNumRight    = 0;
+
+        const size_t iEnd = (iBlock + 1) * blockSize < nItemsets ? (iBlock + 1) * blockSize : nItemsets;
+        size_t iset_size  = startItemsetSize;
+        for (size_t i = iBlock * blockSize; i < iEnd; i++)
+        {
+            while (i >= levelOffset[iset_size + 1]) iset_size++;
+            const assocrules_itemset<cpu> * iset = index[iset_size].listOrder[i - levelOffset[iset_size]];
+            const size_t * items                 = iset->items;
+            size_t itemsSupport                  = iset->support.get();
+            size_t n_rules_prev                  = 0;
 
             /* Find rules that have 1 item in the right part */
-            services::Status statFirstPass =
-                firstPass(minConfidence, L, iset_size, items, itemsSupport, leftItems, R, numRules, numLeft, numRight, n_rules_prev);
-            DAAL_CHECK_STATUS_OK(statFirstPass.ok(), statFirstPass);
+            services::Status s = firstPass(minConfidence, index, iset_size, items, itemsSupport, leftItems, blockR, blockNumRules, blockNumLeft,
+                                           blockNumRight, n_rules_prev);
+            DAAL_CHECK_STATUS_THR(s);
 
             bool found = (n_rules_prev > 0);
             for (size_t right_size = 2; right_size <= iset_size && found; ++right_size)
             {
                 /* Find rules that have right_size items in the right part */
-                services::Status statNextPass =
-                    nextPass(minConfidence, L, right_size, itemsSupport, leftItems, R, numRules, numLeft, numRight, n_rules_prev, found);
-
-                DAAL_CHECK_STATUS_OK(statNextPass.ok(), statNextPass);
+                s = nextPass(minConfidence, index, right_size, itemsSupport, leftItems, blockR, blockNumRules, blockNumLeft, blockNumRight,
+                             n_rules_prev, found);
+                DAAL_CHECK_STATUS_THR(s);
             }
         }
+        blockCounts[3 * iBlock]     = blockNumRules;
+        blockCounts[3 * iBlock + 1] = blockNumLeft;
+        blockCounts[3 * iBlock + 2] = blockNumRight;
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    /* Compact the rules preserving the order of the item sets */
+    for (size_t iBlock = 0; iBlock < nBlocks; iBlock++)
+    {
+        const AssocRule<cpu> * blockR = R.get() + blockOffset[iBlock];
+        for (size_t i = 0; i < blockCounts[3 * iBlock]; i++)
+        {
+            R[numRules + i] = blockR[i];
+        }
+        numRules += blockCounts[3 * iBlock];
+        numLeft += blockCounts[3 * iBlock + 1];
+        numRight += blockCounts[3 * iBlock + 2];
     }
     return services::Status();
 }
@@ -52,10 +52,6 @@ Status AssociationRulesKernel<apriori, algorithmFPType, cpu>::compute(const Nume
     const daal::algorithms::association_rules::Parameter * parameter =
         static_cast<const daal::algorithms::association_rules::Parameter *>(algParameter);
     const double minSupport = parameter->minSupport;
-    size_t minItemsetSize   = (parameter->minItemsetSize ? parameter->minItemsetSize : 1);
-
-    NumericTable * largeItemsetsTable        = r[0];
-    NumericTable * largeItemsetsSupportTable = r[1];
 
     /* Create association rules data set from input numeric table */
     assocrules_dataset<cpu> data(dataTable, parameter->nTransactions, parameter->nUniqueItems, minSupport);
@@ -76,38 +72,38 @@ Status AssociationRulesKernel<apriori, algorithmFPType, cpu>::compute(const Nume
     DAAL_CHECK_STATUS_OK(statLargeItemset.ok(), statLargeItemset);
     DAAL_ASSERT(L_size > 0);
 
+    return writeResults(L.get(), L_size, r, parameter);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status AssociationRulesKernel<apriori, algorithmFPType, cpu>::writeResults(ItemSetList<cpu> * L, size_t L_size, NumericTable * r[],
+                                                                           const Parameter * parameter)
+{
+    size_t minItemsetSize = (parameter->minItemsetSize ? parameter->minItemsetSize : 1);
+
+    NumericTable * largeItemsetsTable        = r[0];
+    NumericTable * largeItemsetsSupportTable = r[1];
+
     /* Allocate memory to store "large" itemsets */
     size_t nLargeItemSets       = 0;
     size_t nItemInLargeItemSets = 0;
     Status s;
-    DAAL_CHECK_STATUS(s, allocateItemsetsTableData(L.get(), L_size, minItemsetSize, largeItemsetsTable, largeItemsetsSupportTable, nLargeItemSets,
+    DAAL_CHECK_STATUS(s, allocateItemsetsTableData(L, L_size, minItemsetSize, largeItemsetsTable, largeItemsetsSupportTable, nLargeItemSets,
                                                    nItemInLargeItemSets));
 
     /* Write "large" itemsets into resulting tables */
-    DAAL_CHECK_STATUS(
-        s, writeItemsetsTableData(L.get(), L_size, minItemsetSize, parameter->itemsetsOrder, *largeItemsetsTable, *largeItemsetsSupportTable));
+    DAAL_CHECK_STATUS(s,
+                      writeItemsetsTableData(L, L_size, minItemsetSize, parameter->itemsetsOrder, *largeItemsetsTable, *largeItemsetsSupportTable));
 
     if (parameter->discoverRules)
     {
-        size_t maxRulesNum = L[0].size * (L[0].size - 1);
-        for (size_t i = 1; i < L_size; i++)
-        {
-            size_t exp2LSize = ((size_t)1 << (i + 1)) - (size_t)2;
-            if (exp2LSize < 2)
-            {
-                exp2LSize = 2;
-            }
-            maxRulesNum += L[i].size * (exp2LSize - 1) * (exp2LSize);
-        }
-
-        TArray<AssocRule<cpu>, cpu> R(maxRulesNum);
-        DAAL_CHECK(R.get(), ErrorMemoryAllocationFailed);
+        TArray<AssocRule<cpu>, cpu> R;
 
         size_t nRules                 = 0; /*<! Number of association rules */
         size_t nLeft                  = 0; /*<! Number of items in left parts of the rules */
         size_t nRight                 = 0; /*<! Number of items in right parts of the rules */
         double minConfidence          = parameter->minConfidence;
-        services::Status statGenRules = generateRules(minConfidence, minItemsetSize, L_size, L.get(), R.get(), nRules, nLeft, nRight);
+        services::Status statGenRules = generateRules(minConfidence, minItemsetSize, L_size, L, R, nRules, nLeft, nRight);
         DAAL_CHECK_STATUS_OK(statGenRules.ok() && !!nRules, statGenRules);
 
         NumericTable * leftItemsTable  = r[2];
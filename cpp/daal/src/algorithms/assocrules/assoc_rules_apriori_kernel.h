@@ -49,6 +49,9 @@ public:
     services::Status compute(const NumericTable * a, NumericTable * r[], const daal::algorithms::Parameter * parameter);
 
 protected:
+    /** Write "large" item sets and association rules built from them into resulting tables */
+    services::Status writeResults(ItemSetList<cpu> * L, size_t L_size, NumericTable * r[], const Parameter * parameter);
+
     services::Status findLargeItemsets(size_t minSupport, size_t maxItemsetSize, assocrules_dataset<cpu> & data, ItemSetList<cpu> * L,
                                        size_t & L_size);
 
@@ -101,23 +104,23 @@ protected:
      */
 
     /** Find item set in the list of item sets */
-    const assocrules_itemset<cpu> * findItemSet(size_t items_size, const size_t * items, const ItemSetList<cpu> & L_cur);
+    const assocrules_itemset<cpu> * findItemSet(size_t items_size, const size_t * items, const ItemSetIndex<cpu> & L_cur);
 
     /** Find intersection between two item sets */
     void setIntersection(const size_t * a, size_t aSize, const size_t * b, size_t bSize, size_t * c, size_t & cSize);
 
     /** Find rules containing 1 item on the right */
-    services::Status firstPass(double minConfidence, ItemSetList<cpu> * L, size_t itemSetSize, const size_t * items, size_t itemsSupport,
+    services::Status firstPass(double minConfidence, const ItemSetIndex<cpu> * L, size_t itemSetSize, const size_t * items, size_t itemsSupport,
                                size_t * leftItems, AssocRule<cpu> * R, size_t & numRules, size_t & numLeft, size_t & numRight,
                                size_t & numRulesFound);
 
     /** Generate rules that have k+1 items on the right from the rules that have k items on the right */
-    services::Status nextPass(double minConfidence, ItemSetList<cpu> * L, size_t right_size, size_t itemsSupport, size_t * leftItems,
+    services::Status nextPass(double minConfidence, const ItemSetIndex<cpu> * L, size_t right_size, size_t itemsSupport, size_t * leftItems,
                               AssocRule<cpu> * R, size_t & numRules, size_t & numLeft, size_t & numRight, size_t & numRulesFound, bool & found);
 
     /** Generate association rules from "large" item sets */
-    services::Status generateRules(double minConfidence, size_t minItemsetSize, size_t L_size, ItemSetList<cpu> * L, AssocRule<cpu> * R,
-                                   size_t & numRules, size_t & numLeft, size_t & numRight);
+    services::Status generateRules(double minConfidence, size_t minItemsetSize, size_t L_size, ItemSetList<cpu> * L,
+                                   TArray<AssocRule<cpu>, cpu> & R, size_t & numRules, size_t & numLeft, size_t & numRight);
 
     /** Store association rules into continuous memory */
     void setRules(AssocRule<cpu> ** R, size_t numRules, int * rleft, int * rright, algorithmFPType * rconf);
@@ -192,6 +192,77 @@ int compareRulesByConfidence(const void * a, const void * b)
     return (aa->confidence < bb->confidence) ? 1 : 0;
 }
 
+/** Compares two item sets of the same size lexicographically */
+template <CpuType cpu>
+int compareItems(const size_t * a, const size_t * b, size_t size)
+{
+    for (size_t i = 0; i < size; i++)
+    {
+        if (a[i] < b[i]) return -1;
+        if (b[i] < a[i]) return 1;
+    }
+    return 0;
+}
+
+template <CpuType cpu>
+int compareItemsetsByItems(const void * a, const void * b)
+{
+    typedef const assocrules_itemset<cpu> * ItemsetConstPtr;
+    ItemsetConstPtr aa = *((ItemsetConstPtr *)a);
+    ItemsetConstPtr bb = *((ItemsetConstPtr *)b);
+    return compareItems<cpu>(aa->items, bb->items, aa->size);
+}
+
+/**
+ *  \brief Structure that provides the search of an item set among the "large" item sets of the same size
+ */
+template <CpuType cpu>
+struct ItemSetIndex
+{
+    DAAL_NEW_DELETE();
+    typedef const assocrules_itemset<cpu> * ItemsetConstPtr;
+
+    ItemSetIndex() : size(0) {}
+
+    /** Collects the item sets from the list and sorts them lexicographically */
+    services::Status build(const ItemSetList<cpu> & L_cur)
+    {
+        size = L_cur.size;
+        DAAL_CHECK_MALLOC(listOrder.reset(size ? size : 1));
+        DAAL_CHECK_MALLOC(itemsets.reset(size ? size : 1));
+        size_t i = 0;
+        for (const auto * current = L_cur.start; current != nullptr; current = current->next(), i++)
+        {
+            listOrder[i] = current->itemSet();
+            itemsets[i]  = listOrder[i];
+        }
+        qSort<ItemsetConstPtr, cpu>(size, itemsets.get(), compareItemsetsByItems<cpu>);
+        return services::Status();
+    }
+
+    /** Binary search of the item set, returns NULL if no item set was found */
+    ItemsetConstPtr find(size_t itemsSize, const size_t * items) const
+    {
+        size_t lo = 0;
+        size_t hi = size;
+        while (lo < hi)
+        {
+            const size_t me = lo + ((hi - lo) >> 1);
+            const int cmp   = compareItems<cpu>(items, itemsets[me]->items, itemsSize);
+            if (cmp == 0) return itemsets[me];
+            if (cmp < 0)
+                hi = me;
+            else
+                lo = me + 1;
+        }
+        return nullptr;
+    }
+
+    TArray<ItemsetConstPtr, cpu> listOrder; /*<! Item sets in the order of the list */
+    TArray<ItemsetConstPtr, cpu> itemsets;  /*<! Item sets sorted lexicographically */
+    size_t size;                            /*<! Number of item sets */
+};
+
 /**
  *  \brief Structure that specifies input data set - a set of transactions
  */
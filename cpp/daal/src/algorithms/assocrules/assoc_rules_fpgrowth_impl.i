@@ -0,0 +1,414 @@
+/* file: assoc_rules_fpgrowth_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of "large" itemsets mining for association rules
+//  FP-Growth method.
+//--
+*/
+
+#ifndef __ASSOC_RULES_FPGROWTH_IMPL_I__
+#define __ASSOC_RULES_FPGROWTH_IMPL_I__
+
+#include "services/collection.h"
+#include "src/threading/threading.h"
+#include "src/algorithms/service_error_handling.h"
+#include "src/algorithms/assocrules/assoc_rules_fpgrowth_kernel.h"
+#include "src/algorithms/assocrules/assoc_rules_apriori_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace association_rules
+{
+namespace internal
+{
+/**
+ *  \brief Working memory of the task that mines the item sets with the given first item.
+ *  The conditional trees are reused for the prefixes of the same length
+ */
+template <CpuType cpu>
+struct fp_growth_task
+{
+    DAAL_NEW_DELETE();
+
+    static fp_growth_task * create(size_t nItems, size_t maxItemsetSize)
+    {
+        fp_growth_task * task = new fp_growth_task(nItems, maxItemsetSize);
+        if (task && !task->ok())
+        {
+            delete task;
+            task = nullptr;
+        }
+        return task;
+    }
+
+    ~fp_growth_task()
+    {
+        delete[] trees;
+        service_free<size_t, cpu>(counts);
+        service_free<size_t, cpu>(localItem);
+        service_free<size_t, cpu>(path);
+        service_free<size_t, cpu>(prefix);
+    }
+
+    /** \brief Stores the item set formed by the first size items of the prefix */
+    bool addItemset(size_t size, size_t support, const size_t * rankToItem)
+    {
+        if (!(itemsets.safe_push_back(size) && itemsets.safe_push_back(support))) return false;
+        const size_t start = itemsets.size();
+        for (size_t i = 0; i < size; i++)
+        {
+            if (!itemsets.safe_push_back(rankToItem[prefix[i]])) return false;
+        }
+        /* Items of the "large" item sets are sorted by ID */
+        size_t * items = itemsets.data() + start;
+        for (size_t i = 1; i < size; i++)
+        {
+            const size_t item = items[i];
+            size_t j          = i;
+            for (; j > 0 && item < items[j - 1]; j--)
+            {
+                items[j] = items[j - 1];
+            }
+            items[j] = item;
+        }
+        return true;
+    }
+
+    fp_tree<cpu> * trees;                  /*<! Conditional trees, one per the length of the prefix */
+    size_t * counts;                       /*<! Supports of the items in the conditional pattern base */
+    size_t * localItem;                    /*<! Index of the item in the conditional tree */
+    size_t * path;                         /*<! Path in the conditional pattern base */
+    size_t * prefix;                       /*<! Ranks of the items in the current prefix */
+    services::Collection<size_t> itemsets; /*<! Found item sets stored as size, support and items */
+
+protected:
+    fp_growth_task(size_t nItems, size_t maxItemsetSize)
+        : trees(new fp_tree<cpu>[maxItemsetSize]),
+          counts(service_calloc<size_t, cpu>(nItems)),
+          localItem(service_malloc<size_t, cpu>(nItems)),
+          path(service_malloc<size_t, cpu>(nItems)),
+          prefix(service_malloc<size_t, cpu>(maxItemsetSize))
+    {}
+
+    bool ok() const { return trees && counts && localItem && path && prefix; }
+};
+
+/**
+ *  \brief Builds the conditional FP-tree of the item from the paths that lead to the nodes of the item
+ *
+ *  \param tree[in]         FP-tree
+ *  \param item[in]         index of the item in the FP-tree
+ *  \param minSupport[in]   minimum support
+ *  \param cond[out]        conditional FP-tree that contains the "large" items of the conditional pattern base
+ *  \param task[in]         working memory of the mining task
+ *  \return false if memory allocation failed
+ */
+template <CpuType cpu>
+bool buildConditionalTree(const fp_tree<cpu> & tree, size_t item, size_t minSupport, fp_tree<cpu> & cond, fp_growth_task<cpu> & task)
+{
+    const fp_tree_node<cpu> * nodes = tree.nodes;
+    size_t * counts                 = task.counts;
+    size_t * localItem              = task.localItem;
+
+    /* The ancestors of the node precede its item in the order of the tree */
+    for (size_t node = tree.headLink[item]; node != fpTreeNil; node = nodes[node].nodeLink)
+    {
+        const size_t count = nodes[node].count;
+        for (size_t p = nodes[node].parent; p != 0; p = nodes[p].parent)
+        {
+            counts[nodes[p].item] += count;
+        }
+    }
+
+    size_t nCondItems = 0;
+    for (size_t i = 0; i < item; i++)
+    {
+        localItem[i] = (counts[i] >= minSupport) ? nCondItems++ : fpTreeNil;
+    }
+    if (!cond.reset(nCondItems)) return false;
+    for (size_t i = 0; i < item; i++)
+    {
+        if (localItem[i] != fpTreeNil) cond.itemRank[localItem[i]] = tree.itemRank[i];
+        counts[i] = 0;
+    }
+    if (!nCondItems) return true;
+
+    size_t * path = task.path;
+    for (size_t node = tree.headLink[item]; node != fpTreeNil; node = nodes[node].nodeLink)
+    {
+        size_t pathSize = 0;
+        for (size_t p = nodes[node].parent; p != 0; p = nodes[p].parent)
+        {
+            const size_t condItem = localItem[nodes[p].item];
+            if (condItem != fpTreeNil) path[pathSize++] = condItem;
+        }
+        for (size_t i = 0, j = pathSize; i + 1 < j; i++, j--)
+        {
+            const size_t tmp = path[i];
+            path[i]          = path[j - 1];
+            path[j - 1]      = tmp;
+        }
+        if (pathSize && !cond.insert(path, pathSize, nodes[node].count)) return false;
+    }
+    return true;
+}
+
+/**
+ *  \brief Mines the "large" item sets that extend the prefix of the given length by the items of its conditional FP-tree
+ *
+ *  \param tree[in]           conditional FP-tree of the prefix
+ *  \param prefixSize[in]     number of items in the prefix
+ *  \param minSupport[in]     minimum support
+ *  \param maxItemsetSize[in] maximal number of items in the "large" item sets
+ *  \param rankToItem[in]     IDs of the items in the order of descending support
+ *  \param task[in,out]       working memory and results of the mining task
+ *  \return false if memory allocation failed
+ */
+template <CpuType cpu>
+bool mineConditionalTree(const fp_tree<cpu> & tree, size_t prefixSize, size_t minSupport, size_t maxItemsetSize, const size_t * rankToItem,
+                         fp_growth_task<cpu> & task)
+{
+    for (size_t item = 0; item < tree.nItems; item++)
+    {
+        task.prefix[prefixSize] = tree.itemRank[item];
+        if (!task.addItemset(prefixSize + 1, tree.itemSupport[item], rankToItem)) return false;
+
+        if (prefixSize + 1 < maxItemsetSize && item > 0)
+        {
+            fp_tree<cpu> & cond = task.trees[prefixSize + 1];
+            if (!buildConditionalTree<cpu>(tree, item, minSupport, cond, task)) return false;
+            if (cond.nItems && !mineConditionalTree<cpu>(cond, prefixSize + 1, minSupport, maxItemsetSize, rankToItem, task)) return false;
+        }
+    }
+    return true;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status AssociationRulesKernel<fpGrowth, algorithmFPType, cpu>::compute(const NumericTable * a, NumericTable * r[],
+                                                                       const daal::algorithms::Parameter * algParameter)
+{
+    NumericTable * dataTable = const_cast<NumericTable *>(a);
+    const daal::algorithms::association_rules::Parameter * parameter =
+        static_cast<const daal::algorithms::association_rules::Parameter *>(algParameter);
+    const double minSupport = parameter->minSupport;
+
+    /* Create association rules data set from input numeric table */
+    assocrules_dataset<cpu> data(dataTable, parameter->nTransactions, parameter->nUniqueItems, minSupport);
+    DAAL_CHECK_STATUS_OK(data.ok(), data.getLastStatus());
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, data.numOfUniqueItems, sizeof(ItemSetList<cpu>));
+
+    TArray<ItemSetList<cpu>, cpu> L(data.numOfUniqueItems);
+    DAAL_CHECK(L.get(), ErrorMemoryAllocationFailed);
+    for (size_t i = 0, n = L.size(); i < n; ++i) L[i].setDataOwner(true);
+
+    /* Find "large" itemsets */
+    size_t L_size         = 0;
+    size_t maxItemsetSize = ((parameter->maxItemsetSize == 0) ? (size_t)-1 : parameter->maxItemsetSize);
+    double ceil           = daal::internal::Math<double, cpu>::sCeil(minSupport * data.numOfTransactions);
+    DAAL_ASSERT(ceil >= 0)
+    services::Status statLargeItemset = findLargeItemsets((size_t)ceil, maxItemsetSize, data, L.get(), L_size);
+    DAAL_CHECK_STATUS_OK(statLargeItemset.ok(), statLargeItemset);
+    DAAL_ASSERT(L_size > 0);
+
+    return this->writeResults(L.get(), L_size, r, parameter);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status AssociationRulesKernel<fpGrowth, algorithmFPType, cpu>::buildTree(assocrules_dataset<cpu> & data, const size_t * itemToRank,
+                                                                                   fp_tree<cpu> & tree)
+{
+    const size_t nItems = data.numOfUniqueItems;
+    DAAL_CHECK_MALLOC(tree.reset(nItems));
+    for (size_t i = 0; i < nItems; i++)
+    {
+        tree.itemRank[i] = i;
+    }
+
+    TArray<size_t, cpu> pathAr(nItems);
+    size_t * path = pathAr.get();
+    DAAL_CHECK_MALLOC(path);
+
+    for (size_t i = 0; i < data.numOfLargeTransactions; i++)
+    {
+        const assocrules_transaction<cpu> * tran = data.large_tran[i];
+        for (size_t j = 0; j < tran->size; j++)
+        {
+            path[j] = itemToRank[tran->items[j]];
+        }
+        qSort<size_t, cpu>(tran->size, path);
+
+        /* Repeated items of a transaction count once */
+        size_t pathSize = 0;
+        for (size_t j = 0; j < tran->size; j++)
+        {
+            if (!pathSize || path[pathSize - 1] != path[j]) path[pathSize++] = path[j];
+        }
+        DAAL_CHECK_MALLOC(tree.insert(path, pathSize, 1));
+    }
+    return services::Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status AssociationRulesKernel<fpGrowth, algorithmFPType, cpu>::findLargeItemsets(size_t minSupport, size_t maxItemsetSize,
+                                                                                           assocrules_dataset<cpu> & data, ItemSetList<cpu> * L,
+                                                                                           size_t & L_size)
+{
+    /* "Large" item sets of size 1 are the unique items which count is not less than minimum support */
+    services::Status s;
+    DAAL_CHECK_STATUS(s, this->firstPass(minSupport, data, L[0]));
+    L_size = 1;
+
+    const size_t nItems = data.numOfUniqueItems;
+    /* Like Apriori method, FP-Growth mines the item sets of size 2 regardless of the maximal item set size */
+    size_t maxSize = (maxItemsetSize < 2 ? 2 : maxItemsetSize);
+    if (maxSize > nItems) maxSize = nItems;
+    if (maxSize < 2) return s;
+
+    /* Rank the items by descending support so that the paths of the frequent items are shared in the tree */
+    TArray<assocRulesUniqueItem<cpu>, cpu> rankedItems(nItems);
+    DAAL_CHECK_MALLOC(rankedItems.get());
+    for (size_t i = 0; i < nItems; i++)
+    {
+        rankedItems[i] = data.uniq_items[i];
+    }
+    qSort<assocRulesUniqueItem<cpu>, cpu>(nItems, rankedItems.get(), compareUniqueItemsBySupport<cpu>);
+
+    /* Unique items are sorted by ID */
+    const size_t nItemIDs = data.uniq_items[nItems - 1].itemID + 1;
+    TArray<size_t, cpu> rankToItemAr(nItems);
+    TArray<size_t, cpu> itemToRankAr(nItemIDs);
+    size_t * rankToItem = rankToItemAr.get();
+    size_t * itemToRank = itemToRankAr.get();
+    DAAL_CHECK_MALLOC(rankToItem && itemToRank);
+    for (size_t i = 0; i < nItems; i++)
+    {
+        rankToItem[i]                     = rankedItems[i].itemID;
+        itemToRank[rankedItems[i].itemID] = i;
+    }
+
+    fp_tree<cpu> tree;
+    DAAL_CHECK_STATUS(s, buildTree(data, itemToRank, tree));
+
+    /* Each task mines the item sets which item of the highest rank is the given item */
+    typedef fp_growth_task<cpu> Task;
+    SafeStatus safeStat;
+    daal::tls<Task *> tlsTask([=, &safeStat]() {
+        Task * const task = Task::create(nItems, maxSize);
+        if (!task) safeStat.add(services::ErrorMemoryAllocationFailed);
+        return task;
+    });
+
+    daal::threader_for(nItems, nItems, [&](size_t item) {
+        Task * const task = tlsTask.local();
+        if (!task) return;
+
+        task->prefix[0]     = item;
+        fp_tree<cpu> & cond = task->trees[1];
+        DAAL_CHECK_MALLOC_THR(buildConditionalTree<cpu>(tree, item, minSupport, cond, *task));
+        DAAL_CHECK_MALLOC_THR(mineConditionalTree<cpu>(cond, 1, minSupport, maxSize, rankToItem, *task));
+    });
+
+    /* Number of the item sets of each size */
+    TArray<size_t, cpu> levelOffsetAr(maxSize + 1);
+    size_t * levelOffset = levelOffsetAr.get();
+    if (!levelOffset) safeStat.add(services::ErrorMemoryAllocationFailed);
+    if (safeStat)
+    {
+        service_memset_seq<size_t, cpu>(levelOffset, 0, maxSize + 1);
+        tlsTask.reduce([&](Task * task) {
+            if (!task) return;
+            const size_t * itemsets = task->itemsets.data();
+            for (size_t pos = 0, n = task->itemsets.size(); pos < n; pos += 2 + itemsets[pos])
+            {
+                levelOffset[itemsets[pos]]++;
+            }
+        });
+    }
+
+    /* Create the item sets grouped by size */
+    typedef assocrules_itemset<cpu> * ItemsetPtr;
+    size_t nItemsets = 0;
+    for (size_t i = 0; safeStat && i <= maxSize; i++)
+    {
+        const size_t levelSize = levelOffset[i];
+        levelOffset[i]         = nItemsets;
+        nItemsets += levelSize;
+    }
+    TArray<ItemsetPtr, cpu> itemsetsAr(nItemsets ? nItemsets : 1);
+    ItemsetPtr * itemsets = itemsetsAr.get();
+    if (!itemsets) safeStat.add(services::ErrorMemoryAllocationFailed);
+    if (safeStat)
+    {
+        service_memset_seq<ItemsetPtr, cpu>(itemsets, nullptr, nItemsets);
+        tlsTask.reduce([&](Task * task) {
+            if (!task) return;
+            const size_t * found = task->itemsets.data();
+            for (size_t pos = 0, n = task->itemsets.size(); pos < n; pos += 2 + found[pos])
+            {
+                const size_t size = found[pos];
+                ItemsetPtr iset   = new assocrules_itemset<cpu>(size, found + pos + 2, found[pos + size + 1], found[pos + 1]);
+                if (!iset || !iset->ok())
+                {
+                    safeStat.add(iset ? iset->getLastStatus() : services::Status(services::ErrorMemoryAllocationFailed));
+                    delete iset;
+                    continue;
+                }
+                itemsets[levelOffset[size]++] = iset;
+            }
+        });
+    }
+    tlsTask.reduce([](Task * task) { delete task; });
+
+    /* Sort the item sets of each size by items and store them into the lists of "large" item sets */
+    bool inserted = !!safeStat;
+    for (size_t size = 2, begin = 0; size <= maxSize && inserted; begin = levelOffset[size++])
+    {
+        const size_t levelSize = levelOffset[size] - begin;
+        if (!levelSize) break;
+        qSort<ItemsetPtr, cpu>(levelSize, itemsets + begin, compareItemsetsByItems<cpu>);
+        for (size_t i = begin; i < levelOffset[size] && inserted; i++)
+        {
+            inserted = L[size - 1].insert(itemsets[i]);
+            if (inserted) itemsets[i] = nullptr;
+        }
+        L_size = size;
+    }
+    if (!inserted)
+    {
+        for (size_t i = 0; itemsets && i < nItemsets; i++)
+        {
+            delete itemsets[i];
+        }
+        if (safeStat) safeStat.add(services::ErrorMemoryAllocationFailed);
+    }
+    return safeStat.detach();
+}
+
+} // namespace internal
+
+} // namespace association_rules
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
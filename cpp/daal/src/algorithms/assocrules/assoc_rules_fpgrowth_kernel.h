@@ -0,0 +1,67 @@
+/* file: assoc_rules_fpgrowth_kernel.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template function that computes association rules results
+//  using FP-Growth method.
+//--
+*/
+
+#ifndef __ASSOC_RULES_FPGROWTH_KERNEL_H__
+#define __ASSOC_RULES_FPGROWTH_KERNEL_H__
+
+#include "src/algorithms/assocrules/assoc_rules_apriori_kernel.h"
+#include "src/algorithms/assocrules/assoc_rules_fpgrowth_tree.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace association_rules
+{
+namespace internal
+{
+/**
+ *  Structure that contains kernels for FP-Growth association rules mining.
+ *  Rules discovery and writing of the results are shared with Apriori method
+ */
+template <typename algorithmFPType, CpuType cpu>
+class AssociationRulesKernel<fpGrowth, algorithmFPType, cpu> : public AssociationRulesKernel<apriori, algorithmFPType, cpu>
+{
+public:
+    /** Find "large" item sets and build association rules */
+    services::Status compute(const NumericTable * a, NumericTable * r[], const daal::algorithms::Parameter * parameter);
+
+protected:
+    /** Find "large" item sets by mining the conditional FP-trees of the items in parallel */
+    services::Status findLargeItemsets(size_t minSupport, size_t maxItemsetSize, assocrules_dataset<cpu> & data, ItemSetList<cpu> * L,
+                                       size_t & L_size);
+
+    /** Build FP-tree from the transactions that contain at least two "large" items */
+    services::Status buildTree(assocrules_dataset<cpu> & data, const size_t * itemToRank, fp_tree<cpu> & tree);
+};
+
+} // namespace internal
+
+} // namespace association_rules
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
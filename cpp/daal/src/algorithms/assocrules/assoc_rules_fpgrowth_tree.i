@@ -0,0 +1,225 @@
+/* file: assoc_rules_fpgrowth_tree.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declarations of FP-tree structure that is used in FP-Growth algorithm
+//--
+*/
+
+#ifndef __ASSOC_RULES_FPGROWTH_TREE_I__
+#define __ASSOC_RULES_FPGROWTH_TREE_I__
+
+#include "src/externals/service_memory.h"
+#include "src/algorithms/assocrules/assoc_rules_apriori_itemset.i"
+#include "src/algorithms/assocrules/assoc_rules_apriori_types.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace association_rules
+{
+namespace internal
+{
+/** Index of the missing node or item */
+const size_t fpTreeNil = (size_t)-1;
+
+/** Orders the unique items by descending support, the items with equal supports are ordered by ID */
+template <CpuType cpu>
+int compareUniqueItemsBySupport(const void * a, const void * b)
+{
+    const assocRulesUniqueItem<cpu> * aa = (const assocRulesUniqueItem<cpu> *)a;
+    const assocRulesUniqueItem<cpu> * bb = (const assocRulesUniqueItem<cpu> *)b;
+
+    if (aa->support != bb->support)
+    {
+        return (bb->support < aa->support) ? -1 : 1;
+    }
+    if (aa->itemID != bb->itemID)
+    {
+        return (aa->itemID < bb->itemID) ? -1 : 1;
+    }
+    return 0;
+}
+
+/**
+ *  \brief FP-tree node
+ */
+template <CpuType cpu>
+struct fp_tree_node
+{
+    size_t item;        /*<! Index of the item in the tree */
+    size_t count;       /*<! Number of transactions that share the path from the root to the node */
+    size_t parent;      /*<! Index of the parent node */
+    size_t firstChild;  /*<! Index of the first child node */
+    size_t nextSibling; /*<! Index of the next node with the same parent */
+    size_t nodeLink;    /*<! Index of the next node that holds the same item */
+};
+
+/**
+ *  \brief FP-tree: prefix tree of the transactions which items are ordered by descending support.
+ *  The nodes that hold the same item are linked into the list that starts in the header table.
+ *  The paths from the root to the nodes of an item form the conditional pattern base of that item.
+ *  The tree keeps its memory on reset so that the conditional trees of one mining task reuse it.
+ */
+template <CpuType cpu>
+struct fp_tree
+{
+    DAAL_NEW_DELETE();
+    fp_tree()
+        : nodes(nullptr),
+          nNodes(0),
+          nodesCapacity(0),
+          nItems(0),
+          itemsCapacity(0),
+          itemRank(nullptr),
+          itemSupport(nullptr),
+          headLink(nullptr),
+          rootChild(nullptr)
+    {}
+
+    ~fp_tree()
+    {
+        service_free<fp_tree_node<cpu>, cpu>(nodes);
+        freeItems();
+    }
+
+    /** \brief Empties the tree and sets the number of items in it, items have to be ordered by descending support */
+    bool reset(size_t n)
+    {
+        if (n > itemsCapacity)
+        {
+            freeItems();
+            itemRank    = service_malloc<size_t, cpu>(n);
+            itemSupport = service_malloc<size_t, cpu>(n);
+            headLink    = service_malloc<size_t, cpu>(n);
+            rootChild   = service_malloc<size_t, cpu>(n);
+            if (!(itemRank && itemSupport && headLink && rootChild))
+            {
+                freeItems();
+                return false;
+            }
+            itemsCapacity = n;
+        }
+        nItems = n;
+        for (size_t i = 0; i < n; i++)
+        {
+            itemSupport[i] = 0;
+            headLink[i]    = fpTreeNil;
+            rootChild[i]   = fpTreeNil;
+        }
+
+        if (!nodesCapacity && !grow()) return false;
+        nNodes               = 1;
+        nodes[0].item        = fpTreeNil;
+        nodes[0].count       = 0;
+        nodes[0].parent      = fpTreeNil;
+        nodes[0].firstChild  = fpTreeNil;
+        nodes[0].nextSibling = fpTreeNil;
+        nodes[0].nodeLink    = fpTreeNil;
+        return true;
+    }
+
+    /** \brief Inserts the path of n items sorted in ascending order that occurs count times */
+    bool insert(const size_t * items, size_t n, size_t count)
+    {
+        size_t cur = 0;
+        for (size_t i = 0; i < n; i++)
+        {
+            const size_t item = items[i];
+            /* Children of the root are addressed directly as every item may start a path */
+            size_t child = (cur ? nodes[cur].firstChild : rootChild[item]);
+            while (cur && child != fpTreeNil && nodes[child].item != item)
+            {
+                child = nodes[child].nextSibling;
+            }
+            if (child == fpTreeNil)
+            {
+                if (nNodes == nodesCapacity && !grow()) return false;
+                child                    = nNodes++;
+                fp_tree_node<cpu> & node = nodes[child];
+                node.item                = item;
+                node.count               = 0;
+                node.parent              = cur;
+                node.firstChild          = fpTreeNil;
+                node.nextSibling         = nodes[cur].firstChild;
+                node.nodeLink            = headLink[item];
+                nodes[cur].firstChild    = child;
+                headLink[item]           = child;
+                if (!cur) rootChild[item] = child;
+            }
+            nodes[child].count += count;
+            itemSupport[item] += count;
+            cur = child;
+        }
+        return true;
+    }
+
+    fp_tree_node<cpu> * nodes; /*<! Nodes of the tree, the root is the node 0 */
+    size_t nNodes;             /*<! Number of nodes */
+    size_t nodesCapacity;      /*<! Number of nodes the memory is allocated for */
+    size_t nItems;             /*<! Number of items in the tree */
+    size_t itemsCapacity;      /*<! Number of items the memory is allocated for */
+    size_t * itemRank;         /*<! Ranks of the items in the order of descending support over all the transactions */
+    size_t * itemSupport;      /*<! Supports of the items in the tree */
+    size_t * headLink;         /*<! Header table: index of the first node that holds the item */
+    size_t * rootChild;        /*<! Index of the child of the root that holds the item */
+
+protected:
+    bool grow()
+    {
+        const size_t newCapacity     = nodesCapacity ? 2 * nodesCapacity : 1024;
+        fp_tree_node<cpu> * newNodes = service_malloc<fp_tree_node<cpu>, cpu>(newCapacity);
+        if (!newNodes) return false;
+        for (size_t i = 0; i < nNodes; i++)
+        {
+            newNodes[i] = nodes[i];
+        }
+        service_free<fp_tree_node<cpu>, cpu>(nodes);
+        nodes         = newNodes;
+        nodesCapacity = newCapacity;
+        return true;
+    }
+
+    void freeItems()
+    {
+        service_free<size_t, cpu>(itemRank);
+        service_free<size_t, cpu>(itemSupport);
+        service_free<size_t, cpu>(headLink);
+        service_free<size_t, cpu>(rootChild);
+        itemRank      = nullptr;
+        itemSupport   = nullptr;
+        headLink      = nullptr;
+        rootChild     = nullptr;
+        itemsCapacity = 0;
+    }
+
+private:
+    fp_tree(const fp_tree &);
+    fp_tree & operator=(const fp_tree &);
+};
+
+} // namespace internal
+
+} // namespace association_rules
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
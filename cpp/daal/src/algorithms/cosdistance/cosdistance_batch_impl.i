@@ -27,6 +27,7 @@
 #include "src/threading/threading.h"
 #include "src/algorithms/service_error_handling.h"
 #include "src/data_management/service_numeric_table.h"
+#include "src/algorithms/service_kernel_math.h"
 
 static const int blockSizeDefault = 128;
 #include "src/algorithms/cosdistance/cosdistance_full_impl.i"
@@ -82,7 +82,8 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 
     if (deviceInfo.isCpu || method != defaultDense)
     {
-        if (par->memorySavingMode == false)
+        /* Neighborhoods found with the spatial index are always streamed while clusters are expanded, instead of being all stored */
+        if (par->memorySavingMode == false && method != spatialIndexDense)
         {
             __DAAL_CALL_KERNEL(env, internal::DBSCANBatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), computeNoMemSave, ntData.get(),
                                ntWeights.get(), ntAssignments.get(), ntNClusters.get(), ntCoreIndices.get(), ntCoreObservations.get(), par);
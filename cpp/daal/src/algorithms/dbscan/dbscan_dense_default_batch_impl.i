@@ -39,8 +39,9 @@ namespace dbscan
 {
 namespace internal
 {
-#define __DBSCAN_PREFETCHED_NEIGHBORHOODS_COUNT 64
-#define __DBSCAN_MAXIMUM_NESTED_STACK_LEVEL     200
+#define __DBSCAN_PREFETCHED_NEIGHBORHOODS_COUNT               64
+#define __DBSCAN_SPATIAL_INDEX_PREFETCHED_NEIGHBORHOODS_COUNT 1024
+#define __DBSCAN_MAXIMUM_NESTED_STACK_LEVEL                   200
 
 template <typename algorithmFPType, Method method, CpuType cpu>
 Status DBSCANBatchKernel<algorithmFPType, method, cpu>::processNeighborhood(size_t clusterId, int * const assignments,
@@ -311,7 +312,9 @@ Status DBSCANBatchKernel<algorithmFPType, method, cpu>::computeMemSave(const Num
 
     service_memset<int, cpu>(isCore, 0, nRows);
 
-    const size_t prefetchBlockSize = __DBSCAN_PREFETCHED_NEIGHBORHOODS_COUNT;
+    /* Queries to the spatial index are cheap, so larger batches of them are needed to load all the threads */
+    const size_t prefetchBlockSize =
+        (method == spatialIndexDense ? __DBSCAN_SPATIAL_INDEX_PREFETCHED_NEIGHBORHOODS_COUNT : __DBSCAN_PREFETCHED_NEIGHBORHOODS_COUNT);
     TArray<Neighborhood<algorithmFPType, cpu>, cpu> prefetchedNeighs(prefetchBlockSize);
     DAAL_CHECK_MALLOC(prefetchedNeighs.get());
 
@@ -323,7 +326,7 @@ Status DBSCANBatchKernel<algorithmFPType, method, cpu>::computeMemSave(const Num
         if (assignments[i] != undefined) continue;
 
         Neighborhood<algorithmFPType, cpu> curNeigh;
-        nEngine.query(&i, 1, &curNeigh);
+        DAAL_CHECK_STATUS_VAR(nEngine.query(&i, 1, &curNeigh));
 
         if (curNeigh.weight() < minObservations)
         {
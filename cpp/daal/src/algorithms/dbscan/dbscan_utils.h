@@ -34,6 +34,7 @@
 #include "src/externals/service_math.h"
 #include "src/algorithms/service_kernel_math.h"
 #include "src/algorithms/service_error_handling.h"
+#include "src/services/service_data_utils.h"
 
 using namespace daal::internal;
 using namespace daal::services::internal;
@@ -50,6 +51,8 @@ namespace internal
 #define __DBSCAN_DEFAULT_QUEUE_SIZE        32
 #define __DBSCAN_DEFAULT_VECTOR_SIZE       32
 #define __DBSCAN_DEFAULT_NEIGHBORHOOD_SIZE 64
+#define __DBSCAN_KD_TREE_LEAF_SIZE         32
+#define __DBSCAN_KD_TREE_MAX_DEPTH         64
 
 template <typename T, CpuType cpu>
 class Queue
@@ -634,6 +637,340 @@ private:
     FPType _p;
 };
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// KDTree. Balanced kd-tree over the observations used to answer the eps-range queries.
+// The tree is a complete binary tree stored implicitly: the node i has the children
+// 2 * i + 1 and 2 * i + 2, and the observations of a node split into two halves at the
+// median of the widest dimension of its bounding box. The indices of the observations
+// are stored in the order of leaves, so the observations of any subtree are contiguous.
+// The observations themselves are read from the input table and are not copied.
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename FPType, CpuType cpu>
+class KDTree
+{
+    static const size_t leafSize = __DBSCAN_KD_TREE_LEAF_SIZE;
+    static const size_t maxDepth = __DBSCAN_KD_TREE_MAX_DEPTH;
+
+public:
+    DAAL_NEW_DELETE();
+
+    KDTree() : _nRows(0), _dim(0), _depth(0), _firstLeaf(0) {}
+
+    KDTree(const KDTree &) = delete;
+    KDTree & operator=(const KDTree &) = delete;
+
+    services::Status build(const NumericTable * table, const NumericTable * weights)
+    {
+        _nRows = table->getNumberOfRows();
+        _dim   = table->getNumberOfColumns();
+        if (!_nRows) return services::Status();
+
+        _depth = 0;
+        while (_depth < maxDepth - 1 && (_nRows >> _depth) > leafSize) _depth++;
+
+        const size_t nNodes = (size_t(2) << _depth) - 1;
+        _firstLeaf          = (size_t(1) << _depth) - 1;
+
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, _nRows, _dim);
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nNodes, 2 * _dim);
+
+        _dataRows.set(const_cast<NumericTable *>(table), 0, _nRows);
+        DAAL_CHECK_BLOCK_STATUS(_dataRows);
+        const FPType * const data = _dataRows.get();
+
+        _indices.reset(_nRows);
+        _bounds.reset(nNodes * 2 * _dim);
+        DAAL_CHECK_MALLOC(_indices.get() && _bounds.get());
+        for (size_t i = 0; i < _nRows; i++) _indices[i] = i;
+
+        /* Boundaries of the ranges of observations of the nodes of the current and of the next level */
+        TArray<size_t, cpu> levelRanges(_firstLeaf + 2);
+        TArray<size_t, cpu> nextLevelRanges(_firstLeaf + 2);
+        DAAL_CHECK_MALLOC(levelRanges.get() && nextLevelRanges.get());
+        levelRanges[0] = 0;
+        levelRanges[1] = _nRows;
+
+        for (size_t lvl = 0; lvl <= _depth; lvl++)
+        {
+            const size_t nLevelNodes = size_t(1) << lvl;
+            const size_t firstNode   = nLevelNodes - 1;
+            const bool isLeafLevel   = (lvl == _depth);
+
+            daal::threader_for(nLevelNodes, nLevelNodes, [&](size_t iNode) {
+                const size_t begin   = levelRanges[iNode];
+                const size_t end     = levelRanges[iNode + 1];
+                const size_t mid     = begin + (end - begin) / 2;
+                FPType * const lower = _bounds.get() + (firstNode + iNode) * 2 * _dim;
+                FPType * const upper = lower + _dim;
+
+                computeBoundingBox(data, begin, end, lower, upper);
+
+                if (!isLeafLevel)
+                {
+                    size_t splitFeature = 0;
+                    for (size_t j = 1; j < _dim; j++)
+                    {
+                        if (upper[j] - lower[j] > upper[splitFeature] - lower[splitFeature]) splitFeature = j;
+                    }
+                    if (end - begin > 1) selectKth(_indices.get() + begin, end - begin, mid - begin, data, splitFeature);
+
+                    nextLevelRanges[2 * iNode]     = begin;
+                    nextLevelRanges[2 * iNode + 1] = mid;
+                }
+            });
+
+            if (!isLeafLevel)
+            {
+                nextLevelRanges[2 * nLevelNodes] = _nRows;
+                for (size_t i = 0; i <= 2 * nLevelNodes; i++) levelRanges[i] = nextLevelRanges[i];
+            }
+        }
+
+        if (weights)
+        {
+            _weightsRows.set(const_cast<NumericTable *>(weights), 0, _nRows);
+            DAAL_CHECK_BLOCK_STATUS(_weightsRows);
+        }
+
+        return services::Status();
+    }
+
+    /* Adds the observations within the distance eps (epsP = eps^2) from x to the neighborhood */
+    int query(const FPType * x, FPType epsP, Neighborhood<FPType, cpu> & neigh) const
+    {
+        if (!_nRows) return 0;
+
+        const FPType * const data = _dataRows.get();
+        const FPType * const w    = _weightsRows.get();
+
+        size_t nodes[maxDepth + 1];
+        size_t begins[maxDepth + 1];
+        size_t ends[maxDepth + 1];
+        size_t stackSize = 0;
+
+        nodes[0]  = 0;
+        begins[0] = 0;
+        ends[0]   = _nRows;
+        stackSize = 1;
+
+        int result = 0;
+        while (stackSize)
+        {
+            stackSize--;
+            const size_t iNode = nodes[stackSize];
+            const size_t begin = begins[stackSize];
+            const size_t end   = ends[stackSize];
+
+            const FPType * const lower = _bounds.get() + iNode * 2 * _dim;
+            const FPType * const upper = lower + _dim;
+
+            FPType minDist = 0;
+            FPType maxDist = 0;
+            for (size_t j = 0; j < _dim; j++)
+            {
+                const FPType toLower  = x[j] - lower[j];
+                const FPType toUpper  = upper[j] - x[j];
+                const FPType outside  = (toLower < 0 ? -toLower : (toUpper < 0 ? -toUpper : FPType(0)));
+                const FPType farthest = (toLower > toUpper ? toLower : toUpper);
+                minDist += outside * outside;
+                maxDist += farthest * farthest;
+            }
+            if (minDist > epsP) continue;
+
+            if (maxDist <= epsP)
+            {
+                /* The whole subtree lies within the eps-ball */
+                result |= neigh.allocateNewEntries(end - begin);
+                if (result) return result;
+                for (size_t i = begin; i < end; i++) neigh.fastAdd(_indices[i], w ? w[_indices[i]] : FPType(1));
+            }
+            else if (iNode >= _firstLeaf)
+            {
+                for (size_t i = begin; i < end; i++)
+                {
+                    if (distancePow2<FPType, cpu>(x, data + _indices[i] * _dim, _dim) <= epsP)
+                    {
+                        result |= neigh.add(_indices[i], w ? w[_indices[i]] : FPType(1));
+                        if (result) return result;
+                    }
+                }
+            }
+            else
+            {
+                const size_t mid  = begin + (end - begin) / 2;
+                nodes[stackSize]  = 2 * iNode + 2;
+                begins[stackSize] = mid;
+                ends[stackSize]   = end;
+                stackSize++;
+                nodes[stackSize]  = 2 * iNode + 1;
+                begins[stackSize] = begin;
+                ends[stackSize]   = mid;
+                stackSize++;
+            }
+        }
+
+        return result;
+    }
+
+private:
+    void computeBoundingBox(const FPType * data, size_t begin, size_t end, FPType * lower, FPType * upper) const
+    {
+        if (begin == end)
+        {
+            /* Empty node is never visited: its box is made unreachable */
+            for (size_t j = 0; j < _dim; j++)
+            {
+                lower[j] = services::internal::MaxVal<FPType>::get();
+                upper[j] = -services::internal::MaxVal<FPType>::get();
+            }
+            return;
+        }
+
+        const FPType * const first = data + _indices[begin] * _dim;
+        for (size_t j = 0; j < _dim; j++) lower[j] = upper[j] = first[j];
+
+        for (size_t i = begin + 1; i < end; i++)
+        {
+            const FPType * const row = data + _indices[i] * _dim;
+            for (size_t j = 0; j < _dim; j++)
+            {
+                lower[j] = (row[j] < lower[j] ? row[j] : lower[j]);
+                upper[j] = (row[j] > upper[j] ? row[j] : upper[j]);
+            }
+        }
+    }
+
+    /* Places the k-th smallest value of the feature to the position k, smaller ones before it and larger ones after it */
+    void selectKth(size_t * idx, size_t n, size_t k, const FPType * data, size_t feature) const
+    {
+        const DAAL_INT64 kth = k;
+        DAAL_INT64 l         = 0;
+        DAAL_INT64 r         = n - 1;
+        while (l < r)
+        {
+            const FPType pivot = data[idx[k] * _dim + feature];
+            DAAL_INT64 i       = l;
+            DAAL_INT64 j       = r;
+            while (i <= j)
+            {
+                while (data[idx[i] * _dim + feature] < pivot) i++;
+                while (pivot < data[idx[j] * _dim + feature]) j--;
+                if (i <= j)
+                {
+                    swap<cpu, size_t>(idx[i], idx[j]);
+                    i++;
+                    j--;
+                }
+            }
+            if (j < kth) l = i;
+            if (kth < i) r = j;
+        }
+    }
+
+    size_t _nRows;
+    size_t _dim;
+    size_t _depth;
+    size_t _firstLeaf;
+    ReadRows<FPType, cpu> _dataRows;    /* Observations of the input table */
+    ReadRows<FPType, cpu> _weightsRows; /* Weights of the observations, empty if observations are not weighted */
+    TArray<size_t, cpu> _indices;       /* Indices of the observations in the order of leaves */
+    TArray<FPType, cpu> _bounds;        /* Lower and upper bounds of the bounding box of every node */
+};
+
+template <typename FPType, CpuType cpu>
+class NeighborhoodEngine<spatialIndexDense, FPType, cpu>
+{
+    DAAL_NEW_DELETE();
+
+public:
+    NeighborhoodEngine(const NumericTable * inTable, const NumericTable * outTable, const NumericTable * weights, FPType eps, FPType p)
+        : _inTable(inTable), _outTable(outTable), _weights(weights), _eps(eps), _p(p), _isIndexBuilt(false)
+    {}
+
+    ~NeighborhoodEngine() {}
+
+    NeighborhoodEngine(const NeighborhoodEngine &) = delete;
+    NeighborhoodEngine & operator=(const NeighborhoodEngine &) = delete;
+
+    services::Status queryFull(Neighborhood<FPType, cpu> * neighs, bool doReset = false)
+    {
+        const size_t inRows = _inTable->getNumberOfRows();
+        DAAL_CHECK_STATUS_VAR(buildIndex());
+
+        const FPType epsP = Math<FPType, cpu>::sPowx(_eps, _p);
+
+        const size_t blockSize = 256;
+        const size_t nBlocks   = inRows / blockSize + !!(inRows % blockSize);
+
+        SafeStatus safeStat;
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            const size_t i1 = iBlock * blockSize;
+            const size_t i2 = services::internal::min<cpu, size_t>(i1 + blockSize, inRows);
+
+            ReadRows<FPType, cpu> inDataRows(const_cast<NumericTable *>(_inTable), i1, i2 - i1);
+            DAAL_CHECK_BLOCK_STATUS_THR(inDataRows);
+            const FPType * const inData = inDataRows.get();
+            const size_t dim            = _inTable->getNumberOfColumns();
+
+            for (size_t i = i1; i < i2; i++)
+            {
+                if (doReset) neighs[i].reset();
+                DAAL_CHECK_MALLOC_THR(!_index.query(inData + (i - i1) * dim, epsP, neighs[i]));
+            }
+        });
+
+        return safeStat.detach();
+    }
+
+    services::Status query(size_t * indices, size_t n, Neighborhood<FPType, cpu> * neighs, bool doReset = false)
+    {
+        DAAL_CHECK_STATUS_VAR(buildIndex());
+
+        const FPType epsP = Math<FPType, cpu>::sPowx(_eps, _p);
+
+        const size_t blockSize = 16;
+        const size_t nBlocks   = n / blockSize + !!(n % blockSize);
+
+        SafeStatus safeStat;
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            const size_t i1 = iBlock * blockSize;
+            const size_t i2 = services::internal::min<cpu, size_t>(i1 + blockSize, n);
+
+            for (size_t i = i1; i < i2; i++)
+            {
+                ReadRows<FPType, cpu> queryRow(const_cast<NumericTable *>(_inTable), indices[i], 1);
+                DAAL_CHECK_BLOCK_STATUS_THR(queryRow);
+
+                if (doReset) neighs[i].reset();
+                DAAL_CHECK_MALLOC_THR(!_index.query(queryRow.get(), epsP, neighs[i]));
+            }
+        });
+
+        return safeStat.detach();
+    }
+
+private:
+    services::Status buildIndex()
+    {
+        if (_isIndexBuilt) return services::Status();
+
+        DAAL_ASSERT(_outTable->getNumberOfColumns() >= _inTable->getNumberOfColumns());
+        DAAL_CHECK_STATUS_VAR(_index.build(_outTable, _weights));
+        _isIndexBuilt = true;
+        return services::Status();
+    }
+
+    const NumericTable * _inTable;
+    const NumericTable * _outTable;
+    const NumericTable * _weights;
+
+    FPType _eps;
+    FPType _p;
+
+    KDTree<FPType, cpu> _index;
+    bool _isIndexBuilt;
+};
+
 template <typename FPType, CpuType cpu>
 FPType findKthStatistic(FPType * values, size_t nElements, size_t k)
 {
@@ -574,6 +574,8 @@ public:
     void putProbabilities(LeavesDataIndex index, double * probs, size_t numProbs) const {}
 };
 
+/* The nodes of the tree are kept in one contiguous array that grows geometrically and is released at once.
+   It serves as the node arena of decision_tree training, so the dtrees node allocators are not used here */
 template <CpuType cpu, typename IndependentVariable, typename DependentVariable>
 class Tree
 {
@@ -102,37 +102,38 @@ void MemoryManager::destroy()
         _aChunk[i] = nullptr;
     }
     _aChunk.clear();
-    _posInChunk = 0;
-    _iCurChunk  = -1;
+    _aChunkSize.clear();
+    _nextChunkSize = _chunkSize;
+    _posInChunk    = 0;
+    _iCurChunk     = -1;
 }
 
 void * MemoryManager::alloc(size_t nBytes)
 {
-    DAAL_ASSERT(nBytes <= _chunkSize);
-    size_t pos = 0; //pos in the chunk to allocate from
-    if ((_iCurChunk >= 0) && (_posInChunk + nBytes <= _chunkSize))
+    if ((_iCurChunk >= 0) && (_posInChunk + nBytes <= _aChunkSize[_iCurChunk]))
     {
         //allocate from the current chunk
-        pos = _posInChunk;
+        byte * ptr = _aChunk[_iCurChunk] + _posInChunk;
+        _posInChunk += nBytes;
+        return ptr;
     }
-    else
+
+    //make the next free chunk that fits the request a current one, the smaller ones are left for the next trees
+    size_t iChunk = size_t(_iCurChunk + 1);
+    while ((iChunk < _aChunk.size()) && (_aChunkSize[iChunk] < nBytes)) ++iChunk;
+    if (iChunk == _aChunk.size())
     {
-        if (!_aChunk.size() || _iCurChunk + 1 >= _aChunk.size())
-        {
-            //allocate a new chunk
-            DAAL_ASSERT(_aChunk.size() ? _iCurChunk >= 0 : _iCurChunk < 0);
-            byte * ptr = (byte *)services::daal_calloc(_chunkSize);
-            if (!ptr) return nullptr;
-            _aChunk.push_back(ptr);
-        }
-        //there are free chunks, make next available a current one and allocate from it
-        _iCurChunk++;
-        pos         = 0;
-        _posInChunk = 0;
+        //allocate a new chunk, large leaves (e.g. with many classes) get a chunk of their own size
+        const size_t size = (_nextChunkSize < nBytes) ? nBytes : _nextChunkSize;
+        byte * ptr        = (byte *)services::daal_malloc(size);
+        if (!ptr) return nullptr;
+        _aChunk.push_back(ptr);
+        _aChunkSize.push_back(size);
+        if (_nextChunkSize < _cMaxChunkSize) _nextChunkSize = (2 * _nextChunkSize < _cMaxChunkSize) ? 2 * _nextChunkSize : _cMaxChunkSize;
     }
-    //allocate from the current chunk
-    _posInChunk += nBytes;
-    return _aChunk[_iCurChunk] + pos;
+    _iCurChunk  = int(iChunk);
+    _posInChunk = nBytes;
+    return _aChunk[iChunk];
 }
 
 void MemoryManager::reset()
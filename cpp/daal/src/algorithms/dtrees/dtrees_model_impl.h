@@ -204,10 +204,12 @@ void HeapMemoryAllocator<NodeType>::free(typename NodeType::Base * n)
     delete n;
 }
 
+//Arena of the nodes of a tree: allocations are bumped in chunks, all of them are released at once by reset().
+//Chunks are kept by reset() and reused by the next tree built with the same allocator
 class MemoryManager
 {
 public:
-    MemoryManager(size_t chunkSize) : _chunkSize(chunkSize), _posInChunk(0), _iCurChunk(-1) {}
+    MemoryManager(size_t chunkSize) : _chunkSize(chunkSize), _nextChunkSize(chunkSize), _posInChunk(0), _iCurChunk(-1) {}
     ~MemoryManager() { destroy(); }
 
     void * alloc(size_t nBytes);
@@ -217,10 +219,14 @@ public:
     void destroy();
 
 private:
+    static const size_t _cMaxChunkSize = 4 * 1024 * 1024; //chunks grow geometrically up to this size
+
     services::Collection<byte *> _aChunk;
-    const size_t _chunkSize; //size of a chunk to be allocated
-    size_t _posInChunk;      //index of the first free byte in the current chunk
-    int _iCurChunk;          //index of the current chunk to allocate from
+    services::Collection<size_t> _aChunkSize; //sizes of the allocated chunks
+    const size_t _chunkSize;                  //size of the first chunk to be allocated
+    size_t _nextChunkSize;                    //size of the next chunk to be allocated
+    size_t _posInChunk;                       //index of the first free byte in the current chunk
+    int _iCurChunk;                           //index of the current chunk to allocate from
 };
 
 template <typename NodeType>
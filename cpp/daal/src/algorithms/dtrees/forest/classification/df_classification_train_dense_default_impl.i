@@ -80,10 +80,16 @@ public:
 
 public:
     UnorderedRespHelper(const dtrees::internal::IndexedFeatures * indexedFeatures, size_t nClasses)
-        : super(indexedFeatures), _nClasses(nClasses), _histLeft(nClasses), _impLeft(nClasses), _impRight(nClasses)
+        : super(indexedFeatures), _nClasses(nClasses), _workBuffers([=]() -> WorkBuffers * { return createWorkBuffers(); })
     {}
+    ~UnorderedRespHelper()
+    {
+        _workBuffers.reduce([](WorkBuffers * ptr) -> void { delete ptr; });
+    }
     virtual bool init(const NumericTable * data, const NumericTable * resp, const IndexType * aSample,
                       const NumericTable * weights) DAAL_C11_OVERRIDE;
+    //checks that the work buffers of the calling thread are allocated
+    bool hasWorkBuffers() const { return _workBuffers.local() != nullptr; }
     void convertLeftImpToRight(size_t n, const ImpurityData & total, TSplitData & split)
     {
         computeRightHistogramm(total.hist, split.left.hist, split.left.hist);
@@ -117,26 +123,38 @@ public:
     bool terminateCriteria(ImpurityData & imp, algorithmFPType impurityThreshold, size_t nSamples) const { return imp.value() < impurityThreshold; }
 
     template <typename BinIndexType>
-    int findBestSplitForFeatureSorted(algorithmFPType * featureBuf, IndexType iFeature, const IndexType * aIdx, size_t n, size_t nMinSplitPart,
-                                      const ImpurityData & curImpurity, TSplitData & split, const algorithmFPType minWeightLeaf,
-                                      const algorithmFPType totalWeights, const BinIndexType * binIndex) const;
+    int findBestSplitForFeatureSorted(IndexType iFeature, const IndexType * aIdx, size_t n, size_t nMinSplitPart, const ImpurityData & curImpurity,
+                                      TSplitData & split, const algorithmFPType minWeightLeaf, const algorithmFPType totalWeights,
+                                      const BinIndexType * binIndex) const;
+
+    //Histogram of the node over the bins of an indexed feature.
+    //For every bin it keeps the sums of weights of the classes followed by the number of observations and their total weight.
+    //The number and the total weight are not computed in case of no weights, they are derived from the sums of the classes then.
+    //The histogram of a node is the sum of the histograms of its children that allows to get one of them by subtraction.
+    size_t histogramWidth() const { return _nClasses + 2; }
+    template <typename BinIndexType>
+    void computeHistogram(IndexType iFeature, const IndexType * aIdx, const BinIndexType * binIndex, size_t n, algorithmFPType * hist) const;
+    int findBestSplitByHistogram(IndexType iFeature, const algorithmFPType * hist, size_t n, size_t nMinSplitPart, const ImpurityData & curImpurity,
+                                 TSplitData & split, const algorithmFPType minWeightLeaf, const algorithmFPType totalWeights) const;
+
     template <typename BinIndexType>
-    void computeHistFewClassesWithoutWeights(IndexType iFeature, const IndexType * aIdx, const BinIndexType * binIndex, size_t n) const;
+    void computeHistFewClassesWithoutWeights(algorithmFPType * hist, const IndexType * aIdx, const BinIndexType * binIndex, size_t n) const;
     template <typename BinIndexType>
-    void computeHistFewClassesWithWeights(IndexType iFeature, const IndexType * aIdx, const BinIndexType * binIndex, size_t n) const;
+    void computeHistFewClassesWithWeights(algorithmFPType * hist, const IndexType * aIdx, const BinIndexType * binIndex, size_t n) const;
     template <typename BinIndexType>
-    void computeHistManyClasses(IndexType iFeature, const IndexType * aIdx, const BinIndexType * binIndex, size_t n) const;
+    void computeHistManyClasses(algorithmFPType * hist, const IndexType * aIdx, const BinIndexType * binIndex, size_t n) const;
 
-    int findBestSplitbyHistDefault(int nDiffFeatMax, size_t n, size_t nMinSplitPart, const ImpurityData & curImpurity, TSplitData & split,
-                                   const algorithmFPType minWeightLeaf, const algorithmFPType totalWeights) const;
+    int findBestSplitbyHistDefault(const algorithmFPType * hist, int nDiffFeatMax, size_t n, size_t nMinSplitPart, const ImpurityData & curImpurity,
+                                   TSplitData & split, const algorithmFPType minWeightLeaf, const algorithmFPType totalWeights) const;
 
     template <int K, bool noWeights>
-    int findBestSplitFewClasses(int nDiffFeatMax, size_t n, size_t nMinSplitPart, const ImpurityData & curImpurity, TSplitData & split,
-                                const algorithmFPType minWeightLeaf, const algorithmFPType totalWeights) const;
+    int findBestSplitFewClasses(const algorithmFPType * hist, int nDiffFeatMax, size_t n, size_t nMinSplitPart, const ImpurityData & curImpurity,
+                                TSplitData & split, const algorithmFPType minWeightLeaf, const algorithmFPType totalWeights) const;
 
     template <bool noWeights>
-    int findBestSplitFewClassesDispatch(int nDiffFeatMax, size_t n, size_t nMinSplitPart, const ImpurityData & curImpurity, TSplitData & split,
-                                        const algorithmFPType minWeightLeaf, const algorithmFPType totalWeights) const;
+    int findBestSplitFewClassesDispatch(const algorithmFPType * hist, int nDiffFeatMax, size_t n, size_t nMinSplitPart,
+                                        const ImpurityData & curImpurity, TSplitData & split, const algorithmFPType minWeightLeaf,
+                                        const algorithmFPType totalWeights) const;
 
     template <bool noWeights, typename BinIndexType>
     void finalizeBestSplit(const IndexType * aIdx, const BinIndexType * binIndex, size_t n, IndexType iFeature, size_t idxFeatureValueBestSplit,
@@ -266,17 +284,43 @@ private:
                                          const algorithmFPType accuracy, const ImpurityData & curImpurity, TSplitData & split,
                                          const algorithmFPType minWeightLeaf, const algorithmFPType totalWeights) const;
 
+    //work buffers of the split search, each thread building nodes or processing features in parallel uses its own set
+    struct WorkBuffers
+    {
+        DAAL_NEW_DELETE();
+        WorkBuffers(size_t nClasses, size_t histSize) : hist(histSize), histLeft(nClasses), impLeft(nClasses), impRight(nClasses) {}
+        bool isValid(size_t histSize) const { return (hist.get() || !histSize) && histLeft.get() && impLeft.hist.get() && impRight.hist.get(); }
+
+        TVector<algorithmFPType, cpu> hist; //histogram of the node, used in findBestSplitForFeatureSorted only
+        Histogramm histLeft;
+        //work variables used in memory saving mode only
+        ImpurityData impLeft;
+        ImpurityData impRight;
+    };
+
+    WorkBuffers * createWorkBuffers() const
+    {
+        const size_t histSize = this->_indexedFeatures ? this->indexedFeatures().maxNumIndices() * histogramWidth() : 0;
+        WorkBuffers * ptr     = new WorkBuffers(_nClasses, histSize);
+        if (ptr && !ptr->isValid(histSize))
+        {
+            delete ptr;
+            ptr = nullptr;
+        }
+        return ptr;
+    }
+
+    WorkBuffers & workBuffers() const
+    {
+        WorkBuffers * ptr = _workBuffers.local();
+        DAAL_ASSERT(ptr);
+        return *ptr;
+    }
+
 private:
     const size_t _nClasses;
-    //set of buffers for indexed features processing, used in findBestSplitForFeatureIndexed only
     const size_t _nClassesThreshold = 8;
-    mutable TVector<IndexType, cpu> _idxFeatureBuf;
-    mutable TVector<algorithmFPType, cpu> _weightsFeatureBuf;
-    mutable TVector<float, cpu> _samplesPerClassBuf;
-    mutable Histogramm _histLeft;
-    //work variables used in memory saving mode only
-    mutable ImpurityData _impLeft;
-    mutable ImpurityData _impRight;
+    mutable daal::tls<WorkBuffers *> _workBuffers;
 };
 
 #ifdef DEBUG_CHECK_IMPURITY
@@ -299,16 +343,8 @@ bool UnorderedRespHelper<algorithmFPType, cpu>::init(const NumericTable * data,
                                                      const NumericTable * weights)
 {
     DAAL_CHECK_STATUS_VAR(super::init(data, resp, aSample, weights));
-    if (this->_indexedFeatures)
-    {
-        //init work buffers for the computation using indexed features
-        const auto nDiffFeatMax = this->indexedFeatures().maxNumIndices();
-        _idxFeatureBuf.reset(nDiffFeatMax);
-        _weightsFeatureBuf.reset(nDiffFeatMax);
-        _samplesPerClassBuf.reset(nClasses() * nDiffFeatMax);
-        return _idxFeatureBuf.get() && _weightsFeatureBuf.get() && _samplesPerClassBuf.get();
-    }
-    return true;
+    //work buffers of the calling thread, other threads allocate them on first use
+    return hasWorkBuffers();
 }
 
 template <typename algorithmFPType, CpuType cpu>
@@ -359,9 +395,12 @@ bool UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitOrderedFeature(cons
                                                                             const ImpurityData & curImpurity, TSplitData & split,
                                                                             const algorithmFPType minWeightLeaf, algorithmFPType totalWeights) const
 {
-    ClassIndexType iClass = this->_aResponse[aIdx[0]].val;
-    _impLeft.init(_nClasses);
-    _impRight = curImpurity;
+    ClassIndexType iClass   = this->_aResponse[aIdx[0]].val;
+    WorkBuffers & buffers   = workBuffers();
+    ImpurityData & impLeft  = buffers.impLeft;
+    ImpurityData & impRight = buffers.impRight;
+    impLeft.init(_nClasses);
+    impRight = curImpurity;
 
     const bool bBestFromOtherFeatures      = isPositive<algorithmFPType, cpu>(split.impurityDecrease);
     algorithmFPType vBestFromOtherFeatures = algorithmFPType(-1);
@@ -398,10 +437,10 @@ bool UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitOrderedFeature(cons
             }
             else
             {
-                updateImpurity(_impLeft, _impRight, iClass, totalWeights, iStartEqualRespValues, nEqualRespValues);
+                updateImpurity(impLeft, impRight, iClass, totalWeights, iStartEqualRespValues, nEqualRespValues);
 #ifdef DEBUG_CHECK_IMPURITY
-                checkImpurity(aIdx, leftWeights, _impLeft);
-                checkImpurity(aIdx + i, totalWeights - leftWeights, _impRight);
+                checkImpurity(aIdx, leftWeights, impLeft);
+                checkImpurity(aIdx + i, totalWeights - leftWeights, impRight);
 #endif
                 iClass                = this->_aResponse[aIdx[i]].val;
                 nEqualRespValues      = weights;
@@ -410,18 +449,18 @@ bool UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitOrderedFeature(cons
             continue;
         }
 
-        updateImpurity(_impLeft, _impRight, iClass, totalWeights, iStartEqualRespValues, nEqualRespValues);
+        updateImpurity(impLeft, impRight, iClass, totalWeights, iStartEqualRespValues, nEqualRespValues);
 #ifdef DEBUG_CHECK_IMPURITY
-        checkImpurity(aIdx, leftWeights, _impLeft);
-        checkImpurity(aIdx + i, totalWeights - leftWeights, _impRight);
+        checkImpurity(aIdx, leftWeights, impLeft);
+        checkImpurity(aIdx + i, totalWeights - leftWeights, impRight);
 #endif
         iClass                = this->_aResponse[aIdx[i]].val;
         nEqualRespValues      = weights;
         iStartEqualRespValues = leftWeights;
-        if (!isPositive<algorithmFPType, cpu>(_impLeft.var)) _impLeft.var = 0;
-        if (!isPositive<algorithmFPType, cpu>(_impRight.var)) _impRight.var = 0;
+        if (!isPositive<algorithmFPType, cpu>(impLeft.var)) impLeft.var = 0;
+        if (!isPositive<algorithmFPType, cpu>(impRight.var)) impRight.var = 0;
 
-        const algorithmFPType v = leftWeights * _impLeft.var + (totalWeights - leftWeights) * _impRight.var;
+        const algorithmFPType v = leftWeights * impLeft.var + (totalWeights - leftWeights) * impRight.var;
         if (iBest < 0)
         {
             if (bBestFromOtherFeatures && isGreater<algorithmFPType, cpu>(v, vBestFromOtherFeatures))
@@ -437,8 +476,8 @@ bool UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitOrderedFeature(cons
         }
         bFound             = true;
         vBest              = v;
-        split.left.var     = _impLeft.var;
-        split.left.hist    = _impLeft.hist;
+        split.left.var     = impLeft.var;
+        split.left.hist    = impLeft.hist;
         iBest              = i;
         split.nLeft        = i;
         split.leftWeights  = leftWeights;
@@ -473,7 +512,10 @@ bool UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitCategoricalFeature(
                                                                                 const algorithmFPType totalWeights) const
 {
     DAAL_ASSERT(n >= 2 * nMinSplitPart);
-    _impRight.init(_nClasses);
+    WorkBuffers & buffers   = workBuffers();
+    ImpurityData & impLeft  = buffers.impLeft;
+    ImpurityData & impRight = buffers.impRight;
+    impRight.init(_nClasses);
     bool bFound                       = false;
     const bool bBestFromOtherFeatures = !(split.impurityDecrease < 0);
     algorithmFPType vBest             = -1;
@@ -482,30 +524,30 @@ bool UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitCategoricalFeature(
     const algorithmFPType vBestFromOtherFeatures = bBestFromOtherFeatures ? totalWeights * (curImpurity.var - split.impurityDecrease) : -1;
     for (size_t i = 0; i < n - nMinSplitPart;)
     {
-        _impLeft.init(_nClasses);
+        impLeft.init(_nClasses);
         auto weights                = this->_aWeights[aIdx[i]].val;
         size_t count                = 1;
         algorithmFPType leftWeights = weights;
         const algorithmFPType first = featureVal[i];
         ClassIndexType xi           = this->_aResponse[aIdx[i]].val;
-        _impLeft.hist[xi]           = weights;
+        impLeft.hist[xi]            = weights;
         const size_t iStart         = i;
         for (++i; (i < n) && (featureVal[i] == first); ++count, ++i)
         {
             weights = this->_aWeights[aIdx[i]].val;
             xi      = this->_aResponse[aIdx[i]].val;
             leftWeights += weights;
-            _impLeft.hist[xi] += weights;
+            impLeft.hist[xi] += weights;
         }
         if ((count < nMinSplitPart) || ((n - count) < nMinSplitPart) || (leftWeights < minWeightLeaf)
             || ((totalWeights - leftWeights) < minWeightLeaf))
             continue;
         PRAGMA_IVDEP
         PRAGMA_VECTOR_ALWAYS
-        for (size_t j = 0; j < _nClasses; ++j) _impRight.hist[j] = curImpurity.hist[j] - _impLeft.hist[j];
-        calcGini(leftWeights, _impLeft);
-        calcGini(totalWeights - leftWeights, _impRight);
-        const algorithmFPType v = leftWeights * _impLeft.var + (totalWeights - leftWeights) * _impRight.var;
+        for (size_t j = 0; j < _nClasses; ++j) impRight.hist[j] = curImpurity.hist[j] - impLeft.hist[j];
+        calcGini(leftWeights, impLeft);
+        calcGini(totalWeights - leftWeights, impRight);
+        const algorithmFPType v = leftWeights * impLeft.var + (totalWeights - leftWeights) * impRight.var;
         if (iBest < 0)
         {
             if (bBestFromOtherFeatures && isGreater<algorithmFPType, cpu>(v, vBestFromOtherFeatures)) continue;
@@ -514,8 +556,8 @@ bool UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitCategoricalFeature(
             continue;
         iBest              = i;
         vBest              = v;
-        split.left.var     = _impLeft.var;
-        split.left.hist    = _impLeft.hist;
+        split.left.var     = impLeft.var;
+        split.left.hist    = impLeft.hist;
         split.nLeft        = count;
         split.leftWeights  = leftWeights;
         split.totalWeights = totalWeights;
@@ -536,104 +578,102 @@ bool UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitCategoricalFeature(
     return bFound;
 }
 
+
 template <typename algorithmFPType, CpuType cpu>
 template <typename BinIndexType>
-void UnorderedRespHelper<algorithmFPType, cpu>::computeHistFewClassesWithoutWeights(IndexType iFeature, const IndexType * aIdx,
+void UnorderedRespHelper<algorithmFPType, cpu>::computeHistFewClassesWithoutWeights(algorithmFPType * hist, const IndexType * aIdx,
                                                                                     const BinIndexType * binIndex, size_t n) const
 {
     const algorithmFPType one(1.0);
-    const auto aResponse  = this->_aResponse.get();
-    auto nSamplesPerClass = _samplesPerClassBuf.get();
+    const auto aResponse = this->_aResponse.get();
+    const size_t nStride = histogramWidth();
     {
         for (size_t i = 0; i < n; ++i)
         {
-            const IndexType iSample = aIdx[i];
-            const auto & r          = aResponse[aIdx[i]];
+            const auto & r = aResponse[aIdx[i]];
 
             const BinIndexType idx      = binIndex[r.idx];
             const ClassIndexType iClass = r.val;
-            nSamplesPerClass[idx * _nClasses + iClass] += one;
+            hist[idx * nStride + iClass] += one;
         }
     }
 }
 
 template <typename algorithmFPType, CpuType cpu>
 template <typename BinIndexType>
-void UnorderedRespHelper<algorithmFPType, cpu>::computeHistFewClassesWithWeights(IndexType iFeature, const IndexType * aIdx,
+void UnorderedRespHelper<algorithmFPType, cpu>::computeHistFewClassesWithWeights(algorithmFPType * hist, const IndexType * aIdx,
                                                                                  const BinIndexType * binIndex, size_t n) const
 {
+    const algorithmFPType one(1.0);
     const auto aResponse = this->_aResponse.get();
     const auto aWeights  = this->_aWeights.get();
-
-    auto nFeatIdx         = _idxFeatureBuf.get();
-    auto nSamplesPerClass = _samplesPerClassBuf.get();
+    const size_t nStride = histogramWidth();
 
     {
         for (size_t i = 0; i < n; ++i)
         {
-            const IndexType iSample = aIdx[i];
-            const auto & r          = aResponse[aIdx[i]];
-            const BinIndexType idx  = binIndex[r.idx];
-            ++nFeatIdx[idx];
+            const IndexType iSample     = aIdx[i];
+            const auto & r              = aResponse[aIdx[i]];
+            algorithmFPType * binHist   = hist + binIndex[r.idx] * nStride;
             const auto weights          = aWeights[iSample].val;
             const ClassIndexType iClass = r.val;
-            nSamplesPerClass[idx * _nClasses + iClass] += weights;
+            binHist[_nClasses] += one;
+            binHist[iClass] += weights;
         }
     }
 }
 
 template <typename algorithmFPType, CpuType cpu>
 template <typename BinIndexType>
-void UnorderedRespHelper<algorithmFPType, cpu>::computeHistManyClasses(IndexType iFeature, const IndexType * aIdx, const BinIndexType * binIndex,
+void UnorderedRespHelper<algorithmFPType, cpu>::computeHistManyClasses(algorithmFPType * hist, const IndexType * aIdx, const BinIndexType * binIndex,
                                                                        size_t n) const
 {
+    const algorithmFPType one(1.0);
     const auto aResponse = this->_aResponse.get();
     const auto aWeights  = this->_aWeights.get();
-
-    auto nFeatIdx         = _idxFeatureBuf.get();
-    auto featWeights      = _weightsFeatureBuf.get();
-    auto nSamplesPerClass = _samplesPerClassBuf.get();
+    const size_t nStride = histogramWidth();
 
     {
         for (size_t i = 0; i < n; ++i)
         {
-            const IndexType iSample = aIdx[i];
-            const auto & r          = aResponse[aIdx[i]];
-            const BinIndexType idx  = binIndex[r.idx];
-            ++nFeatIdx[idx];
+            const IndexType iSample     = aIdx[i];
+            const auto & r              = aResponse[aIdx[i]];
+            algorithmFPType * binHist   = hist + binIndex[r.idx] * nStride;
             const auto weights          = aWeights[iSample].val;
             const ClassIndexType iClass = r.val;
-            featWeights[idx] += weights; //use for calculate leftWeights
-            nSamplesPerClass[idx * _nClasses + iClass] += weights;
+            binHist[_nClasses] += one;
+            binHist[_nClasses + 1] += weights; //use for calculate leftWeights
+            binHist[iClass] += weights;
         }
     }
 }
 
 template <typename algorithmFPType, CpuType cpu>
-int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitbyHistDefault(int nDiffFeatMax, size_t n, size_t nMinSplitPart,
-                                                                          const ImpurityData & curImpurity, TSplitData & split,
+int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitbyHistDefault(const algorithmFPType * hist, int nDiffFeatMax, size_t n,
+                                                                          size_t nMinSplitPart, const ImpurityData & curImpurity, TSplitData & split,
                                                                           const algorithmFPType minWeightLeaf,
                                                                           const algorithmFPType totalWeights) const
 {
-    auto nFeatIdx         = _idxFeatureBuf.get();
-    auto featWeights      = _weightsFeatureBuf.get();
-    auto nSamplesPerClass = _samplesPerClassBuf.get();
+    const size_t nStride = histogramWidth();
 
     algorithmFPType bestImpDecrease =
         split.impurityDecrease < 0 ? split.impurityDecrease : totalWeights * (split.impurityDecrease + algorithmFPType(1.) - curImpurity.var);
 
     //init histogram for the left part
-    _histLeft.setAll(0);
-    auto histLeft               = _histLeft.get();
+    Histogramm & histLeftBuf = workBuffers().histLeft;
+    histLeftBuf.setAll(0);
+    auto histLeft               = histLeftBuf.get();
     size_t nLeft                = 0;
     algorithmFPType leftWeights = 0.;
     int idxFeatureBestSplit     = -1; //index of best feature value in the array of sorted feature values
     for (size_t i = 0; i < nDiffFeatMax; ++i)
     {
-        if (!nFeatIdx[i]) continue;
-        algorithmFPType thisFeatWeights = featWeights[i];
+        const algorithmFPType * binHist = hist + i * nStride;
+        const size_t thisNFeatIdx       = size_t(binHist[_nClasses]);
+        if (!thisNFeatIdx) continue;
+        algorithmFPType thisFeatWeights = binHist[_nClasses + 1];
 
-        nLeft       = (split.featureUnordered ? nFeatIdx[i] : nLeft + nFeatIdx[i]);
+        nLeft       = (split.featureUnordered ? thisNFeatIdx : nLeft + thisNFeatIdx);
         leftWeights = (split.featureUnordered ? thisFeatWeights : leftWeights + thisFeatWeights);
         if ((nLeft == n) //last split
             || ((n - nLeft) < nMinSplitPart) || ((totalWeights - leftWeights) < minWeightLeaf))
@@ -643,7 +683,7 @@ int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitbyHistDefault(int nD
         {
             PRAGMA_IVDEP
             PRAGMA_VECTOR_ALWAYS
-            for (size_t iClass = 0; iClass < _nClasses; ++iClass) histLeft[iClass] += nSamplesPerClass[i * _nClasses + iClass];
+            for (size_t iClass = 0; iClass < _nClasses; ++iClass) histLeft[iClass] += binHist[iClass];
         }
         if ((nLeft < nMinSplitPart) || leftWeights < minWeightLeaf) continue;
 
@@ -652,7 +692,7 @@ int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitbyHistDefault(int nD
             PRAGMA_IVDEP
             PRAGMA_VECTOR_ALWAYS
             //one against others
-            for (size_t iClass = 0; iClass < _nClasses; ++iClass) histLeft[iClass] = nSamplesPerClass[i * _nClasses + iClass];
+            for (size_t iClass = 0; iClass < _nClasses; ++iClass) histLeft[iClass] = binHist[iClass];
         }
 
         auto histTotal           = curImpurity.hist.get();
@@ -670,7 +710,7 @@ int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitbyHistDefault(int nD
         const algorithmFPType decrease = sumLeft / leftWeights + sumRight / (totalWeights - leftWeights);
         if (decrease > bestImpDecrease)
         {
-            split.left.hist     = _histLeft;
+            split.left.hist     = histLeftBuf;
             split.left.var      = sumLeft;
             split.nLeft         = nLeft;
             split.leftWeights   = leftWeights;
@@ -689,36 +729,37 @@ int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitbyHistDefault(int nD
 
 template <typename algorithmFPType, CpuType cpu>
 template <int K, bool noWeights>
-int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitFewClasses(int nDiffFeatMax, size_t n, size_t nMinSplitPart,
+int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitFewClasses(const algorithmFPType * hist, int nDiffFeatMax, size_t n, size_t nMinSplitPart,
                                                                        const ImpurityData & curImpurity, TSplitData & split,
                                                                        const algorithmFPType minWeightLeaf, const algorithmFPType totalWeights) const
 {
-    auto nSamplesPerClass = _samplesPerClassBuf.get();
-    auto nFeatIdx         = _idxFeatureBuf.get();
+    const size_t nStride = K + 2;
 
     algorithmFPType bestImpDecrease =
         split.impurityDecrease < 0 ? split.impurityDecrease : totalWeights * (split.impurityDecrease + algorithmFPType(1.) - curImpurity.var);
 
     //init histogram for the left part
-    _histLeft.setAll(0);
-    auto histLeft               = _histLeft.get();
+    Histogramm & histLeftBuf = workBuffers().histLeft;
+    histLeftBuf.setAll(0);
+    auto histLeft               = histLeftBuf.get();
     size_t nLeft                = 0;
     algorithmFPType leftWeights = 0.;
     int idxFeatureBestSplit     = -1; //index of best feature value in the array of sorted feature values
     for (size_t i = 0; i < nDiffFeatMax; ++i)
     {
+        const algorithmFPType * binHist = hist + i * nStride;
         algorithmFPType thisNFeatIdx(0);
         if (noWeights)
         {
             for (size_t iClass = 0; iClass < K; ++iClass)
             {
-                thisNFeatIdx += nSamplesPerClass[i * K + iClass];
+                thisNFeatIdx += binHist[iClass];
             }
         }
 
         else
         {
-            thisNFeatIdx = nFeatIdx[i];
+            thisNFeatIdx = binHist[K];
         }
 
         if (!thisNFeatIdx) continue;
@@ -732,7 +773,7 @@ int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitFewClasses(int nDiff
         {
             for (size_t iClass = 0; iClass < K; ++iClass)
             {
-                thisFeatWeights += nSamplesPerClass[i * K + iClass];
+                thisFeatWeights += binHist[iClass];
             }
         }
 
@@ -744,13 +785,13 @@ int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitFewClasses(int nDiff
 
         if (!split.featureUnordered)
         {
-            for (size_t iClass = 0; iClass < K; ++iClass) histLeft[iClass] += nSamplesPerClass[i * K + iClass];
+            for (size_t iClass = 0; iClass < K; ++iClass) histLeft[iClass] += binHist[iClass];
         }
         if ((nLeft < nMinSplitPart) || leftWeights < minWeightLeaf) continue;
 
         if (split.featureUnordered)
         {
-            for (size_t iClass = 0; iClass < K; ++iClass) histLeft[iClass] = nSamplesPerClass[i * K + iClass];
+            for (size_t iClass = 0; iClass < K; ++iClass) histLeft[iClass] = binHist[iClass];
         }
 
         auto histTotal           = curImpurity.hist.get();
@@ -767,7 +808,7 @@ int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitFewClasses(int nDiff
         const algorithmFPType decrease = sumLeft / leftWeights + sumRight / (totalWeights - leftWeights);
         if (decrease > bestImpDecrease)
         {
-            split.left.hist     = _histLeft;
+            split.left.hist     = histLeftBuf;
             split.left.var      = sumLeft;
             split.nLeft         = nLeft;
             split.leftWeights   = leftWeights;
@@ -786,65 +827,79 @@ int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitFewClasses(int nDiff
 
 template <typename algorithmFPType, CpuType cpu>
 template <bool noWeights>
-int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitFewClassesDispatch(int nDiffFeatMax, size_t n, size_t nMinSplitPart,
-                                                                               const ImpurityData & curImpurity, TSplitData & split,
-                                                                               const algorithmFPType minWeightLeaf,
+int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitFewClassesDispatch(const algorithmFPType * hist, int nDiffFeatMax, size_t n,
+                                                                               size_t nMinSplitPart, const ImpurityData & curImpurity,
+                                                                               TSplitData & split, const algorithmFPType minWeightLeaf,
                                                                                const algorithmFPType totalWeights) const
 {
     DAAL_ASSERT(_nClasses <= _nClassesThreshold);
     switch (_nClasses)
     {
-    case 2: return findBestSplitFewClasses<2, noWeights>(nDiffFeatMax, n, nMinSplitPart, curImpurity, split, minWeightLeaf, totalWeights);
-    case 3: return findBestSplitFewClasses<3, noWeights>(nDiffFeatMax, n, nMinSplitPart, curImpurity, split, minWeightLeaf, totalWeights);
-    case 4: return findBestSplitFewClasses<4, noWeights>(nDiffFeatMax, n, nMinSplitPart, curImpurity, split, minWeightLeaf, totalWeights);
-    case 5: return findBestSplitFewClasses<5, noWeights>(nDiffFeatMax, n, nMinSplitPart, curImpurity, split, minWeightLeaf, totalWeights);
-    case 6: return findBestSplitFewClasses<6, noWeights>(nDiffFeatMax, n, nMinSplitPart, curImpurity, split, minWeightLeaf, totalWeights);
-    case 7: return findBestSplitFewClasses<7, noWeights>(nDiffFeatMax, n, nMinSplitPart, curImpurity, split, minWeightLeaf, totalWeights);
-    case 8: return findBestSplitFewClasses<8, noWeights>(nDiffFeatMax, n, nMinSplitPart, curImpurity, split, minWeightLeaf, totalWeights);
+    case 2: return findBestSplitFewClasses<2, noWeights>(hist, nDiffFeatMax, n, nMinSplitPart, curImpurity, split, minWeightLeaf, totalWeights);
+    case 3: return findBestSplitFewClasses<3, noWeights>(hist, nDiffFeatMax, n, nMinSplitPart, curImpurity, split, minWeightLeaf, totalWeights);
+    case 4: return findBestSplitFewClasses<4, noWeights>(hist, nDiffFeatMax, n, nMinSplitPart, curImpurity, split, minWeightLeaf, totalWeights);
+    case 5: return findBestSplitFewClasses<5, noWeights>(hist, nDiffFeatMax, n, nMinSplitPart, curImpurity, split, minWeightLeaf, totalWeights);
+    case 6: return findBestSplitFewClasses<6, noWeights>(hist, nDiffFeatMax, n, nMinSplitPart, curImpurity, split, minWeightLeaf, totalWeights);
+    case 7: return findBestSplitFewClasses<7, noWeights>(hist, nDiffFeatMax, n, nMinSplitPart, curImpurity, split, minWeightLeaf, totalWeights);
+    case 8: return findBestSplitFewClasses<8, noWeights>(hist, nDiffFeatMax, n, nMinSplitPart, curImpurity, split, minWeightLeaf, totalWeights);
     }
     return -1;
 }
 
 template <typename algorithmFPType, CpuType cpu>
 template <typename BinIndexType>
-int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(algorithmFPType * featureBuf, IndexType iFeature, const IndexType * aIdx,
-                                                                             size_t n, size_t nMinSplitPart, const ImpurityData & curImpurity,
-                                                                             TSplitData & split, const algorithmFPType minWeightLeaf,
-                                                                             const algorithmFPType totalWeights, const BinIndexType * binIndex) const
+void UnorderedRespHelper<algorithmFPType, cpu>::computeHistogram(IndexType iFeature, const IndexType * aIdx, const BinIndexType * binIndex, size_t n,
+                                                                 algorithmFPType * hist) const
 {
-    const auto nDiffFeatMax = this->indexedFeatures().numIndices(iFeature);
-    _samplesPerClassBuf.setValues(nClasses() * nDiffFeatMax, 0);
-
-    int idxFeatureBestSplit = -1; //index of best feature value in the array of sorted feature values
+    const size_t nHist = this->indexedFeatures().numIndices(iFeature) * histogramWidth();
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t i = 0; i < nHist; ++i) hist[i] = algorithmFPType(0);
 
     if (_nClasses <= _nClassesThreshold)
     {
         if (!this->_weights)
         {
-            // nSamplesPerClass - computed. nFeatIdx and featWeights - no
-            computeHistFewClassesWithoutWeights(iFeature, aIdx, binIndex, n);
-            idxFeatureBestSplit =
-                findBestSplitFewClassesDispatch<true>(nDiffFeatMax, n, nMinSplitPart, curImpurity, split, minWeightLeaf, totalWeights);
+            // sums of classes - computed, number of observations and their weights - no
+            computeHistFewClassesWithoutWeights(hist, aIdx, binIndex, n);
         }
         else
         {
-            // nSamplesPerClass and nFeatIdx - computed, featWeights - no
-            _idxFeatureBuf.setValues(nDiffFeatMax, algorithmFPType(0));
-            computeHistFewClassesWithWeights(iFeature, aIdx, binIndex, n);
-            idxFeatureBestSplit =
-                findBestSplitFewClassesDispatch<false>(nDiffFeatMax, n, nMinSplitPart, curImpurity, split, minWeightLeaf, totalWeights);
+            // sums of classes and number of observations - computed, weights - no
+            computeHistFewClassesWithWeights(hist, aIdx, binIndex, n);
         }
     }
     else
     {
-        // nSamplesPerClass, nFeatIdx and featWeights - computed
-        _weightsFeatureBuf.setValues(nDiffFeatMax, algorithmFPType(0));
-        _idxFeatureBuf.setValues(nDiffFeatMax, algorithmFPType(0));
-        computeHistManyClasses(iFeature, aIdx, binIndex, n);
-        idxFeatureBestSplit = findBestSplitbyHistDefault(nDiffFeatMax, n, nMinSplitPart, curImpurity, split, minWeightLeaf, totalWeights);
+        // sums of classes, number of observations and their weights - computed
+        computeHistManyClasses(hist, aIdx, binIndex, n);
     }
+}
 
-    return idxFeatureBestSplit;
+template <typename algorithmFPType, CpuType cpu>
+int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitByHistogram(IndexType iFeature, const algorithmFPType * hist, size_t n,
+                                                                        size_t nMinSplitPart, const ImpurityData & curImpurity, TSplitData & split,
+                                                                        const algorithmFPType minWeightLeaf, const algorithmFPType totalWeights) const
+{
+    const auto nDiffFeatMax = this->indexedFeatures().numIndices(iFeature);
+    if (_nClasses <= _nClassesThreshold)
+    {
+        return !this->_weights ?
+                   findBestSplitFewClassesDispatch<true>(hist, nDiffFeatMax, n, nMinSplitPart, curImpurity, split, minWeightLeaf, totalWeights) :
+                   findBestSplitFewClassesDispatch<false>(hist, nDiffFeatMax, n, nMinSplitPart, curImpurity, split, minWeightLeaf, totalWeights);
+    }
+    return findBestSplitbyHistDefault(hist, nDiffFeatMax, n, nMinSplitPart, curImpurity, split, minWeightLeaf, totalWeights);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+template <typename BinIndexType>
+int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(IndexType iFeature, const IndexType * aIdx, size_t n,
+                                                                             size_t nMinSplitPart, const ImpurityData & curImpurity,
+                                                                             TSplitData & split, const algorithmFPType minWeightLeaf,
+                                                                             const algorithmFPType totalWeights, const BinIndexType * binIndex) const
+{
+    algorithmFPType * hist = workBuffers().hist.get();
+    computeHistogram(iFeature, aIdx, binIndex, n, hist);
+    return findBestSplitByHistogram(iFeature, hist, n, nMinSplitPart, curImpurity, split, minWeightLeaf, totalWeights);
 }
 
 template <typename algorithmFPType, CpuType cpu>
@@ -27,6 +27,7 @@
 
 #include "src/algorithms/dtrees/dtrees_train_data_helper.i"
 #include "src/threading/threading.h"
+#include "src/algorithms/service_threading.h"
 #include "src/algorithms/dtrees/dtrees_model_impl.h"
 #include "src/algorithms/engines/engine_types_internal.h"
 #include "src/algorithms/service_heap.h"
@@ -379,17 +380,21 @@ services::Status computeImpl(HostAppIface * pHostApp, const NumericTable * x, co
         //initialize its data
         daal::services::internal::service_memset<algorithmFPType, cpu>(mainCtx.varImp, 0, nFeatures);
 
-    //use tls in case of multiple threads
+    //use local storage in case of multiple threads
+    //a task is used exclusively by one tree since a thread waiting for the subtrees of its tree can start building another one
     const bool bThreaded = (threader_get_max_threads_number() > 1) && (par.nTrees > 1);
-    daal::tls<Ctx *> tlsCtx([&]() -> Ctx * {
+    daal::ls<TaskType *> lsTask([&]() -> TaskType * {
         //in case of single thread no need to allocate
-        return (bThreaded ? createTlsContext<algorithmFPType, cpu, Ctx>(x, par, nClasses) : &mainCtx);
-    });
-    daal::tls<TaskType *> tlsTask([&]() -> TaskType * {
-        //in case of single thread no need to allocate
-        Ctx * ctx = tlsCtx.local();
-        return ctx ? new TaskType(pHostApp, x, y, w, par, featTypes, par.memorySavingMode ? nullptr : &indexedFeatures, binIndex, *ctx, nClasses) :
-                     nullptr;
+        Ctx * ctx = (bThreaded ? createTlsContext<algorithmFPType, cpu, Ctx>(x, par, nClasses) : &mainCtx);
+        if (!ctx) return nullptr;
+        TaskType * task =
+            new TaskType(pHostApp, x, y, w, par, featTypes, par.memorySavingMode ? nullptr : &indexedFeatures, binIndex, *ctx, nClasses);
+        if (!task && bThreaded)
+        {
+            ctx->~Ctx();
+            service_scalable_free<byte, cpu>((byte *)ctx);
+        }
+        return task;
     });
 
     engines::internal::ParallelizationTechnique technique = engines::internal::family;
@@ -409,8 +414,9 @@ services::Status computeImpl(HostAppIface * pHostApp, const NumericTable * x, co
     daal::SafeStatus safeStat;
     daal::threader_for(par.nTrees, par.nTrees, [&](size_t i) {
         if (!safeStat.ok()) return;
-        TaskType * task = tlsTask.local();
+        TaskType * task = lsTask.local();
         DAAL_CHECK_MALLOC_THR(task);
+        DAAL_LS_RELEASE(TaskType, lsTask, task); //releases local storage when leaving this scope
         dtrees::internal::Tree * pTree = nullptr;
         numElems[i]                    = 0;
         auto engineImpl                = dynamic_cast<engines::internal::BatchBaseImpl *>(engines[i].get());
@@ -423,18 +429,17 @@ services::Status computeImpl(HostAppIface * pHostApp, const NumericTable * x, co
         }
     });
     s = safeStat.detach();
-    tlsCtx.reduce([&](Ctx * ctx) -> void {
-        if (ctx && bThreaded)
+    lsTask.reduce([&](TaskType * task) -> void {
+        if (!task) return;
+        Ctx * ctx = static_cast<Ctx *>(&task->threadCtx());
+        delete task;
+        if (bThreaded)
         {
             ctx->reduceTo(par.varImportance, mainCtx, nFeatures, nRows);
             ctx->~Ctx();
             service_scalable_free<byte, cpu>((byte *)ctx);
         }
     });
-    tlsTask.parallel_reduce([&](TaskType * task) -> void {
-        delete task;
-        task = nullptr;
-    });
     DAAL_CHECK_STATUS_VAR(s);
     DAAL_CHECK_MALLOC(md.size() == par.nTrees);
 
@@ -467,6 +472,7 @@ class TrainBatchTaskBase
 public:
     typedef TreeThreadCtxBase<algorithmFPType, cpu> ThreadCtxType;
     services::Status run(engines::internal::BatchBaseImpl * engineImpl, dtrees::internal::Tree *& pTree, size_t & numElems);
+    ThreadCtxType & threadCtx() { return _threadCtx; }
 
 protected:
     typedef dtrees::internal::TVector<algorithmFPType, cpu> algorithmFPTypeArray;
@@ -492,7 +498,12 @@ protected:
           _minSamplesSplit(2),
           _minWeightLeaf(0.),
           _minImpurityDecrease(-daal::services::internal::EpsilonVal<algorithmFPType>::get() * x->getNumberOfRows()),
-          _maxLeafNodes(0)
+          _maxLeafNodes(0),
+          _histBlockSize(0),
+          _maxHistBlocks(0),
+          _bHistSubtraction(false),
+          _bParallelSubtrees(false),
+          _bParallelFeatures(false)
     {
         if (_impurityThreshold < _accuracy) _impurityThreshold = _accuracy;
 
@@ -529,7 +540,8 @@ protected:
     size_t nFeatures() const { return _data->getNumberOfColumns(); }
     typename DataHelper::NodeType::Base * buildDepthFirst(services::Status & s, size_t iStart, size_t n, size_t level,
                                                           typename DataHelper::ImpurityData & curImpurity, bool & bUnorderedFeaturesUsed,
-                                                          size_t nClasses, algorithmFPType totalWeights);
+                                                          size_t nClasses, algorithmFPType totalWeights, const algorithmFPType * hist,
+                                                          size_t nHistBlocks);
     typename DataHelper::NodeType::Base * buildBestFirst(services::Status & s, size_t iStart, size_t n, size_t level,
                                                          typename DataHelper::ImpurityData & curImpurity, bool & bUnorderedFeaturesUsed,
                                                          size_t nClasses, algorithmFPType totalWeights);
@@ -560,18 +572,24 @@ protected:
             return (nSamples < 2 * _par.minObservationsInLeafNode || _helper.terminateCriteria(imp, _impurityThreshold, nSamples)
                     || ((_par.maxTreeDepth > 0) && (level >= _par.maxTreeDepth)));
     }
-    ThreadCtxType & threadCtx() { return _threadCtx; }
     typename DataHelper::NodeType::Split * makeSplit(size_t iFeature, algorithmFPType featureValue, bool bUnordered,
                                                      typename DataHelper::NodeType::Base * left, typename DataHelper::NodeType::Base * right,
                                                      algorithmFPType imp);
     typename DataHelper::NodeType::Leaf * makeLeaf(const IndexType * idx, size_t n, typename DataHelper::ImpurityData & imp, size_t makeLeaf);
+    void deleteSubtree(typename DataHelper::NodeType::Base * node);
+    bool isCancelled(services::Status & s, size_t n)
+    {
+        if (!_bParallelSubtrees) return _hostApp.isCancelled(s, n);
+        AUTOLOCK(_mtTree);
+        return _hostApp.isCancelled(s, n);
+    }
 
     bool findBestSplit(size_t iStart, size_t n, const typename DataHelper::ImpurityData & curImpurity, IndexType & iBestFeature,
-                       typename DataHelper::TSplitData & split, algorithmFPType totalWeights);
+                       typename DataHelper::TSplitData & split, algorithmFPType totalWeights, const algorithmFPType * hist);
     bool findBestSplitSerial(size_t iStart, size_t n, const typename DataHelper::ImpurityData & curImpurity, IndexType & iBestFeature,
-                             typename DataHelper::TSplitData & split, algorithmFPType totalWeights);
+                             typename DataHelper::TSplitData & split, algorithmFPType totalWeights, const algorithmFPType * hist);
     bool findBestSplitThreaded(size_t iStart, size_t n, const typename DataHelper::ImpurityData & curImpurity, IndexType & iBestFeature,
-                               typename DataHelper::TSplitData & split, algorithmFPType totalWeights);
+                               typename DataHelper::TSplitData & split, algorithmFPType totalWeights, const algorithmFPType * hist);
     bool simpleSplit(size_t iStart, const typename DataHelper::ImpurityData & curImpurity, IndexType & iFeatureBest,
                      typename DataHelper::TSplitData & split);
     void addImpurityDecrease(IndexType iFeature, size_t n, const typename DataHelper::ImpurityData & curImpurity,
@@ -587,21 +605,27 @@ protected:
     void chooseFeatures()
     {
         const size_t n = nFeatures();
-        if (n == _nFeaturesPerNode)
-        {
-            PRAGMA_IVDEP
-            PRAGMA_VECTOR_ALWAYS
-            for (size_t i = 0; i < n; ++i) _aFeatureIdx[i] = i;
-        }
-        else
-        {
-            *_numElems += n;
-            RNGs<IndexType, cpu> rng;
-            rng.uniformWithoutReplacement(_nFeaturesPerNode, _aFeatureIdx.get(), _aFeatureIdx.get() + _nFeaturesPerNode, _engineImpl->getState(), 0,
-                                          n);
-        }
+        if (n == _nFeaturesPerNode) return; //all features are used, _aFeatureIdx is filled once in run()
+
+        *_numElems += n;
+        RNGs<IndexType, cpu> rng;
+        rng.uniformWithoutReplacement(_nFeaturesPerNode, _aFeatureIdx.get(), _aFeatureIdx.get() + _nFeaturesPerNode, _engineImpl->getState(), 0, n);
+    }
+
+    //check if the split for the feature is found using its indexed (binned) values
+    bool useIndexedFeature(size_t n, size_t iFeature) const
+    {
+        const float qMax = 0.02; //min fracture of observations to be handled as indexed feature values
+        return (!_par.memorySavingMode) && (float(n) > qMax * float(_helper.indexedFeatures().numIndices(iFeature)));
     }
 
+    //compute the histograms of the indexed features of the node.
+    //The histograms are computed for the features indexed in the node of nForNode observations
+    void computeHistograms(const IndexType * aIdx, size_t n, size_t nForNode, algorithmFPType * hist);
+    //compute the histograms of the smaller child and get the ones of the bigger child by subtraction from the parent histograms
+    void computeHistogramsBySubtraction(const IndexType * aIdxSmaller, size_t nSmaller, size_t nBigger, const algorithmFPType * hist,
+                                        algorithmFPType * histSmaller, algorithmFPType * histBigger);
+
     services::Status computeResults(const dtrees::internal::Tree & t);
 
     algorithmFPType computeOOBError(const dtrees::internal::Tree & t, size_t n, const IndexType * aInd);
@@ -644,6 +668,19 @@ protected:
     algorithmFPType _minWeightLeaf;
     algorithmFPType _minImpurityDecrease;
     size_t _maxLeafNodes;
+
+    TArray<size_t, cpu> _histOffsets; //offsets of the histograms of the features in the block of histograms of a node
+    size_t _histBlockSize;            //size of the block of histograms of all the features of a node
+    size_t _maxHistBlocks;            //max number of blocks of histograms kept at the same time while the tree is built
+    bool _bHistSubtraction;           //histograms of the bigger child are obtained by subtraction from the parent ones
+    bool _bParallelSubtrees;          //subtrees of a node are built in parallel
+    bool _bParallelFeatures;          //features of a node are processed in parallel
+    daal::Mutex _mtTree;              //guards tree allocator and thread context when subtrees are built in parallel
+
+    static const size_t _minSamplesParallelSubtree  = 2048;             //min number of observations in a subtree built by a separate task
+    static const size_t _minSamplesParallelFeatures = 4096;             //min number of observations in a node to process its features in parallel
+    static const size_t _maxHistBlocksPerTree       = 64;               //max number of blocks of histograms kept by a tree at the same time
+    static const size_t _maxHistMemory              = size_t(64) << 20; //max size in bytes of the histograms kept by a tree at the same time
 };
 
 template <typename algorithmFPType, typename BinIndexType, typename DataHelper, CpuType cpu>
@@ -661,6 +698,36 @@ services::Status TrainBatchTaskBase<algorithmFPType, BinIndexType, DataHelper, c
 
     DAAL_CHECK_MALLOC(_aSample.get() && _helper.reset(_nSamples) && _helper.resetWeights(_nSamples) && _aFeatureBuf.get() && _aFeatureIndexBuf.get()
                       && _aFeatureIdx.get());
+    if (_nFeaturesPerNode == nFeatures())
+    {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < _nFeaturesPerNode; ++i) _aFeatureIdx[i] = i;
+    }
+
+    const bool bThreaded = (threader_get_max_threads_number() > 1);
+    _bParallelFeatures   = bThreaded && (_nFeaturesPerNode > 1);
+    //subtrees can be built in any order only if the nodes do not use the engine,
+    //i.e. all the features are checked in every node and the nodes of 2 observations are not split
+    _bParallelSubtrees = bThreaded && !_maxLeafNodes && (_nFeaturesPerNode == nFeatures())
+                         && ((_par.minObservationsInLeafNode > 1) || (_minSamplesSplit > 2));
+    //the histograms of the parent node are known for all the features only if all of them are checked in every node
+    _bHistSubtraction = !_par.memorySavingMode && _binIndex && !_maxLeafNodes && (_nFeaturesPerNode == nFeatures());
+    if (_bHistSubtraction)
+    {
+        _histOffsets.reset(nFeatures());
+        DAAL_CHECK_MALLOC(_histOffsets.get());
+        _histBlockSize = 0;
+        for (size_t i = 0; i < nFeatures(); ++i)
+        {
+            _histOffsets[i] = _histBlockSize;
+            _histBlockSize += _helper.indexedFeatures().numIndices(i) * _helper.histogramWidth();
+        }
+        const size_t blockBytes = (_histBlockSize ? _histBlockSize : 1) * sizeof(algorithmFPType);
+        _maxHistBlocks          = services::internal::min<cpu, size_t>(_maxHistBlocksPerTree, _maxHistMemory / blockBytes);
+        //the root and the two children of a node need at least 3 blocks
+        _bHistSubtraction = (_maxHistBlocks >= 3);
+    }
 
     //allocate temporary bufs
 
@@ -709,11 +776,19 @@ services::Status TrainBatchTaskBase<algorithmFPType, BinIndexType, DataHelper, c
     {
         _helper.template calcImpurity<false>(_aSample.get(), _nSamples, initialImpurity, totalWeights);
     }
+    TArrayScalable<algorithmFPType, cpu> rootHist;
+    if (_bHistSubtraction)
+    {
+        rootHist.reset(_histBlockSize);
+        DAAL_CHECK_MALLOC(rootHist.get());
+        computeHistograms(_aSample.get(), _nSamples, _nSamples, rootHist.get());
+    }
     bool bUnorderedFeaturesUsed = false;
     services::Status s;
     typename DataHelper::NodeType::Base * nd =
         _maxLeafNodes ? buildBestFirst(s, 0, _nSamples, 0, initialImpurity, bUnorderedFeaturesUsed, _nClasses, totalWeights) :
-                        buildDepthFirst(s, 0, _nSamples, 0, initialImpurity, bUnorderedFeaturesUsed, _nClasses, totalWeights);
+                        buildDepthFirst(s, 0, _nSamples, 0, initialImpurity, bUnorderedFeaturesUsed, _nClasses, totalWeights, rootHist.get(),
+                                        _bHistSubtraction ? _maxHistBlocks - 1 : 0);
     if (nd)
     {
         //to prevent memory leak in case of general allocator
@@ -732,7 +807,15 @@ typename DataHelper::NodeType::Split * TrainBatchTaskBase<algorithmFPType, BinIn
     size_t iFeature, algorithmFPType featureValue, bool bUnordered, typename DataHelper::NodeType::Base * left,
     typename DataHelper::NodeType::Base * right, algorithmFPType imp)
 {
-    typename DataHelper::NodeType::Split * pNode = _tree.allocator().allocSplit();
+    typename DataHelper::NodeType::Split * pNode = nullptr;
+    if (_bParallelSubtrees)
+    {
+        _mtTree.lock();
+        pNode = _tree.allocator().allocSplit();
+        _mtTree.unlock();
+    }
+    else
+        pNode = _tree.allocator().allocSplit();
     pNode->set(iFeature, featureValue, bUnordered);
     pNode->kid[0]   = left;
     pNode->kid[1]   = right;
@@ -744,23 +827,78 @@ template <typename algorithmFPType, typename BinIndexType, typename DataHelper,
 typename DataHelper::NodeType::Leaf * TrainBatchTaskBase<algorithmFPType, BinIndexType, DataHelper, cpu>::makeLeaf(
     const IndexType * idx, size_t n, typename DataHelper::ImpurityData & imp, size_t nClasses)
 {
-    typename DataHelper::NodeType::Leaf * pNode = _tree.allocator().allocLeaf(_nClasses);
+    typename DataHelper::NodeType::Leaf * pNode = nullptr;
+    if (_bParallelSubtrees)
+    {
+        _mtTree.lock();
+        pNode = _tree.allocator().allocLeaf(_nClasses);
+        _mtTree.unlock();
+    }
+    else
+        pNode = _tree.allocator().allocLeaf(_nClasses);
     _helper.setLeafData(*pNode, idx, n, imp);
     return pNode;
 }
 
+template <typename algorithmFPType, typename BinIndexType, typename DataHelper, CpuType cpu>
+void TrainBatchTaskBase<algorithmFPType, BinIndexType, DataHelper, cpu>::deleteSubtree(typename DataHelper::NodeType::Base * node)
+{
+    if (_bParallelSubtrees)
+    {
+        AUTOLOCK(_mtTree);
+        dtrees::internal::deleteNode<typename DataHelper::NodeType, typename DataHelper::TreeType::Allocator>(node, _tree.allocator());
+    }
+    else
+        dtrees::internal::deleteNode<typename DataHelper::NodeType, typename DataHelper::TreeType::Allocator>(node, _tree.allocator());
+}
+
+template <typename algorithmFPType, typename BinIndexType, typename DataHelper, CpuType cpu>
+void TrainBatchTaskBase<algorithmFPType, BinIndexType, DataHelper, cpu>::computeHistograms(const IndexType * aIdx, size_t n, size_t nForNode,
+                                                                                           algorithmFPType * hist)
+{
+    const size_t nRows = _data->getNumberOfRows();
+    auto computeForFeature = [&](size_t iFeature) -> void {
+        if (useIndexedFeature(nForNode, iFeature))
+            _helper.computeHistogram(iFeature, aIdx, _binIndex + nRows * iFeature, n, hist + _histOffsets[iFeature]);
+    };
+    if (_bParallelFeatures && (n >= _minSamplesParallelFeatures))
+        daal::threader_for(nFeatures(), nFeatures(), [&](size_t iFeature) { computeForFeature(iFeature); });
+    else
+        for (size_t iFeature = 0; iFeature < nFeatures(); ++iFeature) computeForFeature(iFeature);
+}
+
+template <typename algorithmFPType, typename BinIndexType, typename DataHelper, CpuType cpu>
+void TrainBatchTaskBase<algorithmFPType, BinIndexType, DataHelper, cpu>::computeHistogramsBySubtraction(const IndexType * aIdxSmaller,
+                                                                                                        size_t nSmaller, size_t nBigger,
+                                                                                                        const algorithmFPType * hist,
+                                                                                                        algorithmFPType * histSmaller,
+                                                                                                        algorithmFPType * histBigger)
+{
+    //features indexed in the bigger child include the ones indexed in the smaller child
+    computeHistograms(aIdxSmaller, nSmaller, nBigger, histSmaller);
+    for (size_t iFeature = 0; iFeature < nFeatures(); ++iFeature)
+    {
+        if (!useIndexedFeature(nBigger, iFeature)) continue;
+        const size_t offset = _histOffsets[iFeature];
+        const size_t nHist  = _helper.indexedFeatures().numIndices(iFeature) * _helper.histogramWidth();
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = offset; i < offset + nHist; ++i) histBigger[i] = hist[i] - histSmaller[i];
+    }
+}
+
 template <typename algorithmFPType, typename BinIndexType, typename DataHelper, CpuType cpu>
 typename DataHelper::NodeType::Base * TrainBatchTaskBase<algorithmFPType, BinIndexType, DataHelper, cpu>::buildDepthFirst(
     services::Status & s, size_t iStart, size_t n, size_t level, typename DataHelper::ImpurityData & curImpurity, bool & bUnorderedFeaturesUsed,
-    size_t nClasses, algorithmFPType totalWeights)
+    size_t nClasses, algorithmFPType totalWeights, const algorithmFPType * hist, size_t nHistBlocks)
 {
-    if (_hostApp.isCancelled(s, n)) return nullptr;
+    if (isCancelled(s, n)) return nullptr;
 
     if (terminateCriteria(n, level, curImpurity, totalWeights)) return makeLeaf(_aSample.get() + iStart, n, curImpurity, nClasses);
 
     typename DataHelper::TSplitData split;
     IndexType iFeature;
-    if (findBestSplit(iStart, n, curImpurity, iFeature, split, totalWeights))
+    if (findBestSplit(iStart, n, curImpurity, iFeature, split, totalWeights, hist))
     {
         const size_t nLeft   = split.nLeft;
         const double imp     = curImpurity.var;
@@ -771,24 +909,88 @@ typename DataHelper::NodeType::Base * TrainBatchTaskBase<algorithmFPType, BinInd
             < _minImpurityDecrease)
             return makeLeaf(_aSample.get() + iStart, n, curImpurity, nClasses);
         if (_par.varImportance == training::MDI) addImpurityDecrease(iFeature, n, curImpurity, split);
-        typename DataHelper::NodeType::Base * left =
-            buildDepthFirst(s, iStart, split.nLeft, level + 1, split.left, bUnorderedFeaturesUsed, nClasses, split.leftWeights);
+
+        //split keeps the data of the right child from now on
+        typename DataHelper::ImpurityData leftImpurity;
+        leftImpurity                      = split.left;
+        const algorithmFPType leftWeights = split.leftWeights;
         _helper.convertLeftImpToRight(n, curImpurity, split);
-        typename DataHelper::NodeType::Base * right =
-            s.ok() ? buildDepthFirst(s, iStart + nLeft, split.nLeft, level + 1, split.left, bUnorderedFeaturesUsed, nClasses, split.leftWeights) :
-                     nullptr;
+        const size_t nRight = split.nLeft;
+
+        //histograms of the children, the ones of the bigger child are obtained by subtraction.
+        //nHistBlocks is the number of blocks of histograms the subtree may keep at the same time besides hist.
+        //It depends on the structure of the tree only, so the memory is capped and the choice of the nodes
+        //that use histograms does not depend on the order in which subtrees are built
+        TArrayScalable<algorithmFPType, cpu> leftHist;
+        TArrayScalable<algorithmFPType, cpu> rightHist;
+        algorithmFPType * histLeft  = nullptr;
+        algorithmFPType * histRight = nullptr;
+        if (hist && (nHistBlocks >= 2))
+        {
+            const bool bLeftBigger = (nLeft >= nRight);
+            const size_t nBigger   = bLeftBigger ? nLeft : nRight;
+            const bool bBiggerLeaf = bLeftBigger ? terminateCriteria(nLeft, level + 1, leftImpurity, leftWeights) :
+                                                   terminateCriteria(nRight, level + 1, split.left, split.leftWeights);
+            //subtraction is cheaper than computation of the histograms of the bigger child
+            if (!bBiggerLeaf && (nBigger * nFeatures() >= _histBlockSize) && leftHist.reset(_histBlockSize) && rightHist.reset(_histBlockSize))
+            {
+                histLeft  = leftHist.get();
+                histRight = rightHist.get();
+                if (bLeftBigger)
+                    computeHistogramsBySubtraction(_aSample.get() + iStart + nLeft, nRight, nLeft, hist, histRight, histLeft);
+                else
+                    computeHistogramsBySubtraction(_aSample.get() + iStart, nLeft, nRight, hist, histLeft, histRight);
+            }
+        }
+
+        typename DataHelper::NodeType::Base * left  = nullptr;
+        typename DataHelper::NodeType::Base * right = nullptr;
+        //blocks left for the subtrees of the children when the histograms of both children are kept
+        const size_t nChildHistBlocks = histLeft ? nHistBlocks - 2 : nHistBlocks;
+        if (_bParallelSubtrees && (nLeft >= _minSamplesParallelSubtree) && (nRight >= _minSamplesParallelSubtree))
+        {
+            //left subtree is built by a separate task, the children use disjoint parts of the sample and work buffers
+            services::Status sLeft;
+            bool bUnorderedFeaturesUsedLeft = false;
+            auto buildLeft                  = [&]() -> void {
+                if (!_helper.hasWorkBuffers())
+                {
+                    sLeft.add(services::ErrorMemoryAllocationFailed);
+                    return;
+                }
+                left = buildDepthFirst(sLeft, iStart, nLeft, level + 1, leftImpurity, bUnorderedFeaturesUsedLeft, nClasses, leftWeights, histLeft,
+                                       nChildHistBlocks / 2);
+            };
+            daal::task_group taskGroup;
+            taskGroup.run(buildLeft);
+            right = buildDepthFirst(s, iStart + nLeft, nRight, level + 1, split.left, bUnorderedFeaturesUsed, nClasses, split.leftWeights, histRight,
+                                    nChildHistBlocks - nChildHistBlocks / 2);
+            taskGroup.wait();
+            s |= sLeft;
+            bUnorderedFeaturesUsed |= bUnorderedFeaturesUsedLeft;
+        }
+        else
+        {
+            left = buildDepthFirst(s, iStart, nLeft, level + 1, leftImpurity, bUnorderedFeaturesUsed, nClasses, leftWeights, histLeft,
+                                   nChildHistBlocks);
+            //the histograms of the left child are not needed anymore, their block is reused by the right subtree
+            const size_t nRightHistBlocks = histLeft ? nChildHistBlocks + 1 : nChildHistBlocks;
+            leftHist.reset(0);
+            right = s.ok() ? buildDepthFirst(s, iStart + nLeft, nRight, level + 1, split.left, bUnorderedFeaturesUsed, nClasses, split.leftWeights,
+                                             histRight, nRightHistBlocks) :
+                             nullptr;
+        }
         typename DataHelper::NodeType::Base * res = nullptr;
         if (!left || !right || !(res = makeSplit(iFeature, split.featureValue, split.featureUnordered, left, right, curImpurity.var)))
         {
-            if (left) dtrees::internal::deleteNode<typename DataHelper::NodeType, typename DataHelper::TreeType::Allocator>(left, _tree.allocator());
-            if (right)
-                dtrees::internal::deleteNode<typename DataHelper::NodeType, typename DataHelper::TreeType::Allocator>(right, _tree.allocator());
+            if (left) deleteSubtree(left);
+            if (right) deleteSubtree(right);
             return nullptr;
         }
         bUnorderedFeaturesUsed |= bool(split.featureUnordered);
         res->count = n;
         DAAL_ASSERT(nLeft == left->count);
-        DAAL_ASSERT(split.nLeft == right->count);
+        DAAL_ASSERT(nRight == right->count);
         return res;
     }
     return makeLeaf(_aSample.get() + iStart, n, curImpurity, nClasses);
@@ -806,7 +1008,7 @@ typename DataHelper::NodeType::Base * TrainBatchTaskBase<algorithmFPType, BinInd
     {
         return makeLeaf(_aSample.get() + item.start, item.n, impurity, nClasses);
     }
-    else if (findBestSplit(item.start, item.n, impurity, iFeature, split, item.totalWeights))
+    else if (findBestSplit(item.start, item.n, impurity, iFeature, split, item.totalWeights, nullptr))
     {
         const double imp     = impurity.var;
         const double impLeft = split.left.var;
@@ -1009,7 +1211,7 @@ bool TrainBatchTaskBase<algorithmFPType, BinIndexType, DataHelper, cpu>::findBes
                                                                                        const typename DataHelper::ImpurityData & curImpurity,
                                                                                        IndexType & iFeatureBest,
                                                                                        typename DataHelper::TSplitData & split,
-                                                                                       algorithmFPType totalWeights)
+                                                                                       algorithmFPType totalWeights, const algorithmFPType * hist)
 {
     if (n == 2)
     {
@@ -1019,8 +1221,10 @@ bool TrainBatchTaskBase<algorithmFPType, BinIndexType, DataHelper, cpu>::findBes
 #endif
         return simpleSplit(iStart, curImpurity, iFeatureBest, split);
     }
-    if (_nFeatureBufs == 1) return findBestSplitSerial(iStart, n, curImpurity, iFeatureBest, split, totalWeights);
-    return findBestSplitThreaded(iStart, n, curImpurity, iFeatureBest, split, totalWeights);
+    chooseFeatures();
+    if (_bParallelFeatures && (n >= _minSamplesParallelFeatures))
+        return findBestSplitThreaded(iStart, n, curImpurity, iFeatureBest, split, totalWeights, hist);
+    return findBestSplitSerial(iStart, n, curImpurity, iFeatureBest, split, totalWeights, hist);
 }
 
 //find best split and put it to featureIndexBuf
@@ -1029,29 +1233,27 @@ bool TrainBatchTaskBase<algorithmFPType, BinIndexType, DataHelper, cpu>::findBes
                                                                                              const typename DataHelper::ImpurityData & curImpurity,
                                                                                              IndexType & iBestFeature,
                                                                                              typename DataHelper::TSplitData & bestSplit,
-                                                                                             algorithmFPType totalWeights)
+                                                                                             algorithmFPType totalWeights,
+                                                                                             const algorithmFPType * hist)
 {
-    chooseFeatures();
-    const float qMax             = 0.02; //min fracture of observations to be handled as indexed feature values
     IndexType * bestSplitIdx     = featureIndexBuf(0) + iStart;
     IndexType * aIdx             = _aSample.get() + iStart;
     int iBestSplit               = -1;
     int idxFeatureValueBestSplit = -1; //when sorted feature is used
     typename DataHelper::TSplitData split;
-    const float fact = float(n);
     for (size_t i = 0; i < _nFeaturesPerNode; ++i)
     {
-        const auto iFeature            = _aFeatureIdx[i];
-        const bool bUseIndexedFeatures = (!_par.memorySavingMode) && (fact > qMax * float(_helper.indexedFeatures().numIndices(iFeature)));
-
-        if (bUseIndexedFeatures)
+        const auto iFeature = _aFeatureIdx[i];
+        if (useIndexedFeature(n, iFeature))
         {
             if (!_helper.hasDiffFeatureValues(iFeature, aIdx, n)) continue; //all values of the feature are the same
             split.featureUnordered = _featHelper.isUnordered(iFeature);
             //index of best feature value in the array of sorted feature values
             const int idxFeatureValue =
-                _helper.findBestSplitForFeatureSorted(featureBuf(0), iFeature, aIdx, n, _par.minObservationsInLeafNode, curImpurity, split,
-                                                      _minWeightLeaf, totalWeights, _binIndex + _data->getNumberOfRows() * iFeature);
+                hist ? _helper.findBestSplitByHistogram(iFeature, hist + _histOffsets[iFeature], n, _par.minObservationsInLeafNode, curImpurity,
+                                                        split, _minWeightLeaf, totalWeights) :
+                       _helper.findBestSplitForFeatureSorted(iFeature, aIdx, n, _par.minObservationsInLeafNode, curImpurity, split, _minWeightLeaf,
+                                                             totalWeights, _binIndex + _data->getNumberOfRows() * iFeature);
             if (idxFeatureValue < 0) continue;
             iBestSplit = i;
             split.copyTo(bestSplit);
@@ -1127,13 +1329,90 @@ template <typename algorithmFPType, typename BinIndexType, typename DataHelper,
 bool TrainBatchTaskBase<algorithmFPType, BinIndexType, DataHelper, cpu>::findBestSplitThreaded(size_t iStart, size_t n,
                                                                                                const typename DataHelper::ImpurityData & curImpurity,
                                                                                                IndexType & iFeatureBest,
-                                                                                               typename DataHelper::TSplitData & split,
-                                                                                               algorithmFPType totalWeights)
+                                                                                               typename DataHelper::TSplitData & bestSplit,
+                                                                                               algorithmFPType totalWeights,
+                                                                                               const algorithmFPType * hist)
 {
-    chooseFeatures();
+    //best splits of the features and indices of their best feature values: -1 when sorted feature is used, -2 when no split is found
     TArray<typename DataHelper::TSplitData, cpu> aFeatureSplit(_nFeaturesPerNode);
-    //TODO, if parallel for features
-    return false;
+    TArray<int, cpu> aIdxFeatureValue(_nFeaturesPerNode);
+    if (!aFeatureSplit.get() || !aIdxFeatureValue.get())
+        return findBestSplitSerial(iStart, n, curImpurity, iFeatureBest, bestSplit, totalWeights, hist);
+
+    IndexType * aIdx = _aSample.get() + iStart;
+    //buffers of the threads sorting the values of features
+    TlsMem<algorithmFPType, cpu> tlsFeatureBuf(n);
+    TlsMem<IndexType, cpu> tlsIdxBuf(n);
+    daal::SafeStatus safeStat;
+    daal::threader_for(_nFeaturesPerNode, _nFeaturesPerNode, [&](size_t i) {
+        aIdxFeatureValue[i]                     = -2;
+        const auto iFeature                     = _aFeatureIdx[i];
+        typename DataHelper::TSplitData & split = aFeatureSplit[i];
+        split.featureUnordered                  = _featHelper.isUnordered(iFeature);
+        if (useIndexedFeature(n, iFeature))
+        {
+            if (!_helper.hasDiffFeatureValues(iFeature, aIdx, n)) return; //all values of the feature are the same
+            DAAL_CHECK_MALLOC_THR(_helper.hasWorkBuffers());
+            const int idxFeatureValue =
+                hist ? _helper.findBestSplitByHistogram(iFeature, hist + _histOffsets[iFeature], n, _par.minObservationsInLeafNode, curImpurity,
+                                                        split, _minWeightLeaf, totalWeights) :
+                       _helper.findBestSplitForFeatureSorted(iFeature, aIdx, n, _par.minObservationsInLeafNode, curImpurity, split, _minWeightLeaf,
+                                                             totalWeights, _binIndex + _data->getNumberOfRows() * iFeature);
+            if (idxFeatureValue >= 0) aIdxFeatureValue[i] = idxFeatureValue;
+        }
+        else
+        {
+            algorithmFPType * featBuf = tlsFeatureBuf.local();
+            IndexType * idxBuf        = tlsIdxBuf.local();
+            DAAL_CHECK_MALLOC_THR(featBuf && idxBuf);
+            services::internal::tmemcpy<IndexType, cpu>(idxBuf, aIdx, n);
+            featureValuesToBuf(iFeature, featBuf, idxBuf, n);
+            if (featBuf[n - 1] - featBuf[0] <= _accuracy) return; //all values of the feature are the same
+            if (_helper.findBestSplitForFeature(featBuf, idxBuf, n, _par.minObservationsInLeafNode, _accuracy, curImpurity, split, _minWeightLeaf,
+                                                totalWeights))
+                aIdxFeatureValue[i] = -1;
+        }
+    });
+    if (!safeStat.ok()) return findBestSplitSerial(iStart, n, curImpurity, iFeatureBest, bestSplit, totalWeights, hist);
+
+    //the first of the features with the best impurity decrease is chosen, as in serial processing
+    int iBestSplit = -1;
+    for (size_t i = 0; i < _nFeaturesPerNode; ++i)
+    {
+        if (aIdxFeatureValue[i] < -1) continue;
+        if ((iBestSplit < 0) || (aFeatureSplit[i].impurityDecrease > aFeatureSplit[iBestSplit].impurityDecrease)) iBestSplit = i;
+    }
+    if (iBestSplit < 0) return false; //not found
+
+    iFeatureBest = _aFeatureIdx[iBestSplit];
+    aFeatureSplit[iBestSplit].copyTo(bestSplit);
+    IndexType * bestSplitIdx           = featureIndexBuf(0) + iStart;
+    const int idxFeatureValueBestSplit = aIdxFeatureValue[iBestSplit];
+    if (idxFeatureValueBestSplit >= 0)
+    {
+        //sorted feature was used
+        //calculate impurity and get split to bestSplitIdx
+        const BinIndexType * binIndex = _binIndex + _data->getNumberOfRows() * iFeatureBest;
+        if (!_helper.providedWeights())
+            _helper.template finalizeBestSplit<true>(aIdx, binIndex, n, iFeatureBest, idxFeatureValueBestSplit, bestSplit, bestSplitIdx);
+        else
+            _helper.template finalizeBestSplit<false>(aIdx, binIndex, n, iFeatureBest, idxFeatureValueBestSplit, bestSplit, bestSplitIdx);
+        services::internal::tmemcpy<IndexType, cpu>(aIdx, bestSplitIdx, n);
+        return true;
+    }
+
+    //restore the order of observations by the values of the best feature, sorting gives the same order for the same input
+    featureValuesToBuf(iFeatureBest, featureBuf(0) + iStart, aIdx, n);
+    if (bestSplit.featureUnordered && bestSplit.iStart)
+    {
+        DAAL_ASSERT(bestSplit.iStart + bestSplit.nLeft <= n);
+        services::internal::tmemcpy<IndexType, cpu>(bestSplitIdx, aIdx, n);
+        services::internal::tmemcpy<IndexType, cpu>(aIdx, bestSplitIdx + bestSplit.iStart, bestSplit.nLeft);
+        services::internal::tmemcpy<IndexType, cpu>(aIdx + bestSplit.nLeft, bestSplitIdx, bestSplit.iStart);
+        const size_t nProcessed = bestSplit.iStart + bestSplit.nLeft;
+        if (n > nProcessed) services::internal::tmemcpy<IndexType, cpu>(aIdx + nProcessed, bestSplitIdx + nProcessed, n - nProcessed);
+    }
+    return true;
 }
 
 template <typename algorithmFPType, typename BinIndexType, typename DataHelper, CpuType cpu>
@@ -1142,7 +1421,14 @@ void TrainBatchTaskBase<algorithmFPType, BinIndexType, DataHelper, cpu>::addImpu
                                                                                              const typename DataHelper::TSplitData & split)
 {
     DAAL_ASSERT(_threadCtx.varImp);
-    if (!isZero<algorithmFPType, cpu>(split.impurityDecrease)) _threadCtx.varImp[iFeature] += split.impurityDecrease;
+    if (isZero<algorithmFPType, cpu>(split.impurityDecrease)) return;
+    if (_bParallelSubtrees)
+    {
+        AUTOLOCK(_mtTree);
+        _threadCtx.varImp[iFeature] += split.impurityDecrease;
+    }
+    else
+        _threadCtx.varImp[iFeature] += split.impurityDecrease;
 }
 
 template <typename algorithmFPType, typename BinIndexType, typename DataHelper, CpuType cpu>
@@ -96,9 +96,13 @@ public:
     typedef SplitData<algorithmFPType, ImpurityData> TSplitData;
 
 public:
-    OrderedRespHelper(const dtrees::internal::IndexedFeatures * indexedFeatures, size_t dummy) : super(indexedFeatures) {}
+    OrderedRespHelper(const dtrees::internal::IndexedFeatures * indexedFeatures, size_t dummy)
+        : super(indexedFeatures), _histBuf(indexedFeatures ? indexedFeatures->maxNumIndices() * histogramWidth() : 1)
+    {}
     virtual bool init(const NumericTable * data, const NumericTable * resp, const IndexType * aSample,
                       const NumericTable * weights) DAAL_C11_OVERRIDE;
+    //checks that the work buffers of the calling thread are allocated
+    bool hasWorkBuffers() const { return _histBuf.local() != nullptr; }
     void convertLeftImpToRight(size_t n, const ImpurityData & total, TSplitData & split)
     {
         subtractImpurity<double, cpu>(total.var, total.mean, split.left.var, split.left.mean, split.leftWeights, split.left.var, split.left.mean,
@@ -113,20 +117,33 @@ public:
                                  const algorithmFPType accuracy, const ImpurityData & curImpurity, TSplitData & split,
                                  const algorithmFPType minWeightLeaf, const algorithmFPType totalWeights) const;
     template <typename BinIndexType>
-    int findBestSplitForFeatureSorted(algorithmFPType * featureBuf, IndexType iFeature, const IndexType * aIdx, size_t n, size_t nMinSplitPart,
-                                      const ImpurityData & curImpurity, TSplitData & split, const algorithmFPType minWeightLeaf,
-                                      const algorithmFPType totalWeights, const BinIndexType * binIndex) const;
+    int findBestSplitForFeatureSorted(IndexType iFeature, const IndexType * aIdx, size_t n, size_t nMinSplitPart, const ImpurityData & curImpurity,
+                                      TSplitData & split, const algorithmFPType minWeightLeaf, const algorithmFPType totalWeights,
+                                      const BinIndexType * binIndex) const;
+
+    //Histogram of the node over the bins of an indexed feature.
+    //For every bin it keeps the number of observations, their total weight and the sum of their (weighted) responses.
+    //The total weight is not computed in case of no weights, the number of observations is used instead.
+    //The histogram of a node is the sum of the histograms of its children that allows to get one of them by subtraction.
+    static size_t histogramWidth() { return 3; }
+    template <typename BinIndexType>
+    void computeHistogram(IndexType iFeature, const IndexType * aIdx, const BinIndexType * binIndex, size_t n, algorithmFPType * hist) const;
+    int findBestSplitByHistogram(IndexType iFeature, const algorithmFPType * hist, size_t n, size_t nMinSplitPart, const ImpurityData & curImpurity,
+                                 TSplitData & split, const algorithmFPType minWeightLeaf, const algorithmFPType totalWeights) const;
 
     typedef double intermSummFPType;
     template <typename BinIndexType>
-    void computeHistWithWeights(algorithmFPType * buf, IndexType iFeature, const IndexType * aIdx, const BinIndexType * binIndex, size_t n,
+    void computeHistWithWeights(algorithmFPType * hist, const IndexType * aIdx, const BinIndexType * binIndex, size_t n,
                                 intermSummFPType & sumTotal) const;
     template <typename BinIndexType>
-    void computeHistWithoutWeights(algorithmFPType * buf, IndexType iFeature, const IndexType * aIdx, const BinIndexType * binIndex, size_t n,
+    void computeHistWithoutWeights(algorithmFPType * hist, const IndexType * aIdx, const BinIndexType * binIndex, size_t n,
                                    intermSummFPType & sumTotal) const;
 
     template <bool noWeights, bool featureUnordered>
-    int findBestSplitByHist(size_t nDiffFeatMax, intermSummFPType sumTotal, algorithmFPType * buf, size_t n, size_t nMinSplitPart,
+    int findBestSplitByHist(size_t nDiffFeatMax, intermSummFPType sumTotal, const algorithmFPType * hist, size_t n, size_t nMinSplitPart,
+                            const ImpurityData & curImpurity, TSplitData & split, const algorithmFPType minWeightLeaf,
+                            const algorithmFPType totalWeights) const;
+    int findBestSplitByHist(IndexType iFeature, intermSummFPType sumTotal, const algorithmFPType * hist, size_t n, size_t nMinSplitPart,
                             const ImpurityData & curImpurity, TSplitData & split, const algorithmFPType minWeightLeaf,
                             const algorithmFPType totalWeights) const;
 
@@ -195,9 +212,8 @@ private:
                                          const algorithmFPType minWeightLeaf, const algorithmFPType totalWeights) const;
 
 private:
-    //buffer for the computation using indexed features
-    mutable TVector<IndexType, cpu, DefaultAllocator<cpu> > _idxFeatureBuf;
-    mutable TVector<algorithmFPType, cpu, DefaultAllocator<cpu> > _weightsFeatureBuf;
+    //histogram of the node used in findBestSplitForFeatureSorted, each thread building nodes or processing features in parallel uses its own
+    mutable TlsMem<algorithmFPType, cpu> _histBuf;
 };
 
 #ifdef DEBUG_CHECK_IMPURITY
@@ -224,15 +240,8 @@ bool OrderedRespHelper<algorithmFPType, cpu>::init(const NumericTable * data, co
                                                    const NumericTable * weights)
 {
     DAAL_CHECK_STATUS_VAR(super::init(data, resp, aSample, weights));
-    if (this->_indexedFeatures)
-    {
-        //init work buffer for the computation using indexed features
-        const auto nDiffFeatMax = this->indexedFeatures().maxNumIndices();
-        _idxFeatureBuf.reset(nDiffFeatMax);
-        _weightsFeatureBuf.reset(nDiffFeatMax);
-        return _idxFeatureBuf.get() && _weightsFeatureBuf.get();
-    }
-    return true;
+    //work buffers of the calling thread, other threads allocate them on first use
+    return hasWorkBuffers();
 }
 
 template <typename algorithmFPType, CpuType cpu>
@@ -424,10 +433,9 @@ void OrderedRespHelper<algorithmFPType, cpu>::finalizeBestSplit(const IndexType
 
 template <typename algorithmFPType, CpuType cpu>
 template <typename BinIndexType>
-void OrderedRespHelper<algorithmFPType, cpu>::computeHistWithoutWeights(algorithmFPType * buf, IndexType iFeature, const IndexType * aIdx,
-                                                                        const BinIndexType * binIndex, size_t n, intermSummFPType & sumTotal) const
+void OrderedRespHelper<algorithmFPType, cpu>::computeHistWithoutWeights(algorithmFPType * hist, const IndexType * aIdx, const BinIndexType * binIndex,
+                                                                        size_t n, intermSummFPType & sumTotal) const
 {
-    auto nFeatIdx  = _idxFeatureBuf.get(); //number of indexed feature values, array
     auto aResponse = this->_aResponse.get();
     sumTotal       = 0; //total sum of responses in the set being split
     {
@@ -435,9 +443,9 @@ void OrderedRespHelper<algorithmFPType, cpu>::computeHistWithoutWeights(algorith
         {
             const IndexType iSample            = aIdx[i];
             const typename super::Response & r = aResponse[aIdx[i]];
-            const BinIndexType idx             = binIndex[r.idx];
-            ++nFeatIdx[idx];
-            buf[idx] += aResponse[iSample].val;
+            algorithmFPType * binHist          = hist + binIndex[r.idx] * histogramWidth();
+            binHist[0] += algorithmFPType(1);
+            binHist[2] += aResponse[iSample].val;
             sumTotal += aResponse[iSample].val;
         }
     }
@@ -445,39 +453,33 @@ void OrderedRespHelper<algorithmFPType, cpu>::computeHistWithoutWeights(algorith
 
 template <typename algorithmFPType, CpuType cpu>
 template <typename BinIndexType>
-void OrderedRespHelper<algorithmFPType, cpu>::computeHistWithWeights(algorithmFPType * buf, IndexType iFeature, const IndexType * aIdx,
-                                                                     const BinIndexType * binIndex, size_t n, intermSummFPType & sumTotal) const
+void OrderedRespHelper<algorithmFPType, cpu>::computeHistWithWeights(algorithmFPType * hist, const IndexType * aIdx, const BinIndexType * binIndex,
+                                                                     size_t n, intermSummFPType & sumTotal) const
 {
-    auto nFeatIdx    = _idxFeatureBuf.get(); //number of indexed feature values, array
-    auto featWeights = _weightsFeatureBuf.get();
-    auto aResponse   = this->_aResponse.get();
-    auto aWeights    = this->_aWeights.get();
-    sumTotal         = 0; //total sum of responses in the set being split
+    auto aResponse = this->_aResponse.get();
+    auto aWeights  = this->_aWeights.get();
+    sumTotal       = 0; //total sum of responses in the set being split
     {
         for (size_t i = 0; i < n; ++i)
         {
             const IndexType iSample            = aIdx[i];
             const typename super::Response & r = aResponse[aIdx[i]];
-            const BinIndexType idx             = binIndex[r.idx];
+            algorithmFPType * binHist          = hist + binIndex[r.idx] * histogramWidth();
             const auto weights                 = aWeights[iSample].val;
-            ++nFeatIdx[idx];
-            featWeights[idx] += weights;
-            buf[idx] += aResponse[iSample].val * weights;
+            binHist[0] += algorithmFPType(1);
+            binHist[1] += weights;
+            binHist[2] += aResponse[iSample].val * weights;
             sumTotal += aResponse[iSample].val * weights;
         }
     }
 }
 
 template <typename algorithmFPType, CpuType cpu>
-
 template <bool noWeights, bool featureUnordered>
-int OrderedRespHelper<algorithmFPType, cpu>::findBestSplitByHist(size_t nDiffFeatMax, intermSummFPType sumTotal, algorithmFPType * buf, size_t n,
-                                                                 size_t nMinSplitPart, const ImpurityData & curImpurity, TSplitData & split,
+int OrderedRespHelper<algorithmFPType, cpu>::findBestSplitByHist(size_t nDiffFeatMax, intermSummFPType sumTotal, const algorithmFPType * hist,
+                                                                 size_t n, size_t nMinSplitPart, const ImpurityData & curImpurity, TSplitData & split,
                                                                  const algorithmFPType minWeightLeaf, const algorithmFPType totalWeights) const
 {
-    auto featWeights = _weightsFeatureBuf.get();
-    auto nFeatIdx    = _idxFeatureBuf.get(); //number of indexed feature values, array
-
     intermSummFPType bestImpDecreasePart =
         split.impurityDecrease < 0 ? -1 : (split.impurityDecrease + curImpurity.mean * curImpurity.mean) * totalWeights;
     size_t nLeft                = 0;
@@ -486,16 +488,18 @@ int OrderedRespHelper<algorithmFPType, cpu>::findBestSplitByHist(size_t nDiffFea
     int idxFeatureBestSplit     = -1; //index of best feature value in the array of sorted feature values
     for (size_t i = 0; i < nDiffFeatMax; ++i)
     {
-        if (!nFeatIdx[i]) continue;
+        const algorithmFPType * binHist = hist + i * histogramWidth();
+        const size_t thisNFeatIdx       = size_t(binHist[0]);
+        if (!thisNFeatIdx) continue;
 
-        algorithmFPType thisFeatWeights = noWeights ? nFeatIdx[i] : featWeights[i];
+        algorithmFPType thisFeatWeights = noWeights ? algorithmFPType(thisNFeatIdx) : binHist[1];
 
-        nLeft       = (featureUnordered ? nFeatIdx[i] : nLeft + nFeatIdx[i]);
+        nLeft       = (featureUnordered ? thisNFeatIdx : nLeft + thisNFeatIdx);
         leftWeights = (featureUnordered ? thisFeatWeights : leftWeights + thisFeatWeights);
         if ((nLeft == n) //last split
             || ((n - nLeft) < nMinSplitPart) || ((totalWeights - leftWeights) < minWeightLeaf))
             break;
-        sumLeft = (featureUnordered ? buf[i] : sumLeft + buf[i]);
+        sumLeft = (featureUnordered ? binHist[2] : sumLeft + binHist[2]);
         if ((nLeft < nMinSplitPart) || (leftWeights < minWeightLeaf)) continue;
         intermSummFPType sumRight = sumTotal - sumLeft;
         //the part of the impurity decrease dependent on split itself
@@ -519,48 +523,69 @@ int OrderedRespHelper<algorithmFPType, cpu>::findBestSplitByHist(size_t nDiffFea
 }
 
 template <typename algorithmFPType, CpuType cpu>
-template <typename BinIndexType>
-int OrderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(algorithmFPType * buf, IndexType iFeature, const IndexType * aIdx,
-                                                                           size_t n, size_t nMinSplitPart, const ImpurityData & curImpurity,
-                                                                           TSplitData & split, const algorithmFPType minWeightLeaf,
-                                                                           const algorithmFPType totalWeights, const BinIndexType * binIndex) const
+int OrderedRespHelper<algorithmFPType, cpu>::findBestSplitByHist(IndexType iFeature, intermSummFPType sumTotal, const algorithmFPType * hist,
+                                                                 size_t n, size_t nMinSplitPart, const ImpurityData & curImpurity, TSplitData & split,
+                                                                 const algorithmFPType minWeightLeaf, const algorithmFPType totalWeights) const
 {
     const auto nDiffFeatMax = this->indexedFeatures().numIndices(iFeature);
-    _idxFeatureBuf.setValues(nDiffFeatMax, 0);
+    if (!this->_weights)
+    {
+        return split.featureUnordered ?
+                   findBestSplitByHist<true, true>(nDiffFeatMax, sumTotal, hist, n, nMinSplitPart, curImpurity, split, minWeightLeaf, totalWeights) :
+                   findBestSplitByHist<true, false>(nDiffFeatMax, sumTotal, hist, n, nMinSplitPart, curImpurity, split, minWeightLeaf, totalWeights);
+    }
+    return split.featureUnordered ?
+               findBestSplitByHist<false, true>(nDiffFeatMax, sumTotal, hist, n, nMinSplitPart, curImpurity, split, minWeightLeaf, totalWeights) :
+               findBestSplitByHist<false, false>(nDiffFeatMax, sumTotal, hist, n, nMinSplitPart, curImpurity, split, minWeightLeaf, totalWeights);
+}
 
-    //the buffer keeps sums of responses for each of unique feature values
-    for (size_t i = 0; i < nDiffFeatMax; ++i) buf[i] = algorithmFPType(0);
+template <typename algorithmFPType, CpuType cpu>
+template <typename BinIndexType>
+void OrderedRespHelper<algorithmFPType, cpu>::computeHistogram(IndexType iFeature, const IndexType * aIdx, const BinIndexType * binIndex, size_t n,
+                                                               algorithmFPType * hist) const
+{
+    const size_t nHist = this->indexedFeatures().numIndices(iFeature) * histogramWidth();
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t i = 0; i < nHist; ++i) hist[i] = algorithmFPType(0);
 
-    const bool noWeights      = !this->_weights;
-    intermSummFPType sumTotal = 0; //total sum of responses in the set being split
+    intermSummFPType sumTotal = 0;
+    if (!this->_weights)
+        computeHistWithoutWeights(hist, aIdx, binIndex, n, sumTotal);
+    else
+        computeHistWithWeights(hist, aIdx, binIndex, n, sumTotal);
+}
 
-    if (noWeights)
-    {
-        computeHistWithoutWeights(buf, iFeature, aIdx, binIndex, n, sumTotal);
+template <typename algorithmFPType, CpuType cpu>
+int OrderedRespHelper<algorithmFPType, cpu>::findBestSplitByHistogram(IndexType iFeature, const algorithmFPType * hist, size_t n,
+                                                                      size_t nMinSplitPart, const ImpurityData & curImpurity, TSplitData & split,
+                                                                      const algorithmFPType minWeightLeaf, const algorithmFPType totalWeights) const
+{
+    //the histogram could be obtained by subtraction, the total sum of responses is restored from it
+    const auto nDiffFeatMax   = this->indexedFeatures().numIndices(iFeature);
+    intermSummFPType sumTotal = 0;
+    for (size_t i = 0; i < nDiffFeatMax; ++i) sumTotal += hist[i * histogramWidth() + 2];
+    return findBestSplitByHist(iFeature, sumTotal, hist, n, nMinSplitPart, curImpurity, split, minWeightLeaf, totalWeights);
+}
 
-        if (split.featureUnordered)
-        {
-            return findBestSplitByHist<true, true>(nDiffFeatMax, sumTotal, buf, n, nMinSplitPart, curImpurity, split, minWeightLeaf, totalWeights);
-        }
-        else
-        {
-            return findBestSplitByHist<true, false>(nDiffFeatMax, sumTotal, buf, n, nMinSplitPart, curImpurity, split, minWeightLeaf, totalWeights);
-        }
-    }
-    else
-    {
-        _weightsFeatureBuf.setValues(nDiffFeatMax, algorithmFPType(0));
-        computeHistWithWeights(buf, iFeature, aIdx, binIndex, n, sumTotal);
+template <typename algorithmFPType, CpuType cpu>
+template <typename BinIndexType>
+int OrderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(IndexType iFeature, const IndexType * aIdx, size_t n, size_t nMinSplitPart,
+                                                                           const ImpurityData & curImpurity, TSplitData & split,
+                                                                           const algorithmFPType minWeightLeaf, const algorithmFPType totalWeights,
+                                                                           const BinIndexType * binIndex) const
+{
+    algorithmFPType * hist = _histBuf.local();
+    DAAL_ASSERT(hist);
+    const size_t nHist = this->indexedFeatures().numIndices(iFeature) * histogramWidth();
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t i = 0; i < nHist; ++i) hist[i] = algorithmFPType(0);
 
-        if (split.featureUnordered)
-        {
-            return findBestSplitByHist<false, true>(nDiffFeatMax, sumTotal, buf, n, nMinSplitPart, curImpurity, split, minWeightLeaf, totalWeights);
-        }
-        else
-        {
-            return findBestSplitByHist<false, false>(nDiffFeatMax, sumTotal, buf, n, nMinSplitPart, curImpurity, split, minWeightLeaf, totalWeights);
-        }
-    }
+    intermSummFPType sumTotal = 0; //total sum of responses in the set being split
+    if (!this->_weights)
+        computeHistWithoutWeights(hist, aIdx, binIndex, n, sumTotal);
+    else
+        computeHistWithWeights(hist, aIdx, binIndex, n, sumTotal);
+    return findBestSplitByHist(iFeature, sumTotal, hist, n, nMinSplitPart, curImpurity, split, minWeightLeaf, totalWeights);
 }
 
 template <typename algorithmFPType, CpuType cpu>
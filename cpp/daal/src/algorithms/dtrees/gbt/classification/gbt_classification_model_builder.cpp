@@ -45,6 +45,7 @@ services::Status ModelBuilder::convertModelInternal()
 {
     gbt::classification::internal::ModelImpl & modelImplRef =
         daal::algorithms::dtrees::internal::getModelRef<daal::algorithms::gbt::classification::internal::ModelImpl, ModelPtr>(_model);
+    modelImplRef.resetQuickScorerLayout();
     return daal::algorithms::gbt::internal::ModelImpl::convertDecisionTreesToGbtTrees(modelImplRef._serializationData);
 }
 
@@ -70,6 +71,7 @@ services::Status ModelBuilder::createTreeInternal(size_t nNodes, size_t clasLabe
 {
     gbt::classification::internal::ModelImpl & modelImplRef =
         daal::algorithms::dtrees::internal::getModelRef<daal::algorithms::gbt::classification::internal::ModelImpl, ModelPtr>(_model);
+    modelImplRef.resetQuickScorerLayout();
     if (_nClasses == 1)
     {
         return daal::algorithms::dtrees::internal::createTreeInternal(modelImplRef._serializationData, nNodes, resId);
@@ -122,6 +124,7 @@ services::Status ModelBuilder::addLeafNodeInternal(TreeId treeId, NodeId parentI
 {
     gbt::classification::internal::ModelImpl & modelImplRef =
         daal::algorithms::dtrees::internal::getModelRef<daal::algorithms::gbt::classification::internal::ModelImpl, ModelPtr>(_model);
+    modelImplRef.resetQuickScorerLayout();
     return daal::algorithms::dtrees::internal::addLeafNodeInternal<double>(modelImplRef._serializationData, treeId, parentId, position, response,
                                                                            res);
     ;
@@ -132,6 +135,7 @@ services::Status ModelBuilder::addSplitNodeInternal(TreeId treeId, NodeId parent
 {
     gbt::classification::internal::ModelImpl & modelImplRef =
         daal::algorithms::dtrees::internal::getModelRef<daal::algorithms::gbt::classification::internal::ModelImpl, ModelPtr>(_model);
+    modelImplRef.resetQuickScorerLayout();
     return daal::algorithms::dtrees::internal::addSplitNodeInternal(modelImplRef._serializationData, treeId, parentId, position, featureIndex,
                                                                     featureValue, res);
 }
@@ -38,6 +38,7 @@
 #include "src/algorithms/dtrees/gbt/gbt_predict_dense_default_impl.i"
 #include "src/algorithms/objective_function/cross_entropy_loss/cross_entropy_loss_dense_default_batch_kernel.h"
 #include "src/services/service_algo_utils.h"
+#include "src/services/service_unique_ptr.h"
 
 using namespace daal::internal;
 using namespace daal::services::internal;
@@ -64,7 +65,9 @@ class PredictBinaryClassificationTask : public gbt::regression::prediction::inte
 {
 public:
     typedef gbt::regression::prediction::internal::PredictRegressionTask<algorithmFPType, cpu> super;
-    PredictBinaryClassificationTask(const NumericTable * x, NumericTable * y, NumericTable * prob) : super(x, y), _prob(prob) {}
+    PredictBinaryClassificationTask(const NumericTable * x, NumericTable * y, NumericTable * prob, bool bQuickScorer = false)
+        : super(x, y, bQuickScorer), _prob(prob)
+    {}
     services::Status run(const gbt::classification::internal::ModelImpl * m, size_t nIterations, services::HostAppIface * pHostApp)
     {
         DAAL_ASSERT(!nIterations || nIterations <= m->size());
@@ -73,8 +76,9 @@ public:
         this->_aTree.reset(nTreesTotal);
         DAAL_CHECK_MALLOC(this->_aTree.get());
         for (size_t i = 0; i < nTreesTotal; ++i) this->_aTree[i] = m->at(i);
+        services::Status s = this->initQuickScorer(*m);
+        if (!s) return s;
         const auto nRows = this->_data->getNumberOfRows();
-        services::Status s;
         DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows, sizeof(algorithmFPType));
         //compute raw boosted values
         if (this->_res && _prob)
@@ -171,8 +175,11 @@ public:
     typedef gbt::prediction::internal::TileDimensions<algorithmFPType> DimType;
     typedef daal::tls<algorithmFPType *> ClassesRawBoostedTlsBase;
     typedef daal::TlsMem<algorithmFPType, cpu> ClassesRawBoostedTls;
+    typedef gbt::prediction::internal::QuickScorer<algorithmFPType, cpu> QuickScorerType;
 
-    PredictMulticlassTask(const NumericTable * x, NumericTable * y, NumericTable * prob) : _data(x), _res(y), _prob(prob) {}
+    PredictMulticlassTask(const NumericTable * x, NumericTable * y, NumericTable * prob, bool bQuickScorer = false)
+        : _data(x), _res(y), _prob(prob), _bQuickScorer(bQuickScorer)
+    {}
     services::Status run(const gbt::classification::internal::ModelImpl * m, size_t nClasses, size_t nIterations, services::HostAppIface * pHostApp);
 
 protected:
@@ -193,6 +200,8 @@ protected:
     NumericTable * _prob;
     dtrees::internal::FeatureTypes _featHelper;
     TArray<const TreeType *, cpu> _aTree;
+    bool _bQuickScorer;
+    gbt::prediction::internal::QuickScorerLayoutPtr _quickScorerLayout;
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -205,12 +214,13 @@ services::Status PredictKernel<algorithmFPType, method, cpu>::compute(services::
 {
     const daal::algorithms::gbt::classification::internal::ModelImpl * pModel =
         static_cast<const daal::algorithms::gbt::classification::internal::ModelImpl *>(m);
+    const bool bQuickScorer = (method == quickScorerDense);
     if (nClasses == 2)
     {
-        PredictBinaryClassificationTask<algorithmFPType, cpu> task(x, r, prob);
+        PredictBinaryClassificationTask<algorithmFPType, cpu> task(x, r, prob, bQuickScorer);
         return task.run(pModel, nIterations, pHostApp);
     }
-    PredictMulticlassTask<algorithmFPType, cpu> task(x, r, prob);
+    PredictMulticlassTask<algorithmFPType, cpu> task(x, r, prob, bQuickScorer);
     return task.run(pModel, nClasses, nIterations, pHostApp);
 }
 
@@ -224,6 +234,11 @@ services::Status PredictMulticlassTask<algorithmFPType, cpu>::run(const gbt::cla
     this->_aTree.reset(nTreesTotal);
     DAAL_CHECK_MALLOC(this->_aTree.get());
     for (size_t i = 0; i < nTreesTotal; ++i) this->_aTree[i] = m->at(i);
+    if (_bQuickScorer)
+    {
+        services::Status s = gbt::prediction::internal::getQuickScorerLayout<cpu>(*m, _aTree.get(), nTreesTotal, _quickScorerLayout);
+        if (!s) return s;
+    }
 
     DimType dim(*_data, nTreesTotal);
 
@@ -265,6 +280,8 @@ services::Status PredictMulticlassTask<algorithmFPType, cpu>::predictByAllTrees(
     const size_t nCols(_data->getNumberOfColumns());
     const size_t nRows(_data->getNumberOfRows());
     daal::SafeStatus safeStat;
+    UniquePtr<QuickScorerType, cpu> scorer(_quickScorerLayout ? new QuickScorerType(*_quickScorerLayout, _aTree.get(), _featHelper) : nullptr);
+    if (_quickScorerLayout) DAAL_CHECK_MALLOC(scorer.get());
     if (_prob)
     {
         WriteOnlyRows<algorithmFPType, cpu> probBD(_prob, 0, dim.nRowsTotal);
@@ -288,7 +305,14 @@ services::Status PredictMulticlassTask<algorithmFPType, cpu>::predictByAllTrees(
             for (; iRow + VECTOR_BLOCK_SIZE <= nRowsToProcess; iRow += VECTOR_BLOCK_SIZE)
             {
                 val = valL + iRow * nClasses;
-                predictByTreesVector(val, 0, nTreesTotal, nClasses, xBD.get() + iRow * nCols);
+                if (scorer.get())
+                {
+                    DAAL_CHECK_MALLOC_THR(scorer->predict(xBD.get() + iRow * nCols, VECTOR_BLOCK_SIZE, nCols, nClasses, val));
+                }
+                else
+                {
+                    predictByTreesVector(val, 0, nTreesTotal, nClasses, xBD.get() + iRow * nCols);
+                }
                 if (res)
                 {
                     for (size_t i = 0; i < gbt::prediction::internal::VECTOR_BLOCK_SIZE; ++i)
@@ -297,6 +321,15 @@ services::Status PredictMulticlassTask<algorithmFPType, cpu>::predictByAllTrees(
                     }
                 }
             }
+            if (scorer.get() && iRow < nRowsToProcess)
+            {
+                /* The remaining rows are scored as one incomplete tile */
+                const size_t nTail = nRowsToProcess - iRow;
+                val                = valL + iRow * nClasses;
+                DAAL_CHECK_MALLOC_THR(scorer->predict(xBD.get() + iRow * nCols, nTail, nCols, nClasses, val));
+                for (size_t i = 0; res && i < nTail; ++i) res[iRow + i] = algorithmFPType(getMaxClass(val + i * nClasses, nClasses));
+                iRow = nRowsToProcess;
+            }
             for (; iRow < nRowsToProcess; ++iRow)
             {
                 val = valL + iRow * nClasses;
@@ -327,13 +360,29 @@ services::Status PredictMulticlassTask<algorithmFPType, cpu>::predictByAllTrees(
             for (; iRow + VECTOR_BLOCK_SIZE <= nRowsToProcess; iRow += VECTOR_BLOCK_SIZE)
             {
                 services::internal::service_memset_seq<algorithmFPType, cpu>(val, algorithmFPType(0), nClasses * VECTOR_BLOCK_SIZE);
-                predictByTreesVector(val, 0, nTreesTotal, nClasses, xBD.get() + iRow * nCols);
+                if (scorer.get())
+                {
+                    DAAL_CHECK_MALLOC_THR(scorer->predict(xBD.get() + iRow * nCols, VECTOR_BLOCK_SIZE, nCols, nClasses, val));
+                }
+                else
+                {
+                    predictByTreesVector(val, 0, nTreesTotal, nClasses, xBD.get() + iRow * nCols);
+                }
 
                 for (size_t i = 0; i < gbt::prediction::internal::VECTOR_BLOCK_SIZE; ++i)
                 {
                     res[iRow + i] = getMaxClass(val + i * nClasses, nClasses);
                 }
             }
+            if (scorer.get() && iRow < nRowsToProcess)
+            {
+                /* The remaining rows are scored as one incomplete tile */
+                const size_t nTail = nRowsToProcess - iRow;
+                services::internal::service_memset_seq<algorithmFPType, cpu>(val, algorithmFPType(0), nClasses * nTail);
+                DAAL_CHECK_MALLOC_THR(scorer->predict(xBD.get() + iRow * nCols, nTail, nCols, nClasses, val));
+                for (size_t i = 0; i < nTail; ++i) res[iRow + i] = algorithmFPType(getMaxClass(val + i * nClasses, nClasses));
+                iRow = nRowsToProcess;
+            }
             for (; iRow < nRowsToProcess; ++iRow)
             {
                 services::internal::service_memset_seq<algorithmFPType, cpu>(val, algorithmFPType(0), nClasses);
@@ -188,6 +188,7 @@ void ModelImpl::add(gbt::internal::GbtDecisionTree * pTbl, HomogenNumericTable<d
     DAAL_ASSERT(pTblSmplCnt);
 
     _nTree.inc();
+    resetQuickScorerLayout();
 
     _serializationData->push_back(SerializationIfacePtr(pTbl));
     _impurityTables->push_back(SerializationIfacePtr(pTblImp));
@@ -211,19 +212,41 @@ bool ModelImpl::reserve(const size_t nTrees)
 
 bool ModelImpl::resize(const size_t nTrees)
 {
+    resetQuickScorerLayout();
     return super::resize(nTrees);
 }
 
 void ModelImpl::clear()
 {
+    resetQuickScorerLayout();
     super::clear();
 }
 
 void ModelImpl::destroy()
 {
+    resetQuickScorerLayout();
     super::destroy();
 }
 
+gbt::prediction::internal::QuickScorerLayoutPtr ModelImpl::getQuickScorerLayout(size_t nTrees) const
+{
+    AUTOLOCK(_quickScorerMutex);
+    if (_quickScorerLayout && _quickScorerLayout->nTreesTotal == nTrees) return _quickScorerLayout;
+    return gbt::prediction::internal::QuickScorerLayoutPtr();
+}
+
+void ModelImpl::setQuickScorerLayout(const gbt::prediction::internal::QuickScorerLayoutPtr & layout) const
+{
+    AUTOLOCK(_quickScorerMutex);
+    _quickScorerLayout = layout;
+}
+
+void ModelImpl::resetQuickScorerLayout()
+{
+    AUTOLOCK(_quickScorerMutex);
+    _quickScorerLayout.reset();
+}
+
 bool ModelImpl::nodeIsDummyLeaf(size_t idx, const GbtDecisionTree & gbtTree)
 {
     const gbt::prediction::internal::ModelFPType * splitPoints        = gbtTree.getSplitPoints();
@@ -27,6 +27,8 @@
 #include "src/algorithms/dtrees/dtrees_model_impl.h"
 #include "algorithms/regression/tree_traverse.h"
 #include "src/algorithms/dtrees/gbt/gbt_predict_dense_default_impl.i"
+#include "src/algorithms/dtrees/gbt/gbt_predict_quick_scorer_layout.h"
+#include "src/algorithms/service_threading.h"
 #include "algorithms/tree_utils/tree_utils_regression.h"
 #include "src/algorithms/dtrees/dtrees_model_impl_common.h"
 #include "src/services/service_arrays.h"
@@ -284,6 +286,10 @@ public:
     static services::Status treeToTable(TreeType & t, gbt::internal::GbtDecisionTree ** pTbl, HomogenNumericTable<double> ** pTblImp,
                                         HomogenNumericTable<int> ** pTblSmplCnt, size_t nFeature);
 
+    // Layout of the first nTrees trees for quickScorerDense prediction, empty if it was not built yet
+    gbt::prediction::internal::QuickScorerLayoutPtr getQuickScorerLayout(size_t nTrees) const;
+    void setQuickScorerLayout(const gbt::prediction::internal::QuickScorerLayoutPtr & layout) const;
+
 protected:
     static bool nodeIsDummyLeaf(size_t idx, const GbtDecisionTree & gbtTree);
     static bool nodeIsLeaf(size_t idx, const GbtDecisionTree & gbtTree, const size_t lvl);
@@ -345,6 +351,7 @@ protected:
     }
 
     void destroy();
+    void resetQuickScorerLayout();
 
     template <typename Archive, bool onDeserialize>
     services::Status serialImpl(Archive * arch, int daalVersion = INTEL_DAAL_VERSION)
@@ -361,10 +368,18 @@ protected:
             convertDecisionTreesToGbtTrees(_serializationData);
         }
 
-        if (onDeserialize) _nTree.set(_serializationData->size());
+        if (onDeserialize)
+        {
+            _nTree.set(_serializationData->size());
+            resetQuickScorerLayout();
+        }
 
         return services::Status();
     }
+
+protected:
+    mutable gbt::prediction::internal::QuickScorerLayoutPtr _quickScorerLayout; // built on demand by quickScorerDense prediction
+    mutable daal::Mutex _quickScorerMutex;
 };
 
 } // namespace internal
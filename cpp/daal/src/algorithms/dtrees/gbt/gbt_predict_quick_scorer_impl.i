@@ -0,0 +1,441 @@
+/* file: gbt_predict_quick_scorer_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of auxiliary functions for gradient boosted trees prediction
+//  (quickScorerDense) method.
+//--
+*/
+
+#ifndef __GBT_PREDICT_QUICK_SCORER_IMPL_I__
+#define __GBT_PREDICT_QUICK_SCORER_IMPL_I__
+
+#include "src/algorithms/dtrees/gbt/gbt_model_impl.h"
+#include "src/algorithms/dtrees/gbt/gbt_predict_quick_scorer_layout.h"
+#include "src/algorithms/dtrees/gbt/gbt_predict_dense_default_impl.i"
+#include "src/algorithms/service_threading.h"
+#include "src/algorithms/service_sort.h"
+#include "src/services/service_arrays.h"
+#include "src/services/service_data_utils.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace prediction
+{
+namespace internal
+{
+/* Upper bound for the size of leaf bitvectors of a row tile processed for one block of trees (in bytes) */
+const size_t QUICK_SCORER_TILE_STATE_SIZE = 128 * 1024;
+
+/* Maximal number of leaves of a tree in the layout: it bounds the masks of a split node by 128 bytes */
+const size_t QUICK_SCORER_MAX_LEAVES = 1024;
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Index of the lowest set bit of the non-zero mask (de Bruijn multiplication)
+//////////////////////////////////////////////////////////////////////////////////////////
+inline size_t getLowestSetBit(const QuickScorerLayout::MaskType mask)
+{
+    static const unsigned char index64[64] = { 0,  47, 1,  56, 48, 27, 2,  60, 57, 49, 41, 37, 28, 16, 3,  61, 54, 58, 35, 52, 50, 42,
+                                               21, 44, 38, 32, 29, 23, 17, 11, 4,  62, 46, 55, 26, 59, 40, 36, 15, 53, 34, 51, 20, 43,
+                                               31, 22, 10, 45, 25, 39, 14, 33, 19, 30, 9,  24, 13, 18, 8,  12, 7,  6,  5,  63 };
+    const QuickScorerLayout::MaskType debruijn64 = 0x03f79d71b4cb0a89ULL;
+    return index64[((mask ^ (mask - 1)) * debruijn64) >> 58];
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// QuickScorerBuilder. Converts GbtDecisionTree-s into QuickScorerLayout
+//////////////////////////////////////////////////////////////////////////////////////////
+template <CpuType cpu>
+class QuickScorerBuilder
+{
+public:
+    typedef gbt::internal::GbtDecisionTree TreeType;
+    typedef QuickScorerLayout::MaskType MaskType;
+
+    static services::Status build(const TreeType * const * trees, size_t nModelTrees, QuickScorerLayout & layout);
+
+private:
+    struct SplitNode
+    {
+        ModelFPType threshold;
+        FeatureIndexType featureIdx;
+        FeatureIndexType treeIdx;
+        FeatureIndexType firstLeftLeaf; /* Leaves of the left subtree are [firstLeftLeaf, lastLeftLeaf) */
+        FeatureIndexType lastLeftLeaf;
+    };
+
+    /* The leaves above the last level are stored as a chain of dummy copies of the leaf */
+    static bool isLeaf(const TreeType & t, size_t idx, size_t lvl)
+    {
+        if (lvl == t.getMaxLvl()) return true;
+        const size_t left = 2 * idx + 1;
+        return (t.getSplitPoints()[left] == t.getSplitPoints()[idx]) && (t.getFeatureIndexesForSplit()[left] == t.getFeatureIndexesForSplit()[idx]);
+    }
+
+    static void countNodes(const TreeType & t, size_t idx, size_t lvl, size_t & nSplits, size_t & nLeaves, size_t & nFeatures);
+    static void collectNodes(const TreeType & t, size_t idx, size_t lvl, FeatureIndexType iTree, SplitNode * nodes, size_t & nNodes,
+                             services::Collection<ModelFPType> & leafValues, FeatureIndexType & nLeaves);
+};
+
+template <CpuType cpu>
+void QuickScorerBuilder<cpu>::countNodes(const TreeType & t, size_t idx, size_t lvl, size_t & nSplits, size_t & nLeaves, size_t & nFeatures)
+{
+    if (isLeaf(t, idx, lvl))
+    {
+        ++nLeaves;
+        return;
+    }
+    ++nSplits;
+    const size_t iFeature = t.getFeatureIndexesForSplit()[idx];
+    if (iFeature >= nFeatures) nFeatures = iFeature + 1;
+    countNodes(t, 2 * idx + 1, lvl + 1, nSplits, nLeaves, nFeatures);
+    countNodes(t, 2 * idx + 2, lvl + 1, nSplits, nLeaves, nFeatures);
+}
+
+template <CpuType cpu>
+void QuickScorerBuilder<cpu>::collectNodes(const TreeType & t, size_t idx, size_t lvl, FeatureIndexType iTree, SplitNode * nodes, size_t & nNodes,
+                                           services::Collection<ModelFPType> & leafValues, FeatureIndexType & nLeaves)
+{
+    if (isLeaf(t, idx, lvl))
+    {
+        leafValues.push_back(t.getSplitPoints()[idx]);
+        ++nLeaves;
+        return;
+    }
+    SplitNode & node    = nodes[nNodes++];
+    node.threshold      = t.getSplitPoints()[idx];
+    node.featureIdx     = t.getFeatureIndexesForSplit()[idx];
+    node.treeIdx        = iTree;
+    node.firstLeftLeaf  = nLeaves;
+    collectNodes(t, 2 * idx + 1, lvl + 1, iTree, nodes, nNodes, leafValues, nLeaves);
+    node.lastLeftLeaf = nLeaves;
+    collectNodes(t, 2 * idx + 2, lvl + 1, iTree, nodes, nNodes, leafValues, nLeaves);
+}
+
+template <CpuType cpu>
+services::Status QuickScorerBuilder<cpu>::build(const TreeType * const * trees, size_t nModelTrees, QuickScorerLayout & layout)
+{
+    size_t nSplitsTotal = 0;
+    size_t nLeavesMax   = 1;
+    size_t nFeatures    = 0;
+    for (size_t iTree = 0; iTree < nModelTrees; ++iTree)
+    {
+        size_t nSplits       = 0;
+        size_t nLeaves       = 0;
+        size_t nTreeFeatures = 0;
+        countNodes(*trees[iTree], 0, 0, nSplits, nLeaves, nTreeFeatures);
+        if (nLeaves > QUICK_SCORER_MAX_LEAVES)
+        {
+            DAAL_CHECK_MALLOC(layout.fallbackTrees.safe_push_back(iTree));
+            continue;
+        }
+        DAAL_CHECK_MALLOC(layout.treeIndices.safe_push_back(iTree));
+        nSplitsTotal += nSplits;
+        if (nLeaves > nLeavesMax) nLeavesMax = nLeaves;
+        if (nTreeFeatures > nFeatures) nFeatures = nTreeFeatures;
+    }
+    layout.nTreesTotal = nModelTrees;
+
+    const size_t nTrees           = layout.treeIndices.size();
+    const size_t nMaskWords       = (nLeavesMax + QuickScorerLayout::nBitsInMask - 1) / QuickScorerLayout::nBitsInMask;
+    const size_t nBytesPerTree    = nMaskWords * sizeof(MaskType) * VECTOR_BLOCK_SIZE;
+    const size_t nTreesInBlockMax = (QUICK_SCORER_TILE_STATE_SIZE > nBytesPerTree ? QUICK_SCORER_TILE_STATE_SIZE / nBytesPerTree : 1);
+
+    layout.nTrees        = nTrees;
+    layout.nFeatures     = nFeatures;
+    layout.nMaskWords    = nMaskWords;
+    layout.nTreesInBlock = (nTrees < nTreesInBlockMax ? nTrees : nTreesInBlockMax);
+    layout.nTreeBlocks   = (layout.nTreesInBlock ? (nTrees + layout.nTreesInBlock - 1) / layout.nTreesInBlock : 0);
+
+    const size_t nLeafValues = nTrees * nMaskWords * QuickScorerLayout::nBitsInMask;
+    const size_t nOffsets    = layout.nTreeBlocks * nFeatures + 1;
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nSplitsTotal, nMaskWords);
+    DAAL_CHECK_MALLOC(layout.leafValues.resize(nLeafValues) && layout.nodeOffsets.resize(nOffsets));
+    DAAL_CHECK_MALLOC(layout.thresholds.resize(nSplitsTotal + 1) && layout.treeIdx.resize(nSplitsTotal + 1)
+                      && layout.masks.resize(nSplitsTotal * nMaskWords + 1));
+
+    services::internal::TArray<SplitNode, cpu> nodesArr(nSplitsTotal + 1);
+    SplitNode * const nodes = nodesArr.get();
+    DAAL_CHECK_MALLOC(nodes);
+
+    size_t nNodes = 0;
+    for (size_t iTree = 0; iTree < nTrees; ++iTree)
+    {
+        FeatureIndexType nLeaves = 0;
+        collectNodes(*trees[layout.treeIndices[iTree]], 0, 0, FeatureIndexType(iTree), nodes, nNodes, layout.leafValues, nLeaves);
+        for (size_t i = nLeaves; i < nMaskWords * QuickScorerLayout::nBitsInMask; ++i) layout.leafValues.push_back(ModelFPType(0));
+    }
+    DAAL_ASSERT(nNodes == nSplitsTotal);
+
+    /* Order split nodes by block of trees, then by feature, then by ascending threshold */
+    const size_t nTreesInBlock = layout.nTreesInBlock;
+    daal::algorithms::internal::introSort<cpu>(nodes, nodes + nNodes, [nTreesInBlock](const SplitNode & a, const SplitNode & b) -> bool {
+        const size_t aBlock = a.treeIdx / nTreesInBlock;
+        const size_t bBlock = b.treeIdx / nTreesInBlock;
+        if (aBlock != bBlock) return aBlock < bBlock;
+        if (a.featureIdx != b.featureIdx) return a.featureIdx < b.featureIdx;
+        return a.threshold < b.threshold;
+    });
+
+    size_t iNode = 0;
+    for (size_t iBlock = 0; iBlock < layout.nTreeBlocks; ++iBlock)
+    {
+        for (size_t iFeature = 0; iFeature < nFeatures; ++iFeature)
+        {
+            layout.nodeOffsets.push_back(iNode);
+            for (; iNode < nNodes && nodes[iNode].treeIdx / nTreesInBlock == iBlock && nodes[iNode].featureIdx == iFeature; ++iNode)
+            {
+                const SplitNode & node = nodes[iNode];
+                layout.thresholds.push_back(node.threshold);
+                layout.treeIdx.push_back(FeatureIndexType(node.treeIdx % nTreesInBlock));
+                for (size_t iWord = 0; iWord < nMaskWords; ++iWord)
+                {
+                    const size_t firstBit = iWord * QuickScorerLayout::nBitsInMask;
+                    MaskType mask         = ~MaskType(0);
+                    for (size_t iLeaf = node.firstLeftLeaf; iLeaf < node.lastLeftLeaf; ++iLeaf)
+                    {
+                        if (iLeaf >= firstBit && iLeaf < firstBit + QuickScorerLayout::nBitsInMask) mask &= ~(MaskType(1) << (iLeaf - firstBit));
+                    }
+                    layout.masks.push_back(mask);
+                }
+            }
+        }
+    }
+    layout.nodeOffsets.push_back(iNode);
+    DAAL_ASSERT(iNode == nNodes);
+
+    return services::Status();
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// QuickScorer. Computes the responses of the trees of QuickScorerLayout for a tile of
+// at most VECTOR_BLOCK_SIZE rows. Every split node is applied to the whole tile at once:
+// the leaf bitvectors of the rows are stored contiguously for a tree and a mask word.
+// The trees that are not in the layout are predicted by the traversal of their nodes.
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+class QuickScorer
+{
+public:
+    typedef QuickScorerLayout::MaskType MaskType;
+    typedef gbt::internal::GbtDecisionTree TreeType;
+
+    QuickScorer(const QuickScorerLayout & layout, const TreeType * const * trees, const dtrees::internal::FeatureTypes & featTypes)
+        : _layout(layout),
+          _trees(trees),
+          _featTypes(featTypes),
+          _xTls(layout.nFeatures * (VECTOR_BLOCK_SIZE + 1)),
+          _stateTls(layout.nTreesInBlock * layout.nMaskWords * VECTOR_BLOCK_SIZE)
+    {}
+
+    /* Adds the response of every tree iTree for the row iRow of x to res[iRow * nClasses + iTree % nClasses] */
+    bool predict(const algorithmFPType * x, size_t nRows, size_t nCols, size_t nClasses, algorithmFPType * res);
+
+private:
+    void transpose(const algorithmFPType * x, size_t nRows, size_t nCols, algorithmFPType * xT, algorithmFPType * xMax) const;
+    void applyNode(size_t iNode, const algorithmFPType * xf, MaskType * state, bool bUnordered) const;
+    void addLeafValues(size_t iFirstTree, size_t nTrees, size_t nRows, size_t nClasses, const MaskType * state, algorithmFPType * res) const;
+    void addFallbackTrees(const algorithmFPType * x, size_t nRows, size_t nCols, size_t nClasses, algorithmFPType * res) const;
+
+private:
+    const QuickScorerLayout & _layout;
+    const TreeType * const * _trees;
+    const dtrees::internal::FeatureTypes & _featTypes;
+    daal::TlsMem<algorithmFPType, cpu> _xTls;
+    daal::TlsMem<MaskType, cpu> _stateTls;
+};
+
+template <typename algorithmFPType, CpuType cpu>
+void QuickScorer<algorithmFPType, cpu>::transpose(const algorithmFPType * x, size_t nRows, size_t nCols, algorithmFPType * xT,
+                                                   algorithmFPType * xMax) const
+{
+    const size_t nFeatures       = _layout.nFeatures;
+    const algorithmFPType lowest = -services::internal::MaxVal<algorithmFPType>::get();
+
+    for (size_t iRow = 0; iRow < nRows; ++iRow)
+    {
+        PRAGMA_IVDEP
+        for (size_t iFeature = 0; iFeature < nFeatures; ++iFeature) xT[iFeature * VECTOR_BLOCK_SIZE + iRow] = x[iRow * nCols + iFeature];
+    }
+
+    /* Rows of the incomplete tile never go to the right */
+    for (size_t iFeature = 0; iFeature < nFeatures; ++iFeature)
+    {
+        algorithmFPType * const xf = xT + iFeature * VECTOR_BLOCK_SIZE;
+        for (size_t iRow = nRows; iRow < VECTOR_BLOCK_SIZE; ++iRow) xf[iRow] = lowest;
+
+        algorithmFPType maxVal = lowest;
+        for (size_t iRow = 0; iRow < nRows; ++iRow) maxVal = (xf[iRow] > maxVal ? xf[iRow] : maxVal);
+        xMax[iFeature] = maxVal;
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void QuickScorer<algorithmFPType, cpu>::applyNode(size_t iNode, const algorithmFPType * xf, MaskType * state, bool bUnordered) const
+{
+    const size_t nMaskWords     = _layout.nMaskWords;
+    const ModelFPType threshold = _layout.thresholds[iNode];
+    const MaskType * const mask = _layout.masks.data() + iNode * nMaskWords;
+    const MaskType allLeaves    = ~MaskType(0);
+    MaskType * s                = state + _layout.treeIdx[iNode] * nMaskWords * VECTOR_BLOCK_SIZE;
+
+    for (size_t iWord = 0; iWord < nMaskWords; ++iWord, s += VECTOR_BLOCK_SIZE)
+    {
+        const MaskType m = mask[iWord];
+        if (m == allLeaves) continue;
+
+        if (bUnordered)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t k = 0; k < VECTOR_BLOCK_SIZE; ++k) s[k] &= (ModelFPType(xf[k]) != threshold ? m : allLeaves);
+        }
+        else
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t k = 0; k < VECTOR_BLOCK_SIZE; ++k) s[k] &= (xf[k] > threshold ? m : allLeaves);
+        }
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void QuickScorer<algorithmFPType, cpu>::addLeafValues(size_t iFirstTree, size_t nTrees, size_t nRows, size_t nClasses, const MaskType * state,
+                                                      algorithmFPType * res) const
+{
+    const size_t nMaskWords = _layout.nMaskWords;
+    const size_t nLeaves    = nMaskWords * QuickScorerLayout::nBitsInMask;
+
+    for (size_t iTree = 0; iTree < nTrees; ++iTree)
+    {
+        const MaskType * const s    = state + iTree * nMaskWords * VECTOR_BLOCK_SIZE;
+        const ModelFPType * leaves  = _layout.leafValues.data() + (iFirstTree + iTree) * nLeaves;
+        algorithmFPType * const val = res + _layout.treeIndices[iFirstTree + iTree] % nClasses;
+
+        for (size_t iRow = 0; iRow < nRows; ++iRow)
+        {
+            /* The rightmost leaf is never masked out, so the search stops inside the bitvector */
+            size_t iWord = 0;
+            for (; !s[iWord * VECTOR_BLOCK_SIZE + iRow]; ++iWord)
+                ;
+            const size_t iLeaf = iWord * QuickScorerLayout::nBitsInMask + getLowestSetBit(s[iWord * VECTOR_BLOCK_SIZE + iRow]);
+            val[iRow * nClasses] += leaves[iLeaf];
+        }
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void QuickScorer<algorithmFPType, cpu>::addFallbackTrees(const algorithmFPType * x, size_t nRows, size_t nCols, size_t nClasses,
+                                                         algorithmFPType * res) const
+{
+    algorithmFPType v[VECTOR_BLOCK_SIZE];
+    for (size_t i = 0; i < _layout.fallbackTrees.size(); ++i)
+    {
+        const size_t iTree          = _layout.fallbackTrees[i];
+        const TreeType & t          = *_trees[iTree];
+        algorithmFPType * const val = res + iTree % nClasses;
+        if (nRows == VECTOR_BLOCK_SIZE)
+        {
+            predictForTreeVector<algorithmFPType, TreeType, cpu>(t, _featTypes, x, v);
+            for (size_t iRow = 0; iRow < nRows; ++iRow) val[iRow * nClasses] += v[iRow];
+        }
+        else
+        {
+            for (size_t iRow = 0; iRow < nRows; ++iRow)
+            {
+                val[iRow * nClasses] += predictForTree<algorithmFPType, TreeType, cpu>(t, _featTypes, x + iRow * nCols);
+            }
+        }
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+bool QuickScorer<algorithmFPType, cpu>::predict(const algorithmFPType * x, size_t nRows, size_t nCols, size_t nClasses, algorithmFPType * res)
+{
+    DAAL_ASSERT(nRows <= VECTOR_BLOCK_SIZE);
+    DAAL_ASSERT(_layout.nFeatures <= nCols);
+
+    addFallbackTrees(x, nRows, nCols, nClasses, res);
+    if (!_layout.nTrees) return true;
+
+    const size_t nFeatures = _layout.nFeatures;
+    algorithmFPType * xT   = _xTls.local();
+    MaskType * const state = _stateTls.local();
+    if ((nFeatures && !xT) || !state) return false;
+    algorithmFPType * const xMax = xT + nFeatures * VECTOR_BLOCK_SIZE;
+
+    transpose(x, nRows, nCols, xT, xMax);
+
+    for (size_t iBlock = 0; iBlock < _layout.nTreeBlocks; ++iBlock)
+    {
+        const size_t iFirstTree = iBlock * _layout.nTreesInBlock;
+        const size_t nTrees     = (iFirstTree + _layout.nTreesInBlock < _layout.nTrees ? _layout.nTreesInBlock : _layout.nTrees - iFirstTree);
+        services::internal::service_memset_seq<MaskType, cpu>(state, ~MaskType(0), nTrees * _layout.nMaskWords * VECTOR_BLOCK_SIZE);
+
+        for (size_t iFeature = 0; iFeature < nFeatures; ++iFeature)
+        {
+            const size_t iLastNode           = _layout.firstNode(iBlock, iFeature + 1);
+            const algorithmFPType * const xf = xT + iFeature * VECTOR_BLOCK_SIZE;
+            size_t iNode                     = _layout.firstNode(iBlock, iFeature);
+
+            if (_featTypes.isUnordered(iFeature))
+            {
+                for (; iNode < iLastNode; ++iNode) applyNode(iNode, xf, state, true);
+            }
+            else
+            {
+                /* Thresholds are sorted: the nodes above the maximal value of the feature do not send any row to the right */
+                const algorithmFPType maxVal = xMax[iFeature];
+                for (; iNode < iLastNode && _layout.thresholds[iNode] < maxVal; ++iNode) applyNode(iNode, xf, state, false);
+            }
+        }
+
+        addLeafValues(iFirstTree, nTrees, nRows, nClasses, state, res);
+    }
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Returns the layout of the first nTrees trees of the model. The layout is built once and
+// kept by the model for the subsequent prediction calls.
+//////////////////////////////////////////////////////////////////////////////////////////
+template <CpuType cpu>
+services::Status getQuickScorerLayout(const gbt::internal::ModelImpl & model, const gbt::internal::GbtDecisionTree * const * trees, size_t nTrees,
+                                      QuickScorerLayoutPtr & layout)
+{
+    layout = model.getQuickScorerLayout(nTrees);
+    if (layout) return services::Status();
+
+    layout.reset(new QuickScorerLayout());
+    DAAL_CHECK_MALLOC(layout.get());
+    services::Status s = QuickScorerBuilder<cpu>::build(trees, nTrees, *layout);
+    if (s) model.setQuickScorerLayout(layout);
+    return s;
+}
+
+} /* namespace internal */
+} /* namespace prediction */
+} /* namespace gbt */
+} /* namespace algorithms */
+} /* namespace daal */
+
+#endif
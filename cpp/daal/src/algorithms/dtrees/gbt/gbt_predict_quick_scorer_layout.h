@@ -0,0 +1,88 @@
+/* file: gbt_predict_quick_scorer_layout.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the bitvector (QuickScorer) representation of gradient
+//  boosted trees used by the quickScorerDense prediction method.
+//--
+*/
+
+#ifndef __GBT_PREDICT_QUICK_SCORER_LAYOUT_H__
+#define __GBT_PREDICT_QUICK_SCORER_LAYOUT_H__
+
+#include "services/collection.h"
+#include "services/daal_shared_ptr.h"
+#include "src/algorithms/dtrees/gbt/gbt_predict_dense_default_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace prediction
+{
+namespace internal
+{
+//////////////////////////////////////////////////////////////////////////////////////////
+// QuickScorerLayout. Split nodes of an ensemble grouped by feature.
+// Leaves of every tree are numbered from left to right and tracked by a bitvector
+// of nMaskWords words. A split node keeps the mask that clears the leaves of its left
+// subtree: the mask is applied when the observation goes to the right.
+// The exit leaf of a tree is the lowest bit remaining set after all the masks applied.
+// Trees are grouped into blocks so that the bitvectors of a row tile stay in cache.
+// Trees with too many leaves are not put into the layout to bound the size of the masks,
+// they are predicted by the traversal of their nodes.
+//////////////////////////////////////////////////////////////////////////////////////////
+struct QuickScorerLayout
+{
+    typedef uint64_t MaskType;
+    static const size_t nBitsInMask = 64;
+
+    DAAL_NEW_DELETE();
+
+    QuickScorerLayout() : nTreesTotal(0), nTrees(0), nFeatures(0), nMaskWords(0), nTreesInBlock(0), nTreeBlocks(0) {}
+
+    /* Index of the first node of the given feature in the given block of trees */
+    size_t firstNode(size_t iBlock, size_t iFeature) const { return nodeOffsets[iBlock * nFeatures + iFeature]; }
+
+    size_t nTreesTotal;   /* Number of trees of the model the layout is built for */
+    size_t nTrees;        /* Number of trees in the layout */
+    size_t nFeatures;     /* Number of features referenced by split nodes */
+    size_t nMaskWords;    /* Number of words in the bitvector of leaves of a tree */
+    size_t nTreesInBlock; /* Maximal number of trees in a block */
+    size_t nTreeBlocks;   /* Number of blocks of trees */
+
+    services::Collection<size_t> nodeOffsets;          /* nTreeBlocks x nFeatures + 1 offsets of the nodes of a feature */
+    services::Collection<ModelFPType> thresholds;      /* Split values, ascending within a feature of a block */
+    services::Collection<FeatureIndexType> treeIdx;    /* Index of the tree of a split node within its block */
+    services::Collection<MaskType> masks;              /* nNodes x nMaskWords masks of the split nodes */
+    services::Collection<ModelFPType> leafValues;      /* nTrees x (nMaskWords * nBitsInMask) leaf responses */
+    services::Collection<size_t> treeIndices;          /* Indices in the model of the trees in the layout */
+    services::Collection<size_t> fallbackTrees;        /* Indices in the model of the trees predicted by traversal */
+};
+
+typedef services::SharedPtr<QuickScorerLayout> QuickScorerLayoutPtr;
+
+} /* namespace internal */
+} /* namespace prediction */
+} /* namespace gbt */
+} /* namespace algorithms */
+} /* namespace daal */
+
+#endif
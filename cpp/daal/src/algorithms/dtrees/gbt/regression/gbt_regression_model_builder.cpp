@@ -44,6 +44,7 @@ services::Status ModelBuilder::convertModelInternal()
 {
     gbt::regression::internal::ModelImpl & modelImplRef =
         daal::algorithms::dtrees::internal::getModelRef<daal::algorithms::gbt::regression::internal::ModelImpl, ModelPtr>(_model);
+    modelImplRef.resetQuickScorerLayout();
     return daal::algorithms::gbt::internal::ModelImpl::convertDecisionTreesToGbtTrees(modelImplRef._serializationData);
 }
 
@@ -66,6 +67,7 @@ services::Status ModelBuilder::createTreeInternal(size_t nNodes, TreeId & resId)
 {
     gbt::regression::internal::ModelImpl & modelImplRef =
         daal::algorithms::dtrees::internal::getModelRef<daal::algorithms::gbt::regression::internal::ModelImpl, ModelPtr>(_model);
+    modelImplRef.resetQuickScorerLayout();
     return daal::algorithms::dtrees::internal::createTreeInternal(modelImplRef._serializationData, nNodes, resId);
 }
 
@@ -73,6 +75,7 @@ services::Status ModelBuilder::addLeafNodeInternal(TreeId treeId, NodeId parentI
 {
     gbt::regression::internal::ModelImpl & modelImplRef =
         daal::algorithms::dtrees::internal::getModelRef<daal::algorithms::gbt::regression::internal::ModelImpl, ModelPtr>(_model);
+    modelImplRef.resetQuickScorerLayout();
     return daal::algorithms::dtrees::internal::addLeafNodeInternal<double>(modelImplRef._serializationData, treeId, parentId, position, response,
                                                                            res);
 }
@@ -82,6 +85,7 @@ services::Status ModelBuilder::addSplitNodeInternal(TreeId treeId, NodeId parent
 {
     gbt::regression::internal::ModelImpl & modelImplRef =
         daal::algorithms::dtrees::internal::getModelRef<daal::algorithms::gbt::regression::internal::ModelImpl, ModelPtr>(_model);
+    modelImplRef.resetQuickScorerLayout();
     return daal::algorithms::dtrees::internal::addSplitNodeInternal(modelImplRef._serializationData, treeId, parentId, position, featureIndex,
                                                                     featureValue, res);
 }
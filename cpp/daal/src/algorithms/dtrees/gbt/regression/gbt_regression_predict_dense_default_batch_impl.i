@@ -35,6 +35,7 @@
 #include "src/externals/service_memory.h"
 #include "src/algorithms/dtrees/regression/dtrees_regression_predict_dense_default_impl.i"
 #include "src/algorithms/dtrees/gbt/gbt_predict_dense_default_impl.i"
+#include "src/algorithms/dtrees/gbt/gbt_predict_quick_scorer_impl.i"
 
 using namespace daal::internal;
 using namespace daal::services::internal;
@@ -61,11 +62,13 @@ class PredictRegressionTask
 {
 public:
     typedef gbt::internal::GbtDecisionTree TreeType;
-    PredictRegressionTask(const NumericTable * x, NumericTable * y) : _data(x), _res(y) {}
+    PredictRegressionTask(const NumericTable * x, NumericTable * y, bool bQuickScorer = false) : _data(x), _res(y), _bQuickScorer(bQuickScorer) {}
     services::Status run(const gbt::regression::internal::ModelImpl * m, size_t nIterations, services::HostAppIface * pHostApp);
 
 protected:
+    services::Status initQuickScorer(const gbt::internal::ModelImpl & m);
     services::Status runInternal(services::HostAppIface * pHostApp, NumericTable * result);
+    services::Status runQuickScorer(services::HostAppIface * pHostApp, NumericTable * result);
     algorithmFPType predictByTrees(size_t iFirstTree, size_t nTrees, const algorithmFPType * x);
     void predictByTreesVector(size_t iFirstTree, size_t nTrees, const algorithmFPType * x, algorithmFPType * res);
 
@@ -74,6 +77,8 @@ protected:
     TArray<const TreeType *, cpu> _aTree;
     const NumericTable * _data;
     NumericTable * _res;
+    bool _bQuickScorer;
+    gbt::prediction::internal::QuickScorerLayoutPtr _quickScorerLayout;
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -85,7 +90,7 @@ services::Status PredictKernel<algorithmFPType, method, cpu>::compute(services::
 {
     const daal::algorithms::gbt::regression::internal::ModelImpl * pModel =
         static_cast<const daal::algorithms::gbt::regression::internal::ModelImpl *>(m);
-    PredictRegressionTask<algorithmFPType, cpu> task(x, r);
+    PredictRegressionTask<algorithmFPType, cpu> task(x, r, method == quickScorerDense);
     return task.run(pModel, nIterations, pHostApp);
 }
 
@@ -99,12 +104,23 @@ services::Status PredictRegressionTask<algorithmFPType, cpu>::run(const gbt::reg
     this->_aTree.reset(nTreesTotal);
     DAAL_CHECK_MALLOC(this->_aTree.get());
     for (size_t i = 0; i < nTreesTotal; ++i) this->_aTree[i] = m->at(i);
+    services::Status s = initQuickScorer(*m);
+    if (!s) return s;
     return runInternal(pHostApp, this->_res);
 }
 
+template <typename algorithmFPType, CpuType cpu>
+services::Status PredictRegressionTask<algorithmFPType, cpu>::initQuickScorer(const gbt::internal::ModelImpl & m)
+{
+    if (!_bQuickScorer) return services::Status();
+    return gbt::prediction::internal::getQuickScorerLayout<cpu>(m, _aTree.get(), _aTree.size(), _quickScorerLayout);
+}
+
 template <typename algorithmFPType, CpuType cpu>
 services::Status PredictRegressionTask<algorithmFPType, cpu>::runInternal(services::HostAppIface * pHostApp, NumericTable * result)
 {
+    if (_quickScorerLayout) return runQuickScorer(pHostApp, result);
+
     const auto nTreesTotal = this->_aTree.size();
 
     gbt::prediction::internal::TileDimensions<algorithmFPType> dim(*this->_data, nTreesTotal);
@@ -143,6 +159,37 @@ services::Status PredictRegressionTask<algorithmFPType, cpu>::runInternal(servic
     return s;
 }
 
+template <typename algorithmFPType, CpuType cpu>
+services::Status PredictRegressionTask<algorithmFPType, cpu>::runQuickScorer(services::HostAppIface * pHostApp, NumericTable * result)
+{
+    gbt::prediction::internal::TileDimensions<algorithmFPType> dim(*this->_data, this->_aTree.size());
+    WriteOnlyRows<algorithmFPType, cpu> resBD(result, 0, dim.nRowsTotal);
+    DAAL_CHECK_BLOCK_STATUS(resBD);
+    services::internal::service_memset<algorithmFPType, cpu>(resBD.get(), 0, dim.nRowsTotal);
+
+    services::Status s;
+    HostAppHelper host(pHostApp, 100);
+    if (host.isCancelled(s, 1)) return s;
+
+    gbt::prediction::internal::QuickScorer<algorithmFPType, cpu> scorer(*_quickScorerLayout, this->_aTree.get(), this->_featHelper);
+    SafeStatus safeStat;
+    daal::threader_for(dim.nDataBlocks, dim.nDataBlocks, [&](size_t iBlock) {
+        const size_t iStartRow      = iBlock * dim.nRowsInBlock;
+        const size_t nRowsToProcess = (iBlock == dim.nDataBlocks - 1) ? dim.nRowsTotal - iBlock * dim.nRowsInBlock : dim.nRowsInBlock;
+        ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable *>(this->_data), iStartRow, nRowsToProcess);
+        DAAL_CHECK_BLOCK_STATUS_THR(xBD);
+        algorithmFPType * res = resBD.get() + iStartRow;
+
+        for (size_t iRow = 0; iRow < nRowsToProcess; iRow += VECTOR_BLOCK_SIZE)
+        {
+            const size_t nRows = (iRow + VECTOR_BLOCK_SIZE <= nRowsToProcess ? VECTOR_BLOCK_SIZE : nRowsToProcess - iRow);
+            DAAL_CHECK_MALLOC_THR(scorer.predict(xBD.get() + iRow * dim.nCols, nRows, dim.nCols, 1, res + iRow));
+        }
+    });
+
+    return safeStat.detach();
+}
+
 template <typename algorithmFPType, CpuType cpu>
 algorithmFPType PredictRegressionTask<algorithmFPType, cpu>::predictByTrees(size_t iFirstTree, size_t nTrees, const algorithmFPType * x)
 {
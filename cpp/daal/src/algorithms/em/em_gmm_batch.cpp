@@ -44,15 +44,18 @@ __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_EM_GMM_RESULT_ID);
  * \param[in] maxIterations            Maximal number of iterations of the algorithm
  * \param[in] accuracyThreshold        Threshold for the termination of the algorithm
  * \param[in] covariance               Pointer to the algorithm that computes the covariance
+ * \param[in] stepSizeDecay            Decay rate of the step size of the online processing mode
  */
 Parameter::Parameter(const size_t _nComponents, const SharedPtr<covariance::BatchImpl> & _covariance, const size_t _maxIterations,
-                     const double _accuracyThreshold, const double _regularizationFactor, const CovarianceStorageId _covarianceStorage)
+                     const double _accuracyThreshold, const double _regularizationFactor, const CovarianceStorageId _covarianceStorage,
+                     const double _stepSizeDecay)
     : nComponents(_nComponents),
       maxIterations(_maxIterations),
       accuracyThreshold(_accuracyThreshold),
       covariance(_covariance),
       regularizationFactor(_regularizationFactor),
-      covarianceStorage(_covarianceStorage)
+      covarianceStorage(_covarianceStorage),
+      stepSizeDecay(_stepSizeDecay)
 {}
 
 Parameter::Parameter(const Parameter & other)
@@ -61,7 +64,8 @@ Parameter::Parameter(const Parameter & other)
       accuracyThreshold(other.accuracyThreshold),
       covariance(other.covariance),
       regularizationFactor(other.regularizationFactor),
-      covarianceStorage(other.covarianceStorage)
+      covarianceStorage(other.covarianceStorage),
+      stepSizeDecay(other.stepSizeDecay)
 {}
 
 services::Status Parameter::check() const
@@ -71,6 +75,7 @@ services::Status Parameter::check() const
     DAAL_CHECK_EX(nComponents > 0, ErrorEMIncorrectNumberOfComponents, ParameterName, nComponentsStr());
     DAAL_CHECK_EX(covariance, ErrorNullAuxiliaryAlgorithm, ParameterName, covarianceStr());
     DAAL_CHECK(regularizationFactor >= 0, ErrorIncorrectParameter);
+    DAAL_CHECK_EX(stepSizeDecay > 0.5 && stepSizeDecay <= 1.0, ErrorIncorrectParameter, ParameterName, stepSizeDecayStr());
     return services::Status();
 }
 
@@ -255,11 +260,28 @@ NumericTablePtr Result::get(ResultCovariancesId id, size_t index) const
 */
 services::Status Result::check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par, int method) const
 {
-    Input * algInput         = static_cast<Input *>(const_cast<daal::algorithms::Input *>(input));
-    Parameter * algParameter = static_cast<Parameter *>(const_cast<daal::algorithms::Parameter *>(par));
+    const Input * algInput = static_cast<const Input *>(input);
+    return checkImpl(algInput->get(data)->getNumberOfColumns(), par);
+}
 
-    size_t nComponents = algParameter->nComponents;
-    size_t nFeatures   = algInput->get(data)->getNumberOfColumns();
+/**
+* Checks the result parameter of the EM for GMM algorithm in the online processing mode
+* \param[in] partialResult %Partial result of the algorithm
+* \param[in] par           %Parameter of algorithm
+* \param[in] method        Computation method
+*/
+services::Status Result::check(const daal::algorithms::PartialResult * partialResult, const daal::algorithms::Parameter * par, int method) const
+{
+    services::Status s;
+    size_t nFeatures = 0;
+    DAAL_CHECK_STATUS(s, static_cast<const PartialResult *>(partialResult)->getNumberOfFeatures(nFeatures));
+    return checkImpl(nFeatures, par);
+}
+
+services::Status Result::checkImpl(size_t nFeatures, const daal::algorithms::Parameter * par) const
+{
+    const Parameter * algParameter = static_cast<const Parameter *>(par);
+    size_t nComponents             = algParameter->nComponents;
 
     services::Status s;
     int unexpectedLayouts = packed_mask;
@@ -68,8 +68,9 @@ services::Status EMKernelTask<algorithmFPType, method, cpu>::compute()
     double diff             = 2 * threshold + 1;
     double oldLogLikelyhood = 0;
 
+    const algorithmFPType * diagCoeffs = diagCoeffsPtr.get();
     daal::tls<Task<algorithmFPType, cpu> *> threadBuffer([=]() -> Task<algorithmFPType, cpu> * {
-        return new Task<algorithmFPType, cpu>(dataTable, blockSizeDefault, nFeatures, nComponents, logAlpha, means, covs.get());
+        return new Task<algorithmFPType, cpu>(dataTable, blockSizeDefault, nFeatures, nComponents, logAlpha, means, covs.get(), diagCoeffs);
     });
     int & iterCounter               = iterCounterArray[0];
     algorithmFPType & logLikelyhood = logLikelyhoodArray[0];
@@ -81,6 +82,11 @@ services::Status EMKernelTask<algorithmFPType, method, cpu>::compute()
 
         Math<algorithmFPType, cpu>::vLog(nComponents, alpha, logAlpha); // inplace: same memory as alpha
 
+        if (par.covarianceStorage == diagonal)
+        {
+            computeDiagonalCoefficients();
+        }
+
         logLikelyhood = 0;
 
         SafeStatus safeStat;
@@ -169,26 +175,40 @@ void EMKernelTask<algorithmFPType, method, cpu>::stepE(const size_t nVectorsInCu
 
     if (covType == diagonal)
     {
-        for (size_t k = 0; k < nComponents; k++)
+        /* The log-densities of all the components are evaluated for the whole block with one matrix multiplication:
+         * p[k, i] = [x_i^2, x_i] * diagCoeffs[k] + const_k, the block of [x^2, x] occupies x_mu and Ax_mu */
+        const size_t nCoeffs      = 2 * nFeatures;
+        algorithmFPType * xx_x    = t.x_mu;
+        const algorithmFPType * x = t.dataBlock;
+        for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
         {
-            const algorithmFPType * curMean  = &t.means[k * nFeatures];
-            const algorithmFPType * invSigma = (t.covs->getSigma())[k];
-            const algorithmFPType addition   = t.logAlpha[k] + t.logSqrtInvDetSigma[k];
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                xx_x[i * nCoeffs + j]             = x[i * nFeatures + j] * x[i * nFeatures + j];
+                xx_x[i * nCoeffs + nFeatures + j] = x[i * nFeatures + j];
+            }
+        }
 
+        const algorithmFPType * addition = t.diagCoeffs + nComponents * nCoeffs;
+        for (size_t k = 0; k < nComponents; k++)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
             for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
             {
-                algorithmFPType tp = 0;
-                PRAGMA_IVDEP
-                PRAGMA_VECTOR_ALWAYS
-                for (size_t j = 0; j < nFeatures; j++)
-                {
-                    algorithmFPType x_mu = t.dataBlock[i * nFeatures + j] - curMean[j];
-                    tp += x_mu * x_mu * invSigma[j];
-                }
-
-                t.p[k * nVectorsInCurrentBlock + i] = addition + -0.5 * tp;
+                t.p[k * nVectorsInCurrentBlock + i] = addition[k];
             }
         }
+
+        char transa         = 'T';
+        char transb         = 'N';
+        DAAL_INT m          = nVectorsInCurrentBlock;
+        DAAL_INT n          = nComponents;
+        DAAL_INT kDim       = nCoeffs;
+        algorithmFPType one = 1.0;
+        Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &m, &n, &kDim, &one, xx_x, &kDim, t.diagCoeffs, &kDim, &one, t.p, &m);
     }
     else
     {
@@ -384,6 +404,35 @@ Status EMKernelTask<algorithmFPType, method, cpu>::stepM_partial(const size_t nV
     return Status();
 }
 
+/**
+ * Function represents the log-densities of the diagonal components as linear functions of [x^2, x]:
+ * log(alpha_k * N(x | mu_k, sigma_k)) = sum_j (-0.5 * s_kj * x_j^2 + mu_kj * s_kj * x_j) + const_k, where s_k = 1 / sigma_k
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+void EMKernelTask<algorithmFPType, method, cpu>::computeDiagonalCoefficients()
+{
+    const size_t nCoeffs                       = 2 * nFeatures;
+    algorithmFPType * diagCoeffs               = diagCoeffsPtr.get();
+    algorithmFPType * addition                 = diagCoeffs + nComponents * nCoeffs;
+    const algorithmFPType * logSqrtInvDetSigma = covs->getLogSqrtInvDetSigma();
+
+    for (size_t k = 0; k < nComponents; k++)
+    {
+        const algorithmFPType * curMean  = &means[k * nFeatures];
+        const algorithmFPType * invSigma = covs->getSigma(k);
+        algorithmFPType * coeffs         = &diagCoeffs[k * nCoeffs];
+
+        algorithmFPType muInvSigmaMu = 0;
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            coeffs[j]             = -0.5 * invSigma[j];
+            coeffs[nFeatures + j] = curMean[j] * invSigma[j];
+            muInvSigmaMu += curMean[j] * coeffs[nFeatures + j];
+        }
+        addition[k] = logAlpha[k] + logSqrtInvDetSigma[k] - 0.5 * muInvSigmaMu;
+    }
+}
+
 /**
  * Function scales merged values of to get result
  */
@@ -489,6 +538,12 @@ Status EMKernelTask<algorithmFPType, method, cpu>::initialize()
     covs = initializeCovariances();
     DAAL_CHECK(covs, ErrorMemoryAllocationFailed);
 
+    if (par.covarianceStorage == diagonal)
+    {
+        diagCoeffsPtr.reset(nComponents * (2 * nFeatures + 1));
+        DAAL_CHECK(diagCoeffsPtr.get(), ErrorMemoryAllocationFailed);
+    }
+
     return Status();
 }
 
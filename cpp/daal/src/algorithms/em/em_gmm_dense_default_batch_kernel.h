@@ -75,6 +75,7 @@ public:
     Status initialize();
     services::Status setStartValues();
     void setResultToZero();
+    void computeDiagonalCoefficients();
     Status stepM_merge(size_t iteration);
 
     static void stepE(const size_t nVectorsInCurrentBlock, Task<algorithmFPType, cpu> & t, em_gmm::CovarianceStorageId covType);
@@ -100,6 +101,7 @@ public:
     const algorithmFPType threshold;
     TArray<WriteRows<algorithmFPType, cpu, NumericTable>, cpu> covsPtr;
     GmmModelPtr covs;
+    TArray<algorithmFPType, cpu> diagCoeffsPtr;
 
     WriteRows<algorithmFPType, cpu, NumericTable> weightsBD;
     WriteRows<algorithmFPType, cpu, NumericTable> meansBD;
@@ -287,7 +287,7 @@ struct Task
 
     Task(NumericTable & _dataTable, size_t blockSizeDefault, size_t _nFeatures, size_t _nComponents,
          algorithmFPType * _logAlpha, //placed in alpha memory
-         algorithmFPType * _means, GmmModel<algorithmFPType, cpu> * _covs)
+         algorithmFPType * _means, GmmModel<algorithmFPType, cpu> * _covs, const algorithmFPType * _diagCoeffs = nullptr)
         : dataTable(&_dataTable),
           dataBlock(nullptr),
           logAlpha(_logAlpha),
@@ -295,6 +295,7 @@ struct Task
           covs(_covs),
           invSigma(_covs->getSigma()),
           logSqrtInvDetSigma(_covs->getLogSqrtInvDetSigma()),
+          diagCoeffs(_diagCoeffs),
           nFeatures(_nFeatures),
           nComponents(_nComponents),
           logLikelyhood(0)
@@ -379,6 +380,7 @@ struct Task
     algorithmFPType * means;
     algorithmFPType ** invSigma;
     algorithmFPType * logSqrtInvDetSigma;
+    const algorithmFPType * diagCoeffs; /* coefficients of the log-densities of the diagonal components as linear functions of [x^2, x] */
     algorithmFPType partLogLikelyhood;
 
     algorithmFPType * wSums;
@@ -0,0 +1,267 @@
+/* file: em_gmm_dense_default_online_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the stepwise EM for GMM in the online processing mode.
+//--
+*/
+
+#ifndef __EM_GMM_DENSE_DEFAULT_ONLINE_IMPL_I__
+#define __EM_GMM_DENSE_DEFAULT_ONLINE_IMPL_I__
+
+#include "data_management/data/homogen_numeric_table.h"
+#include "src/algorithms/em/em_gmm_dense_default_online_kernel.h"
+#include "src/algorithms/em/em_gmm_dense_default_batch_impl.i"
+#include "src/data_management/service_numeric_table.h"
+#include "src/externals/service_math.h"
+#include "src/threading/threading.h"
+#include "src/algorithms/service_error_handling.h"
+
+using namespace daal::internal;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace em_gmm
+{
+namespace internal
+{
+/**
+ * Runs one EM iteration on the block of data starting from the model fitted to the previous blocks
+ * (from the initial values for the first block) and blends the resulting model into the partial result
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status EMOnlineKernel<algorithmFPType, method, cpu>::compute(NumericTable & dataTable, NumericTable & initialWeights,
+                                                                       NumericTable & initialMeans, NumericTable ** initialCovariances,
+                                                                       NumericTable & partialWeights, NumericTable & partialMeans,
+                                                                       NumericTable ** partialCovariances, NumericTable & partialGoalFunction,
+                                                                       NumericTable & partialNBlocks, const Parameter & par)
+{
+    Status s;
+    const size_t nFeatures   = dataTable.getNumberOfColumns();
+    const size_t nComponents = par.nComponents;
+    const size_t nRowsInCov  = (par.covarianceStorage == diagonal) ? 1 : nFeatures;
+
+    int nBlocks = 0;
+    {
+        ReadRows<int, cpu> nBlocksRows(partialNBlocks, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(nBlocksRows);
+        nBlocks = nBlocksRows.get()[0];
+    }
+
+    NumericTablePtr blockWeights = HomogenNumericTable<algorithmFPType>::create(nComponents, 1, NumericTable::doAllocate, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    NumericTablePtr blockMeans = HomogenNumericTable<algorithmFPType>::create(nFeatures, nComponents, NumericTable::doAllocate, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    NumericTablePtr blockGoalFunction = HomogenNumericTable<algorithmFPType>::create(1, 1, NumericTable::doAllocate, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    NumericTablePtr blockNIterations = HomogenNumericTable<int>::create(1, 1, NumericTable::doAllocate, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    DataCollection blockCovariancesCollection;
+    TArray<NumericTable *, cpu> blockCovariancesPtr(nComponents);
+    NumericTable ** blockCovariances = blockCovariancesPtr.get();
+    DAAL_CHECK_MALLOC(blockCovariances);
+    for (size_t i = 0; i < nComponents; i++)
+    {
+        NumericTablePtr cov = HomogenNumericTable<algorithmFPType>::create(nFeatures, nRowsInCov, NumericTable::doAllocate, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        blockCovariancesCollection.push_back(cov);
+        blockCovariances[i] = cov.get();
+    }
+
+    /* The first block starts from the initial values, the next ones start from the model fitted to the previous blocks */
+    NumericTable & startWeights      = nBlocks ? partialWeights : initialWeights;
+    NumericTable & startMeans        = nBlocks ? partialMeans : initialMeans;
+    NumericTable ** startCovariances = nBlocks ? partialCovariances : initialCovariances;
+
+    Parameter blockPar(par);
+    blockPar.maxIterations = 1;
+    {
+        EMKernelTask<algorithmFPType, method, cpu> kernelTask(dataTable, startWeights, startMeans, startCovariances, *blockWeights, *blockMeans,
+                                                              blockCovariances, *blockNIterations, *blockGoalFunction, blockPar);
+        DAAL_CHECK_STATUS(s, kernelTask.compute());
+    }
+
+    /* Step size of the block t is (t + 1)^(-kappa), the model fitted to the first block replaces the empty one */
+    const algorithmFPType stepSize = Math<algorithmFPType, cpu>::sPowx(algorithmFPType(nBlocks + 1), algorithmFPType(-par.stepSizeDecay));
+    DAAL_CHECK_STATUS(s, blendModels(stepSize, *blockWeights, *blockMeans, blockCovariances, partialWeights, partialMeans, partialCovariances,
+                                     nFeatures, par));
+
+    ReadRows<algorithmFPType, cpu> blockGoalFunctionRows(blockGoalFunction.get(), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(blockGoalFunctionRows);
+    WriteOnlyRows<algorithmFPType, cpu> goalFunctionRows(partialGoalFunction, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(goalFunctionRows);
+    goalFunctionRows.get()[0] = blockGoalFunctionRows.get()[0];
+
+    WriteOnlyRows<int, cpu> nBlocksRows(partialNBlocks, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nBlocksRows);
+    nBlocksRows.get()[0] = nBlocks + 1;
+    return s;
+}
+
+/**
+ * Blends the model fitted to the block into the model fitted to the previous blocks.
+ * The sufficient statistics (weights, weighted means and weighted cross products normalized by the number of observations)
+ * are combined as (1 - stepSize) * previous + stepSize * block, that gives for every component:
+ * W = w1 + w2, mu = (w1 * mu_1 + w2 * mu_2) / W, sigma = (w1 * sigma_1 + w2 * sigma_2) / W + w1 * w2 / W^2 * (mu_1 - mu_2)(mu_1 - mu_2)^T,
+ * where w1 = (1 - stepSize) * W_1 and w2 = stepSize * W_2. A component with W close to zero is left unchanged.
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status EMOnlineKernel<algorithmFPType, method, cpu>::blendModels(algorithmFPType stepSize, NumericTable & blockWeights,
+                                                                           NumericTable & blockMeans, NumericTable ** blockCovariances,
+                                                                           NumericTable & partialWeights, NumericTable & partialMeans,
+                                                                           NumericTable ** partialCovariances, size_t nFeatures,
+                                                                           const Parameter & par)
+{
+    const size_t nComponents = par.nComponents;
+    const size_t nRowsInCov  = (par.covarianceStorage == diagonal) ? 1 : nFeatures;
+
+    ReadRows<algorithmFPType, cpu> blockWeightsRows(blockWeights, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(blockWeightsRows);
+    ReadRows<algorithmFPType, cpu> blockMeansRows(blockMeans, 0, nComponents);
+    DAAL_CHECK_BLOCK_STATUS(blockMeansRows);
+    WriteRows<algorithmFPType, cpu> weightsRows(partialWeights, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(weightsRows);
+    WriteRows<algorithmFPType, cpu> meansRows(partialMeans, 0, nComponents);
+    DAAL_CHECK_BLOCK_STATUS(meansRows);
+
+    const algorithmFPType * const blockWeightsArray = blockWeightsRows.get();
+    const algorithmFPType * const blockMeansArray   = blockMeansRows.get();
+    algorithmFPType * const weightsArray            = weightsRows.get();
+    algorithmFPType * const meansArray              = meansRows.get();
+
+    SafeStatus safeStat;
+    daal::threader_for(nComponents, nComponents, [&](size_t k) {
+        const algorithmFPType w1 = (algorithmFPType(1) - stepSize) * weightsArray[k];
+        const algorithmFPType w2 = stepSize * blockWeightsArray[k];
+        /* The component is empty in both models, keep the previous one */
+        if (!(w1 + w2 > MinVal<algorithmFPType>::get())) return;
+        const algorithmFPType a = w1 / (w1 + w2);
+        const algorithmFPType b = w2 / (w1 + w2);
+
+        ReadRows<algorithmFPType, cpu> blockCovRows(blockCovariances[k], 0, nRowsInCov);
+        DAAL_CHECK_BLOCK_STATUS_THR(blockCovRows);
+        WriteRows<algorithmFPType, cpu> covRows(partialCovariances[k], 0, nRowsInCov);
+        DAAL_CHECK_BLOCK_STATUS_THR(covRows);
+        const algorithmFPType * const blockCov = blockCovRows.get();
+        algorithmFPType * const cov            = covRows.get();
+
+        algorithmFPType * const mean            = &meansArray[k * nFeatures];
+        const algorithmFPType * const blockMean = &blockMeansArray[k * nFeatures];
+        if (nRowsInCov == 1)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                const algorithmFPType diff = mean[j] - blockMean[j];
+                cov[j]                     = a * cov[j] + b * blockCov[j] + a * b * diff * diff;
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < nFeatures; i++)
+            {
+                const algorithmFPType diff = a * b * (mean[i] - blockMean[i]);
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < nFeatures; j++)
+                {
+                    cov[i * nFeatures + j] = a * cov[i * nFeatures + j] + b * blockCov[i * nFeatures + j] + diff * (mean[j] - blockMean[j]);
+                }
+            }
+        }
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            mean[j] = a * mean[j] + b * blockMean[j];
+        }
+        weightsArray[k] = w1 + w2;
+    });
+    return safeStat.detach();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status EMOnlineKernel<algorithmFPType, method, cpu>::finalizeCompute(NumericTable & partialWeights, NumericTable & partialMeans,
+                                                                               NumericTable ** partialCovariances, NumericTable & partialGoalFunction,
+                                                                               NumericTable & partialNBlocks, NumericTable & resultWeights,
+                                                                               NumericTable & resultMeans, NumericTable ** resultCovariances,
+                                                                               NumericTable & resultGoalFunction, NumericTable & resultNIterations,
+                                                                               const Parameter & par)
+{
+    const size_t nFeatures   = partialMeans.getNumberOfColumns();
+    const size_t nComponents = par.nComponents;
+    const size_t nRowsInCov  = (par.covarianceStorage == diagonal) ? 1 : nFeatures;
+
+    int result = 0;
+    {
+        ReadRows<algorithmFPType, cpu> weightsRows(partialWeights, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(weightsRows);
+        WriteOnlyRows<algorithmFPType, cpu> resultWeightsRows(resultWeights, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(resultWeightsRows);
+        const size_t size = nComponents * sizeof(algorithmFPType);
+        result |= daal::services::internal::daal_memcpy_s(resultWeightsRows.get(), size, weightsRows.get(), size);
+    }
+    {
+        ReadRows<algorithmFPType, cpu> meansRows(partialMeans, 0, nComponents);
+        DAAL_CHECK_BLOCK_STATUS(meansRows);
+        WriteOnlyRows<algorithmFPType, cpu> resultMeansRows(resultMeans, 0, nComponents);
+        DAAL_CHECK_BLOCK_STATUS(resultMeansRows);
+        const size_t size = nComponents * nFeatures * sizeof(algorithmFPType);
+        result |= daal::services::internal::daal_memcpy_s(resultMeansRows.get(), size, meansRows.get(), size);
+    }
+    for (size_t i = 0; i < nComponents; i++)
+    {
+        ReadRows<algorithmFPType, cpu> covRows(partialCovariances[i], 0, nRowsInCov);
+        DAAL_CHECK_BLOCK_STATUS(covRows);
+        WriteOnlyRows<algorithmFPType, cpu> resultCovRows(resultCovariances[i], 0, nRowsInCov);
+        DAAL_CHECK_BLOCK_STATUS(resultCovRows);
+        const size_t size = nRowsInCov * nFeatures * sizeof(algorithmFPType);
+        result |= daal::services::internal::daal_memcpy_s(resultCovRows.get(), size, covRows.get(), size);
+    }
+    DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+
+    ReadRows<algorithmFPType, cpu> goalFunctionRows(partialGoalFunction, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(goalFunctionRows);
+    WriteOnlyRows<algorithmFPType, cpu> resultGoalFunctionRows(resultGoalFunction, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(resultGoalFunctionRows);
+    resultGoalFunctionRows.get()[0] = goalFunctionRows.get()[0];
+
+    /* Every processed block gets one EM iteration */
+    ReadRows<int, cpu> nBlocksRows(partialNBlocks, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nBlocksRows);
+    WriteOnlyRows<int, cpu> resultNIterationsRows(resultNIterations, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(resultNIterationsRows);
+    resultNIterationsRows.get()[0] = nBlocksRows.get()[0];
+    return services::Status();
+}
+
+} // namespace internal
+
+} // namespace em_gmm
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
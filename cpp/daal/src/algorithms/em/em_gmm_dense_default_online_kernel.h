@@ -0,0 +1,72 @@
+/* file: em_gmm_dense_default_online_kernel.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template function that calculate ems in the online processing mode.
+//--
+*/
+
+#ifndef __EM_GMM_DENSE_DEFAULT_ONLINE_KERNEL_H__
+#define __EM_GMM_DENSE_DEFAULT_ONLINE_KERNEL_H__
+
+#include "algorithms/em/em_gmm_online.h"
+#include "src/algorithms/kernel.h"
+#include "data_management/data/numeric_table.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace em_gmm
+{
+namespace internal
+{
+/**
+ * Stepwise (mini-batch) EM: every block of data gets one EM iteration started from the current model,
+ * the statistics of the block are blended into the model with the decreasing step size
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+class EMOnlineKernel : public Kernel
+{
+public:
+    services::Status compute(NumericTable & dataTable, NumericTable & initialWeights, NumericTable & initialMeans, NumericTable ** initialCovariances,
+                             NumericTable & partialWeights, NumericTable & partialMeans, NumericTable ** partialCovariances,
+                             NumericTable & partialGoalFunction, NumericTable & partialNBlocks, const Parameter & par);
+
+    services::Status finalizeCompute(NumericTable & partialWeights, NumericTable & partialMeans, NumericTable ** partialCovariances,
+                                     NumericTable & partialGoalFunction, NumericTable & partialNBlocks, NumericTable & resultWeights,
+                                     NumericTable & resultMeans, NumericTable ** resultCovariances, NumericTable & resultGoalFunction,
+                                     NumericTable & resultNIterations, const Parameter & par);
+
+protected:
+    services::Status blendModels(algorithmFPType stepSize, NumericTable & blockWeights, NumericTable & blockMeans, NumericTable ** blockCovariances,
+                                 NumericTable & partialWeights, NumericTable & partialMeans, NumericTable ** partialCovariances, size_t nFeatures,
+                                 const Parameter & par);
+};
+
+} // namespace internal
+
+} // namespace em_gmm
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
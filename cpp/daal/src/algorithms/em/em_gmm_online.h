@@ -0,0 +1,133 @@
+/* file: em_gmm_online.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the EM for GMM interface in the online processing mode.
+//--
+*/
+
+#ifndef __EM_ONLINE_
+#define __EM_ONLINE_
+
+#include "algorithms/em/em_gmm_types.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace em_gmm
+{
+/**
+ * Allocates memory for storing results of the EM for GMM algorithm in the online processing mode
+ * \param[in] partialResult Pointer to the partial result structure
+ * \param[in] parameter     Pointer to the parameter structure
+ * \param[in] method        Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::PartialResult * partialResult, const daal::algorithms::Parameter * parameter,
+                                              const int method)
+{
+    const Parameter * algParameter = static_cast<const Parameter *>(parameter);
+
+    services::Status status;
+    size_t nFeatures = 0;
+    DAAL_CHECK_STATUS(status, static_cast<const PartialResult *>(partialResult)->getNumberOfFeatures(nFeatures));
+    size_t nComponents = algParameter->nComponents;
+
+    set(weights, HomogenNumericTable<algorithmFPType>::create(nComponents, 1, NumericTable::doAllocate, 0, &status));
+    set(means, HomogenNumericTable<algorithmFPType>::create(nFeatures, nComponents, NumericTable::doAllocate, 0, &status));
+
+    const size_t nRowsInCov                = (algParameter->covarianceStorage == diagonal) ? 1 : nFeatures;
+    DataCollectionPtr covarianceCollection = DataCollectionPtr(new DataCollection());
+    for (size_t i = 0; i < nComponents; i++)
+    {
+        covarianceCollection->push_back(HomogenNumericTable<algorithmFPType>::create(nFeatures, nRowsInCov, NumericTable::doAllocate, 0, &status));
+    }
+    set(covariances, covarianceCollection);
+
+    set(goalFunction, HomogenNumericTable<algorithmFPType>::create(1, 1, NumericTable::doAllocate, 0, &status));
+    set(nIterations, HomogenNumericTable<int>::create(1, 1, NumericTable::doAllocate, 0, &status));
+    return status;
+}
+
+/**
+ * Allocates memory for storing partial results of the EM for GMM algorithm
+ * \param[in] input     Pointer to the input structure
+ * \param[in] parameter Pointer to the parameter structure
+ * \param[in] method    Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter,
+                                                     const int method)
+{
+    const Input * algInput         = static_cast<const Input *>(input);
+    const Parameter * algParameter = static_cast<const Parameter *>(parameter);
+
+    size_t nFeatures   = algInput->get(data)->getNumberOfColumns();
+    size_t nComponents = algParameter->nComponents;
+
+    services::Status status;
+
+    set(partialWeights, HomogenNumericTable<algorithmFPType>::create(nComponents, 1, NumericTable::doAllocate, 0, &status));
+    set(partialMeans, HomogenNumericTable<algorithmFPType>::create(nFeatures, nComponents, NumericTable::doAllocate, 0, &status));
+
+    const size_t nRowsInCov                = (algParameter->covarianceStorage == diagonal) ? 1 : nFeatures;
+    DataCollectionPtr covarianceCollection = DataCollectionPtr(new DataCollection());
+    for (size_t i = 0; i < nComponents; i++)
+    {
+        covarianceCollection->push_back(HomogenNumericTable<algorithmFPType>::create(nFeatures, nRowsInCov, NumericTable::doAllocate, 0, &status));
+    }
+    set(partialCovariances, covarianceCollection);
+
+    set(partialGoalFunction, HomogenNumericTable<algorithmFPType>::create(1, 1, NumericTable::doAllocate, 0, &status));
+    set(partialNBlocks, HomogenNumericTable<int>::create(1, 1, NumericTable::doAllocate, 0, &status));
+    return status;
+}
+
+/**
+ * Initializes partial results of the EM for GMM algorithm with the empty model.
+ * The model is taken from the input initial values when the first block is processed
+ * \param[in] input     Pointer to the input structure
+ * \param[in] parameter Pointer to the parameter structure
+ * \param[in] method    Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::initialize(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter,
+                                                       const int method)
+{
+    services::Status s;
+    DAAL_CHECK_STATUS(s, get(partialWeights)->assign((algorithmFPType)0.0));
+    DAAL_CHECK_STATUS(s, get(partialMeans)->assign((algorithmFPType)0.0));
+    DAAL_CHECK_STATUS(s, get(partialGoalFunction)->assign((algorithmFPType)0.0));
+    DAAL_CHECK_STATUS(s, get(partialNBlocks)->assign(0));
+
+    const size_t nComponents = static_cast<const Parameter *>(parameter)->nComponents;
+    for (size_t i = 0; i < nComponents; i++)
+    {
+        DAAL_CHECK_STATUS(s, get(partialCovariances, i)->assign((algorithmFPType)0.0));
+    }
+    return s;
+}
+
+} // namespace em_gmm
+} // namespace algorithms
+} // namespace daal
+
+#endif
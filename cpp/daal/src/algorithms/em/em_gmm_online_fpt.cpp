@@ -0,0 +1,41 @@
+/* file: em_gmm_online_fpt.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the EM for GMM interface in the online processing mode.
+//--
+*/
+
+#include "src/algorithms/em/em_gmm_online.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace em_gmm
+{
+template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::PartialResult * partialResult,
+                                                                    const daal::algorithms::Parameter * parameter, const int method);
+template DAAL_EXPORT services::Status PartialResult::allocate<DAAL_FPTYPE>(const daal::algorithms::Input * input,
+                                                                           const daal::algorithms::Parameter * parameter, const int method);
+template DAAL_EXPORT services::Status PartialResult::initialize<DAAL_FPTYPE>(const daal::algorithms::Input * input,
+                                                                             const daal::algorithms::Parameter * parameter, const int method);
+
+} // namespace em_gmm
+} // namespace algorithms
+} // namespace daal
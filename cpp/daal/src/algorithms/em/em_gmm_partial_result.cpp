@@ -0,0 +1,167 @@
+/* file: em_gmm_partial_result.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the partial result of the EM for GMM algorithm.
+//--
+*/
+
+#include "algorithms/em/em_gmm_types.h"
+#include "services/daal_defines.h"
+#include "src/services/serialization_utils.h"
+#include "src/services/daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace em_gmm
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(PartialResult, SERIALIZATION_EM_GMM_PARTIAL_RESULT_ID);
+
+/** Default constructor */
+PartialResult::PartialResult() : daal::algorithms::PartialResult(lastPartialResultCovariancesId + 1)
+{
+    Argument::set(partialCovariances, DataCollectionPtr(new DataCollection()));
+}
+
+/**
+ * Returns the number of features in the partial result of the EM for GMM algorithm
+ * \param[out] nFeatures Number of features
+ * \return Status of the call
+ */
+Status PartialResult::getNumberOfFeatures(size_t & nFeatures) const
+{
+    NumericTablePtr ntPtr = get(partialMeans);
+    Status s              = checkNumericTable(ntPtr.get(), partialMeansStr());
+    nFeatures             = (s ? ntPtr->getNumberOfColumns() : 0);
+    return s;
+}
+
+/**
+ * Sets the partial result of the EM for GMM algorithm
+ * \param[in] id    %Partial result identifier
+ * \param[in] ptr   Pointer to the numeric table with the partial result
+ */
+void PartialResult::set(PartialResultId id, const NumericTablePtr & ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Sets the collection of partial covariances for the EM for GMM algorithm
+ * \param[in] id    Identifier of the collection of partial covariances
+ * \param[in] ptr   Pointer to the collection of partial covariances
+ */
+void PartialResult::set(PartialResultCovariancesId id, const DataCollectionPtr & ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Returns the partial result of the EM for GMM algorithm
+ * \param[in] id   %Partial result identifier
+ * \return         %Partial result that corresponds to the given identifier
+ */
+NumericTablePtr PartialResult::get(PartialResultId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Returns the collection of partial covariances of the EM for GMM algorithm
+ * \param[in] id   Identifier of the collection of partial covariances
+ * \return         Collection of partial covariances that corresponds to the given identifier
+ */
+DataCollectionPtr PartialResult::get(PartialResultCovariancesId id) const
+{
+    return staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Returns the covariance with a given index from the collection of partial covariances
+ * \param[in] id    Identifier of the collection of partial covariances
+ * \param[in] index Index of the covariance to be returned
+ * \return          Pointer to the table with the partial covariance
+ */
+NumericTablePtr PartialResult::get(PartialResultCovariancesId id, size_t index) const
+{
+    DataCollectionPtr covCollection = this->get(id);
+    return staticPointerCast<NumericTable, SerializationIface>((*covCollection)[index]);
+}
+
+/**
+ * Checks the partial result of the EM for GMM algorithm
+ * \param[in] input     %Input of the algorithm
+ * \param[in] parameter %Parameter of algorithm
+ * \param[in] method    Computation method
+ */
+Status PartialResult::check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, int method) const
+{
+    const Input * algInput = static_cast<const Input *>(input);
+    return checkImpl(algInput->get(data)->getNumberOfColumns(), parameter);
+}
+
+/**
+ * Checks the partial result of the EM for GMM algorithm
+ * \param[in] parameter %Parameter of algorithm
+ * \param[in] method    Computation method
+ */
+Status PartialResult::check(const daal::algorithms::Parameter * parameter, int method) const
+{
+    Status s;
+    size_t nFeatures = 0;
+    DAAL_CHECK_STATUS(s, getNumberOfFeatures(nFeatures));
+    return checkImpl(nFeatures, parameter);
+}
+
+Status PartialResult::checkImpl(size_t nFeatures, const daal::algorithms::Parameter * parameter) const
+{
+    const Parameter * algParameter = static_cast<const Parameter *>(parameter);
+    const size_t nComponents       = algParameter->nComponents;
+
+    Status s;
+    const int unexpectedLayouts = (int)packed_mask;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(partialWeights).get(), partialWeightsStr(), unexpectedLayouts, 0, nComponents, 1));
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(partialMeans).get(), partialMeansStr(), unexpectedLayouts, 0, nFeatures, nComponents));
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(partialGoalFunction).get(), partialGoalFunctionStr(), unexpectedLayouts, 0, 1, 1));
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(partialNBlocks).get(), partialNBlocksStr(), unexpectedLayouts, 0, 1, 1));
+
+    DataCollectionPtr covCollection = get(partialCovariances);
+    DAAL_CHECK(covCollection, ErrorNullPartialResult);
+    DAAL_CHECK(covCollection->size() == nComponents, ErrorIncorrectNumberOfElementsInResultCollection);
+
+    const size_t nRowsInCov = (algParameter->covarianceStorage == full) ? nFeatures : 1;
+    for (size_t i = 0; i < nComponents; i++)
+    {
+        NumericTablePtr nt = NumericTable::cast((*covCollection)[i]);
+        DAAL_CHECK_EX(nt, ErrorIncorrectElementInCollection, ArgumentName, partialCovariancesStr());
+        DAAL_CHECK_STATUS(s, checkNumericTable(nt.get(), partialCovariancesStr(), unexpectedLayouts, 0, nFeatures, nRowsInCov));
+    }
+    return s;
+}
+
+} // namespace interface1
+} // namespace em_gmm
+} // namespace algorithms
+} // namespace daal
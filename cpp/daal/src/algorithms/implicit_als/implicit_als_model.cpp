@@ -57,6 +57,26 @@ services::Status Parameter::check() const
     return services::Status();
 }
 
+TrainParameter::TrainParameter(size_t nFactors, size_t maxIterations, double alpha, double lambda, double preferenceThreshold,
+                               SolverMethod solverMethod, size_t nCGIterations)
+    : Parameter(nFactors, maxIterations, alpha, lambda, preferenceThreshold), solverMethod(solverMethod), nCGIterations(nCGIterations)
+{}
+
+services::Status TrainParameter::check() const
+{
+    services::Status s = Parameter::check();
+    if (!s) return s;
+    if (solverMethod != choleskySolver && solverMethod != conjugateGradientSolver)
+    {
+        return services::Status(services::Error::create(services::ErrorIncorrectParameter, services::ParameterName, solverMethodStr()));
+    }
+    if (solverMethod == conjugateGradientSolver && nCGIterations == 0)
+    {
+        return services::Status(services::Error::create(services::ErrorIncorrectParameter, services::ParameterName, nCGIterationsStr()));
+    }
+    return services::Status();
+}
+
 PartialModel::PartialModel(const data_management::NumericTablePtr & factors, const data_management::NumericTablePtr & indices, services::Status & st)
     : _factors(factors), _indices(indices)
 {}
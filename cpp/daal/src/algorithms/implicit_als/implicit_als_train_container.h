@@ -62,7 +62,7 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     Model * a1        = static_cast<Model *>(input->get(inputModel).get());
     Model * r         = static_cast<Model *>(result->get(model).get());
 
-    Parameter * par                        = static_cast<Parameter *>(_par);
+    TrainParameter * par                   = static_cast<TrainParameter *>(_par);
     daal::services::Environment::env & env = *_env;
 
     __DAAL_CALL_KERNEL(env, internal::ImplicitALSTrainBatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, a0, a1, r, par);
@@ -225,14 +225,15 @@ services::Status DistributedContainer<step4Local, algorithmFPType, method, cpu>:
     KeyValueDataCollection * models = static_cast<KeyValueDataCollection *>(input->get(partialModels).get());
     NumericTable * dataTable        = static_cast<NumericTable *>(input->get(partialData).get());
     NumericTable * cpTable          = static_cast<NumericTable *>(input->get(inputOfStep4FromStep2).get());
+    PartialModel * previousModel    = static_cast<PartialModel *>(input->get(inputOfStep4FromStep4).get());
 
     PartialModel * partialModel = static_cast<PartialModel *>(partialResult->get(outputOfStep4ForStep1).get());
 
-    Parameter * par                        = static_cast<Parameter *>(_par);
+    TrainParameter * par                   = static_cast<TrainParameter *>(_par);
     daal::services::Environment::env & env = *_env;
 
     services::Status s = __DAAL_CALL_KERNEL_STATUS(env, internal::ImplicitALSTrainDistrStep4Kernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method),
-                                                   compute, models, dataTable, cpTable, partialModel, par);
+                                                   compute, models, dataTable, cpTable, previousModel, partialModel, par);
 
     models->clear();
     return s;
@@ -176,33 +176,67 @@ template <typename algorithmFPType, CpuType cpu>
 struct AlsTls
 {
     DAAL_NEW_DELETE();
-    AlsTls(size_t nBlocks, const Parameter & parameter) : _nBlocks(nBlocks), _prm(parameter), _lhs(parameter.nFactors * parameter.nFactors) {}
-    bool isValid() const { return _lhs.get(); }
+    AlsTls(size_t nBlocks, const TrainParameter & parameter)
+        : _nBlocks(nBlocks),
+          _prm(parameter),
+          _lhs(parameter.solverMethod == conjugateGradientSolver ? 0 : parameter.nFactors * parameter.nFactors),
+          _cgTask(parameter.nFactors)
+    {}
+    bool isValid() const { return (_prm.solverMethod == conjugateGradientSolver) ? _cgTask.isValid() : (_lhs.get() != nullptr); }
 
     Status run(NumericTable & dstFactors, ReadRowsCSR<algorithmFPType, cpu> & mtData, size_t i, const algorithmFPType * xtx,
-               NumericTable ** aSrcFactors, const size_t * nColFactorsRows, const int ** indices);
+               NumericTable ** aSrcFactors, const size_t * nColFactorsRows, const int ** indices, const algorithmFPType * previousFactors);
 
 protected:
     Status formSystem(ReadRowsCSR<algorithmFPType, cpu> & mtData, size_t i, NumericTable ** aSrcFactors, const size_t * nColFactorsRows,
                       const int ** indices);
 
+    Status gatherSystem(ReadRowsCSR<algorithmFPType, cpu> & mtData, size_t i, NumericTable ** aSrcFactors, const size_t * nColFactorsRows,
+                        const int ** indices, size_t & nNonZeros);
+
+    Status readSrcFactors(int colIndex, NumericTable ** aSrcFactors, const size_t * nColFactorsRows, const int ** indices);
+
 protected:
     WriteOnlyRows<algorithmFPType, cpu> _mtDstFactors;
     TArray<algorithmFPType, cpu> _lhs;
+    ImplicitALSCGTask<algorithmFPType, cpu> _cgTask;
     ReadRows<algorithmFPType, cpu> _mtSrcFactors;
-    const Parameter & _prm;
+    const TrainParameter & _prm;
     size_t _nBlocks;
 };
 
 template <typename algorithmFPType, CpuType cpu>
 Status AlsTls<algorithmFPType, cpu>::run(NumericTable & dstFactors, ReadRowsCSR<algorithmFPType, cpu> & mtData, size_t i, const algorithmFPType * xtx,
-                                         NumericTable ** aSrcFactors, const size_t * nColFactorsRows, const int ** indices)
+                                         NumericTable ** aSrcFactors, const size_t * nColFactorsRows, const int ** indices,
+                                         const algorithmFPType * previousFactors)
 {
     int result = 0;
 
     _mtDstFactors.set(dstFactors, i, 1);
     DAAL_CHECK_BLOCK_STATUS(_mtDstFactors);
     algorithmFPType * rhs = _mtDstFactors.get();
+
+    if (_prm.solverMethod == conjugateGradientSolver)
+    {
+        /* Start from the factors of the previous iteration if they are passed to this step, otherwise from zero */
+        if (previousFactors)
+        {
+            DAAL_CHECK(!daal::services::internal::daal_memcpy_s(rhs, _prm.nFactors * sizeof(algorithmFPType), previousFactors + i * _prm.nFactors,
+                                                                _prm.nFactors * sizeof(algorithmFPType)),
+                       ErrorMemoryCopyFailedInternal);
+        }
+        else
+        {
+            service_memset<algorithmFPType, cpu>(rhs, 0.0, _prm.nFactors);
+        }
+        size_t nNonZeros = 0;
+        Status s         = gatherSystem(mtData, i, aSrcFactors, nColFactorsRows, indices, nNonZeros);
+        if (!s) return s;
+        const algorithmFPType gamma = algorithmFPType(_prm.lambda) * nNonZeros;
+        ImplicitALSTrainKernelBase<algorithmFPType, cpu>::solveCG(_prm.nFactors, xtx, nNonZeros, _cgTask.y.get(), _cgTask.coeff.get(), gamma,
+                                                                  _prm.nCGIterations, rhs, _cgTask.t.get(), _cgTask.work.get());
+        return s;
+    }
     service_memset<algorithmFPType, cpu>(rhs, 0.0, _prm.nFactors);
     result = daal::services::internal::daal_memcpy_s(_lhs.get(), _prm.nFactors * _prm.nFactors * sizeof(algorithmFPType), xtx,
                                                      _prm.nFactors * _prm.nFactors * sizeof(algorithmFPType));
@@ -219,8 +253,9 @@ template <typename algorithmFPType, CpuType cpu>
 Status ImplicitALSTrainDistrStep4Kernel<algorithmFPType, fastCSR, cpu>::compute(data_management::KeyValueDataCollection * srcPartialModels,
                                                                                 data_management::NumericTable * dataTable,
                                                                                 data_management::NumericTable * cpTable,
+                                                                                const implicit_als::PartialModel * previousPartialModel,
                                                                                 implicit_als::PartialModel * dstPartialModel,
-                                                                                const Parameter * parameter)
+                                                                                const TrainParameter * parameter)
 {
     const size_t nBlocks = srcPartialModels->size();
     TArray<size_t, cpu> nFactorsRows(nBlocks);
@@ -258,23 +293,112 @@ Status ImplicitALSTrainDistrStep4Kernel<algorithmFPType, fastCSR, cpu>::compute(
     DAAL_CHECK_BLOCK_STATUS(mtXTX);
     const algorithmFPType * xtx = mtXTX.get();
 
+    /* The conjugate gradient method multiplies vectors by the full symmetric cross product */
+    TArray<algorithmFPType, cpu> fullXtx;
+    if (parameter->solverMethod == conjugateGradientSolver)
+    {
+        const size_t nFactors = parameter->nFactors;
+        fullXtx.reset(nFactors * nFactors);
+        DAAL_CHECK_MALLOC(fullXtx.get());
+        DAAL_CHECK(!daal::services::internal::daal_memcpy_s(fullXtx.get(), nFactors * nFactors * sizeof(algorithmFPType), xtx,
+                                                            nFactors * nFactors * sizeof(algorithmFPType)),
+                   ErrorMemoryCopyFailedInternal);
+        ImplicitALSTrainKernelBase<algorithmFPType, cpu>::symmetrize(nFactors, fullXtx.get());
+        xtx = fullXtx.get();
+    }
+
     const size_t nRows                    = dataTable->getNumberOfRows();
     const CSRNumericTableIface * csrIface = dynamic_cast<const CSRNumericTableIface *>(dataTable);
     ReadRowsCSR<algorithmFPType, cpu> mtData(*const_cast<CSRNumericTableIface *>(csrIface), 0, nRows);
     DAAL_CHECK_BLOCK_STATUS(mtData);
 
+    /* The conjugate gradient method is warm-started from the factors computed on this node in the previous iteration */
+    ReadRows<algorithmFPType, cpu> mtPreviousFactors;
+    const algorithmFPType * previousFactors = nullptr;
+    if (parameter->solverMethod == conjugateGradientSolver && previousPartialModel)
+    {
+        mtPreviousFactors.set(previousPartialModel->getFactors().get(), 0, nRows);
+        DAAL_CHECK_BLOCK_STATUS(mtPreviousFactors);
+        previousFactors = mtPreviousFactors.get();
+    }
+
     NumericTablePtr pDstFactors = dstPartialModel->getFactors();
     SafeStatus safeStat;
     daal::threader_for(nRows, nRows, [&](size_t i) {
         AlsTls<algorithmFPType, cpu> * alsTlsLocal = alsTls.local();
         DAAL_CHECK_THR(alsTlsLocal, ErrorMemoryAllocationFailed);
-        safeStat |= alsTlsLocal->run(*pDstFactors, mtData, i, xtx, aSrcFactors.get(), nFactorsRows.get(), indices.get());
+        safeStat |= alsTlsLocal->run(*pDstFactors, mtData, i, xtx, aSrcFactors.get(), nFactorsRows.get(), indices.get(), previousFactors);
     });
 
     alsTls.reduce([=](AlsTls<algorithmFPType, cpu> * alsTlsLocal) { delete alsTlsLocal; });
     return safeStat.detach();
 }
 
+template <typename algorithmFPType, CpuType cpu>
+Status AlsTls<algorithmFPType, cpu>::readSrcFactors(int colIndex, NumericTable ** aSrcFactors, const size_t * nColFactorsRows, const int ** indices)
+{
+    int blockIndex = -1;
+    /* find block that contains needed index */
+    for (size_t block = 0; block < _nBlocks; block++)
+    {
+        if (indices[block] && indices[block][0] <= colIndex && colIndex <= indices[block][nColFactorsRows[block] - 1])
+        {
+            blockIndex = block;
+            break;
+        }
+    }
+    if (blockIndex == -1) return Status(ErrorALSInconsistentSparseDataBlocks);
+
+    const int * blockIndices = indices[blockIndex];
+    /* find index in the block using binary search */
+    size_t hiIndex = nColFactorsRows[blockIndex] - 1;
+    size_t loIndex = 0;
+    size_t meIndex = ((loIndex + hiIndex) >> 1);
+    while (colIndex != blockIndices[meIndex])
+    {
+        if (colIndex < blockIndices[meIndex])
+            hiIndex = meIndex - 1;
+        else if (colIndex > blockIndices[meIndex])
+            loIndex = meIndex + 1;
+        meIndex = ((loIndex + hiIndex) >> 1);
+        if (loIndex >= hiIndex) break;
+    }
+    if (colIndex != blockIndices[meIndex]) return Status(ErrorALSInconsistentSparseDataBlocks);
+
+    _mtSrcFactors.set(*aSrcFactors[blockIndex], meIndex, 1);
+    DAAL_CHECK_BLOCK_STATUS(_mtSrcFactors);
+    return Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status AlsTls<algorithmFPType, cpu>::gatherSystem(ReadRowsCSR<algorithmFPType, cpu> & mtData, size_t i, NumericTable ** aSrcFactors,
+                                                  const size_t * nColFactorsRows, const int ** indices, size_t & nNonZeros)
+{
+    const size_t startIdx = mtData.rows()[i] - 1;
+    const size_t endIdx   = mtData.rows()[i + 1] - 1;
+    nNonZeros             = endIdx - startIdx;
+    DAAL_CHECK_MALLOC(_cgTask.reserve(nNonZeros));
+
+    /* Factors are copied as the blocks of the partial models are not guaranteed to stay valid after the next read */
+    algorithmFPType * y     = _cgTask.y.get();
+    algorithmFPType * coeff = _cgTask.coeff.get();
+    for (size_t j = 0; j < nNonZeros; j++)
+    {
+        coeff[j] = algorithmFPType(_prm.alpha) * mtData.values()[startIdx + j];
+        DAAL_ASSERT(mtData.cols()[startIdx + j] <= services::internal::MaxVal<int>::get())
+        const int colIndex = (int)mtData.cols()[startIdx + j] - 1;
+
+        Status s = readSrcFactors(colIndex, aSrcFactors, nColFactorsRows, indices);
+        if (!s) return s;
+        const algorithmFPType * srcFactors = _mtSrcFactors.get();
+        for (size_t k = 0; k < _prm.nFactors; k++)
+        {
+            y[j * _prm.nFactors + k] = srcFactors[k];
+        }
+    }
+    return Status();
+}
+
 template <typename algorithmFPType, CpuType cpu>
 Status AlsTls<algorithmFPType, cpu>::formSystem(ReadRowsCSR<algorithmFPType, cpu> & mtData, size_t i, NumericTable ** aSrcFactors,
                                                 const size_t * nColFactorsRows, const int ** indices)
@@ -292,36 +416,8 @@ Status AlsTls<algorithmFPType, cpu>::formSystem(ReadRowsCSR<algorithmFPType, cpu
         DAAL_ASSERT(mtData.cols()[j] <= services::internal::MaxVal<int>::get())
         int colIndex = (int)mtData.cols()[j] - 1;
 
-        int blockIndex = -1;
-        /* find block that contains needed index */
-        for (size_t block = 0; block < _nBlocks; block++)
-        {
-            if (indices[block] && indices[block][0] <= colIndex && colIndex <= indices[block][nColFactorsRows[block] - 1])
-            {
-                blockIndex = block;
-                break;
-            }
-        }
-        if (blockIndex == -1) return Status(ErrorALSInconsistentSparseDataBlocks);
-
-        const int * blockIndices = indices[blockIndex];
-        /* find index in the block using binary search */
-        size_t hiIndex = nColFactorsRows[blockIndex] - 1;
-        size_t loIndex = 0;
-        size_t meIndex = ((loIndex + hiIndex) >> 1);
-        while (colIndex != blockIndices[meIndex])
-        {
-            if (colIndex < blockIndices[meIndex])
-                hiIndex = meIndex - 1;
-            else if (colIndex > blockIndices[meIndex])
-                loIndex = meIndex + 1;
-            meIndex = ((loIndex + hiIndex) >> 1);
-            if (loIndex >= hiIndex) break;
-        }
-        if (colIndex != blockIndices[meIndex]) return Status(ErrorALSInconsistentSparseDataBlocks);
-
-        _mtSrcFactors.set(*aSrcFactors[blockIndex], meIndex, 1);
-        DAAL_CHECK_BLOCK_STATUS(_mtSrcFactors);
+        Status s = readSrcFactors(colIndex, aSrcFactors, nColFactorsRows, indices);
+        if (!s) return s;
         ImplicitALSTrainKernelBase<algorithmFPType, cpu>::updateSystem(_prm.nFactors, _mtSrcFactors.get(), &c1, &c, lhs, rhs);
     }
 
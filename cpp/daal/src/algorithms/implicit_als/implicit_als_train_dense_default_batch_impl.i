@@ -28,6 +28,7 @@
 #include "src/externals/service_blas.h"
 #include "src/externals/service_lapack.h"
 #include "src/algorithms/service_error_handling.h"
+#include "src/services/service_data_utils.h"
 
 namespace daal
 {
@@ -86,6 +87,110 @@ bool ImplicitALSTrainKernelBase<algorithmFPType, cpu>::solve(size_t nCols, algor
     return (info == 0);
 }
 
+template <typename algorithmFPType, CpuType cpu>
+void ImplicitALSTrainKernelBase<algorithmFPType, cpu>::symmetrize(size_t nCols, algorithmFPType * a)
+{
+    /* Copy the upper triangle computed by SYRK into the lower one */
+    for (size_t i = 0; i < nCols; i++)
+    {
+        for (size_t j = i + 1; j < nCols; j++)
+        {
+            a[i * nCols + j] = a[j * nCols + i];
+        }
+    }
+}
+
+/* Runs nIterations of the conjugate gradient method started from x for the system
+ *     (A + gamma * I + Y' * diag(coeff) * Y) * x = Y' * (coeff + 1),
+ * where A is the full symmetric cross product of the factors and the rows of Y are the factors of the rated columns.
+ * Only the products of the system matrix with vectors are computed, so every iteration takes O(nCols^2 + nNonZeros * nCols) operations */
+template <typename algorithmFPType, CpuType cpu>
+void ImplicitALSTrainKernelBase<algorithmFPType, cpu>::solveCG(size_t nCols, const algorithmFPType * a, size_t nNonZeros, const algorithmFPType * y,
+                                                               const algorithmFPType * coeff, algorithmFPType gamma, size_t nIterations,
+                                                               algorithmFPType * x, algorithmFPType * t, algorithmFPType * work)
+{
+    const algorithmFPType zero(0.0);
+    const algorithmFPType one(1.0);
+    const algorithmFPType eps = services::internal::EpsilonVal<algorithmFPType>::get();
+
+    const char notrans  = 'N';
+    const char trans    = 'T';
+    const DAAL_INT iOne = 1;
+    const DAAL_INT n    = (DAAL_INT)nCols;
+    const DAAL_INT nnz  = (DAAL_INT)nNonZeros;
+
+    algorithmFPType * r  = work;
+    algorithmFPType * p  = work + nCols;
+    algorithmFPType * ap = work + 2 * nCols;
+
+    /* r = Y' * (coeff + 1) - (A + gamma * I + Y' * diag(coeff) * Y) * x,
+       the columns with non-positive coefficients do not contribute to the right-hand side */
+    for (size_t k = 0; k < nCols; k++)
+    {
+        r[k] = -gamma * x[k];
+    }
+    if (nNonZeros)
+    {
+        Blas<algorithmFPType, cpu>::xxgemv(&trans, &n, &nnz, &one, y, &n, x, &iOne, &zero, t, &iOne);
+        for (size_t j = 0; j < nNonZeros; j++)
+        {
+            t[j] = ((coeff[j] > zero) ? coeff[j] + one : zero) - coeff[j] * t[j];
+        }
+        Blas<algorithmFPType, cpu>::xxgemv(&notrans, &n, &nnz, &one, y, &n, t, &iOne, &one, r, &iOne);
+    }
+    const algorithmFPType minusOne(-1.0);
+    Blas<algorithmFPType, cpu>::xxgemv(&notrans, &n, &n, &minusOne, a, &n, x, &iOne, &one, r, &iOne);
+
+    algorithmFPType rr = zero;
+    for (size_t k = 0; k < nCols; k++)
+    {
+        p[k] = r[k];
+        rr += r[k] * r[k];
+    }
+
+    for (size_t it = 0; it < nIterations && rr > eps; it++)
+    {
+        /* ap = (A + gamma * I + Y' * diag(coeff) * Y) * p */
+        for (size_t k = 0; k < nCols; k++)
+        {
+            ap[k] = gamma * p[k];
+        }
+        if (nNonZeros)
+        {
+            Blas<algorithmFPType, cpu>::xxgemv(&trans, &n, &nnz, &one, y, &n, p, &iOne, &zero, t, &iOne);
+            for (size_t j = 0; j < nNonZeros; j++)
+            {
+                t[j] *= coeff[j];
+            }
+            Blas<algorithmFPType, cpu>::xxgemv(&notrans, &n, &nnz, &one, y, &n, t, &iOne, &one, ap, &iOne);
+        }
+        Blas<algorithmFPType, cpu>::xxgemv(&notrans, &n, &n, &one, a, &n, p, &iOne, &one, ap, &iOne);
+
+        algorithmFPType pap = zero;
+        for (size_t k = 0; k < nCols; k++)
+        {
+            pap += p[k] * ap[k];
+        }
+        if (!(pap > zero)) break;
+
+        const algorithmFPType step = rr / pap;
+        algorithmFPType rrNew      = zero;
+        for (size_t k = 0; k < nCols; k++)
+        {
+            x[k] += step * p[k];
+            r[k] -= step * ap[k];
+            rrNew += r[k] * r[k];
+        }
+
+        const algorithmFPType beta = rrNew / rr;
+        for (size_t k = 0; k < nCols; k++)
+        {
+            p[k] = r[k] + beta * p[k];
+        }
+        rr = rrNew;
+    }
+}
+
 static inline void getSizes(size_t nRows, size_t nCols, size_t & nBlocks, size_t & blockSize, size_t & tailSize)
 {
     const size_t nThreads       = threader_get_threads_number();
@@ -146,6 +251,89 @@ Status ImplicitALSTrainKernelBase<algorithmFPType, cpu>::computeFactors(size_t n
     return safeStat.detach();
 }
 
+template <typename algorithmFPType, CpuType cpu>
+Status ImplicitALSTrainKernelBase<algorithmFPType, cpu>::computeFactorsCG(size_t nRows, size_t nCols, const algorithmFPType * data,
+                                                                          const size_t * colIndices, const size_t * rowOffsets, size_t nFactors,
+                                                                          algorithmFPType * colFactors, algorithmFPType * rowFactors,
+                                                                          algorithmFPType alpha, algorithmFPType lambda, const algorithmFPType * xtx,
+                                                                          size_t nIterations,
+                                                                          daal::tls<ImplicitALSCGTask<algorithmFPType, cpu> *> & cgTask)
+{
+    SafeStatus safeStat;
+    size_t nBlocks, blockSize, tailSize;
+
+    getSizes(nRows, nCols, nBlocks, blockSize, tailSize);
+
+    daal::threader_for(nBlocks, nBlocks, [&](size_t i) {
+        ImplicitALSCGTask<algorithmFPType, cpu> * cgTaskLocal = cgTask.local();
+        DAAL_CHECK_THR(cgTaskLocal, ErrorMemoryAllocationFailed);
+
+        const size_t curBlockSize = (i < tailSize) ? blockSize + 1 : blockSize;
+        const size_t offset       = (i < tailSize) ? i * blockSize + i : i * blockSize + tailSize;
+
+        for (size_t j = 0; j < curBlockSize; j++)
+        {
+            size_t nNonZeros      = 0;
+            algorithmFPType gamma = 0.0;
+            DAAL_CHECK_THR(gatherSystem(offset + j, nCols, data, colIndices, rowOffsets, nFactors, colFactors, alpha, lambda, *cgTaskLocal, nNonZeros,
+                                        gamma),
+                           ErrorMemoryAllocationFailed);
+
+            /* The current factors of the row are the initial approximation */
+            solveCG(nFactors, xtx, nNonZeros, cgTaskLocal->y.get(), cgTaskLocal->coeff.get(), gamma, nIterations,
+                    rowFactors + (offset + j) * nFactors, cgTaskLocal->t.get(), cgTaskLocal->work.get());
+        }
+    });
+
+    return safeStat.detach();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status ImplicitALSTrainKernelBase<algorithmFPType, cpu>::trainCG(size_t nUsers, size_t nItems, const algorithmFPType * data,
+                                                                 const size_t * colIndices, const size_t * rowOffsets, const algorithmFPType * tdata,
+                                                                 const size_t * rowIndices, const size_t * colOffsets, size_t nFactors,
+                                                                 algorithmFPType * itemsFactors, algorithmFPType * usersFactors,
+                                                                 algorithmFPType * xtx, const TrainParameter * parameter)
+{
+    const algorithmFPType alpha(parameter->alpha);
+    const algorithmFPType lambda(parameter->lambda);
+    const size_t nIterations = parameter->nCGIterations;
+
+    daal::tls<ImplicitALSCGTask<algorithmFPType, cpu> *> cgTask([=]() {
+        auto ptr = new ImplicitALSCGTask<algorithmFPType, cpu>(nFactors);
+        if (ptr && !ptr->isValid())
+        {
+            delete ptr;
+            ptr = nullptr;
+        }
+        return ptr;
+    });
+
+    /* Users factors are not initialized by the model, the solution for them starts from zero */
+    service_memset<algorithmFPType, cpu>(usersFactors, algorithmFPType(0.0), nUsers * nFactors);
+
+    Status s;
+    algorithmFPType beta = 0.0;
+    for (size_t i = 0; i < parameter->maxIterations; i++)
+    {
+        this->computeXtX(&nItems, &nFactors, &beta, itemsFactors, &nFactors, xtx, &nFactors);
+        symmetrize(nFactors, xtx);
+
+        s = computeFactorsCG(nUsers, nItems, data, colIndices, rowOffsets, nFactors, itemsFactors, usersFactors, alpha, lambda, xtx, nIterations,
+                             cgTask);
+        if (!s) break;
+
+        this->computeXtX(&nUsers, &nFactors, &beta, usersFactors, &nFactors, xtx, &nFactors);
+        symmetrize(nFactors, xtx);
+
+        s = computeFactorsCG(nItems, nUsers, tdata, rowIndices, colOffsets, nFactors, usersFactors, itemsFactors, alpha, lambda, xtx, nIterations,
+                             cgTask);
+        if (!s) break;
+    }
+    cgTask.reduce([](ImplicitALSCGTask<algorithmFPType, cpu> * cgTaskLocal) { delete cgTaskLocal; });
+    return s;
+}
+
 template <typename algorithmFPType, CpuType cpu>
 void ImplicitALSTrainKernel<algorithmFPType, fastCSR, cpu>::computeCostFunction(size_t nUsers, size_t nItems, size_t nFactors, algorithmFPType * data,
                                                                                 size_t * colIndices, size_t * rowOffsets,
@@ -294,9 +482,71 @@ void ImplicitALSTrainKernel<algorithmFPType, defaultDense, cpu>::formSystem(size
     }
 }
 
+template <typename algorithmFPType, CpuType cpu>
+bool ImplicitALSTrainKernel<algorithmFPType, fastCSR, cpu>::gatherSystem(size_t i, size_t nCols, const algorithmFPType * data,
+                                                                         const size_t * colIndices, const size_t * rowOffsets, size_t nFactors,
+                                                                         const algorithmFPType * colFactors, algorithmFPType alpha,
+                                                                         algorithmFPType lambda, ImplicitALSCGTask<algorithmFPType, cpu> & cgTask,
+                                                                         size_t & nNonZeros, algorithmFPType & gamma)
+{
+    const size_t startIdx = rowOffsets[i] - 1;
+    const size_t endIdx   = rowOffsets[i + 1] - 1;
+    nNonZeros             = endIdx - startIdx;
+    gamma                 = lambda * nNonZeros;
+    if (!cgTask.reserve(nNonZeros)) return false;
+
+    algorithmFPType * y     = cgTask.y.get();
+    algorithmFPType * coeff = cgTask.coeff.get();
+    for (size_t j = 0; j < nNonZeros; j++)
+    {
+        coeff[j]                              = alpha * data[startIdx + j];
+        const algorithmFPType * colFactorsRow = colFactors + (colIndices[startIdx + j] - 1) * nFactors;
+        for (size_t k = 0; k < nFactors; k++)
+        {
+            y[j * nFactors + k] = colFactorsRow[k];
+        }
+    }
+    return true;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+bool ImplicitALSTrainKernel<algorithmFPType, defaultDense, cpu>::gatherSystem(size_t i, size_t nCols, const algorithmFPType * data,
+                                                                              const size_t * colIndices, const size_t * rowOffsets, size_t nFactors,
+                                                                              const algorithmFPType * colFactors, algorithmFPType alpha,
+                                                                              algorithmFPType lambda,
+                                                                              ImplicitALSCGTask<algorithmFPType, cpu> & cgTask, size_t & nNonZeros,
+                                                                              algorithmFPType & gamma)
+{
+    const algorithmFPType * row = data + i * nCols;
+    nNonZeros                   = 0;
+    for (size_t j = 0; j < nCols; j++)
+    {
+        nNonZeros += (row[j] > 0.0);
+    }
+    gamma = lambda * (nNonZeros + 1);
+    if (!cgTask.reserve(nNonZeros)) return false;
+
+    algorithmFPType * y     = cgTask.y.get();
+    algorithmFPType * coeff = cgTask.coeff.get();
+    for (size_t j = 0, l = 0; j < nCols; j++)
+    {
+        if (row[j] > 0.0)
+        {
+            coeff[l]                              = alpha * row[j];
+            const algorithmFPType * colFactorsRow = colFactors + j * nFactors;
+            for (size_t k = 0; k < nFactors; k++)
+            {
+                y[l * nFactors + k] = colFactorsRow[k];
+            }
+            l++;
+        }
+    }
+    return true;
+}
+
 template <typename algorithmFPType, CpuType cpu>
 services::Status ImplicitALSTrainBatchKernel<algorithmFPType, fastCSR, cpu>::compute(const NumericTable * dataTable, implicit_als::Model * initModel,
-                                                                                     implicit_als::Model * model, const Parameter * parameter)
+                                                                                     implicit_als::Model * model, const TrainParameter * parameter)
 {
     Status s;
     ImplicitALSTrainTask<algorithmFPType, fastCSR, cpu> task(dataTable, model, parameter);
@@ -325,6 +575,12 @@ services::Status ImplicitALSTrainBatchKernel<algorithmFPType, fastCSR, cpu>::com
                         alpha, lambda, &costFunction);
 #endif
 
+    if (parameter->solverMethod == conjugateGradientSolver)
+    {
+        return this->trainCG(nUsers, nItems, data, colIndices, rowOffsets, tdata, rowIndices, colOffsets, nFactors, itemsFactors, usersFactors, xtx,
+                             parameter);
+    }
+
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, parameter->nFactors, parameter->nFactors);
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, parameter->nFactors * parameter->nFactors, sizeof(algorithmFPType));
 
@@ -364,7 +620,8 @@ services::Status ImplicitALSTrainBatchKernel<algorithmFPType, fastCSR, cpu>::com
 template <typename algorithmFPType, CpuType cpu>
 services::Status ImplicitALSTrainBatchKernel<algorithmFPType, defaultDense, cpu>::compute(const NumericTable * dataTable,
                                                                                           implicit_als::Model * initModel,
-                                                                                          implicit_als::Model * model, const Parameter * parameter)
+                                                                                          implicit_als::Model * model,
+                                                                                          const TrainParameter * parameter)
 {
     ImplicitALSTrainTask<algorithmFPType, defaultDense, cpu> task(dataTable, model, parameter);
     Status s = task.init(dataTable, initModel, parameter);
@@ -389,6 +646,11 @@ services::Status ImplicitALSTrainBatchKernel<algorithmFPType, defaultDense, cpu>
                         alpha, lambda, &costFunction);
 #endif
 
+    if (parameter->solverMethod == conjugateGradientSolver)
+    {
+        return this->trainCG(nUsers, nItems, data, NULL, NULL, tdata, NULL, NULL, nFactors, itemsFactors, usersFactors, xtx, parameter);
+    }
+
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, parameter->nFactors, parameter->nFactors);
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, parameter->nFactors * parameter->nFactors, sizeof(algorithmFPType));
 
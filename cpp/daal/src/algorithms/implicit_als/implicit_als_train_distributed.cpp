@@ -497,7 +497,7 @@ services::Status DistributedPartialResultStep3::check(const daal::algorithms::In
     return s;
 }
 /** Default constructor */
-DistributedInput<step4Local>::DistributedInput() : daal::algorithms::Input(lastStep4LocalNumericTableInputId + 1) {}
+DistributedInput<step4Local>::DistributedInput() : daal::algorithms::Input(lastStep4LocalPartialModelInputId + 1) {}
 
 /**
  * Returns an input key-value data collection object for the implicit ALS training algorithm
@@ -542,6 +542,26 @@ void DistributedInput<step4Local>::set(Step4LocalNumericTableInputId id, const d
     Argument::set(id, ptr);
 }
 
+/**
+ * Returns an input partial model object for the implicit ALS training algorithm
+ * \param[in] id    Identifier of the input object
+ * \return          %Input object that corresponds to the given identifier
+ */
+PartialModelPtr DistributedInput<step4Local>::get(Step4LocalPartialModelInputId id) const
+{
+    return services::staticPointerCast<PartialModel, data_management::SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets an input partial model object for the implicit ALS training algorithm
+ * \param[in] id    Identifier of the input object
+ * \param[in] ptr   Pointer to the new input object value
+ */
+void DistributedInput<step4Local>::set(Step4LocalPartialModelInputId id, const PartialModelPtr & ptr)
+{
+    Argument::set(id, ptr);
+}
+
 /**
  * Returns the number of rows in the partial matrix of users factors/items factors
  * \return Number of rows in the partial matrix of factors
@@ -597,6 +617,13 @@ services::Status DistributedInput<step4Local>::check(const daal::algorithms::Par
         s |= checkNumericTable(model->getIndices().get(), indicesStr(), unexpectedLayoutsCSR, 0, 1, nRows);
         if (!s) return s;
     }
+
+    /* Check the optional partial model of the previous iteration */
+    PartialModelPtr previousModel = get(inputOfStep4FromStep4);
+    if (previousModel)
+    {
+        s |= checkNumericTable(previousModel->getFactors().get(), factorsStr(), unexpectedLayoutsPacked, 0, nFactors, dataTable->getNumberOfRows());
+    }
     return s;
 }
 
@@ -51,6 +51,35 @@ struct ImplicitALSTrainTaskBase;
 template <typename algorithmFPType, Method method, CpuType cpu>
 struct ImplicitALSTrainTask;
 
+/* Buffers of the conjugate gradient solver: factors and coefficients of the ratings of one row gathered contiguously */
+template <typename algorithmFPType, CpuType cpu>
+struct ImplicitALSCGTask
+{
+    DAAL_NEW_DELETE();
+    ImplicitALSCGTask(size_t nFactors) : nFactors(nFactors), capacity(0), work(3 * nFactors) {}
+    bool isValid() const { return work.get(); }
+
+    /* Grows the buffers so that they hold at least nNonZeros ratings */
+    bool reserve(size_t nNonZeros)
+    {
+        if (nNonZeros <= capacity) return true;
+        size_t newCapacity = 2 * capacity;
+        if (newCapacity < nNonZeros) newCapacity = nNonZeros;
+        y.reset(newCapacity * nFactors);
+        coeff.reset(newCapacity);
+        t.reset(newCapacity);
+        capacity = (y.get() && coeff.get() && t.get()) ? newCapacity : 0;
+        return capacity != 0;
+    }
+
+    size_t nFactors;
+    size_t capacity;
+    daal::internal::TArray<algorithmFPType, cpu> y;
+    daal::internal::TArray<algorithmFPType, cpu> coeff;
+    daal::internal::TArray<algorithmFPType, cpu> t;
+    daal::internal::TArray<algorithmFPType, cpu> work;
+};
+
 template <typename algorithmFPType, CpuType cpu>
 class ImplicitALSTrainKernelCommon : public daal::algorithms::Kernel
 {
@@ -67,6 +96,11 @@ public:
 
     static bool solve(size_t nCols, algorithmFPType * a, algorithmFPType * b);
 
+    static void symmetrize(size_t nCols, algorithmFPType * a);
+
+    static void solveCG(size_t nCols, const algorithmFPType * a, size_t nNonZeros, const algorithmFPType * y, const algorithmFPType * coeff,
+                        algorithmFPType gamma, size_t nIterations, algorithmFPType * x, algorithmFPType * t, algorithmFPType * work);
+
 protected:
     friend struct ImplicitALSTrainTaskBase<algorithmFPType, cpu>;
     friend struct ImplicitALSTrainTask<algorithmFPType, fastCSR, cpu>;
@@ -76,6 +110,19 @@ protected:
                                     size_t nFactors, algorithmFPType * colFactors, algorithmFPType * rowFactors, algorithmFPType alpha,
                                     algorithmFPType lambda, algorithmFPType * xtx, daal::tls<algorithmFPType *> & lhs);
 
+    services::Status computeFactorsCG(size_t nRows, size_t nCols, const algorithmFPType * data, const size_t * colIndices, const size_t * rowOffsets,
+                                      size_t nFactors, algorithmFPType * colFactors, algorithmFPType * rowFactors, algorithmFPType alpha,
+                                      algorithmFPType lambda, const algorithmFPType * xtx, size_t nIterations,
+                                      daal::tls<ImplicitALSCGTask<algorithmFPType, cpu> *> & cgTask);
+
+    services::Status trainCG(size_t nUsers, size_t nItems, const algorithmFPType * data, const size_t * colIndices, const size_t * rowOffsets,
+                             const algorithmFPType * tdata, const size_t * rowIndices, const size_t * colOffsets, size_t nFactors,
+                             algorithmFPType * itemsFactors, algorithmFPType * usersFactors, algorithmFPType * xtx, const TrainParameter * parameter);
+
+    virtual bool gatherSystem(size_t i, size_t nCols, const algorithmFPType * data, const size_t * colIndices, const size_t * rowOffsets,
+                              size_t nFactors, const algorithmFPType * colFactors, algorithmFPType alpha, algorithmFPType lambda,
+                              ImplicitALSCGTask<algorithmFPType, cpu> & cgTask, size_t & nNonZeros, algorithmFPType & gamma) = 0;
+
     virtual void formSystem(size_t i, size_t nCols, const algorithmFPType * data, const size_t * colIndices, const size_t * rowOffsets,
                             size_t nFactors, algorithmFPType * colFactors, algorithmFPType alpha, algorithmFPType * lhs, algorithmFPType * rhs,
                             algorithmFPType lambda) = 0;
@@ -93,6 +140,10 @@ template <typename algorithmFPType, CpuType cpu>
 class ImplicitALSTrainKernel<algorithmFPType, fastCSR, cpu> : public ImplicitALSTrainKernelBase<algorithmFPType, cpu>
 {
 protected:
+    virtual bool gatherSystem(size_t i, size_t nCols, const algorithmFPType * data, const size_t * colIndices, const size_t * rowOffsets,
+                              size_t nFactors, const algorithmFPType * colFactors, algorithmFPType alpha, algorithmFPType lambda,
+                              ImplicitALSCGTask<algorithmFPType, cpu> & cgTask, size_t & nNonZeros, algorithmFPType & gamma) DAAL_C11_OVERRIDE;
+
     virtual void formSystem(size_t i, size_t nCols, const algorithmFPType * data, const size_t * colIndices, const size_t * rowOffsets,
                             size_t nFactors, algorithmFPType * colFactors, algorithmFPType alpha, algorithmFPType * lhs, algorithmFPType * rhs,
                             algorithmFPType lambda) DAAL_C11_OVERRIDE;
@@ -106,6 +157,10 @@ template <typename algorithmFPType, CpuType cpu>
 class ImplicitALSTrainKernel<algorithmFPType, defaultDense, cpu> : public ImplicitALSTrainKernelBase<algorithmFPType, cpu>
 {
 protected:
+    virtual bool gatherSystem(size_t i, size_t nCols, const algorithmFPType * data, const size_t * colIndices, const size_t * rowOffsets,
+                              size_t nFactors, const algorithmFPType * colFactors, algorithmFPType alpha, algorithmFPType lambda,
+                              ImplicitALSCGTask<algorithmFPType, cpu> & cgTask, size_t & nNonZeros, algorithmFPType & gamma) DAAL_C11_OVERRIDE;
+
     virtual void formSystem(size_t i, size_t nCols, const algorithmFPType * data, const size_t * colIndices, const size_t * rowOffsets,
                             size_t nFactors, algorithmFPType * colFactors, algorithmFPType alpha, algorithmFPType * lhs, algorithmFPType * rhs,
                             algorithmFPType lambda) DAAL_C11_OVERRIDE;
@@ -123,14 +178,16 @@ template <typename algorithmFPType, CpuType cpu>
 class ImplicitALSTrainBatchKernel<algorithmFPType, fastCSR, cpu> : public ImplicitALSTrainKernel<algorithmFPType, fastCSR, cpu>
 {
 public:
-    services::Status compute(const NumericTable * data, implicit_als::Model * initModel, implicit_als::Model * model, const Parameter * parameter);
+    services::Status compute(const NumericTable * data, implicit_als::Model * initModel, implicit_als::Model * model,
+                             const TrainParameter * parameter);
 };
 
 template <typename algorithmFPType, CpuType cpu>
 class ImplicitALSTrainBatchKernel<algorithmFPType, defaultDense, cpu> : public ImplicitALSTrainKernel<algorithmFPType, defaultDense, cpu>
 {
 public:
-    services::Status compute(const NumericTable * data, implicit_als::Model * initModel, implicit_als::Model * model, const Parameter * parameter);
+    services::Status compute(const NumericTable * data, implicit_als::Model * initModel, implicit_als::Model * model,
+                             const TrainParameter * parameter);
 };
 
 template <typename algorithmFPType, CpuType cpu>
@@ -222,7 +279,8 @@ class ImplicitALSTrainDistrStep4Kernel : public ImplicitALSTrainKernel<algorithm
 {
 public:
     services::Status compute(data_management::KeyValueDataCollection * models, data_management::NumericTable * dataTable,
-                             data_management::NumericTable * cpTable, implicit_als::PartialModel * partialModel, const Parameter * parameter);
+                             data_management::NumericTable * cpTable, const implicit_als::PartialModel * previousPartialModel,
+                             implicit_als::PartialModel * partialModel, const TrainParameter * parameter);
 };
 
 template <typename algorithmFPType, CpuType cpu>
@@ -230,7 +288,8 @@ class ImplicitALSTrainDistrStep4Kernel<algorithmFPType, fastCSR, cpu> : public I
 {
 public:
     services::Status compute(data_management::KeyValueDataCollection * models, data_management::NumericTable * dataTable,
-                             data_management::NumericTable * cpTable, implicit_als::PartialModel * partialModel, const Parameter * parameter);
+                             data_management::NumericTable * cpTable, const implicit_als::PartialModel * previousPartialModel,
+                             implicit_als::PartialModel * partialModel, const TrainParameter * parameter);
 };
 
 } // namespace internal
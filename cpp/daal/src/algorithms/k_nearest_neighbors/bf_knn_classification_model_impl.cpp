@@ -55,7 +55,8 @@ services::Status Model::serializeImpl(data_management::InputDataArchive * arch)
 services::Status Model::deserializeImpl(const data_management::OutputDataArchive * arch)
 {
     daal::algorithms::classifier::Model::serialImpl<const data_management::OutputDataArchive, true>(arch);
-    return _impl->serialImpl<const data_management::OutputDataArchive, true>(arch);
+    const int daalVersion = COMPUTE_DAAL_VERSION(arch->getMajorVersion(), arch->getMinorVersion(), arch->getUpdateVersion());
+    return _impl->serialImpl<const data_management::OutputDataArchive, true>(arch, daalVersion);
 }
 
 size_t Model::getNumberOfFeatures() const
@@ -63,16 +64,26 @@ size_t Model::getNumberOfFeatures() const
     return _impl->getNumberOfFeatures();
 }
 
+} // namespace interface1
+
+namespace interface2
+{
 services::Status Parameter::check() const
 {
     DAAL_CHECK_EX(this->nClasses > 1 && this->nClasses < static_cast<size_t>(services::internal::MaxVal<int>::get()),
                   services::ErrorIncorrectParameter, services::ParameterName, nClassesStr());
     DAAL_CHECK_EX(this->k > 0 && this->k <= static_cast<size_t>(services::internal::MaxVal<int>::get()), services::ErrorIncorrectParameter,
                   services::ParameterName, kStr());
+    DAAL_CHECK_EX(this->maxDegree > 1 && this->maxDegree <= static_cast<size_t>(services::internal::MaxVal<int>::get()) / 2,
+                  services::ErrorIncorrectParameter, services::ParameterName, maxDegreeStr());
+    DAAL_CHECK_EX(this->efConstruction > 0, services::ErrorIncorrectParameter, services::ParameterName, efConstructionStr());
+    DAAL_CHECK_EX(this->efSearch > 0, services::ErrorIncorrectParameter, services::ParameterName, efSearchStr());
+    DAAL_CHECK_EX(this->metric >= euclidean && this->metric <= hamming, services::ErrorIncorrectParameter, services::ParameterName, metricStr());
+    DAAL_CHECK_EX(this->minkowskiPower >= 1.0, services::ErrorIncorrectParameter, services::ParameterName, minkowskiPowerStr());
     return services::Status();
 }
 
-} // namespace interface1
+} // namespace interface2
 } // namespace bf_knn_classification
 } // namespace algorithms
 } // namespace daal
@@ -64,6 +64,11 @@ services::Status Input::check(const daal::algorithms::Parameter * parameter, int
     {
         DAAL_CHECK(checkNumericTable(m->impl()->getLabels().get(), labelsStr()), ErrorModelNotFullInitialized);
     }
+    if (method == hnswDense)
+    {
+        DAAL_CHECK(m->impl()->getGraph() && m->impl()->getUpperGraph() && m->impl()->getNodeLevels(), ErrorModelNotFullInitialized);
+        DAAL_CHECK(m->impl()->getGraph()->getNumberOfRows() == m->impl()->getData()->getNumberOfRows(), ErrorModelNotFullInitialized);
+    }
     return services::Status();
 }
 
@@ -35,7 +35,11 @@ BatchContainer<algorithmFpType, method, cpu>::BatchContainer(daal::services::Env
     auto & context    = services::internal::getDefaultContext();
     auto & deviceInfo = context.getInfoDevice();
 
-    if (deviceInfo.isCpu)
+    if (method == hnswDense)
+    {
+        __DAAL_INITIALIZE_KERNELS(internal::KNNClassificationPredictHnswKernel, algorithmFpType);
+    }
+    else if (deviceInfo.isCpu)
     {
         __DAAL_INITIALIZE_KERNELS(internal::KNNClassificationPredictKernel, algorithmFpType);
     }
@@ -65,7 +69,12 @@ services::Status BatchContainer<algorithmFpType, method, cpu>::compute()
     auto & context                                           = services::internal::getDefaultContext();
     auto & deviceInfo                                        = context.getInfoDevice();
 
-    if (deviceInfo.isCpu)
+    if (method == hnswDense)
+    {
+        __DAAL_CALL_KERNEL(env, internal::KNNClassificationPredictHnswKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFpType), compute, a.get(), m.get(),
+                           label.get(), indices.get(), distances.get(), par);
+    }
+    else if (deviceInfo.isCpu)
     {
         __DAAL_CALL_KERNEL(env, internal::KNNClassificationPredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFpType), compute, a.get(), m.get(),
                            label.get(), indices.get(), distances.get(), par);
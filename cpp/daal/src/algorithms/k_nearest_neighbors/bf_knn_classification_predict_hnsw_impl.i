@@ -0,0 +1,248 @@
+/* file: bf_knn_classification_predict_hnsw_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Approximate search of the nearest neighbors over the HNSW graph
+//  for kNN model-based prediction.
+//--
+*/
+
+#ifndef __BF_KNN_CLASSIFICATION_PREDICT_HNSW_IMPL_I__
+#define __BF_KNN_CLASSIFICATION_PREDICT_HNSW_IMPL_I__
+
+#include "services/daal_defines.h"
+
+#include "algorithms/k_nearest_neighbors/bf_knn_classification_model.h"
+#include "src/algorithms/k_nearest_neighbors/bf_knn_classification_predict_kernel.h"
+#include "src/algorithms/k_nearest_neighbors/oneapi/bf_knn_classification_model_ucapi_impl.h"
+#include "src/algorithms/k_nearest_neighbors/bf_knn_hnsw_impl.i"
+#include "src/data_management/service_numeric_table.h"
+#include "src/externals/service_math.h"
+#include "src/services/service_data_utils.h"
+
+#include "src/externals/service_ittnotify.h"
+
+DAAL_ITTNOTIFY_DOMAIN(knn.hnsw.prediction.batch);
+
+namespace daal
+{
+namespace algorithms
+{
+namespace bf_knn_classification
+{
+namespace prediction
+{
+namespace internal
+{
+using namespace daal::algorithms::bf_knn_classification::internal;
+
+const size_t hnswQueryBlockSize = 128;
+
+/* Votes for the class of one query among its nearest neighbors, the missing neighbors have negative indices */
+template <typename algorithmFpType, CpuType cpu>
+int hnswVote(size_t nClasses, size_t k, VoteWeights voteWeights, const int * indices, const algorithmFpType * distances,
+             const algorithmFpType * trainLabel, algorithmFpType * classWeights)
+{
+    const algorithmFpType epsilon = services::internal::EpsilonVal<algorithmFpType>::get();
+
+    bool hasZeroDistance = false;
+    for (size_t j = 0; j < k && voteWeights == voteDistance; j++)
+    {
+        hasZeroDistance |= (indices[j] >= 0 && distances[j] < epsilon);
+    }
+
+    service_memset_seq<algorithmFpType, cpu>(classWeights, algorithmFpType(0), nClasses);
+    for (size_t j = 0; j < k; j++)
+    {
+        if (indices[j] < 0) continue;
+        const size_t label = static_cast<size_t>(trainLabel[indices[j]]);
+        if (voteWeights == voteUniform)
+        {
+            classWeights[label] += algorithmFpType(1);
+        }
+        else if (hasZeroDistance)
+        {
+            /* Observations that coincide with the query outweigh all the others */
+            classWeights[label] += (distances[j] < epsilon) ? algorithmFpType(1) : algorithmFpType(0);
+        }
+        else
+        {
+            classWeights[label] += algorithmFpType(1) / distances[j];
+        }
+    }
+
+    size_t maxWeightClass     = 0;
+    algorithmFpType maxWeight = algorithmFpType(0);
+    for (size_t j = 0; j < nClasses; j++)
+    {
+        if (classWeights[j] > maxWeight)
+        {
+            maxWeight      = classWeights[j];
+            maxWeightClass = j;
+        }
+    }
+    return int(maxWeightClass);
+}
+
+template <typename algorithmFpType, CpuType cpu>
+services::Status KNNClassificationPredictHnswKernel<algorithmFpType, cpu>::compute(const NumericTable * data, const classifier::Model * m,
+                                                                                   NumericTable * label, NumericTable * indices,
+                                                                                   NumericTable * distances, const daal::algorithms::Parameter * par)
+{
+    const Model * const model         = static_cast<const Model *>(m);
+    const Parameter * const parameter = static_cast<const Parameter *>(par);
+
+    NumericTable * const trainTable      = const_cast<NumericTable *>(model->impl()->getData().get());
+    NumericTable * const trainLabelTable = const_cast<NumericTable *>(model->impl()->getLabels().get());
+    NumericTable * const graphTable      = const_cast<NumericTable *>(model->impl()->getGraph().get());
+    NumericTable * const upperGraphTable = const_cast<NumericTable *>(model->impl()->getUpperGraph().get());
+    NumericTable * const nodeLevelsTable = const_cast<NumericTable *>(model->impl()->getNodeLevels().get());
+    DAAL_CHECK(graphTable && upperGraphTable && nodeLevelsTable, services::ErrorModelNotFullInitialized);
+
+    const size_t nTrain                 = trainTable->getNumberOfRows();
+    const size_t nTest                  = data->getNumberOfRows();
+    const size_t p                      = trainTable->getNumberOfColumns();
+    const size_t k                      = parameter->k;
+    const size_t nClasses               = parameter->nClasses;
+    const size_t ef                     = (parameter->efSearch < k) ? k : parameter->efSearch;
+    const VoteWeights voteWeights       = parameter->voteWeights;
+    const DAAL_UINT64 resultsToEvaluate = parameter->resultsToEvaluate;
+    const DAAL_UINT64 resultsToCompute  = parameter->resultsToCompute;
+    const size_t entryPoint             = model->impl()->getEntryPoint();
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, hnswQueryBlockSize, k);
+    DAAL_CHECK(entryPoint < nTrain && graphTable->getNumberOfRows() == nTrain && nodeLevelsTable->getNumberOfRows() == nTrain,
+               services::ErrorModelNotFullInitialized);
+
+    ReadRows<algorithmFpType, cpu> trainRows(trainTable, 0, nTrain);
+    DAAL_CHECK_BLOCK_STATUS(trainRows);
+    ReadRows<int, cpu> graphRows(graphTable, 0, nTrain);
+    DAAL_CHECK_BLOCK_STATUS(graphRows);
+    ReadRows<int, cpu> upperGraphRows(upperGraphTable, 0, upperGraphTable->getNumberOfRows());
+    DAAL_CHECK_BLOCK_STATUS(upperGraphRows);
+    ReadRows<int, cpu> nodeLevelsRows(nodeLevelsTable, 0, nTrain);
+    DAAL_CHECK_BLOCK_STATUS(nodeLevelsRows);
+
+    const bool computeLabels = (resultsToEvaluate & daal::algorithms::classifier::computeClassLabels) != 0;
+    ReadRows<algorithmFpType, cpu> trainLabelRows;
+    if (computeLabels)
+    {
+        trainLabelRows.set(trainLabelTable, 0, nTrain);
+        DAAL_CHECK_BLOCK_STATUS(trainLabelRows);
+    }
+    const algorithmFpType * const trainLabel = trainLabelRows.get();
+
+    HnswGraph graph;
+    graph.graph      = const_cast<int *>(graphRows.get());
+    graph.upperGraph = const_cast<int *>(upperGraphRows.get());
+    graph.nodeLevels = nodeLevelsRows.get();
+    graph.graphWidth = graphTable->getNumberOfColumns();
+    graph.upperWidth = upperGraphTable->getNumberOfColumns();
+
+    const HnswIndex<algorithmFpType, cpu> index(trainRows.get(), p, graph);
+
+    typedef HnswSearchTask<algorithmFpType, cpu> Task;
+    SafeStatus safeStat;
+    daal::tls<Task *> tlsTask([=, &safeStat]() {
+        Task * const task = Task::create(nTrain, ef, graph.graphWidth - 1);
+        if (!task) safeStat.add(services::ErrorMemoryAllocationFailed);
+        return task;
+    });
+    TlsMem<int, cpu> tlsKIndices(hnswQueryBlockSize * k);
+    TlsMem<algorithmFpType, cpu> tlsKDistances(hnswQueryBlockSize * k);
+    TlsMem<algorithmFpType, cpu> tlsVoting(nClasses);
+
+    const size_t nBlocks = nTest / hnswQueryBlockSize + !!(nTest % hnswQueryBlockSize);
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t iStart = iBlock * hnswQueryBlockSize;
+        const size_t iSize  = (iStart + hnswQueryBlockSize > nTest) ? nTest - iStart : hnswQueryBlockSize;
+
+        Task * const task = tlsTask.local();
+        if (!task) return;
+        int * const kIndices = tlsKIndices.local();
+        DAAL_CHECK_MALLOC_THR(kIndices);
+        algorithmFpType * const kDistances = tlsKDistances.local();
+        DAAL_CHECK_MALLOC_THR(kDistances);
+
+        ReadRows<algorithmFpType, cpu> testRows(const_cast<NumericTable *>(data), iStart, iSize);
+        DAAL_CHECK_BLOCK_STATUS_THR(testRows);
+        const algorithmFpType * const testData = testRows.get();
+
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(searchGraph);
+            for (size_t i = 0; i < iSize; i++)
+            {
+                index.search(testData + i * p, entryPoint, ef, *task);
+
+                const size_t nFound = (task->nResults < k) ? task->nResults : k;
+                for (size_t j = 0; j < nFound; j++)
+                {
+                    kIndices[i * k + j]   = task->results[j].index;
+                    kDistances[i * k + j] = Math<algorithmFpType, cpu>::sSqrt(task->results[j].distance);
+                }
+                for (size_t j = nFound; j < k; j++)
+                {
+                    kIndices[i * k + j]   = -1;
+                    kDistances[i * k + j] = services::internal::MaxVal<algorithmFpType>::get();
+                }
+            }
+        }
+
+        if (resultsToCompute & computeIndicesOfNeighbors)
+        {
+            WriteOnlyRows<int, cpu> indicesRows(indices, iStart, iSize);
+            DAAL_CHECK_BLOCK_STATUS_THR(indicesRows);
+            const size_t size = iSize * k * sizeof(int);
+            DAAL_CHECK_THR(!daal::services::internal::daal_memcpy_s(indicesRows.get(), size, kIndices, size),
+                           services::ErrorMemoryCopyFailedInternal);
+        }
+
+        if (resultsToCompute & computeDistances)
+        {
+            WriteOnlyRows<algorithmFpType, cpu> distancesRows(distances, iStart, iSize);
+            DAAL_CHECK_BLOCK_STATUS_THR(distancesRows);
+            const size_t size = iSize * k * sizeof(algorithmFpType);
+            DAAL_CHECK_THR(!daal::services::internal::daal_memcpy_s(distancesRows.get(), size, kDistances, size),
+                           services::ErrorMemoryCopyFailedInternal);
+        }
+
+        if (computeLabels)
+        {
+            algorithmFpType * const voting = tlsVoting.local();
+            DAAL_CHECK_MALLOC_THR(voting);
+            WriteOnlyRows<int, cpu> labelRows(label, iStart, iSize);
+            DAAL_CHECK_BLOCK_STATUS_THR(labelRows);
+            int * const testLabel = labelRows.get();
+            for (size_t i = 0; i < iSize; i++)
+            {
+                testLabel[i] = hnswVote<algorithmFpType, cpu>(nClasses, k, voteWeights, kIndices + i * k, kDistances + i * k, trainLabel, voting);
+            }
+        }
+    });
+
+    tlsTask.reduce([](Task * task) { delete task; });
+    return safeStat.detach();
+}
+
+} // namespace internal
+} // namespace prediction
+} // namespace bf_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
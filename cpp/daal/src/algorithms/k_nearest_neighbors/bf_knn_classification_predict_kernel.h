@@ -43,6 +43,14 @@ public:
                              NumericTable * distances, const daal::algorithms::Parameter * par);
 };
 
+template <typename algorithmFpType, CpuType cpu>
+class KNNClassificationPredictHnswKernel : public daal::algorithms::Kernel
+{
+public:
+    services::Status compute(const NumericTable * data, const classifier::Model * m, NumericTable * label, NumericTable * indices,
+                             NumericTable * distances, const daal::algorithms::Parameter * par);
+};
+
 } // namespace internal
 } // namespace prediction
 } // namespace bf_knn_classification
@@ -47,18 +47,18 @@ services::Status KNNClassificationPredictKernel<algorithmFPType, cpu>::compute(c
     NumericTableConstPtr trainDataTable  = convModel->impl()->getData();
     NumericTableConstPtr trainLabelTable = convModel->impl()->getLabels();
 
-    const Parameter * const parameter   = static_cast<const Parameter *>(par);
-    const uint32_t k                    = parameter->k;
-    const uint32_t nClasses             = parameter->nClasses;
-    const VoteWeights voteWeights       = parameter->voteWeights;
-    const DAAL_UINT64 resultsToEvaluate = parameter->resultsToEvaluate;
-    const DAAL_UINT64 resultsToCompute  = parameter->resultsToCompute;
+    const Parameter * const parameter    = static_cast<const Parameter *>(par);
+    const uint32_t k                     = parameter->k;
+    const uint32_t nClasses              = parameter->nClasses;
+    const VoteWeights voteWeights        = parameter->voteWeights;
+    const DistanceMetric metric          = parameter->metric;
+    const algorithmFPType minkowskiPower = static_cast<algorithmFPType>(parameter->minkowskiPower);
+    const DAAL_UINT64 resultsToEvaluate  = parameter->resultsToEvaluate;
+    const DAAL_UINT64 resultsToCompute   = parameter->resultsToCompute;
 
     daal::algorithms::bf_knn_classification::internal::BruteForceNearestNeighbors<algorithmFPType, cpu> bfnn;
-    bfnn.kNeighbors(k, nClasses, voteWeights, resultsToCompute, resultsToEvaluate, trainDataTable.get(), data, trainLabelTable.get(), label, indices,
-                    distances);
-
-    return services::Status();
+    return bfnn.kNeighbors(k, nClasses, voteWeights, metric, minkowskiPower, resultsToCompute, resultsToEvaluate, trainDataTable.get(), data,
+                           trainLabelTable.get(), label, indices, distances);
 }
 
 } // namespace internal
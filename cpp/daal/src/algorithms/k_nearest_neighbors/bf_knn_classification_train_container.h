@@ -44,7 +44,11 @@ BatchContainer<algorithmFpType, method, cpu>::BatchContainer(daal::services::Env
     auto & context    = services::internal::getDefaultContext();
     auto & deviceInfo = context.getInfoDevice();
 
-    if (deviceInfo.isCpu)
+    if (method == hnswDense)
+    {
+        __DAAL_INITIALIZE_KERNELS(internal::KNNClassificationTrainHnswKernel, algorithmFpType);
+    }
+    else if (deviceInfo.isCpu)
     {
         __DAAL_INITIALIZE_KERNELS(internal::KNNClassificationTrainKernel, algorithmFpType);
     }
@@ -86,7 +90,12 @@ services::Status BatchContainer<algorithmFpType, method, cpu>::compute()
     auto & context    = services::internal::getDefaultContext();
     auto & deviceInfo = context.getInfoDevice();
 
-    if (deviceInfo.isCpu)
+    if (method == hnswDense)
+    {
+        __DAAL_CALL_KERNEL(env, internal::KNNClassificationTrainHnswKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFpType), compute,
+                           r->impl()->getData().get(), r.get(), *par, *par->engine);
+    }
+    else if (deviceInfo.isCpu)
     {
         __DAAL_CALL_KERNEL(env, internal::KNNClassificationTrainKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFpType), compute, r->impl()->getData().get(),
                            r->impl()->getLabels().get(), r.get(), *par, *par->engine);
@@ -51,6 +51,7 @@ Batch<algorithmFPType, method>::Batch(size_t nClasses)
 }
 
 template class Batch<DAAL_FPTYPE, defaultDense>;
+template class Batch<DAAL_FPTYPE, hnswDense>;
 
 } // namespace interface1
 } // namespace training
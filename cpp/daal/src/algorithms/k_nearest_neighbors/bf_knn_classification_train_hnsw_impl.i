@@ -0,0 +1,189 @@
+/* file: bf_knn_classification_train_hnsw_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Construction of the HNSW graph for kNN model-based training.
+//--
+*/
+
+#ifndef __BF_KNN_CLASSIFICATION_TRAIN_HNSW_IMPL_I__
+#define __BF_KNN_CLASSIFICATION_TRAIN_HNSW_IMPL_I__
+
+#include "algorithms/engines/engine.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "services/daal_defines.h"
+
+#include "src/algorithms/k_nearest_neighbors/bf_knn_classification_train_kernel.h"
+#include "src/algorithms/k_nearest_neighbors/oneapi/bf_knn_classification_model_ucapi_impl.h"
+#include "src/algorithms/k_nearest_neighbors/bf_knn_hnsw_impl.i"
+#include "src/algorithms/distributions/uniform/uniform_kernel.h"
+#include "src/algorithms/distributions/uniform/uniform_impl.i"
+#include "src/data_management/service_numeric_table.h"
+#include "src/externals/service_math.h"
+#include "src/services/service_data_utils.h"
+#include "src/services/service_unique_ptr.h"
+
+#include "src/externals/service_ittnotify.h"
+
+DAAL_ITTNOTIFY_DOMAIN(knn.hnsw.training.batch);
+
+namespace daal
+{
+namespace algorithms
+{
+namespace bf_knn_classification
+{
+namespace training
+{
+namespace internal
+{
+using namespace daal::algorithms::bf_knn_classification::internal;
+using namespace daal::algorithms::distributions::uniform::internal;
+
+/* The first observations are inserted sequentially to give the concurrent insertions a connected graph to start from */
+const size_t hnswNSequentialInsertions = 1024;
+const size_t hnswInsertionBlockSize    = 64;
+
+template <typename algorithmFpType, CpuType cpu>
+services::Status KNNClassificationTrainHnswKernel<algorithmFpType, cpu>::compute(NumericTable * x, Model * r, const Parameter & par,
+                                                                                 engines::BatchBase & engine)
+{
+    services::Status s;
+    const size_t n         = x->getNumberOfRows();
+    const size_t p         = x->getNumberOfColumns();
+    const size_t maxDegree = par.maxDegree;
+    /* At least maxDegree candidates are needed to fill the adjacency lists */
+    const size_t ef = (par.efConstruction < maxDegree) ? maxDegree : par.efConstruction;
+
+    DAAL_CHECK(n <= static_cast<size_t>(services::internal::MaxVal<int>::get()), services::ErrorIncorrectNumberOfRowsInInputNumericTable);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, 2 * maxDegree + 1);
+
+    /* Levels of the observations follow the geometric distribution with the normalization factor 1 / ln(maxDegree) */
+    TArray<algorithmFpType, cpu> levelsRandom(n);
+    DAAL_CHECK_MALLOC(levelsRandom.get());
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(drawLevels);
+        DAAL_CHECK_STATUS(s, (UniformKernelDefault<algorithmFpType, cpu>::compute(algorithmFpType(0), algorithmFpType(1), engine, n,
+                                                                                  levelsRandom.get())));
+    }
+    for (size_t i = 0; i < n; i++)
+    {
+        levelsRandom[i] = algorithmFpType(1) - levelsRandom[i];
+    }
+    Math<algorithmFpType, cpu>::vLog(n, levelsRandom.get(), levelsRandom.get());
+    const algorithmFpType levelFactor = algorithmFpType(-1) / Math<algorithmFpType, cpu>::sLog(algorithmFpType(maxDegree));
+
+    NumericTablePtr nodeLevelsTable = HomogenNumericTable<int>::create(2, n, NumericTable::doAllocate, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    size_t nUpperRows = 0;
+    {
+        WriteOnlyRows<int, cpu> nodeLevelsRows(nodeLevelsTable.get(), 0, n);
+        DAAL_CHECK_BLOCK_STATUS(nodeLevelsRows);
+        int * const nodeLevels = nodeLevelsRows.get();
+        for (size_t i = 0; i < n; i++)
+        {
+            const algorithmFpType level = levelsRandom[i] * levelFactor;
+            const size_t nodeLevel      = (level < algorithmFpType(hnswMaxLevel)) ? size_t(level) : hnswMaxLevel;
+            nodeLevels[2 * i]           = int(nodeLevel);
+            nodeLevels[2 * i + 1]       = int(nUpperRows);
+            nUpperRows += nodeLevel;
+        }
+    }
+    DAAL_CHECK(nUpperRows <= static_cast<size_t>(services::internal::MaxVal<int>::get()), services::ErrorIncorrectNumberOfRowsInInputNumericTable);
+
+    NumericTablePtr graphTable = HomogenNumericTable<int>::create(2 * maxDegree + 1, n, NumericTable::doAllocate, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    NumericTablePtr upperGraphTable = HomogenNumericTable<int>::create(maxDegree + 1, nUpperRows ? nUpperRows : 1, NumericTable::doAllocate, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    size_t entryPoint = 0;
+    {
+        ReadRows<algorithmFpType, cpu> dataRows(x, 0, n);
+        DAAL_CHECK_BLOCK_STATUS(dataRows);
+        ReadRows<int, cpu> nodeLevelsRows(nodeLevelsTable.get(), 0, n);
+        DAAL_CHECK_BLOCK_STATUS(nodeLevelsRows);
+        WriteOnlyRows<int, cpu> graphRows(graphTable.get(), 0, n);
+        DAAL_CHECK_BLOCK_STATUS(graphRows);
+        WriteOnlyRows<int, cpu> upperGraphRows(upperGraphTable.get(), 0, upperGraphTable->getNumberOfRows());
+        DAAL_CHECK_BLOCK_STATUS(upperGraphRows);
+
+        service_memset<int, cpu>(graphRows.get(), 0, n * (2 * maxDegree + 1));
+        service_memset<int, cpu>(upperGraphRows.get(), 0, upperGraphTable->getNumberOfRows() * (maxDegree + 1));
+
+        HnswGraph graph;
+        graph.graph      = graphRows.get();
+        graph.upperGraph = upperGraphRows.get();
+        graph.nodeLevels = nodeLevelsRows.get();
+        graph.graphWidth = 2 * maxDegree + 1;
+        graph.upperWidth = maxDegree + 1;
+
+        typedef HnswSearchTask<algorithmFpType, cpu> Task;
+        HnswBuilder<algorithmFpType, cpu> builder(dataRows.get(), p, graph, 0);
+
+        const size_t nSequential = (n < hnswNSequentialInsertions) ? n : hnswNSequentialInsertions;
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(insertSequential);
+            daal::internal::UniquePtr<Task, cpu> task(Task::create(n, ef, 2 * maxDegree));
+            DAAL_CHECK_MALLOC(task.get());
+            for (size_t i = 1; i < nSequential; i++)
+            {
+                builder.insert(i, ef, *task);
+            }
+        }
+
+        const size_t nBlocks = (n - nSequential) / hnswInsertionBlockSize + !!((n - nSequential) % hnswInsertionBlockSize);
+        if (nBlocks)
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(insertConcurrent);
+            SafeStatus safeStat;
+            daal::tls<Task *> tlsTask([=, &safeStat]() {
+                Task * const task = Task::create(n, ef, 2 * maxDegree);
+                if (!task) safeStat.add(services::ErrorMemoryAllocationFailed);
+                return task;
+            });
+
+            daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+                Task * const task = tlsTask.local();
+                if (!task) return;
+
+                const size_t iStart = nSequential + iBlock * hnswInsertionBlockSize;
+                const size_t iEnd   = (iStart + hnswInsertionBlockSize > n) ? n : iStart + hnswInsertionBlockSize;
+                for (size_t i = iStart; i < iEnd; i++)
+                {
+                    builder.insert(i, ef, *task);
+                }
+            });
+
+            tlsTask.reduce([](Task * task) { delete task; });
+            DAAL_CHECK_SAFE_STATUS();
+        }
+        entryPoint = builder.getEntryPoint();
+    }
+
+    r->impl()->setGraph(graphTable, upperGraphTable, nodeLevelsTable, entryPoint);
+    return s;
+}
+
+} // namespace internal
+} // namespace training
+} // namespace bf_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -43,6 +43,13 @@ public:
     services::Status compute(NumericTable * x, NumericTable * y, Model * r, const Parameter & par, engines::BatchBase & engine);
 };
 
+template <typename algorithmFpType, CpuType cpu>
+class KNNClassificationTrainHnswKernel : public daal::algorithms::Kernel
+{
+public:
+    services::Status compute(NumericTable * x, Model * r, const Parameter & par, engines::BatchBase & engine);
+};
+
 } // namespace internal
 } // namespace training
 } // namespace bf_knn_classification
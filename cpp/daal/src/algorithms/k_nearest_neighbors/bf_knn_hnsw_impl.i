@@ -0,0 +1,506 @@
+/* file: bf_knn_hnsw_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Hierarchical navigable small world (HNSW) graph used for the approximate
+//  search of the nearest neighbors.
+//--
+*/
+
+#ifndef __BF_KNN_HNSW_IMPL_I__
+#define __BF_KNN_HNSW_IMPL_I__
+
+#include "services/daal_defines.h"
+#include "src/algorithms/service_error_handling.h"
+#include "src/algorithms/service_threading.h"
+#include "src/externals/service_memory.h"
+#include "src/services/service_arrays.h"
+#include "src/services/service_defines.h"
+#include "src/threading/threading.h"
+#include "src/algorithms/k_nearest_neighbors/knn_heap.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace bf_knn_classification
+{
+namespace internal
+{
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+/* Number of the mutexes that guard the adjacency lists while the graph is built */
+const size_t hnswNLocks = 1024;
+
+/* Upper bound of the level of an observation in the graph */
+const size_t hnswMaxLevel = 30;
+
+template <typename FPType>
+struct HnswNeighbor
+{
+    FPType distance;
+    int index;
+
+    /* Ordering of the max-heap of the nearest found observations */
+    inline bool operator<(const HnswNeighbor & rhs) const { return distance < rhs.distance; }
+};
+
+template <typename FPType>
+struct HnswCandidate
+{
+    FPType distance;
+    int index;
+
+    /* Reversed ordering turns the max-heap routines into the min-heap of the candidates to expand */
+    inline bool operator<(const HnswCandidate & rhs) const { return rhs.distance < distance; }
+};
+
+/* Squared Euclidean distance between two observations */
+template <typename FPType, CpuType cpu>
+DAAL_FORCEINLINE FPType hnswDistance(const FPType * a, const FPType * b, size_t nFeatures)
+{
+    FPType sum = FPType(0);
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        const FPType diff = a[j] - b[j];
+        sum += diff * diff;
+    }
+    return sum;
+}
+
+/**
+ *  Raw view of the HNSW graph. Every adjacency list is a row of the fixed width:
+ *  the number of neighbors followed by their indices
+ */
+struct HnswGraph
+{
+    int * graph;            /* Bottom level, one row of graphWidth elements per observation */
+    int * upperGraph;       /* Upper levels, one row of upperWidth elements per pair (observation, level) */
+    const int * nodeLevels; /* Top level and the first row in upperGraph of every observation */
+    size_t graphWidth;
+    size_t upperWidth;
+
+    int * neighbors(size_t node, size_t level) const
+    {
+        return level ? upperGraph + (nodeLevels[2 * node + 1] + level - 1) * upperWidth : graph + node * graphWidth;
+    }
+
+    size_t level(size_t node) const { return nodeLevels[2 * node]; }
+
+    size_t maxDegree(size_t level) const { return (level ? upperWidth : graphWidth) - 1; }
+};
+
+/**
+ *  Thread local state of the search: the set of the visited observations, the heap of the found neighbors
+ *  and the heap of the candidates to expand
+ */
+template <typename FPType, CpuType cpu>
+class HnswSearchTask
+{
+public:
+    DAAL_NEW_DELETE();
+
+    static HnswSearchTask * create(size_t nObservations, size_t ef, size_t maxDegree)
+    {
+        HnswSearchTask * task = new HnswSearchTask(nObservations, ef, maxDegree);
+        if (task && task->isValid()) return task;
+        delete task;
+        return nullptr;
+    }
+
+    bool isValid() const { return _visited.get() && _results.get() && _candidates.get() && _neighbors.get() && _pool.get(); }
+
+    /* Starts a new search from the given observation */
+    void start(const HnswNeighbor<FPType> & entry)
+    {
+        clearVisited();
+        visit(entry.index);
+        nResults    = 0;
+        nCandidates = 0;
+        pushResult(entry, 1);
+        pushCandidate(entry.distance, entry.index);
+    }
+
+    /* Starts the search on the next level from all the neighbors found on the current one, sorted in ascending order */
+    void restart(size_t node)
+    {
+        clearVisited();
+        visit(node);
+        for (size_t i = 0; i < nResults; i++)
+        {
+            visit(results[i].index);
+            candidates[i].distance = results[i].distance;
+            candidates[i].index    = results[i].index;
+        }
+        nCandidates = nResults;
+
+        /* Ascending order is a valid heap of the candidates, descending one is a valid heap of the results */
+        for (size_t i = 0; i < nResults / 2; i++)
+        {
+            const HnswNeighbor<FPType> tmp = results[i];
+            results[i]                     = results[nResults - 1 - i];
+            results[nResults - 1 - i]      = tmp;
+        }
+    }
+
+    bool visit(size_t node)
+    {
+        if (_visited[node] == _tag) return false;
+        _visited[node] = _tag;
+        return true;
+    }
+
+    void pushResult(const HnswNeighbor<FPType> & neighbor, size_t ef)
+    {
+        if (nResults < ef)
+        {
+            results[nResults++] = neighbor;
+        }
+        else
+        {
+            popMaxHeap<cpu>(results, results + nResults);
+            results[nResults - 1] = neighbor;
+        }
+        pushMaxHeap<cpu>(results, results + nResults);
+    }
+
+    void pushCandidate(FPType distance, int index)
+    {
+        if (nCandidates == _candidatesCapacity)
+        {
+            /* Candidates farther than the furthest found neighbor are never expanded */
+            const FPType bound = results[0].distance;
+            size_t nKept       = 0;
+            for (size_t i = 0; i < nCandidates; i++)
+            {
+                if (!(bound < candidates[i].distance)) candidates[nKept++] = candidates[i];
+            }
+            nCandidates = nKept;
+            makeMaxHeap<cpu>(candidates, candidates + nCandidates);
+            if (nCandidates == _candidatesCapacity) return;
+        }
+        candidates[nCandidates].distance = distance;
+        candidates[nCandidates].index    = index;
+        nCandidates++;
+        pushMaxHeap<cpu>(candidates, candidates + nCandidates);
+    }
+
+    void popCandidate()
+    {
+        popMaxHeap<cpu>(candidates, candidates + nCandidates);
+        nCandidates--;
+    }
+
+    /* Sorts the found neighbors in ascending order of the distance */
+    void sortResults()
+    {
+        for (size_t i = nResults; i > 1; i--)
+        {
+            popMaxHeap<cpu>(results, results + i);
+        }
+    }
+
+    HnswNeighbor<FPType> * results;
+    size_t nResults;
+    HnswCandidate<FPType> * candidates;
+    size_t nCandidates;
+    int * neighbors;             /* Copy of the adjacency list being expanded */
+    HnswNeighbor<FPType> * pool; /* Candidates to the adjacency list being shrunk */
+
+private:
+    HnswSearchTask(size_t nObservations, size_t ef, size_t maxDegree)
+        : nResults(0), nCandidates(0), _candidatesCapacity(2 * (ef + maxDegree)), _nObservations(nObservations), _tag(0)
+    {
+        _visited.reset(nObservations);
+        _results.reset(ef);
+        _candidates.reset(_candidatesCapacity);
+        _neighbors.reset(maxDegree);
+        _pool.reset(maxDegree + 1);
+        if (_visited.get()) service_memset_seq<unsigned int, cpu>(_visited.get(), 0u, nObservations);
+
+        results    = _results.get();
+        candidates = _candidates.get();
+        neighbors  = _neighbors.get();
+        pool       = _pool.get();
+    }
+
+    void clearVisited()
+    {
+        if (++_tag == 0)
+        {
+            service_memset_seq<unsigned int, cpu>(_visited.get(), 0u, _nObservations);
+            _tag = 1;
+        }
+    }
+
+    size_t _candidatesCapacity;
+    size_t _nObservations;
+    unsigned int _tag;
+    TArrayScalable<unsigned int, cpu> _visited;
+    TArrayScalable<HnswNeighbor<FPType>, cpu> _results;
+    TArrayScalable<HnswCandidate<FPType>, cpu> _candidates;
+    TArrayScalable<int, cpu> _neighbors;
+    TArrayScalable<HnswNeighbor<FPType>, cpu> _pool;
+};
+
+/**
+ *  Search over the HNSW graph. The adjacency lists are read under the locks when the graph is being built concurrently
+ */
+template <typename FPType, CpuType cpu>
+class HnswIndex
+{
+public:
+    typedef HnswSearchTask<FPType, cpu> Task;
+
+    HnswIndex(const FPType * data, size_t nFeatures, const HnswGraph & graph, Mutex * locks = nullptr)
+        : _data(data), _nFeatures(nFeatures), _graph(graph), _locks(locks)
+    {}
+
+    const FPType * point(size_t node) const { return _data + node * _nFeatures; }
+
+    FPType distance(const FPType * query, size_t node) const { return hnswDistance<FPType, cpu>(query, point(node), _nFeatures); }
+
+    /* Finds the approximate nearest neighbors of the query; on exit task.results holds them in ascending order of the distance */
+    void search(const FPType * query, size_t entryPoint, size_t ef, Task & task) const
+    {
+        HnswNeighbor<FPType> nearest;
+        nearest.distance = distance(query, entryPoint);
+        nearest.index    = entryPoint;
+        descend(query, _graph.level(entryPoint), 0, nearest, task);
+
+        task.start(nearest);
+        searchLevel(query, 0, ef, task);
+        task.sortResults();
+    }
+
+protected:
+    /* Greedy search of the nearest observation on the levels from topLevel down to bottomLevel + 1 */
+    void descend(const FPType * query, size_t topLevel, size_t bottomLevel, HnswNeighbor<FPType> & nearest, Task & task) const
+    {
+        for (size_t level = topLevel; level > bottomLevel; level--)
+        {
+            bool changed = true;
+            while (changed)
+            {
+                changed                 = false;
+                const size_t nNeighbors = copyNeighbors(nearest.index, level, task.neighbors);
+                for (size_t i = 0; i < nNeighbors; i++)
+                {
+                    const FPType d = distance(query, task.neighbors[i]);
+                    if (d < nearest.distance)
+                    {
+                        nearest.distance = d;
+                        nearest.index    = task.neighbors[i];
+                        changed          = true;
+                    }
+                }
+            }
+        }
+    }
+
+    /* Beam search with ef found neighbors on one level starting from the neighbors and the candidates already in the task */
+    void searchLevel(const FPType * query, size_t level, size_t ef, Task & task) const
+    {
+        while (task.nCandidates)
+        {
+            const HnswCandidate<FPType> nearest = task.candidates[0];
+            if (task.nResults >= ef && task.results[0].distance < nearest.distance) break;
+            task.popCandidate();
+
+            const size_t nNeighbors = copyNeighbors(nearest.index, level, task.neighbors);
+            for (size_t i = 0; i < nNeighbors; i++)
+            {
+                const int node = task.neighbors[i];
+                if (!task.visit(node)) continue;
+
+                HnswNeighbor<FPType> neighbor;
+                neighbor.distance = distance(query, node);
+                neighbor.index    = node;
+                if (task.nResults < ef || neighbor.distance < task.results[0].distance)
+                {
+                    task.pushResult(neighbor, ef);
+                    task.pushCandidate(neighbor.distance, node);
+                }
+            }
+        }
+    }
+
+    size_t copyNeighbors(size_t node, size_t level, int * dst) const
+    {
+        if (_locks) _locks[node % hnswNLocks].lock();
+        const int * const row = _graph.neighbors(node, level);
+        const size_t count    = row[0];
+        for (size_t i = 0; i < count; i++)
+        {
+            dst[i] = row[i + 1];
+        }
+        if (_locks) _locks[node % hnswNLocks].unlock();
+        return count;
+    }
+
+    const FPType * _data;
+    size_t _nFeatures;
+    HnswGraph _graph;
+    Mutex * _locks;
+};
+
+/**
+ *  Concurrent construction of the HNSW graph: every observation is inserted with the search of its neighbors
+ *  in the part of the graph built so far, the adjacency lists are guarded by a pool of mutexes
+ */
+template <typename FPType, CpuType cpu>
+class HnswBuilder : public HnswIndex<FPType, cpu>
+{
+public:
+    typedef HnswIndex<FPType, cpu> super;
+    typedef typename super::Task Task;
+
+    HnswBuilder(const FPType * data, size_t nFeatures, const HnswGraph & graph, size_t entryPoint)
+        : super(data, nFeatures, graph, _nodeLocks), _entryPoint(entryPoint), _topLevel(graph.level(entryPoint))
+    {}
+
+    size_t getEntryPoint() const { return _entryPoint; }
+
+    void insert(size_t node, size_t ef, Task & task)
+    {
+        size_t entryPoint, topLevel;
+        {
+            AUTOLOCK(_entryLock);
+            entryPoint = _entryPoint;
+            topLevel   = _topLevel;
+        }
+
+        const FPType * const query = this->point(node);
+        const size_t nodeLevel     = this->_graph.level(node);
+
+        HnswNeighbor<FPType> nearest;
+        nearest.distance = this->distance(query, entryPoint);
+        nearest.index    = entryPoint;
+        this->descend(query, topLevel, nodeLevel, nearest, task);
+
+        task.start(nearest);
+        task.visit(node);
+        for (size_t level = (nodeLevel < topLevel ? nodeLevel : topLevel) + 1; level-- > 0;)
+        {
+            this->searchLevel(query, level, ef, task);
+            task.sortResults();
+            link(node, level, task);
+            task.restart(node);
+        }
+
+        if (nodeLevel > topLevel)
+        {
+            AUTOLOCK(_entryLock);
+            if (nodeLevel > _topLevel)
+            {
+                _entryPoint = node;
+                _topLevel   = nodeLevel;
+            }
+        }
+    }
+
+protected:
+    /**
+     *  Keeps the neighbor only if it is closer to the base observation than to any of the neighbors selected before,
+     *  which preserves the links between the distant clusters of the observations
+     */
+    size_t selectNeighbors(const HnswNeighbor<FPType> * sorted, size_t n, size_t maxDegree, int * selected) const
+    {
+        size_t nSelected = 0;
+        for (size_t i = 0; i < n && nSelected < maxDegree; i++)
+        {
+            const FPType * const x = this->point(sorted[i].index);
+            bool keep              = true;
+            for (size_t j = 0; j < nSelected && keep; j++)
+            {
+                keep = !(this->distance(x, selected[j]) < sorted[i].distance);
+            }
+            if (keep) selected[nSelected++] = sorted[i].index;
+        }
+        return nSelected;
+    }
+
+    /* Connects the observation with the neighbors found on the level in both directions */
+    void link(size_t node, size_t level, Task & task)
+    {
+        const size_t nodeMaxDegree = this->_graph.maxDegree(1);
+        const size_t maxDegree     = this->_graph.maxDegree(level);
+
+        size_t nSelected;
+        {
+            AUTOLOCK(_nodeLocks[node % hnswNLocks]);
+            int * const row = this->_graph.neighbors(node, level);
+            nSelected       = selectNeighbors(task.results, task.nResults, nodeMaxDegree, row + 1);
+            row[0]          = int(nSelected);
+            for (size_t i = 0; i < nSelected; i++)
+            {
+                task.neighbors[i] = row[i + 1];
+            }
+        }
+
+        for (size_t i = 0; i < nSelected; i++)
+        {
+            const size_t neighbor = task.neighbors[i];
+            AUTOLOCK(_nodeLocks[neighbor % hnswNLocks]);
+            int * const row    = this->_graph.neighbors(neighbor, level);
+            const size_t count = row[0];
+            if (count < maxDegree)
+            {
+                row[count + 1] = int(node);
+                row[0]         = int(count + 1);
+                continue;
+            }
+
+            /* The adjacency list is full: select the neighbors again among the current ones and the new observation */
+            const FPType * const base = this->point(neighbor);
+            HnswNeighbor<FPType> * const pool = task.pool;
+            pool[0].distance                  = this->distance(base, node);
+            pool[0].index                     = int(node);
+            for (size_t j = 0; j < count; j++)
+            {
+                pool[j + 1].distance = this->distance(base, row[j + 1]);
+                pool[j + 1].index    = row[j + 1];
+            }
+            for (size_t j = 1; j <= count; j++)
+            {
+                const HnswNeighbor<FPType> tmp = pool[j];
+                size_t jj                      = j;
+                for (; jj > 0 && tmp.distance < pool[jj - 1].distance; jj--)
+                {
+                    pool[jj] = pool[jj - 1];
+                }
+                pool[jj] = tmp;
+            }
+            row[0] = int(selectNeighbors(pool, count + 1, maxDegree, row + 1));
+        }
+    }
+
+    Mutex _nodeLocks[hnswNLocks];
+    Mutex _entryLock;
+    size_t _entryPoint;
+    size_t _topLevel;
+};
+
+} // namespace internal
+} // namespace bf_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -56,10 +56,10 @@ public:
     typedef GlobalNeighbors<FPType, cpu> Neighbors;
     typedef Heap<Neighbors, cpu> HeapType;
 
-    services::Status kNeighbors(const size_t k, const size_t nClasses, VoteWeights voteWeights, DAAL_UINT64 resultsToCompute,
-                                DAAL_UINT64 resultsToEvaluate, const NumericTable * trainTable, const NumericTable * testTable,
-                                const NumericTable * trainLabelTable, NumericTable * testLabelTable, NumericTable * indicesTable,
-                                NumericTable * distancesTable)
+    services::Status kNeighbors(const size_t k, const size_t nClasses, VoteWeights voteWeights, DistanceMetric metric, FPType minkowskiPower,
+                                DAAL_UINT64 resultsToCompute, DAAL_UINT64 resultsToEvaluate, const NumericTable * trainTable,
+                                const NumericTable * testTable, const NumericTable * trainLabelTable, NumericTable * testLabelTable,
+                                NumericTable * indicesTable, NumericTable * distancesTable)
     {
         const size_t nDims  = trainTable->getNumberOfColumns();
         const size_t nTrain = trainTable->getNumberOfRows();
@@ -76,6 +76,17 @@ public:
             DAAL_CHECK_MALLOC(trainLabel);
         }
 
+        if (metric != euclidean)
+        {
+            services::Status s = kNeighborsByMetric(k, nClasses, voteWeights, metric, minkowskiPower, resultsToCompute, resultsToEvaluate, trainTable,
+                                                    testTable, trainLabel, testLabelTable, indicesTable, distancesTable);
+            if (resultsToEvaluate & daal::algorithms::classifier::computeClassLabels)
+            {
+                newTrainLabelTable->releaseBlockOfRows(trainLabelBlock);
+            }
+            return s;
+        }
+
         daal::algorithms::internal::EuclideanDistances<FPType, cpu> euclDist(*testTable, *trainTable, true);
         euclDist.init();
 
@@ -110,6 +121,90 @@ public:
     }
 
 protected:
+    // Non-Euclidean metrics use the generic tiled distances with the fused k nearest selection
+    services::Status kNeighborsByMetric(const size_t k, const size_t nClasses, VoteWeights voteWeights, DistanceMetric metric, FPType minkowskiPower,
+                                        DAAL_UINT64 resultsToCompute, DAAL_UINT64 resultsToEvaluate, const NumericTable * trainTable,
+                                        const NumericTable * testTable, const FPType * trainLabel, NumericTable * testLabelTable,
+                                        NumericTable * indicesTable, NumericTable * distancesTable)
+    {
+        switch (metric)
+        {
+        case minkowski:
+        {
+            daal::algorithms::internal::MinkowskiDistances<FPType, cpu> distances(*testTable, *trainTable, minkowskiPower, true);
+            return kNeighborsFused(distances, k, nClasses, voteWeights, minkowskiPower, resultsToCompute, resultsToEvaluate, trainTable, testTable,
+                                   trainLabel, testLabelTable, indicesTable, distancesTable);
+        }
+        case chebyshev:
+        {
+            daal::algorithms::internal::ChebyshevDistances<FPType, cpu> distances(*testTable, *trainTable);
+            return kNeighborsFused(distances, k, nClasses, voteWeights, FPType(1), resultsToCompute, resultsToEvaluate, trainTable, testTable,
+                                   trainLabel, testLabelTable, indicesTable, distancesTable);
+        }
+        case cosine:
+        {
+            daal::algorithms::internal::CosineDistances<FPType, cpu> distances(*testTable, *trainTable);
+            return kNeighborsFused(distances, k, nClasses, voteWeights, FPType(1), resultsToCompute, resultsToEvaluate, trainTable, testTable,
+                                   trainLabel, testLabelTable, indicesTable, distancesTable);
+        }
+        case hamming:
+        {
+            daal::algorithms::internal::HammingDistances<FPType, cpu> distances(*testTable, *trainTable);
+            return kNeighborsFused(distances, k, nClasses, voteWeights, FPType(1), resultsToCompute, resultsToEvaluate, trainTable, testTable,
+                                   trainLabel, testLabelTable, indicesTable, distancesTable);
+        }
+        default: return services::Status(services::ErrorIncorrectParameter);
+        }
+    }
+
+    // Distances are selected as they are computed by the metric, the power 1/rootPower is applied to the k nearest only
+    services::Status kNeighborsFused(daal::algorithms::internal::PairwiseDistances<FPType, cpu> & distances, const size_t k, const size_t nClasses,
+                                     VoteWeights voteWeights, const FPType rootPower, DAAL_UINT64 resultsToCompute, DAAL_UINT64 resultsToEvaluate,
+                                     const NumericTable * trainTable, const NumericTable * testTable, const FPType * trainLabel,
+                                     NumericTable * testLabelTable, NumericTable * indicesTable, NumericTable * distancesTable)
+    {
+        const size_t nTrain = trainTable->getNumberOfRows();
+        DAAL_CHECK(k <= nTrain, services::ErrorIncorrectParameter);
+        DAAL_ASSERT(nTrain <= static_cast<size_t>(services::internal::MaxVal<int>::get()));
+
+        DAAL_CHECK_STATUS_VAR(distances.init());
+
+        const size_t maxBlockSize = daal::algorithms::internal::kNearestBlockSize;
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, maxBlockSize, k);
+
+        TlsMem<FPType, cpu> tlsKDistances(maxBlockSize * k);
+        TlsMem<int, cpu> tlsKIndexes(maxBlockSize * k);
+        TlsMem<FPType, cpu> tlsVoting(nClasses);
+
+        return daal::algorithms::internal::computeKNearest<FPType, cpu>(
+            distances, *testTable, *trainTable, k,
+            [&](size_t startTestIdx, size_t iSize, size_t nNeighbors, const size_t * indices, const FPType * nearest) -> services::Status {
+                DAAL_ASSERT(nNeighbors == k);
+                DAAL_ASSERT(iSize <= maxBlockSize);
+
+                int * kIndexes = tlsKIndexes.local();
+                DAAL_CHECK_MALLOC(kIndexes);
+
+                FPType * kDistances = tlsKDistances.local();
+                DAAL_CHECK_MALLOC(kDistances);
+
+                for (size_t i = 0; i < iSize * k; i++)
+                {
+                    // max(0, d) to remove negative cosine distances caused by rounding
+                    kDistances[i] = services::internal::max<cpu, FPType>(FPType(0), nearest[i]);
+                    kIndexes[i]   = static_cast<int>(indices[i]);
+                }
+
+                if (rootPower != FPType(1))
+                {
+                    Math<FPType, cpu>::vPowx(iSize * k, kDistances, FPType(1) / rootPower, kDistances);
+                }
+
+                return writeBlockResults(startTestIdx, iSize, k, kIndexes, kDistances, resultsToEvaluate, resultsToCompute, nClasses, nTrain,
+                                         voteWeights, trainLabel, testLabelTable, indicesTable, distancesTable, tlsVoting);
+            });
+    }
+
     struct BruteForceTask
     {
     public:
@@ -266,14 +361,24 @@ protected:
             daal::algorithms::internal::qSort<FPType, int, cpu>(k, kDistances + i * k, kIndexes + i * k);
         }
 
+        return writeBlockResults(startTestIdx, iSize, k, kIndexes, kDistances, resultsToEvaluate, resultsToCompute, nClasses, nTrain, voteWeights,
+                                 trainLabel, testLabelTable, indicesTable, distancesTable, tlsVoting);
+    }
+
+    // Writes indices and distances to the k nearest neighbors of the block of test rows and votes for their labels
+    services::Status writeBlockResults(const size_t startTestIdx, const size_t iSize, const size_t k, int * kIndexes, FPType * kDistances,
+                                       DAAL_UINT64 resultsToEvaluate, DAAL_UINT64 resultsToCompute, const size_t nClasses, const size_t nTrain,
+                                       VoteWeights voteWeights, const FPType * trainLabel, NumericTable * testLabelTable, NumericTable * indicesTable,
+                                       NumericTable * distancesTable, TlsMem<FPType, cpu> & tlsVoting)
+    {
         if (resultsToCompute & computeIndicesOfNeighbors)
         {
             daal::internal::WriteOnlyRows<int, cpu> indexesBlock(indicesTable, startTestIdx, iSize);
             DAAL_CHECK_BLOCK_STATUS(indexesBlock);
             int * indices = indexesBlock.get();
 
-            DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, blockSize * sizeof(*indices), k);
-            const size_t size = blockSize * k * sizeof(*indices);
+            DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, iSize * sizeof(*indices), k);
+            const size_t size = iSize * k * sizeof(*indices);
             DAAL_CHECK(!daal::services::internal::daal_memcpy_s(indices, size, kIndexes, size), daal::services::ErrorMemoryCopyFailedInternal);
         }
 
@@ -283,8 +388,8 @@ protected:
             DAAL_CHECK_BLOCK_STATUS(distancesBlock);
             FPType * distances = distancesBlock.get();
 
-            DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, blockSize * sizeof(FPType), k);
-            const size_t size = blockSize * k * sizeof(FPType);
+            DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, iSize * sizeof(FPType), k);
+            const size_t size = iSize * k * sizeof(FPType);
             DAAL_CHECK(!daal::services::internal::daal_memcpy_s(distances, size, kDistances, size), daal::services::ErrorMemoryCopyFailedInternal);
         }
 
@@ -0,0 +1,48 @@
+/* file: bf_knn_classification_model_impl_v1.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the parameter of the brute-force K-Nearest Neighbors (kNN) algorithm
+//--
+*/
+
+#include "algorithms/k_nearest_neighbors/bf_knn_classification_model.h"
+#include "src/services/daal_strings.h"
+#include "src/services/service_data_utils.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace bf_knn_classification
+{
+namespace interface1
+{
+services::Status Parameter::check() const
+{
+    DAAL_CHECK_EX(this->nClasses > 1 && this->nClasses < static_cast<size_t>(services::internal::MaxVal<int>::get()),
+                  services::ErrorIncorrectParameter, services::ParameterName, nClassesStr());
+    DAAL_CHECK_EX(this->k > 0 && this->k <= static_cast<size_t>(services::internal::MaxVal<int>::get()), services::ErrorIncorrectParameter,
+                  services::ParameterName, kStr());
+    return services::Status();
+}
+
+} // namespace interface1
+} // namespace bf_knn_classification
+} // namespace algorithms
+} // namespace daal
@@ -25,7 +25,9 @@
 #define __KDTREE_KNN_CLASSIFICATION_MODEL_IMPL_
 
 #include "algorithms/k_nearest_neighbors/kdtree_knn_classification_model.h"
+#include "services/collection.h"
 #include "src/services/service_data_utils.h"
+#include "src/algorithms/service_threading.h"
 
 namespace daal
 {
@@ -59,6 +61,118 @@ public:
 typedef services::SharedPtr<KDTreeTable> KDTreeTablePtr;
 typedef services::SharedPtr<const KDTreeTable> KDTreeTableConstPtr;
 
+/**
+ * KD-tree node of the compact layout: 32-bit indices and the cut point in the type of the computations.
+ * The node takes 16 bytes for float instead of 32 bytes of KDTreeNode.
+ */
+template <typename algorithmFPType>
+struct KDTreeNodeCompact
+{
+    uint32_t dimension;       /* Splitting feature or KDTreeCompact::nullDimension for a leaf */
+    uint32_t leftIndex;       /* Index of the left child or the first point of a leaf */
+    uint32_t rightIndex;      /* Index of the right child or the point past the last one of a leaf */
+    algorithmFPType cutPoint; /* Value of the splitting feature */
+};
+
+/**
+ * Compact copy of the KD-tree used in the prediction.
+ * The points of every leaf bucket are stored row by row in one contiguous block,
+ * so the distances to all the points of a leaf are computed without gathering the features.
+ * The training data that is already a homogen table of algorithmFPType is referenced instead of copied.
+ */
+template <typename algorithmFPType>
+class KDTreeCompact
+{
+public:
+    static const uint32_t nullDimension = static_cast<uint32_t>(-1);
+
+    DAAL_NEW_DELETE();
+
+    KDTreeCompact() : _nFeatures(0), _pointsPtr(nullptr) {}
+
+    /**
+     * Checks whether the tree and the training data of the given sizes fit into the compact layout
+     */
+    static bool isApplicable(size_t nNodes, size_t nRows, size_t nFeatures)
+    {
+        return nNodes < nullDimension && nRows < nullDimension && nFeatures < nullDimension;
+    }
+
+    services::Status build(const KDTreeTable & kdTreeTable, const data_management::NumericTablePtr & data)
+    {
+        const size_t nNodes = kdTreeTable.getNumberOfRows();
+        const size_t nRows  = data->getNumberOfRows();
+        _nFeatures          = data->getNumberOfColumns();
+        DAAL_CHECK(isApplicable(nNodes, nRows, _nFeatures), services::ErrorIncorrectSizeOfModel);
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows, _nFeatures);
+
+        _nodes.resize(nNodes);
+        DAAL_CHECK_MALLOC(!nNodes || _nodes.data());
+
+        const KDTreeNode * const srcNodes = static_cast<const KDTreeNode *>(const_cast<KDTreeTable &>(kdTreeTable).getArray());
+        KDTreeNodeCompact<algorithmFPType> * const nodes = _nodes.data();
+        for (size_t i = 0; i < nNodes; ++i)
+        {
+            const KDTreeNode & src = srcNodes[i];
+            nodes[i].dimension     = (src.dimension == static_cast<size_t>(-1)) ? nullDimension : static_cast<uint32_t>(src.dimension);
+            nodes[i].leftIndex     = static_cast<uint32_t>(src.leftIndex);
+            nodes[i].rightIndex    = static_cast<uint32_t>(src.rightIndex);
+            nodes[i].cutPoint      = static_cast<algorithmFPType>(src.cutPoint);
+        }
+
+        return buildPoints(data);
+    }
+
+    const KDTreeNodeCompact<algorithmFPType> * getNodes() const { return _nodes.data(); }
+
+    /* Points of the training data in the order of the leaves, nRows x nFeatures */
+    const algorithmFPType * getPoints() const { return _pointsPtr; }
+
+    size_t getNumberOfFeatures() const { return _nFeatures; }
+
+private:
+    services::Status buildPoints(const data_management::NumericTablePtr & data)
+    {
+        typedef data_management::HomogenNumericTable<algorithmFPType> HomogenNT;
+
+        const HomogenNT * const hmgData = dynamic_cast<const HomogenNT *>(data.get());
+        if (hmgData && hmgData->getArray())
+        {
+            /* The table is kept alive by the tree, the model resets the tree when the data is replaced */
+            _data      = data;
+            _pointsPtr = hmgData->getArray();
+            return services::Status();
+        }
+
+        const size_t nRows = data->getNumberOfRows();
+        _points.resize(nRows * _nFeatures);
+        DAAL_CHECK_MALLOC(!nRows || _points.data());
+        _pointsPtr = _points.data();
+
+        const size_t blockSize = 4096;
+        services::Status st;
+        for (size_t iStart = 0; iStart < nRows; iStart += blockSize)
+        {
+            const size_t nRowsInBlock = (iStart + blockSize > nRows) ? nRows - iStart : blockSize;
+
+            data_management::BlockDescriptor<algorithmFPType> block;
+            DAAL_CHECK_STATUS(st, data->getBlockOfRows(iStart, nRowsInBlock, data_management::readOnly, block));
+            const int result = services::internal::daal_memcpy_s(_points.data() + iStart * _nFeatures,
+                                                                 nRowsInBlock * _nFeatures * sizeof(algorithmFPType), block.getBlockPtr(),
+                                                                 nRowsInBlock * _nFeatures * sizeof(algorithmFPType));
+            DAAL_CHECK_STATUS(st, data->releaseBlockOfRows(block));
+            DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+        }
+        return st;
+    }
+
+    size_t _nFeatures;
+    services::Collection<KDTreeNodeCompact<algorithmFPType> > _nodes;
+    services::Collection<algorithmFPType> _points; /* Copy of the training data that is not a homogen table of algorithmFPType */
+    data_management::NumericTablePtr _data;        /* Training data referenced by the tree */
+    const algorithmFPType * _pointsPtr;
+};
+
 class Model::ModelImpl
 {
 public:
@@ -83,7 +197,11 @@ public:
      * Sets a KD-tree table
      * \param[in]  value  KD-tree table
      */
-    void setKDTreeTable(const KDTreeTablePtr & value) { _kdTreeTable = value; }
+    void setKDTreeTable(const KDTreeTablePtr & value)
+    {
+        _kdTreeTable = value;
+        resetCompactKDTree();
+    }
 
     /**
      * Returns the index of KD-tree root node
@@ -121,9 +239,47 @@ public:
      */
     data_management::NumericTablePtr getData() { return _data; }
 
+    /**
+     * Returns the compact copy of the KD-tree built in the type of the computations.
+     * The copy is built on the first request and reused by the next predictions
+     * \param[out] st  Status of the operation
+     * \return Compact copy of the KD-tree or empty pointer if the tree does not fit into the compact layout
+     */
+    template <typename algorithmFPType>
+    services::SharedPtr<const KDTreeCompact<algorithmFPType> > getCompactKDTree(services::Status & st) const
+    {
+        typedef services::SharedPtr<KDTreeCompact<algorithmFPType> > CompactPtr;
+
+        if (!_kdTreeTable || !_data
+            || !KDTreeCompact<algorithmFPType>::isApplicable(_kdTreeTable->getNumberOfRows(), _data->getNumberOfRows(), _data->getNumberOfColumns()))
+        {
+            return services::SharedPtr<const KDTreeCompact<algorithmFPType> >();
+        }
+
+        AUTOLOCK(_compactKDTreeMutex);
+        CompactPtr & compact = compactKDTree(static_cast<algorithmFPType *>(nullptr));
+        if (!compact)
+        {
+            CompactPtr newCompact(new KDTreeCompact<algorithmFPType>());
+            if (!newCompact)
+            {
+                st.add(services::ErrorMemoryAllocationFailed);
+                return services::SharedPtr<const KDTreeCompact<algorithmFPType> >();
+            }
+            st |= newCompact->build(*_kdTreeTable, _data);
+            if (!st) return services::SharedPtr<const KDTreeCompact<algorithmFPType> >();
+            compact = newCompact;
+        }
+        return compact;
+    }
+
     template <typename Archive, bool onDeserialize>
     services::Status serialImpl(Archive * arch)
     {
+        if (onDeserialize)
+        {
+            resetCompactKDTree();
+        }
         arch->set(_nFeatures);
         arch->set(_rootNodeIndex);
         arch->set(_lastNodeIndex);
@@ -144,6 +300,7 @@ public:
     DAAL_EXPORT DAAL_FORCEINLINE services::Status setData(const data_management::NumericTablePtr & value, bool copy)
     {
         int result = 0;
+        resetCompactKDTree();
         if (!copy)
         {
             _data = value;
@@ -261,6 +418,15 @@ public:
     }
 
 private:
+    void resetCompactKDTree()
+    {
+        _compactKDTreeFloat.reset();
+        _compactKDTreeDouble.reset();
+    }
+
+    services::SharedPtr<KDTreeCompact<float> > & compactKDTree(float *) const { return _compactKDTreeFloat; }
+    services::SharedPtr<KDTreeCompact<double> > & compactKDTree(double *) const { return _compactKDTreeDouble; }
+
     size_t _nFeatures;
     KDTreeTablePtr _kdTreeTable;
     size_t _rootNodeIndex;
@@ -268,6 +434,11 @@ private:
     data_management::NumericTablePtr _data;
     data_management::NumericTablePtr _labels;
     data_management::NumericTablePtr _indices;
+
+    /* Compact copies of the KD-tree are not serialized: they are rebuilt on the first prediction */
+    mutable services::SharedPtr<KDTreeCompact<float> > _compactKDTreeFloat;
+    mutable services::SharedPtr<KDTreeCompact<double> > _compactKDTreeDouble;
+    mutable daal::Mutex _compactKDTreeMutex;
 };
 
 } // namespace interface1
@@ -276,6 +447,8 @@ using interface1::KDTreeTable;
 using interface1::KDTreeTablePtr;
 using interface1::KDTreeTableConstPtr;
 using interface1::KDTreeNode;
+using interface1::KDTreeNodeCompact;
+using interface1::KDTreeCompact;
 
 } // namespace kdtree_knn_classification
 } // namespace algorithms
@@ -72,6 +72,15 @@ protected:
                               const KDTreeTable & kdTreeTable, size_t rootTreeNodeIndex, const NumericTable & data, const bool isHomogenSOA,
                               services::internal::TArrayScalable<algorithmFpType *, cpu> & soa_arrays);
 
+    void findNearestNeighborsTile(const algorithmFpType * queries, size_t nQueries, Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> * heaps,
+                                  kdtree_knn_classification::internal::Stack<SearchNode<algorithmFpType>, cpu> & stack, size_t k,
+                                  const KDTreeCompact<algorithmFpType> & kdTree, size_t rootTreeNodeIndex);
+
+    void findNearestNeighborsCompact(const algorithmFpType * query, Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap,
+                                     kdtree_knn_classification::internal::Stack<SearchNode<algorithmFpType>, cpu> & stack, size_t k,
+                                     algorithmFpType radius, const KDTreeCompact<algorithmFpType> & kdTree, size_t rootTreeNodeIndex,
+                                     size_t skippedLeafIndex);
+
     services::Status predict(algorithmFpType * predictedClass, const Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap,
                              const NumericTable * labels, size_t k, VoteWeights voteWeights, const NumericTable * modelIndices,
                              data_management::BlockDescriptor<int> & indices, data_management::BlockDescriptor<algorithmFpType> & distances,
@@ -174,6 +174,10 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::compu
 
     const NumericTable * const modelIndices = model->impl()->getIndices().get();
 
+    /* Compact copy of the tree is built once per model; models that do not fit into it are searched in the original layout */
+    const services::SharedPtr<const KDTreeCompact<algorithmFpType> > compactTree = model->impl()->template getCompactKDTree<algorithmFpType>(status);
+    DAAL_CHECK_STATUS_VAR(status);
+
     size_t iSize = 1;
     while (iSize < k)
     {
@@ -185,25 +189,34 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::compu
     const algorithmFpType base    = 2.0;
     const size_t expectedMaxDepth = (Math::sLog(xRowCount) / Math::sLog(base) + 1) * __KDTREE_DEPTH_MULTIPLICATION_FACTOR;
     const size_t stackSize        = Math::sPowx(base, Math::sCeil(Math::sLog(expectedMaxDepth) / Math::sLog(base)));
+    const size_t nHeaps           = compactTree ? __KDTREE_QUERY_TILE_SIZE : 1;
     struct Local
     {
-        MaxHeap heap;
+        MaxHeap heaps[__KDTREE_QUERY_TILE_SIZE];
         SearchStack stack;
+
+        void clear()
+        {
+            stack.clear();
+            for (size_t i = 0; i < __KDTREE_QUERY_TILE_SIZE; ++i)
+            {
+                heaps[i].clear();
+            }
+        }
     };
     daal::tls<Local *> localTLS([&]() -> Local * {
         Local * const ptr = service_scalable_calloc<Local, cpu>(1);
         if (ptr)
         {
-            if (!ptr->heap.init(heapSize))
+            bool isInitialized = ptr->stack.init(stackSize);
+            for (size_t i = 0; i < nHeaps && isInitialized; ++i)
             {
-                status.add(services::ErrorMemoryAllocationFailed);
-                service_scalable_free<Local, cpu>(ptr);
-                return nullptr;
+                isInitialized = ptr->heaps[i].init(heapSize);
             }
-            if (!ptr->stack.init(stackSize))
+            if (!isInitialized)
             {
                 status.add(services::ErrorMemoryAllocationFailed);
-                ptr->heap.clear();
+                ptr->clear();
                 service_scalable_free<Local, cpu>(ptr);
                 return nullptr;
             }
@@ -253,35 +266,49 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::compu
                 DAAL_CHECK_STATUS_THR(s);
             }
 
+            size_t yColumnCount = 0;
+            algorithmFpType * dy = nullptr;
+            data_management::BlockDescriptor<algorithmFpType> yBD;
             if (labels)
             {
-                const size_t yColumnCount = y->getNumberOfColumns();
-                data_management::BlockDescriptor<algorithmFpType> yBD;
+                yColumnCount = y->getNumberOfColumns();
                 y->getBlockOfRows(first, last - first, writeOnly, yBD);
-                auto * const dy = yBD.getBlockPtr();
+                dy = yBD.getBlockPtr();
+            }
 
-                for (size_t i = 0; i < last - first; ++i)
+            if (compactTree)
+            {
+                for (size_t iTile = 0; iTile < last - first; iTile += __KDTREE_QUERY_TILE_SIZE)
                 {
-                    findNearestNeighbors(&dx[i * xColumnCount], local->heap, local->stack, k, radius, kdTreeTable, rootTreeNodeIndex, data,
-                                         isHomogenSOA, soa_arrays);
-                    s = predict(&(dy[i * yColumnCount]), local->heap, labels, k, voteWeights, modelIndices, indicesBD, distancesBD, i, nClasses);
-                    DAAL_CHECK_STATUS_THR(s)
-                }
+                    const size_t tileSize = min<cpu>(static_cast<size_t>(__KDTREE_QUERY_TILE_SIZE), last - first - iTile);
+                    findNearestNeighborsTile(&dx[iTile * xColumnCount], tileSize, local->heaps, local->stack, k, *compactTree, rootTreeNodeIndex);
 
-                s |= y->releaseBlockOfRows(yBD);
-                DAAL_CHECK_STATUS_THR(s);
+                    for (size_t i = iTile; i < iTile + tileSize; ++i)
+                    {
+                        s = predict(dy ? &(dy[i * yColumnCount]) : nullptr, local->heaps[i - iTile], labels, k, voteWeights, modelIndices, indicesBD,
+                                    distancesBD, i, nClasses);
+                        DAAL_CHECK_STATUS_THR(s)
+                    }
+                }
             }
             else
             {
                 for (size_t i = 0; i < last - first; ++i)
                 {
-                    findNearestNeighbors(&dx[i * xColumnCount], local->heap, local->stack, k, radius, kdTreeTable, rootTreeNodeIndex, data,
+                    findNearestNeighbors(&dx[i * xColumnCount], local->heaps[0], local->stack, k, radius, kdTreeTable, rootTreeNodeIndex, data,
                                          isHomogenSOA, soa_arrays);
-                    s = predict(nullptr, local->heap, labels, k, voteWeights, modelIndices, indicesBD, distancesBD, i, nClasses);
+                    s = predict(dy ? &(dy[i * yColumnCount]) : nullptr, local->heaps[0], labels, k, voteWeights, modelIndices, indicesBD, distancesBD,
+                                i, nClasses);
                     DAAL_CHECK_STATUS_THR(s)
                 }
             }
 
+            if (labels)
+            {
+                s |= y->releaseBlockOfRows(yBD);
+                DAAL_CHECK_STATUS_THR(s);
+            }
+
             if (indices)
             {
                 s |= indices->releaseBlockOfRows(indicesBD);
@@ -302,8 +329,7 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::compu
     localTLS.reduce([&](Local * ptr) -> void {
         if (ptr)
         {
-            ptr->stack.clear();
-            ptr->heap.clear();
+            ptr->clear();
             service_scalable_free<Local, cpu>(ptr);
         }
     });
@@ -448,6 +474,178 @@ void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::findNea
     }
 }
 
+/* Adds the point to the k nearest neighbors if it is closer than the current radius of the search */
+template <typename algorithmFpType, CpuType cpu>
+DAAL_FORCEINLINE void updateNeighbors(Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap, size_t k, algorithmFpType distance, size_t index,
+                                      algorithmFpType & radius)
+{
+    if (distance > radius)
+    {
+        return;
+    }
+
+    GlobalNeighbors<algorithmFpType, cpu> curNeighbor;
+    curNeighbor.distance = distance;
+    curNeighbor.index    = index;
+    if (heap.size() < k)
+    {
+        heap.push(curNeighbor, k);
+        if (heap.size() == k)
+        {
+            radius = heap.getMax()->distance;
+        }
+    }
+    else if (heap.getMax()->distance > distance)
+    {
+        heap.replaceMax(curNeighbor);
+        radius = heap.getMax()->distance;
+    }
+}
+
+/* Squared Euclidean distance between the query and the point stored row by row in the leaf bucket */
+template <typename algorithmFpType, CpuType cpu>
+DAAL_FORCEINLINE algorithmFpType computeDistanceCompact(const algorithmFpType * point, const algorithmFpType * query, size_t nFeatures)
+{
+    algorithmFpType sum = 0;
+    PRAGMA_IVDEP
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t j = 0; j < nFeatures; ++j)
+    {
+        const algorithmFpType diff = query[j] - point[j];
+        sum += diff * diff;
+    }
+    return sum;
+}
+
+/**
+ *  Searches the nearest neighbors of a tile of queries in the compact KD-tree.
+ *  Every query is first descended to the leaf containing it. The queries are grouped by these leaves, and the distances
+ *  to the points of a leaf bucket are computed for the whole group while the bucket stays in cache.
+ *  The rest of the tree is then searched for every query starting from the radius found in its own leaf.
+ */
+template <typename algorithmFpType, CpuType cpu>
+void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::findNearestNeighborsTile(
+    const algorithmFpType * queries, size_t nQueries, Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> * heaps,
+    kdtree_knn_classification::internal::Stack<SearchNode<algorithmFpType>, cpu> & stack, size_t k, const KDTreeCompact<algorithmFpType> & kdTree,
+    size_t rootTreeNodeIndex)
+{
+    typedef KDTreeNodeCompact<algorithmFpType> Node;
+
+    const Node * const nodes             = kdTree.getNodes();
+    const algorithmFpType * const points = kdTree.getPoints();
+    const size_t nFeatures               = kdTree.getNumberOfFeatures();
+
+    size_t leafIndex[__KDTREE_QUERY_TILE_SIZE];
+    size_t order[__KDTREE_QUERY_TILE_SIZE];
+    algorithmFpType radius[__KDTREE_QUERY_TILE_SIZE];
+
+    for (size_t t = 0; t < nQueries; ++t)
+    {
+        const algorithmFpType * const query = queries + t * nFeatures;
+
+        size_t nodeIndex = rootTreeNodeIndex;
+        while (nodes[nodeIndex].dimension != KDTreeCompact<algorithmFpType>::nullDimension)
+        {
+            const Node & node = nodes[nodeIndex];
+            nodeIndex         = (query[node.dimension] < node.cutPoint) ? node.leftIndex : node.rightIndex;
+        }
+
+        leafIndex[t] = nodeIndex;
+        order[t]     = t;
+        radius[t]    = daal::services::internal::MaxVal<algorithmFpType>::get();
+        heaps[t].reset();
+    }
+
+    for (size_t t = 1; t < nQueries; ++t)
+    {
+        const size_t cur = order[t];
+        size_t j         = t;
+        for (; j > 0 && leafIndex[order[j - 1]] > leafIndex[cur]; --j)
+        {
+            order[j] = order[j - 1];
+        }
+        order[j] = cur;
+    }
+
+    for (size_t groupStart = 0; groupStart < nQueries;)
+    {
+        const size_t leaf = leafIndex[order[groupStart]];
+        size_t groupEnd   = groupStart + 1;
+        while (groupEnd < nQueries && leafIndex[order[groupEnd]] == leaf)
+        {
+            ++groupEnd;
+        }
+
+        const Node & node = nodes[leaf];
+        for (size_t i = node.leftIndex; i < node.rightIndex; ++i)
+        {
+            const algorithmFpType * const point = points + i * nFeatures;
+            DAAL_PREFETCH_READ_T0(point + nFeatures);
+            for (size_t g = groupStart; g < groupEnd; ++g)
+            {
+                const size_t t                 = order[g];
+                const algorithmFpType distance = computeDistanceCompact<algorithmFpType, cpu>(point, queries + t * nFeatures, nFeatures);
+                updateNeighbors<algorithmFpType, cpu>(heaps[t], k, distance, i, radius[t]);
+            }
+        }
+        groupStart = groupEnd;
+    }
+
+    for (size_t t = 0; t < nQueries; ++t)
+    {
+        findNearestNeighborsCompact(queries + t * nFeatures, heaps[t], stack, k, radius[t], kdTree, rootTreeNodeIndex, leafIndex[t]);
+    }
+}
+
+template <typename algorithmFpType, CpuType cpu>
+void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::findNearestNeighborsCompact(
+    const algorithmFpType * query, Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap,
+    kdtree_knn_classification::internal::Stack<SearchNode<algorithmFpType>, cpu> & stack, size_t k, algorithmFpType radius,
+    const KDTreeCompact<algorithmFpType> & kdTree, size_t rootTreeNodeIndex, size_t skippedLeafIndex)
+{
+    typedef KDTreeNodeCompact<algorithmFpType> Node;
+
+    const Node * const nodes             = kdTree.getNodes();
+    const algorithmFpType * const points = kdTree.getPoints();
+    const size_t nFeatures               = kdTree.getNumberOfFeatures();
+
+    stack.reset();
+    SearchNode<algorithmFpType> cur, toPush;
+    cur.nodeIndex   = rootTreeNodeIndex;
+    cur.minDistance = 0;
+
+    for (;;)
+    {
+        const Node & node = nodes[cur.nodeIndex];
+        if (node.dimension == KDTreeCompact<algorithmFpType>::nullDimension || cur.minDistance > radius)
+        {
+            if (node.dimension == KDTreeCompact<algorithmFpType>::nullDimension && cur.nodeIndex != skippedLeafIndex && cur.minDistance <= radius)
+            {
+                for (size_t i = node.leftIndex; i < node.rightIndex; ++i)
+                {
+                    const algorithmFpType distance = computeDistanceCompact<algorithmFpType, cpu>(points + i * nFeatures, query, nFeatures);
+                    updateNeighbors<algorithmFpType, cpu>(heap, k, distance, i, radius);
+                }
+            }
+
+            if (stack.empty())
+            {
+                break;
+            }
+            cur = stack.pop();
+            DAAL_PREFETCH_READ_T0(nodes + cur.nodeIndex);
+        }
+        else
+        {
+            const algorithmFpType diff = query[node.dimension] - node.cutPoint;
+            cur.nodeIndex              = (diff < 0) ? node.leftIndex : node.rightIndex;
+            toPush.nodeIndex           = (diff < 0) ? node.rightIndex : node.leftIndex;
+            toPush.minDistance         = cur.minDistance + diff * diff;
+            stack.push(toPush);
+        }
+    }
+}
+
 template <typename algorithmFpType, CpuType cpu>
 services::Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::predict(
     algorithmFpType * predictedClass, const Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap, const NumericTable * labels, size_t k,
@@ -48,6 +48,7 @@ namespace internal
 #define __KDTREE_MAX_SAMPLES                          1024
 #define __KDTREE_MIN_SAMPLES                          256
 #define __SIMDWIDTH                                   8
+#define __KDTREE_QUERY_TILE_SIZE                      32 // Number of queries searched together in the compact KD-tree.
 
 #define __KDTREE_NULLDIMENSION (static_cast<size_t>(-1))
 
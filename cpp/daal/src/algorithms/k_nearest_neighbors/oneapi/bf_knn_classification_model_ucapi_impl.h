@@ -23,6 +23,8 @@
 #include "data_management/data/homogen_numeric_table.h"
 #include "services/internal/sycl/execution_context.h"
 #include "services/daal_defines.h"
+#include "services/library_version_info.h"
+#include "src/services/service_defines.h"
 
 namespace daal
 {
@@ -35,19 +37,27 @@ namespace interface1
 class Model::ModelImpl
 {
 public:
-    ModelImpl(size_t nFeatures = 0) : _nFeatures(nFeatures) {}
+    ModelImpl(size_t nFeatures = 0) : _nFeatures(nFeatures), _entryPoint(0) {}
 
     data_management::NumericTableConstPtr getData() const { return _data; }
 
     data_management::NumericTablePtr getData() { return _data; }
 
     template <typename Archive, bool onDeserialize>
-    services::Status serialImpl(Archive * arch)
+    services::Status serialImpl(Archive * arch, int daalVersion = INTEL_DAAL_VERSION)
     {
         arch->set(_nFeatures);
         arch->setSharedPtrObj(_data);
         arch->setSharedPtrObj(_labels);
 
+        if (daalVersion >= COMPUTE_DAAL_VERSION(2021, 3, 0))
+        {
+            arch->set(_entryPoint);
+            arch->setSharedPtrObj(_graph);
+            arch->setSharedPtrObj(_upperGraph);
+            arch->setSharedPtrObj(_nodeLevels);
+        }
+
         return services::Status();
     }
 
@@ -69,6 +79,30 @@ public:
 
     size_t getNumberOfFeatures() const { return _nFeatures; }
 
+    /**
+     * HNSW graph built by the hnswDense training method:
+     *  - graph       Bottom level adjacency, one row per observation: the number of neighbors followed by their indices
+     *  - upperGraph  Adjacency on the upper levels, one row per pair (observation, level) in the same format
+     *  - nodeLevels  One row per observation: the top level of the observation and the first row of it in upperGraph
+     *  - entryPoint  Index of the observation the search starts from
+     */
+    data_management::NumericTableConstPtr getGraph() const { return _graph; }
+
+    data_management::NumericTableConstPtr getUpperGraph() const { return _upperGraph; }
+
+    data_management::NumericTableConstPtr getNodeLevels() const { return _nodeLevels; }
+
+    size_t getEntryPoint() const { return _entryPoint; }
+
+    void setGraph(const data_management::NumericTablePtr & graph, const data_management::NumericTablePtr & upperGraph,
+                  const data_management::NumericTablePtr & nodeLevels, size_t entryPoint)
+    {
+        _graph      = graph;
+        _upperGraph = upperGraph;
+        _nodeLevels = nodeLevels;
+        _entryPoint = entryPoint;
+    }
+
 protected:
     template <typename algorithmFPType>
     DAAL_FORCEINLINE services::Status setTable(const data_management::NumericTablePtr & value, data_management::NumericTablePtr & dest, bool copy)
@@ -124,6 +158,10 @@ private:
     size_t _nFeatures;
     data_management::NumericTablePtr _data;
     data_management::NumericTablePtr _labels;
+    size_t _entryPoint;
+    data_management::NumericTablePtr _graph;
+    data_management::NumericTablePtr _upperGraph;
+    data_management::NumericTablePtr _nodeLevels;
 };
 
 } // namespace interface1
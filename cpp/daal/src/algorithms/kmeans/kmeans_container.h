@@ -28,6 +28,7 @@
 #include "algorithms/kmeans/kmeans_types.h"
 #include "algorithms/kmeans/kmeans_batch.h"
 #include "algorithms/kmeans/kmeans_distributed.h"
+#include "algorithms/kmeans/kmeans_online.h"
 #include "src/algorithms/kmeans/kmeans_lloyd_kernel.h"
 #include "src/algorithms/kmeans/oneapi/kmeans_dense_lloyd_batch_kernel_ucapi.h"
 #include "src/algorithms/kmeans/oneapi/kmeans_lloyd_distr_step1_kernel_ucapi.h"
@@ -297,6 +298,62 @@ services::Status DistributedContainer<step2Master, algorithmFPType, method, cpu>
     }
 }
 
+template <typename algorithmFPType, Method method, CpuType cpu>
+OnlineContainer<algorithmFPType, method, cpu>::OnlineContainer(daal::services::Environment::env * daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::KMeansOnlineKernel, method, algorithmFPType);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+OnlineContainer<algorithmFPType, method, cpu>::~OnlineContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status OnlineContainer<algorithmFPType, method, cpu>::compute()
+{
+    Input * input        = static_cast<Input *>(_in);
+    PartialResult * pres = static_cast<PartialResult *>(_pres);
+    Parameter * par      = static_cast<Parameter *>(_par);
+
+    const size_t na = 1;
+    NumericTable * a[na];
+    a[0] = static_cast<NumericTable *>(input->get(data).get());
+
+    const size_t nr = 3;
+    NumericTable * r[nr];
+    r[0] = static_cast<NumericTable *>(pres->get(nObservations).get());
+    r[1] = static_cast<NumericTable *>(pres->get(partialSums).get());
+    r[2] = static_cast<NumericTable *>(pres->get(partialObjectiveFunction).get());
+
+    daal::services::Environment::env & env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::KMeansOnlineKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, na, a, nr, r, par);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status OnlineContainer<algorithmFPType, method, cpu>::finalizeCompute()
+{
+    PartialResult * pres = static_cast<PartialResult *>(_pres);
+    Result * result      = static_cast<Result *>(_res);
+    Parameter * par      = static_cast<Parameter *>(_par);
+
+    const size_t na = 3;
+    NumericTable * a[na];
+    a[0] = static_cast<NumericTable *>(pres->get(nObservations).get());
+    a[1] = static_cast<NumericTable *>(pres->get(partialSums).get());
+    a[2] = static_cast<NumericTable *>(pres->get(partialObjectiveFunction).get());
+
+    const size_t nr = 3;
+    NumericTable * r[nr];
+    r[0] = static_cast<NumericTable *>(result->get(centroids).get());
+    r[1] = static_cast<NumericTable *>(result->get(objectiveFunction).get());
+    r[2] = static_cast<NumericTable *>(result->get(nIterations).get());
+
+    daal::services::Environment::env & env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::KMeansOnlineKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), finalizeCompute, na, a, nr, r, par);
+}
+
 } // namespace interface2
 } // namespace kmeans
 } // namespace algorithms
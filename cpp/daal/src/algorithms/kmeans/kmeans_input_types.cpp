@@ -82,6 +82,14 @@ services::Status Input::check(const daal::algorithms::Parameter * parameter, int
     const size_t inputFeatures = get(data)->getNumberOfColumns();
     const size_t inputRows     = get(data)->getNumberOfRows();
 
+    if (method == miniBatchDense)
+    {
+        /* In the online processing mode the centroids are required on the first call only,
+           the next calls continue from the partial results */
+        const NumericTable * const inCentroids = get(inputCentroids).get();
+        return inCentroids ? checkNumericTable(inCentroids, inputCentroidsStr(), 0, 0, inputFeatures, kmPar->nClusters) : s;
+    }
+
     if (kmPar->maxIterations > 0)
     {
         DAAL_CHECK(inputRows >= kmPar->nClusters, ErrorKMeansNumberOfClustersIsTooLarge);
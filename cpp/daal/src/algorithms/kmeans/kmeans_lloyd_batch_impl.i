@@ -141,6 +141,12 @@ Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTab
     size_t blockSize = 0;
     DAAL_SAFE_CPU_CALL((blockSize = BSHelper<method, algorithmFPType, cpu>::kmeansGetBlockSize(n, p, nClusters)), (blockSize = 512))
 
+    /* Triangle inequality bounds pay off when the distances to many centroids can be skipped in the later iterations */
+    const size_t minClustersForBounds = 16;
+    const bool useBounds              = (method == lloydDense) && (nIter > 1) && (nClusters >= minClustersForBounds);
+    KMeansBounds<algorithmFPType, cpu> bounds(useBounds ? n : 0, useBounds ? nClusters : 0, p);
+    DAAL_CHECK(!useBounds || bounds.isValid(), services::ErrorMemoryAllocationFailed);
+
     size_t kIter;
 
     for (kIter = 0; kIter < nIter; kIter++)
@@ -150,8 +156,16 @@ Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTab
         {
             DAAL_ITTNOTIFY_SCOPED_TASK(addNTToTaskThreaded);
             /* For the last iteration we do not need to recount of assignmets */
-            s = task->template addNTToTaskThreaded<method>(ntData, catCoef.get(), blockSize,
-                                                           assignmetsNT && (kIter == nIter - 1) ? assignmetsNT : nullptr);
+            NumericTable * const ntAssign = assignmetsNT && (kIter == nIter - 1) ? assignmetsNT : nullptr;
+            if (useBounds)
+            {
+                s = bounds.setCentroids(inClusters);
+                if (s) s = task->addNTToTaskThreadedDenseBounded(ntData, blockSize, bounds, ntAssign);
+            }
+            else
+            {
+                s = task->template addNTToTaskThreaded<method>(ntData, catCoef.get(), blockSize, ntAssign);
+            }
         }
 
         if (!s)
@@ -200,6 +214,11 @@ Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTab
             }
         }
 
+        if (useBounds)
+        {
+            bounds.updateCentroids(clusters);
+        }
+
         {
             DAAL_ITTNOTIFY_SCOPED_TASK(kmeansUpdateObjectiveFunction);
             if (par->accuracyThreshold > (algorithmFPType)0.0)
@@ -48,18 +48,26 @@ using namespace daal::internal;
 using namespace daal::services;
 using namespace daal::services::internal;
 
+/* Number of centroids processed at a time by the nearest centroids search.
+ * Only the block of rows by the tile of centroids part of the distance matrix is stored */
+const size_t kmeansClusterTileSize = 128;
+
 template <typename algorithmFPType, CpuType cpu>
 struct TlsTask
 {
     DAAL_NEW_DELETE();
 
-    TlsTask(int dim, int clNum, int maxBlockSize)
+    TlsTask(int dim, int clNum, int maxBlockSize) : _dim(dim), _maxBlockSize(maxBlockSize)
     {
-        mklBuff  = service_scalable_calloc<algorithmFPType, cpu>(maxBlockSize * clNum);
+        const size_t tileSize = ((size_t)clNum < kmeansClusterTileSize) ? clNum : kmeansClusterTileSize;
+
+        mklBuff  = service_scalable_calloc<algorithmFPType, cpu>(maxBlockSize * tileSize);
         cS1      = service_scalable_calloc<algorithmFPType, cpu>(clNum * dim);
         cS0      = service_scalable_calloc<int, cpu>(clNum);
         cValues  = service_scalable_calloc<algorithmFPType, cpu>(clNum);
         cIndices = service_scalable_calloc<size_t, cpu>(clNum);
+        minIdx   = service_scalable_calloc<int, cpu>(maxBlockSize);
+        minVal   = service_scalable_calloc<algorithmFPType, cpu>(maxBlockSize);
     }
 
     ~TlsTask()
@@ -84,6 +92,30 @@ struct TlsTask
         {
             service_scalable_free<size_t, cpu>(cIndices);
         }
+        if (minIdx)
+        {
+            service_scalable_free<int, cpu>(minIdx);
+        }
+        if (minVal)
+        {
+            service_scalable_free<algorithmFPType, cpu>(minVal);
+        }
+        if (secondVal)
+        {
+            service_scalable_free<algorithmFPType, cpu>(secondVal);
+        }
+        if (distSq)
+        {
+            service_scalable_free<algorithmFPType, cpu>(distSq);
+        }
+        if (rowIndices)
+        {
+            service_scalable_free<int, cpu>(rowIndices);
+        }
+        if (rowsBuff)
+        {
+            service_scalable_free<algorithmFPType, cpu>(rowsBuff);
+        }
     }
 
     static TlsTask<algorithmFPType, cpu> * create(const size_t dim, const size_t clNum, const size_t maxBlockSize)
@@ -93,7 +125,7 @@ struct TlsTask
         {
             return nullptr;
         }
-        if (!result->mklBuff || !result->cS1 || !result->cS0)
+        if (!result->mklBuff || !result->cS1 || !result->cS0 || !result->minIdx || !result->minVal)
         {
             delete result;
             return nullptr;
@@ -101,6 +133,22 @@ struct TlsTask
         return result;
     }
 
+    /* Allocates the buffers used only by the search with the bounds on the distances, on the first call */
+    bool allocateBoundBuffers()
+    {
+        if (!rowsBuff)
+        {
+            secondVal  = service_scalable_calloc<algorithmFPType, cpu>(_maxBlockSize);
+            distSq     = service_scalable_calloc<algorithmFPType, cpu>(_maxBlockSize);
+            rowIndices = service_scalable_calloc<int, cpu>(_maxBlockSize);
+            if (secondVal && distSq && rowIndices)
+            {
+                rowsBuff = service_scalable_calloc<algorithmFPType, cpu>(_maxBlockSize * _dim);
+            }
+        }
+        return rowsBuff != nullptr;
+    }
+
     algorithmFPType * mklBuff = nullptr;
     algorithmFPType * cS1     = nullptr;
     int * cS0                 = nullptr;
@@ -108,6 +156,18 @@ struct TlsTask
     size_t cNum               = 0;
     algorithmFPType * cValues = nullptr;
     size_t * cIndices         = nullptr;
+
+    /* Buffers of the nearest centroids search in a block of rows */
+    int * minIdx                = nullptr;
+    algorithmFPType * minVal    = nullptr;
+    algorithmFPType * secondVal = nullptr;
+    algorithmFPType * distSq    = nullptr;
+    int * rowIndices            = nullptr;
+    algorithmFPType * rowsBuff  = nullptr;
+
+private:
+    size_t _dim;
+    size_t _maxBlockSize;
 };
 
 template <Method method, typename algorithmFPType, CpuType cpu>
@@ -119,8 +179,10 @@ struct BSHelper
 template <typename algorithmFPType, CpuType cpu>
 struct BSHelper<lloydDense, algorithmFPType, cpu>
 {
-    static size_t kmeansGetBlockSize(const size_t nRows, const size_t dim, const size_t clNum)
+    static size_t kmeansGetBlockSize(const size_t nRows, const size_t dim, const size_t nClusters)
     {
+        /* The centroids are processed by tiles, so only a tile of them has to fit into the cache */
+        const size_t clNum             = (nClusters < kmeansClusterTileSize) ? nClusters : kmeansClusterTileSize;
         const double cacheFullness     = 0.8;
         const size_t maxRowsPerBlock   = 512;
         const size_t minRowsPerBlockL1 = 256;
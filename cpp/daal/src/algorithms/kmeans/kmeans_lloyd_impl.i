@@ -46,6 +46,128 @@ using namespace daal::internal;
 using namespace daal::services;
 using namespace daal::services::internal;
 
+/**
+ *  Hamerly bounds on the distances from the observations to the centroids.
+ *  Every observation keeps the upper bound of the distance to its centroid and the lower bound of the distance
+ *  to the second nearest centroid between the iterations; the bounds are corrected by the shifts of the centroids.
+ *  The observation keeps its cluster while the distance to its centroid does not exceed the lower bound
+ *  and the half distance from its centroid to the nearest other centroid, so the distances to all the centroids
+ *  are computed only for the observations that fail this test.
+ */
+template <typename algorithmFPType, CpuType cpu>
+class KMeansBounds
+{
+public:
+    KMeansBounds(size_t n, size_t nClusters, size_t p)
+        : _nClusters(nClusters),
+          _p(p),
+          _upper(n),
+          _lower(n),
+          _assignments(n),
+          _halfMinDist(nClusters),
+          _shifts(nClusters),
+          _centroids(nClusters * p),
+          _maxShift(0),
+          _secondMaxShift(0),
+          _maxShiftIdx(0),
+          _isInitialized(false)
+    {}
+
+    bool isValid() const
+    {
+        return _upper.get() && _lower.get() && _assignments.get() && _halfMinDist.get() && _shifts.get() && _centroids.get();
+    }
+
+    /* Bounds are available after the first iteration, before it the distances to all the centroids are computed */
+    bool isInitialized() const { return _isInitialized; }
+
+    /* Stores the centroids used for the assignment and computes the half distances to the nearest other centroids */
+    Status setCentroids(const algorithmFPType * const centroids)
+    {
+        const size_t p         = _p;
+        const size_t nClusters = _nClusters;
+        int result = daal::services::internal::daal_memcpy_s(_centroids.get(), nClusters * p * sizeof(algorithmFPType), centroids,
+                                                             nClusters * p * sizeof(algorithmFPType));
+        DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+
+        algorithmFPType * const halfMinDist = _halfMinDist.get();
+        daal::threader_for(nClusters, nClusters, [&](size_t i) {
+            algorithmFPType minDist = MaxVal<algorithmFPType>::get();
+            for (size_t j = 0; j < nClusters; j++)
+            {
+                if (j == i) continue;
+                algorithmFPType dist = algorithmFPType(0);
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t k = 0; k < p; k++)
+                {
+                    const algorithmFPType diff = centroids[i * p + k] - centroids[j * p + k];
+                    dist += diff * diff;
+                }
+                minDist = (dist < minDist) ? dist : minDist;
+            }
+            halfMinDist[i] = (nClusters > 1) ? algorithmFPType(0.5) * Math<algorithmFPType, cpu>::sSqrt(minDist) : minDist;
+        });
+        return Status();
+    }
+
+    /* Computes the shifts of the centroids stored by setCentroids() */
+    void updateCentroids(const algorithmFPType * const centroids)
+    {
+        const size_t p  = _p;
+        _maxShift       = algorithmFPType(0);
+        _secondMaxShift = algorithmFPType(0);
+        _maxShiftIdx    = 0;
+        for (size_t i = 0; i < _nClusters; i++)
+        {
+            algorithmFPType shift = algorithmFPType(0);
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t k = 0; k < p; k++)
+            {
+                const algorithmFPType diff = centroids[i * p + k] - _centroids[i * p + k];
+                shift += diff * diff;
+            }
+            shift      = Math<algorithmFPType, cpu>::sSqrt(shift);
+            _shifts[i] = shift;
+            if (shift > _maxShift)
+            {
+                _secondMaxShift = _maxShift;
+                _maxShift       = shift;
+                _maxShiftIdx    = i;
+            }
+            else if (shift > _secondMaxShift)
+            {
+                _secondMaxShift = shift;
+            }
+        }
+        _isInitialized = true;
+    }
+
+    algorithmFPType * upper() { return _upper.get(); }
+    algorithmFPType * lower() { return _lower.get(); }
+    int * assignments() { return _assignments.get(); }
+    const algorithmFPType * halfMinDistances() const { return _halfMinDist.get(); }
+    const algorithmFPType * shifts() const { return _shifts.get(); }
+
+    /* Largest shift of the centroids other than the given one */
+    algorithmFPType maxOtherShift(size_t i) const { return (i == _maxShiftIdx) ? _secondMaxShift : _maxShift; }
+
+private:
+    size_t _nClusters;
+    size_t _p;
+    TArrayScalable<algorithmFPType, cpu> _upper;
+    TArrayScalable<algorithmFPType, cpu> _lower;
+    TArrayScalable<int, cpu> _assignments;
+    TArray<algorithmFPType, cpu> _halfMinDist;
+    TArray<algorithmFPType, cpu> _shifts;
+    TArray<algorithmFPType, cpu> _centroids;
+    algorithmFPType _maxShift;
+    algorithmFPType _secondMaxShift;
+    size_t _maxShiftIdx;
+    bool _isInitialized;
+};
+
 template <typename algorithmFPType, CpuType cpu>
 struct TaskKMeansLloyd
 {
@@ -112,6 +234,17 @@ struct TaskKMeansLloyd
     Status addNTToTaskThreaded(const NumericTable * const ntData, const algorithmFPType * const catCoef, const size_t blockSizeDefault,
                                NumericTable * ntAssign = nullptr);
 
+    Status addNTToTaskThreadedDenseBounded(const NumericTable * const ntData, const size_t blockSizeDefault,
+                                           KMeansBounds<algorithmFPType, cpu> & bounds, NumericTable * ntAssign = nullptr);
+
+    void kmeansFindNearestDense(const algorithmFPType * const data, const size_t blockSize, TlsTask<algorithmFPType, cpu> * tt,
+                                const bool findSecond);
+
+    void kmeansResetNearest(TlsTask<algorithmFPType, cpu> * tt, const size_t blockSize, const bool findSecond);
+
+    void kmeansMergeTile(TlsTask<algorithmFPType, cpu> * tt, const algorithmFPType * const x_clusters, const size_t blockSize, const size_t jStart,
+                         const size_t nTile, const bool findSecond);
+
     template <typename centroidsFPType>
     int kmeansUpdateCluster(int jidx, centroidsFPType * s1);
 
@@ -130,8 +263,6 @@ struct TaskKMeansLloyd
 
     int dim;
     int clNum;
-
-    typedef typename Fp2IntSize<algorithmFPType>::IntT algIntType;
 };
 
 template <typename algorithmFPType, CpuType cpu>
@@ -153,13 +284,9 @@ Status TaskKMeansLloyd<algorithmFPType, cpu>::addNTToTaskThreadedDense(const Num
         DAAL_CHECK_BLOCK_STATUS_THR(mtData);
         const algorithmFPType * const data = mtData.get();
 
-        const size_t p                           = dim;
-        const size_t nClusters                   = clNum;
-        const algorithmFPType * const inClusters = cCenters;
-        const algorithmFPType * const clustersSq = clSq;
+        const size_t p = dim;
 
-        algorithmFPType * trg        = &(tt->goalFunc);
-        algorithmFPType * x_clusters = tt->mklBuff;
+        algorithmFPType * trg = &(tt->goalFunc);
 
         int * cS0             = tt->cS0;
         algorithmFPType * cS1 = tt->cS1;
@@ -172,56 +299,13 @@ Status TaskKMeansLloyd<algorithmFPType, cpu>::addNTToTaskThreadedDense(const Num
             assignments = assignBlock.get();
         }
 
-        const char transa           = 't';
-        const char transb           = 'n';
-        const DAAL_INT _m           = blockSize;
-        const DAAL_INT _n           = nClusters;
-        const DAAL_INT _k           = p;
-        const algorithmFPType alpha = -1.0;
-        const DAAL_INT lda          = p;
-        const DAAL_INT ldy          = p;
-        const algorithmFPType beta  = 1.0;
-        const DAAL_INT ldaty        = blockSize;
-
-        for (size_t j = 0; j < nClusters; j++)
-        {
-            PRAGMA_IVDEP
-            PRAGMA_VECTOR_ALWAYS
-            for (size_t i = 0; i < blockSize; i++)
-            {
-                x_clusters[i + j * blockSize] = clustersSq[j];
-            }
-        }
-
-        Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &_m, &_n, &_k, &alpha, data, &lda, inClusters, &ldy, &beta, x_clusters, &ldaty);
-
-        PRAGMA_ICC_OMP(simd simdlen(16))
-        for (algIntType i = 0; i < (algIntType)blockSize; i++)
-        {
-            algorithmFPType minGoalVal = x_clusters[i];
-            algIntType minIdx          = 0;
-
-            for (algIntType j = 0; j < (algIntType)nClusters; j++)
-            {
-                algorithmFPType localGoalVal = x_clusters[i + j * blockSize];
-                if (localGoalVal < minGoalVal)
-                {
-                    minGoalVal = localGoalVal;
-                    minIdx     = j;
-                }
-            }
-
-            minGoalVal *= 2.0;
-
-            *((algIntType *)&(x_clusters[i])) = minIdx;
-            x_clusters[i + blockSize]         = minGoalVal;
-        }
+        kmeansFindNearestDense(data, blockSize, tt, false);
 
         algorithmFPType goal = algorithmFPType(0);
         for (size_t i = 0; i < blockSize; i++)
         {
-            const size_t minIdx        = *((algIntType *)&(x_clusters[i]));
-            algorithmFPType minGoalVal = x_clusters[i + blockSize];
+            const size_t minIdx        = tt->minIdx[i];
+            algorithmFPType minGoalVal = tt->minVal[i] * 2.0;
 
             PRAGMA_IVDEP
             for (size_t j = 0; j < p; j++)
@@ -291,31 +375,40 @@ Status TaskKMeansLloyd<algorithmFPType, cpu>::addNTToTaskThreadedCSR(const Numer
             assignments = assignBlock.get();
         }
 
+        const size_t tileSize       = (nClusters < kmeansClusterTileSize) ? nClusters : kmeansClusterTileSize;
         const char transa           = 'n';
         const DAAL_INT _n           = blockSize;
         const DAAL_INT _p           = p;
-        const DAAL_INT _c           = nClusters;
         const algorithmFPType alpha = 1.0;
         const algorithmFPType beta  = 0.0;
         const char matdescra[6]     = { 'G', 0, 0, 'F', 0, 0 };
 
-        SpBlas<algorithmFPType, cpu>::xxcsrmm(&transa, &_n, &_c, &_p, &alpha, matdescra, data, (DAAL_INT *)colIdx, (DAAL_INT *)rowIdx, inClusters,
-                                              &_p, &beta, x_clusters, &_n);
-
-        size_t csrCursor = 0;
-        for (size_t i = 0; i < blockSize; i++)
+        kmeansResetNearest(tt, blockSize, false);
+        for (size_t jStart = 0; jStart < nClusters; jStart += tileSize)
         {
-            algorithmFPType minGoalVal = clustersSq[0] - x_clusters[i];
-            size_t minIdx              = 0;
+            const size_t nTile = (jStart + tileSize > nClusters) ? nClusters - jStart : tileSize;
+            const DAAL_INT _c  = nTile;
 
-            for (size_t j = 0; j < nClusters; j++)
+            SpBlas<algorithmFPType, cpu>::xxcsrmm(&transa, &_n, &_c, &_p, &alpha, matdescra, data, (DAAL_INT *)colIdx, (DAAL_INT *)rowIdx,
+                                                  inClusters + jStart * p, &_p, &beta, x_clusters, &_n);
+
+            for (size_t j = 0; j < nTile; j++)
             {
-                if (minGoalVal > clustersSq[j] - x_clusters[i + j * blockSize])
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < blockSize; i++)
                 {
-                    minGoalVal = clustersSq[j] - x_clusters[i + j * blockSize];
-                    minIdx     = j;
+                    x_clusters[i + j * blockSize] = clustersSq[jStart + j] - x_clusters[i + j * blockSize];
                 }
             }
+            kmeansMergeTile(tt, x_clusters, blockSize, jStart, nTile, false);
+        }
+
+        size_t csrCursor = 0;
+        for (size_t i = 0; i < blockSize; i++)
+        {
+            algorithmFPType minGoalVal = tt->minVal[i];
+            const size_t minIdx        = tt->minIdx[i];
 
             minGoalVal *= 2.0;
 
@@ -343,6 +436,277 @@ Status TaskKMeansLloyd<algorithmFPType, cpu>::addNTToTaskThreadedCSR(const Numer
     return safeStat.detach();
 }
 
+template <typename algorithmFPType, CpuType cpu>
+void TaskKMeansLloyd<algorithmFPType, cpu>::kmeansResetNearest(TlsTask<algorithmFPType, cpu> * tt, const size_t blockSize, const bool findSecond)
+{
+    const algorithmFPType maxVal = MaxVal<algorithmFPType>::get();
+    for (size_t i = 0; i < blockSize; i++)
+    {
+        tt->minIdx[i] = 0;
+        tt->minVal[i] = maxVal;
+    }
+    if (findSecond)
+    {
+        service_memset_seq<algorithmFPType, cpu>(tt->secondVal, maxVal, blockSize);
+    }
+}
+
+/**
+ *  Updates the nearest centroids of the rows, and optionally the values for the second nearest ones,
+ *  with a tile of nTile centroids starting from jStart. x_clusters holds the values of ||c||^2 / 2 - <x, c> for the tile.
+ *  The update is branch-free, so the loop over the rows is vectorized with the masked blends
+ */
+template <typename algorithmFPType, CpuType cpu>
+void TaskKMeansLloyd<algorithmFPType, cpu>::kmeansMergeTile(TlsTask<algorithmFPType, cpu> * tt, const algorithmFPType * const x_clusters,
+                                                            const size_t blockSize, const size_t jStart, const size_t nTile, const bool findSecond)
+{
+    int * const minIdx                = tt->minIdx;
+    algorithmFPType * const minVal    = tt->minVal;
+    algorithmFPType * const secondVal = tt->secondVal;
+
+    for (size_t j = 0; j < nTile; j++)
+    {
+        const algorithmFPType * const values = x_clusters + j * blockSize;
+        const int idx                        = (int)(jStart + j);
+        if (findSecond)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < blockSize; i++)
+            {
+                const algorithmFPType value = values[i];
+                const bool isMin            = value < minVal[i];
+                const algorithmFPType other = (value < secondVal[i]) ? value : secondVal[i];
+                secondVal[i]                = isMin ? minVal[i] : other;
+                minIdx[i]                   = isMin ? idx : minIdx[i];
+                minVal[i]                   = isMin ? value : minVal[i];
+            }
+        }
+        else
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < blockSize; i++)
+            {
+                const algorithmFPType value = values[i];
+                const bool isMin            = value < minVal[i];
+                minIdx[i]                   = isMin ? idx : minIdx[i];
+                minVal[i]                   = isMin ? value : minVal[i];
+            }
+        }
+    }
+}
+
+/**
+ *  Finds the nearest centroids for the rows of a dense block, and optionally the values for the second nearest ones.
+ *  The values ||c||^2 / 2 - <x, c> are computed by tiles of kmeansClusterTileSize centroids and merged into the running minimums,
+ *  so the full block by nClusters distance matrix is never stored
+ */
+template <typename algorithmFPType, CpuType cpu>
+void TaskKMeansLloyd<algorithmFPType, cpu>::kmeansFindNearestDense(const algorithmFPType * const data, const size_t blockSize,
+                                                                   TlsTask<algorithmFPType, cpu> * tt, const bool findSecond)
+{
+    const size_t p                           = dim;
+    const size_t nClusters                   = clNum;
+    const algorithmFPType * const inClusters = cCenters;
+    const algorithmFPType * const clustersSq = clSq;
+    const size_t tileSize                    = (nClusters < kmeansClusterTileSize) ? nClusters : kmeansClusterTileSize;
+
+    algorithmFPType * x_clusters = tt->mklBuff;
+
+    const char transa           = 't';
+    const char transb           = 'n';
+    const DAAL_INT _m           = blockSize;
+    const DAAL_INT _k           = p;
+    const algorithmFPType alpha = -1.0;
+    const DAAL_INT lda          = p;
+    const DAAL_INT ldy          = p;
+    const algorithmFPType beta  = 1.0;
+    const DAAL_INT ldaty        = blockSize;
+
+    kmeansResetNearest(tt, blockSize, findSecond);
+    for (size_t jStart = 0; jStart < nClusters; jStart += tileSize)
+    {
+        const size_t nTile = (jStart + tileSize > nClusters) ? nClusters - jStart : tileSize;
+        const DAAL_INT _n  = nTile;
+
+        for (size_t j = 0; j < nTile; j++)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < blockSize; i++)
+            {
+                x_clusters[i + j * blockSize] = clustersSq[jStart + j];
+            }
+        }
+
+        Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &_m, &_n, &_k, &alpha, data, &lda, inClusters + jStart * p, &ldy, &beta, x_clusters,
+                                           &ldaty);
+
+        kmeansMergeTile(tt, x_clusters, blockSize, jStart, nTile, findSecond);
+    }
+}
+
+/**
+ *  Assigns the rows of the dense table to the nearest centroids using the bounds on the distances.
+ *  The distance to the current centroid is computed for every row, the distances to all the centroids
+ *  only for the rows which can change the cluster. Such rows are gathered into a contiguous buffer.
+ */
+template <typename algorithmFPType, CpuType cpu>
+Status TaskKMeansLloyd<algorithmFPType, cpu>::addNTToTaskThreadedDenseBounded(const NumericTable * const ntData, const size_t blockSizeDefault,
+                                                                              KMeansBounds<algorithmFPType, cpu> & bounds, NumericTable * ntAssign)
+{
+    const size_t n = ntData->getNumberOfRows();
+
+    size_t nBlocks = n / blockSizeDefault;
+    nBlocks += (nBlocks * blockSizeDefault != n);
+
+    const bool isInitialized                  = bounds.isInitialized();
+    const algorithmFPType * const halfMinDist = bounds.halfMinDistances();
+    const algorithmFPType * const shifts      = bounds.shifts();
+    const algorithmFPType maxVal              = MaxVal<algorithmFPType>::get();
+
+    SafeStatus safeStat;
+    daal::static_threader_for(nBlocks, [=, &bounds, &safeStat](const int k, size_t tid) {
+        struct TlsTask<algorithmFPType, cpu> * tt = tls_task->local(tid);
+        DAAL_CHECK_MALLOC_THR(tt);
+        DAAL_CHECK_MALLOC_THR(tt->allocateBoundBuffers());
+        const size_t iStart    = k * blockSizeDefault;
+        const size_t blockSize = (k == nBlocks - 1) ? n - iStart : blockSizeDefault;
+
+        ReadRows<algorithmFPType, cpu> mtData(*const_cast<NumericTable *>(ntData), iStart, blockSize);
+        DAAL_CHECK_BLOCK_STATUS_THR(mtData);
+        const algorithmFPType * const data = mtData.get();
+
+        int * assignments = nullptr;
+        WriteOnlyRows<int, cpu> assignBlock(ntAssign, iStart, blockSize);
+        if (ntAssign)
+        {
+            DAAL_CHECK_BLOCK_STATUS_THR(assignBlock);
+            assignments = assignBlock.get();
+        }
+
+        const size_t p                           = dim;
+        const algorithmFPType * const inClusters = cCenters;
+
+        algorithmFPType * const upper = bounds.upper() + iStart;
+        algorithmFPType * const lower = bounds.lower() + iStart;
+        int * const assign            = bounds.assignments() + iStart;
+        algorithmFPType * const dist2 = tt->distSq;
+        int * const rowIndices        = tt->rowIndices;
+
+        size_t nSearch = blockSize;
+        if (isInitialized)
+        {
+            nSearch = 0;
+            for (size_t i = 0; i < blockSize; i++)
+            {
+                const size_t a                   = assign[i];
+                const algorithmFPType * const x  = data + i * p;
+                const algorithmFPType * const ca = inClusters + a * p;
+
+                algorithmFPType d2 = algorithmFPType(0);
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < p; j++)
+                {
+                    d2 += (x[j] - ca[j]) * (x[j] - ca[j]);
+                }
+                dist2[i] = d2;
+                upper[i] = Math<algorithmFPType, cpu>::sSqrt(d2);
+                if (lower[i] < maxVal)
+                {
+                    lower[i] -= bounds.maxOtherShift(a);
+                }
+
+                const algorithmFPType bound = (halfMinDist[a] > lower[i]) ? halfMinDist[a] : lower[i];
+                if (upper[i] > bound)
+                {
+                    rowIndices[nSearch++] = i;
+                }
+            }
+        }
+
+        if (nSearch)
+        {
+            const bool isGathered                    = nSearch < blockSize;
+            const algorithmFPType * const searchData = isGathered ? tt->rowsBuff : data;
+            if (isGathered)
+            {
+                for (size_t r = 0; r < nSearch; r++)
+                {
+                    const algorithmFPType * const x = data + rowIndices[r] * p;
+                    algorithmFPType * const y       = tt->rowsBuff + r * p;
+                    PRAGMA_IVDEP
+                    PRAGMA_VECTOR_ALWAYS
+                    for (size_t j = 0; j < p; j++)
+                    {
+                        y[j] = x[j];
+                    }
+                }
+            }
+
+            kmeansFindNearestDense(searchData, nSearch, tt, true);
+
+            for (size_t r = 0; r < nSearch; r++)
+            {
+                const size_t i                  = isGathered ? rowIndices[r] : r;
+                const algorithmFPType * const x = searchData + r * p;
+
+                algorithmFPType xSq = algorithmFPType(0);
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < p; j++)
+                {
+                    xSq += x[j] * x[j];
+                }
+
+                algorithmFPType d2 = tt->minVal[r] * 2.0 + xSq;
+                d2                 = (d2 > algorithmFPType(0)) ? d2 : algorithmFPType(0);
+                assign[i]          = tt->minIdx[r];
+                dist2[i]           = d2;
+                upper[i]           = Math<algorithmFPType, cpu>::sSqrt(d2);
+                if (tt->secondVal[r] < maxVal)
+                {
+                    const algorithmFPType s2 = tt->secondVal[r] * 2.0 + xSq;
+                    lower[i]                 = Math<algorithmFPType, cpu>::sSqrt((s2 > algorithmFPType(0)) ? s2 : algorithmFPType(0));
+                }
+                else
+                {
+                    lower[i] = maxVal;
+                }
+            }
+        }
+
+        int * cS0             = tt->cS0;
+        algorithmFPType * cS1 = tt->cS1;
+        algorithmFPType goal  = algorithmFPType(0);
+        for (size_t i = 0; i < blockSize; i++)
+        {
+            const size_t minIdx = assign[i];
+
+            PRAGMA_IVDEP
+            for (size_t j = 0; j < p; j++)
+            {
+                cS1[minIdx * p + j] += data[i * p + j];
+            }
+
+            kmeansInsertCandidate(tt, dist2[i], iStart + i);
+            cS0[minIdx]++;
+
+            goal += dist2[i];
+
+            if (ntAssign)
+            {
+                assignments[i] = (int)minIdx;
+            }
+        }
+
+        tt->goalFunc += goal;
+    });
+    return safeStat.detach();
+}
+
 template <typename algorithmFPType, CpuType cpu>
 template <Method method>
 Status TaskKMeansLloyd<algorithmFPType, cpu>::addNTToTaskThreaded(const NumericTable * const ntData, const algorithmFPType * const catCoef,
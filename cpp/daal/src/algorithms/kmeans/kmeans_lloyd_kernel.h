@@ -46,6 +46,21 @@ public:
     services::Status compute(const NumericTable * const * a, const NumericTable * const * r, const Parameter * par);
 };
 
+template <typename algorithmFPType, CpuType cpu>
+class KMeansBatchKernel<miniBatchDense, algorithmFPType, cpu> : public Kernel
+{
+public:
+    services::Status compute(const NumericTable * const * a, const NumericTable * const * r, const Parameter * par);
+};
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+class KMeansOnlineKernel : public Kernel
+{
+public:
+    services::Status compute(size_t na, const NumericTable * const * a, size_t nr, const NumericTable * const * r, const Parameter * par);
+    services::Status finalizeCompute(size_t na, const NumericTable * const * a, size_t nr, const NumericTable * const * r, const Parameter * par);
+};
+
 template <Method method, typename algorithmFPType, CpuType cpu>
 class KMeansDistributedStep1Kernel : public Kernel
 {
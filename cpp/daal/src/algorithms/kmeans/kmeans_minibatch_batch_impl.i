@@ -0,0 +1,226 @@
+/* file: kmeans_minibatch_batch_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of mini-batch method for K-means algorithm.
+//--
+*/
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "src/threading/threading.h"
+#include "services/daal_defines.h"
+#include "src/externals/service_memory.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/services/service_defines.h"
+#include "src/algorithms/distributions/uniform/uniform_kernel.h"
+#include "src/algorithms/distributions/uniform/uniform_impl.i"
+
+#include "src/algorithms/kmeans/kmeans_minibatch_impl.i"
+#include "src/algorithms/kmeans/kmeans_lloyd_postprocessing.h"
+
+#include "src/externals/service_ittnotify.h"
+
+DAAL_ITTNOTIFY_DOMAIN(kmeans.dense.minibatch.batch);
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace internal
+{
+using namespace daal::algorithms::distributions::uniform::internal;
+
+/* Copies the rows with the given indices into the contiguous buffer of the mini-batch */
+template <typename algorithmFPType, CpuType cpu>
+Status gatherRows(NumericTable * ntData, const int * indices, size_t nRows, size_t p, algorithmFPType * batch)
+{
+    const size_t blockSize = 256;
+    const size_t nBlocks   = nRows / blockSize + !!(nRows % blockSize);
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t iStart = iBlock * blockSize;
+        const size_t iEnd   = (iStart + blockSize > nRows) ? nRows : iStart + blockSize;
+
+        ReadRows<algorithmFPType, cpu> mtRow;
+        for (size_t i = iStart; i < iEnd; i++)
+        {
+            const algorithmFPType * const row = mtRow.set(ntData, indices[i], 1);
+            DAAL_CHECK_BLOCK_STATUS_THR(mtRow);
+
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < p; j++)
+            {
+                batch[i * p + j] = row[j];
+            }
+        }
+    });
+    return safeStat.detach();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status KMeansBatchKernel<miniBatchDense, algorithmFPType, cpu>::compute(const NumericTable * const * a, const NumericTable * const * r,
+                                                                          const Parameter * parameter)
+{
+    Status s;
+    const MiniBatchParameter * par = static_cast<const MiniBatchParameter *>(parameter);
+    NumericTable * ntData          = const_cast<NumericTable *>(a[0]);
+    const size_t nIter     = par->maxIterations;
+    const size_t n         = ntData->getNumberOfRows();
+    const size_t p         = ntData->getNumberOfColumns();
+    const size_t nClusters = par->nClusters;
+    const size_t batchSize = (par->batchSize < n) ? par->batchSize : n;
+
+    DAAL_CHECK(a[1], services::ErrorNullInputNumericTable);
+    DAAL_CHECK(n <= services::internal::MaxVal<int>::get(), services::ErrorIncorrectNumberOfRowsInInputNumericTable);
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nClusters, p);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nClusters * p, sizeof(algorithmFPType));
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, batchSize, p);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, batchSize * p, sizeof(algorithmFPType));
+
+    TArray<algorithmFPType, cpu> catCoef;
+    DAAL_CHECK_STATUS(s, (getCategoricalCoefficients<algorithmFPType, cpu>(ntData, par, catCoef)));
+
+    ReadRows<algorithmFPType, cpu> mtInClusters(*const_cast<NumericTable *>(a[1]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtInClusters);
+    const algorithmFPType * const inClusters = mtInClusters.get();
+
+    WriteOnlyRows<algorithmFPType, cpu> mtClusters(const_cast<NumericTable *>(r[0]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtClusters);
+    algorithmFPType * clusters = mtClusters.get();
+
+    TArray<algorithmFPType, cpu> tClusters;
+    if (clusters == nullptr)
+    {
+        tClusters.reset(nClusters * p);
+        DAAL_CHECK_MALLOC(tClusters.get());
+        clusters = tClusters.get();
+    }
+
+    /* Warm start: every cluster starts from the input centroid taken with the weight of one observation */
+    TArray<algorithmFPType, cpu> counts(nClusters);
+    TArray<algorithmFPType, cpu> sums(nClusters * p);
+    DAAL_CHECK_MALLOC(counts.get() && sums.get());
+    for (size_t i = 0; i < nClusters; i++)
+    {
+        counts[i] = algorithmFPType(1);
+    }
+    int result = daal::services::internal::daal_memcpy_s(clusters, nClusters * p * sizeof(algorithmFPType), inClusters,
+                                                         nClusters * p * sizeof(algorithmFPType));
+    result |= daal::services::internal::daal_memcpy_s(sums.get(), nClusters * p * sizeof(algorithmFPType), inClusters,
+                                                      nClusters * p * sizeof(algorithmFPType));
+    DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+
+    TArray<int, cpu> indices(nIter ? batchSize : 0);
+    TArray<algorithmFPType, cpu> batch(nIter ? batchSize * p : 0);
+    MiniBatchTask<algorithmFPType, cpu> miniBatchTask(nClusters, p);
+    DAAL_CHECK_MALLOC(!nIter || (indices.get() && batch.get() && miniBatchTask.isValid()));
+
+    NumericTablePtr batchPtr;
+    if (nIter)
+    {
+        batchPtr = HomogenNumericTableCPU<algorithmFPType, cpu>::create(batch.get(), p, batchSize, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+    }
+
+    size_t blockSize = 0;
+    DAAL_SAFE_CPU_CALL((blockSize = BSHelper<lloydDense, algorithmFPType, cpu>::kmeansGetBlockSize(batchSize, p, nClusters)), (blockSize = 512))
+
+    engines::BatchBase & engine = *par->engine;
+    algorithmFPType batchTargetFunc(0.0);
+
+    size_t kIter;
+    for (kIter = 0; kIter < nIter; kIter++)
+    {
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(sampleMiniBatch);
+            DAAL_CHECK_STATUS(s, (UniformKernelDefault<int, cpu>::compute(0, (int)n, engine, batchSize, indices.get())));
+            DAAL_CHECK_STATUS(s, (gatherRows<algorithmFPType, cpu>(ntData, indices.get(), batchSize, p, batch.get())));
+        }
+
+        algorithmFPType shift = algorithmFPType(0);
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(updateCentroids);
+            DAAL_CHECK_STATUS(s, miniBatchTask.update(batchPtr.get(), catCoef.get(), blockSize, clusters, counts.get(), sums.get(), batchTargetFunc,
+                                                      shift));
+        }
+
+        if (par->accuracyThreshold > (algorithmFPType)0.0 && shift < par->accuracyThreshold)
+        {
+            kIter++;
+            break;
+        }
+    }
+
+    NumericTable * assignmetsNT = nullptr;
+    NumericTablePtr assignmentsPtr;
+    if (r[1])
+    {
+        assignmetsNT = const_cast<NumericTable *>(r[1]);
+    }
+    else if (par->resultsToEvaluate & computeExactObjectiveFunction)
+    {
+        assignmentsPtr = HomogenNumericTableCPU<int, cpu>::create(1, n, &s);
+        DAAL_CHECK_MALLOC(s);
+        assignmetsNT = assignmentsPtr.get();
+    }
+
+    size_t dataBlockSize = 0;
+    DAAL_SAFE_CPU_CALL((dataBlockSize = BSHelper<lloydDense, algorithmFPType, cpu>::kmeansGetBlockSize(n, p, nClusters)), (dataBlockSize = 512))
+
+    if (par->resultsToEvaluate & computeAssignments || par->assignFlag || par->resultsToEvaluate & computeExactObjectiveFunction)
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(computeAssignments);
+        DAAL_CHECK_STATUS(s, (PostProcessing<lloydDense, algorithmFPType, cpu>::computeAssignments(p, nClusters, clusters, ntData, catCoef.get(),
+                                                                                                    assignmetsNT, dataBlockSize)));
+    }
+
+    WriteOnlyRows<algorithmFPType, cpu> mtTarget(*const_cast<NumericTable *>(r[2]), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtTarget);
+    if (par->resultsToEvaluate & computeExactObjectiveFunction)
+    {
+        algorithmFPType exactTargetFunc = algorithmFPType(0);
+        DAAL_CHECK_STATUS(s, (PostProcessing<lloydDense, algorithmFPType, cpu>::computeExactObjectiveFunction(
+                                 p, nClusters, clusters, ntData, catCoef.get(), assignmetsNT, exactTargetFunc, dataBlockSize)));
+
+        *mtTarget.get() = exactTargetFunc;
+    }
+    else
+    {
+        /* Objective function of the last mini-batch */
+        *mtTarget.get() = batchTargetFunc;
+    }
+
+    WriteOnlyRows<int, cpu> mtIterations(*const_cast<NumericTable *>(r[3]), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtIterations);
+    *mtIterations.get() = kIter;
+    return s;
+}
+
+} // namespace internal
+} // namespace kmeans
+} // namespace algorithms
+} // namespace daal
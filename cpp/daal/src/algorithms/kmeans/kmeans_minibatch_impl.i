@@ -0,0 +1,149 @@
+/* file: kmeans_minibatch_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of auxiliary functions used in mini-batch method
+//  of K-means algorithm.
+//--
+*/
+
+#include "src/algorithms/kmeans/kmeans_lloyd_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace internal
+{
+/**
+ *  Update of the centroids from a mini-batch of observations.
+ *  Every cluster keeps the number of observations assigned to it so far (counts) and their sum (sums).
+ *  The observations of the batch are assigned to the nearest of the current centroids,
+ *  then each centroid becomes the mean of all the observations it received: this is the same as moving it
+ *  towards every new observation x with the per-centroid learning rate 1 / count, c = c + (x - c) / count.
+ *  Clusters that receive no observations keep their centroids.
+ */
+template <typename algorithmFPType, CpuType cpu>
+class MiniBatchTask
+{
+public:
+    MiniBatchTask(size_t nClusters, size_t p) : _nClusters(nClusters), _p(p), _clusterS0(nClusters), _clusterS1(nClusters * p), _dS1(p) {}
+
+    bool isValid() const { return _clusterS0.get() && _clusterS1.get() && _dS1.get(); }
+
+    /**
+     *  Processes a mini-batch
+     *  \param[in]     ntBatch     Observations of the mini-batch
+     *  \param[in]     catCoef     Weights of the categorical features, may be null
+     *  \param[in]     blockSize   Number of rows processed by one thread at a time
+     *  \param[in,out] centroids   Current centroids, nClusters x p
+     *  \param[in,out] counts      Number of observations assigned to the clusters so far
+     *  \param[in,out] sums        Sums of observations assigned to the clusters so far, nClusters x p
+     *  \param[out]    goalFunc    Objective function of the mini-batch with respect to the centroids before the update
+     *  \param[out]    shift       Sum of squared distances between the centroids before and after the update
+     */
+    Status update(const NumericTable * ntBatch, const algorithmFPType * catCoef, size_t blockSize, algorithmFPType * centroids,
+                  algorithmFPType * counts, algorithmFPType * sums, algorithmFPType & goalFunc, algorithmFPType & shift)
+    {
+        Status s;
+        {
+            auto task = TaskKMeansLloyd<algorithmFPType, cpu>::create(_p, _nClusters, centroids, blockSize);
+            DAAL_CHECK(task.get(), services::ErrorMemoryAllocationFailed);
+
+            s = task->template addNTToTaskThreaded<lloydDense>(ntBatch, catCoef, blockSize);
+            if (!s)
+            {
+                task->kmeansClearClusters(nullptr);
+                return s;
+            }
+
+            task->template kmeansComputeCentroids<lloydDense>(_clusterS0.get(), _clusterS1.get(), _dS1.get());
+            task->kmeansClearClusters(&goalFunc);
+        }
+
+        const int * const clusterS0             = _clusterS0.get();
+        const algorithmFPType * const clusterS1 = _clusterS1.get();
+
+        shift = algorithmFPType(0);
+        for (size_t i = 0; i < _nClusters; i++)
+        {
+            if (clusterS0[i] == 0)
+            {
+                continue;
+            }
+
+            counts[i] += clusterS0[i];
+            const algorithmFPType coeff = algorithmFPType(1.0) / counts[i];
+
+            algorithmFPType * const sum      = sums + i * _p;
+            algorithmFPType * const centroid = centroids + i * _p;
+            const algorithmFPType * const s1 = clusterS1 + i * _p;
+
+            algorithmFPType clusterShift = algorithmFPType(0);
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < _p; j++)
+            {
+                sum[j] += s1[j];
+                const algorithmFPType newValue = sum[j] * coeff;
+                const algorithmFPType diff     = newValue - centroid[j];
+                clusterShift += diff * diff;
+                centroid[j] = newValue;
+            }
+            shift += clusterShift;
+        }
+        return s;
+    }
+
+private:
+    size_t _nClusters;
+    size_t _p;
+    TArray<int, cpu> _clusterS0;
+    TArray<algorithmFPType, cpu> _clusterS1;
+    TArray<double, cpu> _dS1;
+};
+
+template <typename algorithmFPType, CpuType cpu>
+Status getCategoricalCoefficients(const NumericTable * ntData, const Parameter * par, TArray<algorithmFPType, cpu> & catCoef)
+{
+    const size_t p = ntData->getNumberOfColumns();
+    bool catFlag   = false;
+    for (size_t i = 0; i < p && !catFlag; i++)
+    {
+        catFlag = (ntData->getFeatureType(i) == features::DAAL_CATEGORICAL);
+    }
+    if (!catFlag)
+    {
+        return Status();
+    }
+
+    catCoef.reset(p);
+    DAAL_CHECK(catCoef.get(), services::ErrorMemoryAllocationFailed);
+    for (size_t i = 0; i < p; i++)
+    {
+        catCoef[i] = (ntData->getFeatureType(i) == features::DAAL_CATEGORICAL) ? par->gamma : (algorithmFPType)1.0;
+    }
+    return Status();
+}
+
+} // namespace internal
+} // namespace kmeans
+} // namespace algorithms
+} // namespace daal
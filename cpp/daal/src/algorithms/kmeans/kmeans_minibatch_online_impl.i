@@ -0,0 +1,173 @@
+/* file: kmeans_minibatch_online_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of mini-batch method for K-means algorithm
+//  in the online processing mode.
+//--
+*/
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "src/threading/threading.h"
+#include "services/daal_defines.h"
+#include "src/externals/service_memory.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/services/service_defines.h"
+
+#include "src/algorithms/kmeans/kmeans_minibatch_impl.i"
+
+#include "src/externals/service_ittnotify.h"
+
+DAAL_ITTNOTIFY_DOMAIN(kmeans.dense.minibatch.online);
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace internal
+{
+/**
+ *  Consumes a block of observations: the block is split into mini-batches of consecutive rows
+ *  and the centroids are updated after each of them.
+ *  a = { data }, r = { nObservations, partialSums, partialObjectiveFunction }
+ */
+template <Method method, typename algorithmFPType, CpuType cpu>
+Status KMeansOnlineKernel<method, algorithmFPType, cpu>::compute(size_t na, const NumericTable * const * a, size_t nr, const NumericTable * const * r,
+                                                                 const Parameter * parameter)
+{
+    Status s;
+    const MiniBatchParameter * par = static_cast<const MiniBatchParameter *>(parameter);
+    NumericTable * ntData          = const_cast<NumericTable *>(a[0]);
+    const size_t n         = ntData->getNumberOfRows();
+    const size_t p         = ntData->getNumberOfColumns();
+    const size_t nClusters = par->nClusters;
+    const size_t batchSize = (par->batchSize < n) ? par->batchSize : n;
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nClusters, p);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nClusters * p, sizeof(algorithmFPType));
+
+    TArray<algorithmFPType, cpu> catCoef;
+    DAAL_CHECK_STATUS(s, (getCategoricalCoefficients<algorithmFPType, cpu>(ntData, par, catCoef)));
+
+    WriteRows<algorithmFPType, cpu> mtCounts(const_cast<NumericTable *>(r[0]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtCounts);
+    algorithmFPType * const counts = mtCounts.get();
+
+    WriteRows<algorithmFPType, cpu> mtSums(const_cast<NumericTable *>(r[1]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtSums);
+    algorithmFPType * const sums = mtSums.get();
+
+    WriteRows<algorithmFPType, cpu> mtTarget(const_cast<NumericTable *>(r[2]), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtTarget);
+
+    TArray<algorithmFPType, cpu> centroids(nClusters * p);
+    MiniBatchTask<algorithmFPType, cpu> miniBatchTask(nClusters, p);
+    DAAL_CHECK_MALLOC(centroids.get() && miniBatchTask.isValid());
+
+    for (size_t i = 0; i < nClusters; i++)
+    {
+        const algorithmFPType coeff = algorithmFPType(1.0) / counts[i];
+        for (size_t j = 0; j < p; j++)
+        {
+            centroids[i * p + j] = sums[i * p + j] * coeff;
+        }
+    }
+
+    size_t blockSize = 0;
+    DAAL_SAFE_CPU_CALL((blockSize = BSHelper<lloydDense, algorithmFPType, cpu>::kmeansGetBlockSize(batchSize, p, nClusters)), (blockSize = 512))
+
+    algorithmFPType targetFunc = algorithmFPType(0);
+    for (size_t iStart = 0; iStart < n; iStart += batchSize)
+    {
+        const size_t nRows = (iStart + batchSize > n) ? n - iStart : batchSize;
+
+        ReadRows<algorithmFPType, cpu> mtBatch(ntData, iStart, nRows);
+        DAAL_CHECK_BLOCK_STATUS(mtBatch);
+        NumericTablePtr batchPtr = HomogenNumericTableCPU<algorithmFPType, cpu>::create(const_cast<algorithmFPType *>(mtBatch.get()), p, nRows, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+
+        algorithmFPType batchTargetFunc = algorithmFPType(0);
+        algorithmFPType shift           = algorithmFPType(0);
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(updateCentroids);
+            DAAL_CHECK_STATUS(s,
+                              miniBatchTask.update(batchPtr.get(), catCoef.get(), blockSize, centroids.get(), counts, sums, batchTargetFunc, shift));
+        }
+        targetFunc += batchTargetFunc;
+    }
+
+    *mtTarget.get() += targetFunc;
+    return s;
+}
+
+/**
+ *  Computes the centroids from the accumulated sums of observations.
+ *  a = { nObservations, partialSums, partialObjectiveFunction }, r = { centroids, objectiveFunction, nIterations }
+ */
+template <Method method, typename algorithmFPType, CpuType cpu>
+Status KMeansOnlineKernel<method, algorithmFPType, cpu>::finalizeCompute(size_t na, const NumericTable * const * a, size_t nr,
+                                                                         const NumericTable * const * r, const Parameter * par)
+{
+    const size_t nClusters = par->nClusters;
+    const size_t p         = a[1]->getNumberOfColumns();
+
+    ReadRows<algorithmFPType, cpu> mtCounts(*const_cast<NumericTable *>(a[0]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtCounts);
+    const algorithmFPType * const counts = mtCounts.get();
+
+    ReadRows<algorithmFPType, cpu> mtSums(*const_cast<NumericTable *>(a[1]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtSums);
+    const algorithmFPType * const sums = mtSums.get();
+
+    ReadRows<algorithmFPType, cpu> mtPartialTarget(*const_cast<NumericTable *>(a[2]), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtPartialTarget);
+
+    WriteOnlyRows<algorithmFPType, cpu> mtClusters(const_cast<NumericTable *>(r[0]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtClusters);
+    algorithmFPType * const clusters = mtClusters.get();
+
+    for (size_t i = 0; i < nClusters; i++)
+    {
+        const algorithmFPType coeff = algorithmFPType(1.0) / counts[i];
+        for (size_t j = 0; j < p; j++)
+        {
+            clusters[i * p + j] = sums[i * p + j] * coeff;
+        }
+    }
+
+    WriteOnlyRows<algorithmFPType, cpu> mtTarget(*const_cast<NumericTable *>(r[1]), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtTarget);
+    *mtTarget.get() = *mtPartialTarget.get();
+
+    /* Number of iterations is not tracked in the online processing mode */
+    WriteOnlyRows<int, cpu> mtIterations(*const_cast<NumericTable *>(r[2]), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtIterations);
+    *mtIterations.get() = 0;
+    return Status();
+}
+
+} // namespace internal
+} // namespace kmeans
+} // namespace algorithms
+} // namespace daal
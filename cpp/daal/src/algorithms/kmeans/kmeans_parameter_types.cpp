@@ -73,6 +73,30 @@ services::Status Parameter::check() const
     return services::Status();
 }
 
+/**
+ *  Constructs parameters of the K-Means algorithm with the miniBatchDense method
+ *  \param[in] _nClusters   Number of clusters
+ *  \param[in] _maxIterations Number of iterations
+ */
+MiniBatchParameter::MiniBatchParameter(size_t _nClusters, size_t _maxIterations)
+    : Parameter(_nClusters, _maxIterations), batchSize(1024), engine(engines::mt19937::Batch<>::create())
+{}
+
+/**
+ *  Constructs parameters of the K-Means algorithm with the miniBatchDense method by copying another parameters
+ *  \param[in] other    Parameters of the K-Means algorithm with the miniBatchDense method
+ */
+MiniBatchParameter::MiniBatchParameter(const MiniBatchParameter & other) : Parameter(other), batchSize(other.batchSize), engine(other.engine) {}
+
+services::Status MiniBatchParameter::check() const
+{
+    services::Status s = Parameter::check();
+    if (!s) return s;
+    DAAL_CHECK_EX(batchSize > 0, ErrorIncorrectParameter, ParameterName, batchSizeStr());
+    DAAL_CHECK_EX(engine, ErrorIncorrectEngineParameter, ParameterName, engineStr());
+    return s;
+}
+
 } // namespace interface2
 } // namespace kmeans
 } // namespace algorithms
@@ -66,6 +66,11 @@ DAAL_EXPORT services::Status PartialResult::allocate(const daal::algorithms::Inp
 
     const Input * step1Input = dynamic_cast<const Input *>(input);
 
+    if (method == miniBatchDense)
+    {
+        return status;
+    }
+
     if (kmPar2)
     {
         if ((kmPar2->resultsToEvaluate & computeAssignments || kmPar2->assignFlag) && step1Input)
@@ -86,6 +91,49 @@ DAAL_EXPORT services::Status PartialResult::allocate(const daal::algorithms::Inp
     return status;
 }
 
+/**
+ * Initializes partial results of the K-Means algorithm in the online processing mode.
+ * Every cluster starts from the input centroid taken with the weight of one observation
+ * \param[in] input        Pointer to the structure of the input objects
+ * \param[in] parameter    Pointer to the structure of the algorithm parameters
+ * \param[in] method       Computation method of the algorithm
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::initialize(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter,
+                                                       const int method)
+{
+    const Input * algInput = static_cast<const Input *>(input);
+    const size_t nClusters = static_cast<const interface2::Parameter *>(parameter)->nClusters;
+
+    NumericTablePtr inCentroids = algInput->get(inputCentroids);
+    DAAL_CHECK(inCentroids, services::ErrorNullInputNumericTable);
+    const size_t nFeatures = inCentroids->getNumberOfColumns();
+
+    services::Status status;
+    {
+        BlockDescriptor<algorithmFPType> inBlock;
+        BlockDescriptor<algorithmFPType> sumsBlock;
+        DAAL_CHECK_STATUS(status, inCentroids->getBlockOfRows(0, nClusters, readOnly, inBlock));
+        status = get(partialSums)->getBlockOfRows(0, nClusters, writeOnly, sumsBlock);
+        if (status)
+        {
+            const algorithmFPType * const src = inBlock.getBlockPtr();
+            algorithmFPType * const dst       = sumsBlock.getBlockPtr();
+            for (size_t i = 0; i < nClusters * nFeatures; i++)
+            {
+                dst[i] = src[i];
+            }
+            status |= get(partialSums)->releaseBlockOfRows(sumsBlock);
+        }
+        status |= inCentroids->releaseBlockOfRows(inBlock);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    DAAL_CHECK_STATUS(status, get(nObservations)->assign((algorithmFPType)1.0));
+    DAAL_CHECK_STATUS(status, get(partialObjectiveFunction)->assign((algorithmFPType)0.0));
+    return status;
+}
+
 } // namespace kmeans
 } // namespace algorithms
 } // namespace daal
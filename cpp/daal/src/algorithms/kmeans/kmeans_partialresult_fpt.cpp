@@ -31,6 +31,8 @@ namespace kmeans
 {
 template DAAL_EXPORT services::Status PartialResult::allocate<DAAL_FPTYPE>(const daal::algorithms::Input * input,
                                                                            const daal::algorithms::Parameter * parameter, const int method);
+template DAAL_EXPORT services::Status PartialResult::initialize<DAAL_FPTYPE>(const daal::algorithms::Input * input,
+                                                                             const daal::algorithms::Parameter * parameter, const int method);
 
 } // namespace kmeans
 } // namespace algorithms
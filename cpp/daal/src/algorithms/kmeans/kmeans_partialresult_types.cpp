@@ -97,6 +97,11 @@ services::Status PartialResult::check(const daal::algorithms::Input * input, con
                       checkNumericTable(get(partialCandidatesDistances).get(), partialCandidatesDistancesStr(), unexpectedLayouts, 0, 1, nClusters));
     DAAL_CHECK_STATUS(
         s, checkNumericTable(get(partialCandidatesCentroids).get(), partialCandidatesCentroidsStr(), unexpectedLayouts, 0, inputFeatures, nClusters));
+    if (method == miniBatchDense)
+    {
+        /* Assignments are not accumulated in the online processing mode */
+        return s;
+    }
     if (kmPar2)
     {
         if (kmPar2->resultsToEvaluate & computeAssignments || kmPar2->assignFlag)
@@ -45,13 +45,14 @@ BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Env
     auto & context    = services::internal::getDefaultContext();
     auto & deviceInfo = context.getInfoDevice();
 
-    if (deviceInfo.isCpu)
+    /* Sparse data is processed on CPU only */
+    if (deviceInfo.isCpu || method == fastCSR)
     {
         __DAAL_INITIALIZE_KERNELS(internal::PredictKernel, algorithmFPType, method);
     }
     else
     {
-        __DAAL_INITIALIZE_KERNELS_SYCL(internal::PredictBatchKernelOneAPI, algorithmFPType, method);
+        __DAAL_INITIALIZE_KERNELS_SYCL(internal::PredictBatchKernelOneAPI, algorithmFPType, defaultDense);
     }
 }
 
@@ -82,14 +83,15 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     auto & context    = services::internal::getDefaultContext();
     auto & deviceInfo = context.getInfoDevice();
 
-    if (deviceInfo.isCpu)
+    /* Sparse data is processed on CPU only */
+    if (deviceInfo.isCpu || method == fastCSR)
     {
         __DAAL_CALL_KERNEL(env, internal::PredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
                            daal::services::internal::hostApp(*input), a, m, par->nClasses, r, prob, logProb);
     }
     else
     {
-        __DAAL_CALL_KERNEL_SYCL(env, internal::PredictBatchKernelOneAPI, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
+        __DAAL_CALL_KERNEL_SYCL(env, internal::PredictBatchKernelOneAPI, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, defaultDense), compute,
                                 daal::services::internal::hostApp(*input), a, m, par->nClasses, r, prob, logProb);
     }
 }
@@ -40,6 +40,11 @@
 #include "src/externals/service_blas.h"
 #include "src/algorithms/objective_function/cross_entropy_loss/cross_entropy_loss_dense_default_batch_kernel.h"
 #include "src/algorithms/objective_function/logistic_loss/logistic_loss_dense_default_batch_kernel.h"
+#include "src/externals/service_ittnotify.h"
+
+DAAL_ITTNOTIFY_DOMAIN(logistic_regression.predict.batch);
+
+#include "src/algorithms/objective_function/common/objective_function_utils.i"
 
 using namespace daal::internal;
 using namespace daal::services::internal;
@@ -55,6 +60,7 @@ namespace prediction
 namespace internal
 {
 namespace ll = daal::algorithms::optimization_solver::logistic_loss;
+namespace of = daal::algorithms::optimization_solver::objective_function;
 
 //////////////////////////////////////////////////////////////////////////////////////////
 // PredictBinaryClassificationTask
@@ -175,7 +181,15 @@ protected:
     {
         services::Status s;
 
-        if (dynamic_cast<SOANumericTable *>(const_cast<NumericTable *>(_data)))
+        if (_data->getDataLayout() == NumericTableIface::csrArray)
+        {
+            CSRNumericTableIface * const csrData = dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(_data));
+            DAAL_CHECK(csrData, services::ErrorIncorrectTypeOfInputNumericTable);
+            ReadRowsCSR<algorithmFPType, cpu> xBD(csrData, xOffset, nRows);
+            DAAL_CHECK_BLOCK_STATUS(xBD);
+            of::internal::applyBetaCSR<algorithmFPType, cpu>(xBD.values(), xBD.cols(), xBD.rows(), beta, xb, nRows, 1, nCols + 1, bIntercept);
+        }
+        else if (dynamic_cast<SOANumericTable *>(const_cast<NumericTable *>(_data)))
         {
             s |= gemvSoa(x, beta + 1, xb, nRows, nCols, xOffset);
             if (bIntercept)
@@ -295,6 +309,9 @@ services::Status PredictMulticlassTask<algorithmFPType, cpu>::run(const NumericT
     ReadRows<algorithmFPType, cpu> betaBD(const_cast<NumericTable &>(beta), 0, nClasses);
     DAAL_CHECK_BLOCK_STATUS(betaBD);
 
+    CSRNumericTableIface * const csrData =
+        (_data->getDataLayout() == NumericTableIface::csrArray) ? dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(_data)) : nullptr;
+
     using TlsDataCpu = TlsData<algorithmFPType, cpu>;
     daal::tls<TlsDataCpu *> tlsData([=]() -> TlsDataCpu * { return new TlsDataCpu(nRowsInBlock * nClasses, _data); });
 
@@ -315,9 +332,19 @@ services::Status PredictMulticlassTask<algorithmFPType, cpu>::run(const NumericT
         DAAL_CHECK_MALLOC_THR(pLocal);
         algorithmFPType * pRawValues = pLocal->raw;
 
-        ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable *>(_data), iStartRow, nRowsToProcess);
-        DAAL_CHECK_BLOCK_STATUS_THR(xBD);
-        predictRaw(xBD.get(), betaBD.get(), pRawValues, nRowsToProcess, nClasses, nCols);
+        if (csrData)
+        {
+            ReadRowsCSR<algorithmFPType, cpu> xBD(csrData, iStartRow, nRowsToProcess);
+            DAAL_CHECK_BLOCK_STATUS_THR(xBD);
+            of::internal::applyBetaCSR<algorithmFPType, cpu>(xBD.values(), xBD.cols(), xBD.rows(), betaBD.get(), pRawValues, nRowsToProcess,
+                                                             nClasses, nCols + 1, true);
+        }
+        else
+        {
+            ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable *>(_data), iStartRow, nRowsToProcess);
+            DAAL_CHECK_BLOCK_STATUS_THR(xBD);
+            predictRaw(xBD.get(), betaBD.get(), pRawValues, nRowsToProcess, nClasses, nCols);
+        }
 
         if (_res)
         {
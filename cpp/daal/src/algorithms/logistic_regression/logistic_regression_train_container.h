@@ -50,13 +50,14 @@ BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Env
     auto & context    = services::internal::getDefaultContext();
     auto & deviceInfo = context.getInfoDevice();
 
-    if (deviceInfo.isCpu)
+    /* Sparse data is processed on CPU only */
+    if (deviceInfo.isCpu || method == fastCSR)
     {
         __DAAL_INITIALIZE_KERNELS(internal::TrainBatchKernel, algorithmFPType, method);
     }
     else
     {
-        __DAAL_INITIALIZE_KERNELS_SYCL(internal::TrainBatchKernelOneAPI, algorithmFPType, method);
+        __DAAL_INITIALIZE_KERNELS_SYCL(internal::TrainBatchKernelOneAPI, algorithmFPType, defaultDense);
     }
 }
 
@@ -80,14 +81,15 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     auto & context    = services::internal::getDefaultContext();
     auto & deviceInfo = context.getInfoDevice();
 
-    if (deviceInfo.isCpu)
+    /* Sparse data is processed on CPU only */
+    if (deviceInfo.isCpu || method == fastCSR)
     {
         __DAAL_CALL_KERNEL(env, internal::TrainBatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
                            daal::services::internal::getHostApp(*input), x, y, *m, *result, *par);
     }
     else
     {
-        __DAAL_CALL_KERNEL_SYCL(env, internal::TrainBatchKernelOneAPI, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
+        __DAAL_CALL_KERNEL_SYCL(env, internal::TrainBatchKernelOneAPI, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, defaultDense), compute,
                                 daal::services::internal::getHostApp(*input), x, y, *m, *result, *par);
     }
 }
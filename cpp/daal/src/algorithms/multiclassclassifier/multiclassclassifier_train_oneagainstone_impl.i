@@ -69,17 +69,21 @@ services::Status MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType,
     services::SharedPtr<ClsType> simpleTrainingInit = mccPar->training->clone();
 
     const size_t nClasses = mccPar->nClasses;
+    const bool isCSR      = (xTable->getDataLayout() == NumericTableIface::csrArray);
+
+    /* Group the observation indices by class once, the training subset of every pair of classes is then gathered from two slices of indices */
+    ClassPartition<algorithmFPType, cpu> partition;
+    Status s;
+    DAAL_CHECK_STATUS(s, partition.init(xTable, y, nClasses));
+
     /* Compute data size needed to store the largest subset of input tables */
     size_t nSubsetVectors, dataSize;
-    {
-        Status s;
-        DAAL_CHECK_STATUS(s, computeDataSize(nVectors, nFeatures, nClasses, xTable, y, nSubsetVectors, dataSize));
-    }
+    DAAL_CHECK_STATUS(s, computeDataSize(nFeatures, isCSR, partition, nSubsetVectors, dataSize));
 
     typedef SubTask<algorithmFPType, ClsType, cpu> TSubTask;
     /* Allocate memory for storing subsets of input data */
     daal::ls<TSubTask *> lsTask([=, &simpleTrainingInit]() {
-        if (xTable->getDataLayout() == NumericTableIface::csrArray)
+        if (isCSR)
             return (TSubTask *)SubTaskCSR<algorithmFPType, ClsType, cpu>::create(nFeatures, nSubsetVectors, dataSize, xTable, weights,
                                                                                  simpleTrainingInit);
         return (TSubTask *)SubTaskDense<algorithmFPType, ClsType, cpu>::create(nFeatures, nSubsetVectors, dataSize, xTable, weights,
@@ -109,7 +113,7 @@ services::Status MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType,
         DAAL_LS_RELEASE(TSubTask, lsTask, local); //releases local storage when leaving this scope
 
         size_t nRowsInSubset = 0;
-        Status s             = local->getDataSubset(nFeatures, nVectors, i, j, y, nRowsInSubset);
+        Status s             = local->getDataSubset(nFeatures, partition, i, j, nRowsInSubset);
         DAAL_CHECK_STATUS_THR(s);
         classifier::ModelPtr pModel;
         if (nRowsInSubset)
@@ -131,64 +135,107 @@ services::Status MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType,
     return safeStat.detach();
 }
 
-template <typename algorithmFPType, typename ClsType, typename MccParType, CpuType cpu>
-Status MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType, ClsType, MccParType, cpu>::computeDataSize(
-    size_t nVectors, size_t nFeatures, size_t nClasses, const NumericTable * xTable, const algorithmFPType * y, size_t & nSubsetVectors,
-    size_t & dataSize)
+template <typename algorithmFPType, CpuType cpu>
+Status ClassPartition<algorithmFPType, cpu>::init(const NumericTable * xTable, const algorithmFPType * y, size_t nClasses)
 {
-    TArray<size_t, cpu> buffer(4 * nClasses);
-    DAAL_CHECK_MALLOC(buffer.get());
-    daal::services::internal::service_memset_seq<size_t, cpu>(buffer.get(), 0, buffer.size());
-    size_t * classLabelsCount        = buffer.get();
-    size_t * classNonZeroValuesCount = buffer.get() + nClasses;
-    size_t * classDataSize           = buffer.get() + 2 * nClasses;
-    size_t * classIndex              = buffer.get() + 3 * nClasses;
+    const size_t nVectors = xTable->getNumberOfRows();
+    this->nClasses        = nClasses;
+
+    /* Stable counting sort of the observation indices by class keeps the order of the observations within each class */
+    classOffsets.reset(nClasses + 1);
+    order.reset(nVectors);
+    DAAL_CHECK_MALLOC(classOffsets.get() && order.get());
+    service_memset_seq<size_t, cpu>(classOffsets.get(), 0, nClasses + 1);
     for (size_t i = 0; i < nVectors; ++i)
     {
-        ++classLabelsCount[size_t(y[i])];
+        DAAL_CHECK(y[i] >= 0 && y[i] < algorithmFPType(nClasses), services::ErrorIncorrectClassLabels);
+        ++classOffsets[size_t(y[i]) + 1];
     }
+    for (size_t c = 0; c < nClasses; ++c)
+    {
+        classOffsets[c + 1] += classOffsets[c];
+    }
+    {
+        TArray<size_t, cpu> position(nClasses);
+        DAAL_CHECK_MALLOC(position.get());
+        for (size_t c = 0; c < nClasses; ++c) position[c] = classOffsets[c];
+        for (size_t i = 0; i < nVectors; ++i) order[position[size_t(y[i])]++] = i;
+    }
+
     if (xTable->getDataLayout() == NumericTableIface::csrArray)
     {
         CSRNumericTableIface * csrIface = dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(xTable));
-        ReadRowsCSR<algorithmFPType, cpu> _mtX(*csrIface, 0, nVectors);
-        DAAL_CHECK_BLOCK_STATUS(_mtX);
-        const size_t * rowOffsets = _mtX.rows();
-        /* Compute data size needed to store the largest subset of input tables */
+        ReadRowsCSR<algorithmFPType, cpu> mtX(*csrIface, 0, nVectors);
+        DAAL_CHECK_BLOCK_STATUS(mtX);
+        const size_t * rowOffsets = mtX.rows();
+
+        nonZeroValues.reset(nClasses);
+        DAAL_CHECK_MALLOC(nonZeroValues.get());
+        service_memset_seq<size_t, cpu>(nonZeroValues.get(), 0, nClasses);
         for (size_t i = 0; i < nVectors; ++i)
         {
-            classNonZeroValuesCount[size_t(y[i])] += (rowOffsets[i + 1] - rowOffsets[i]);
+            nonZeroValues[size_t(y[i])] += (rowOffsets[i + 1] - rowOffsets[i]);
         }
+    }
+    return Status();
+}
 
-        for (size_t i = 0; i < nClasses; ++i)
+template <typename algorithmFPType, typename ClsType, typename MccParType, CpuType cpu>
+Status MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType, ClsType, MccParType, cpu>::computeDataSize(
+    size_t nFeatures, bool isCSR, const ClassPartition<algorithmFPType, cpu> & partition, size_t & nSubsetVectors, size_t & dataSize)
+{
+    /* The largest subset consists of the two largest classes */
+    size_t maxSize[2]      = { 0, 0 };
+    size_t maxNonZeroes[2] = { 0, 0 };
+    for (size_t c = 0; c < partition.nClasses; ++c)
+    {
+        const size_t size = partition.classSize(c);
+        if (size > maxSize[0])
         {
-            classDataSize[i] = classLabelsCount[i] + classNonZeroValuesCount[i];
-            classIndex[i]    = i;
+            maxSize[1] = maxSize[0];
+            maxSize[0] = size;
         }
-
-        daal::algorithms::internal::qSort<size_t, size_t, cpu>(nClasses, classDataSize, classIndex);
-        const auto idx1 = classIndex[nClasses - 1], idx2 = classIndex[nClasses - 2];
-        dataSize = classNonZeroValuesCount[idx1] + classNonZeroValuesCount[idx2];
-        daal::algorithms::internal::qSort<size_t, cpu>(nClasses, classLabelsCount);
-        nSubsetVectors = classLabelsCount[nClasses - 1] + classLabelsCount[nClasses - 2];
+        else if (size > maxSize[1])
+        {
+            maxSize[1] = size;
+        }
+        if (isCSR)
+        {
+            const size_t nNonZeroes = partition.classNonZeroValues(c);
+            if (nNonZeroes > maxNonZeroes[0])
+            {
+                maxNonZeroes[1] = maxNonZeroes[0];
+                maxNonZeroes[0] = nNonZeroes;
+            }
+            else if (nNonZeroes > maxNonZeroes[1])
+            {
+                maxNonZeroes[1] = nNonZeroes;
+            }
+        }
+    }
+    nSubsetVectors = maxSize[0] + maxSize[1];
+    if (isCSR)
+    {
+        dataSize = maxNonZeroes[0] + maxNonZeroes[1];
     }
     else
     {
-        daal::algorithms::internal::qSort<size_t, cpu>(nClasses, classLabelsCount);
-        nSubsetVectors = classLabelsCount[nClasses - 1] + classLabelsCount[nClasses - 2];
-        dataSize       = nFeatures * nSubsetVectors;
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nFeatures, nSubsetVectors);
+        dataSize = nFeatures * nSubsetVectors;
     }
-
     return Status();
 }
 
 template <typename algorithmFPType, typename ClsType, CpuType cpu>
-Status SubTaskDense<algorithmFPType, ClsType, cpu>::copyDataIntoSubtable(size_t nFeatures, size_t nVectors, int classIdx, algorithmFPType label,
-                                                                         const algorithmFPType * y, size_t & nRows)
+Status SubTaskDense<algorithmFPType, ClsType, cpu>::copyDataIntoSubtable(size_t nFeatures, const typename super::TPartition & partition, int classIdx,
+                                                                         algorithmFPType label, size_t & nRows)
 {
-    for (size_t ix = 0; ix < nVectors; ix++)
+    const size_t * classRows = partition.order.get() + partition.classOffsets[classIdx];
+    const size_t nClassRows  = partition.classSize(classIdx);
+    for (size_t ix = 0; ix < nClassRows; ix++)
     {
-        if (size_t(y[ix]) != classIdx) continue;
-        _mtX.next(ix, 1);
+        const size_t iRow = classRows[ix];
+        _mtX.next(iRow, 1);
         DAAL_CHECK_BLOCK_STATUS(_mtX);
         PRAGMA_IVDEP
         PRAGMA_VECTOR_ALWAYS
@@ -196,7 +243,7 @@ Status SubTaskDense<algorithmFPType, ClsType, cpu>::copyDataIntoSubtable(size_t
         this->_subsetY[nRows] = label;
         if (this->_weights)
         {
-            this->_subsetW[nRows] = this->_weights[ix];
+            this->_subsetW[nRows] = this->_weights[iRow];
         }
         ++nRows;
     }
@@ -204,15 +251,17 @@ Status SubTaskDense<algorithmFPType, ClsType, cpu>::copyDataIntoSubtable(size_t
 }
 
 template <typename algorithmFPType, typename ClsType, CpuType cpu>
-Status SubTaskCSR<algorithmFPType, ClsType, cpu>::copyDataIntoSubtable(size_t nFeatures, size_t nVectors, int classIdx, algorithmFPType label,
-                                                                       const algorithmFPType * y, size_t & nRows)
+Status SubTaskCSR<algorithmFPType, ClsType, cpu>::copyDataIntoSubtable(size_t nFeatures, const typename super::TPartition & partition, int classIdx,
+                                                                       algorithmFPType label, size_t & nRows)
 {
-    _rowOffsetsX[0]  = 1;
-    size_t dataIndex = (nRows ? _rowOffsetsX[nRows] - _rowOffsetsX[0] : 0);
-    for (size_t ix = 0; ix < nVectors; ix++)
+    _rowOffsetsX[0]          = 1;
+    size_t dataIndex         = (nRows ? _rowOffsetsX[nRows] - _rowOffsetsX[0] : 0);
+    const size_t * classRows = partition.order.get() + partition.classOffsets[classIdx];
+    const size_t nClassRows  = partition.classSize(classIdx);
+    for (size_t ix = 0; ix < nClassRows; ix++)
     {
-        if (size_t(y[ix]) != classIdx) continue;
-        _mtX.next(ix, 1);
+        const size_t iRow = classRows[ix];
+        _mtX.next(iRow, 1);
         DAAL_CHECK_BLOCK_STATUS(_mtX);
         const size_t nNonZeroValuesInRow = _mtX.rows()[1] - _mtX.rows()[0];
         const size_t * colIndices        = _mtX.cols();
@@ -227,7 +276,7 @@ Status SubTaskCSR<algorithmFPType, ClsType, cpu>::copyDataIntoSubtable(size_t nF
         this->_subsetY[nRows]   = label;
         if (this->_weights)
         {
-            this->_subsetW[nRows] = this->_weights[ix];
+            this->_subsetW[nRows] = this->_weights[iRow];
         }
 
         ++nRows;
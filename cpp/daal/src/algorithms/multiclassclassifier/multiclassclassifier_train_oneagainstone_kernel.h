@@ -46,6 +46,21 @@ namespace training
 {
 namespace internal
 {
+//Indices of the input observations grouped by class once, so that the observations of every class are found without scanning all labels
+template <typename algorithmFPType, CpuType cpu>
+struct ClassPartition
+{
+    services::Status init(const NumericTable * xTable, const algorithmFPType * y, size_t nClasses);
+
+    size_t nClasses;
+    TArray<size_t, cpu> classOffsets;  /* Index of the first observation of every class in order, nClasses + 1 values */
+    TArray<size_t, cpu> order;         /* Indices of the observations sorted by class, the order within every class is kept */
+    TArray<size_t, cpu> nonZeroValues; /* Number of non-zero values of every class in the CSR data, empty for the dense data */
+
+    size_t classSize(size_t classIdx) const { return classOffsets[classIdx + 1] - classOffsets[classIdx]; }
+    size_t classNonZeroValues(size_t classIdx) const { return nonZeroValues[classIdx]; }
+};
+
 //Base class for binary classification subtask
 template <typename algorithmFPType, typename ClsType, CpuType cpu>
 class SubTask
@@ -54,14 +69,15 @@ public:
     DAAL_NEW_DELETE();
     virtual ~SubTask() {}
 
-    services::Status getDataSubset(size_t nFeatures, size_t nVectors, int classIdxPositive, int classIdxNegative, const algorithmFPType * y,
-                                   size_t & nRows)
+    typedef ClassPartition<algorithmFPType, cpu> TPartition;
+
+    services::Status getDataSubset(size_t nFeatures, const TPartition & partition, int classIdxPositive, int classIdxNegative, size_t & nRows)
     {
         nRows = 0;
         /* Prepare "positive" observations of the training subset */
-        services::Status s = copyDataIntoSubtable(nFeatures, nVectors, classIdxPositive, 1, y, nRows);
+        services::Status s = copyDataIntoSubtable(nFeatures, partition, classIdxPositive, 1, nRows);
         if (s) /* Prepare "negative" observations of the training subset */
-            s = copyDataIntoSubtable(nFeatures, nVectors, classIdxNegative, -1, y, nRows);
+            s = copyDataIntoSubtable(nFeatures, partition, classIdxNegative, -1, nRows);
         return s;
     }
 
@@ -108,7 +124,7 @@ protected:
 
     bool isValid() const { return _subsetX.get() && _subsetYTable.get() && _simpleTraining.get(); }
 
-    virtual services::Status copyDataIntoSubtable(size_t nFeatures, size_t nVectors, int classIdx, algorithmFPType label, const algorithmFPType * y,
+    virtual services::Status copyDataIntoSubtable(size_t nFeatures, const TPartition & partition, int classIdx, algorithmFPType label,
                                                   size_t & nRows) = 0;
 
 protected:
@@ -157,8 +173,8 @@ private:
         }
     }
 
-    virtual services::Status copyDataIntoSubtable(size_t nFeatures, size_t nVectors, int classIdx, algorithmFPType label, const algorithmFPType * y,
-                                                  size_t & nRows) DAAL_C11_OVERRIDE;
+    virtual services::Status copyDataIntoSubtable(size_t nFeatures, const typename super::TPartition & partition, int classIdx,
+                                                  algorithmFPType label, size_t & nRows) DAAL_C11_OVERRIDE;
 
 private:
     TArray<size_t, cpu> _colIndicesX;
@@ -196,8 +212,8 @@ private:
         if (!status) return;
     }
 
-    virtual services::Status copyDataIntoSubtable(size_t nFeatures, size_t nVectors, int classIdx, algorithmFPType label, const algorithmFPType * y,
-                                                  size_t & nRows) DAAL_C11_OVERRIDE;
+    virtual services::Status copyDataIntoSubtable(size_t nFeatures, const typename super::TPartition & partition, int classIdx,
+                                                  algorithmFPType label, size_t & nRows) DAAL_C11_OVERRIDE;
 
 private:
     ReadRows<algorithmFPType, cpu> _mtX;
@@ -211,8 +227,8 @@ public:
                              const daal::algorithms::Parameter * par);
 
 protected:
-    services::Status computeDataSize(size_t nVectors, size_t nFeatures, size_t nClasses, const NumericTable * xTable, const algorithmFPType * y,
-                                     size_t & nSubsetVectors, size_t & dataSize);
+    services::Status computeDataSize(size_t nFeatures, bool isCSR, const ClassPartition<algorithmFPType, cpu> & partition, size_t & nSubsetVectors,
+                                     size_t & dataSize);
 };
 
 } // namespace internal
@@ -64,6 +64,140 @@ services::Status getXY(NumericTable * dataNT, NumericTable * dependentVariablesN
     return services::Status();
 }
 
+/* Grows the buffer to keep at least the given number of elements, the first nToKeep elements are preserved */
+template <typename T, CpuType cpu>
+bool growBuffer(TArrayScalable<T, cpu> & buffer, size_t size, size_t nToKeep)
+{
+    if (buffer.get() && buffer.size() >= size) return true;
+    const size_t minSize = size ? size : 1;
+    const size_t newSize = (2 * buffer.size() > minSize) ? 2 * buffer.size() : minSize;
+    TArrayScalable<T, cpu> kept(nToKeep);
+    if (nToKeep && !kept.get()) return false;
+    if (nToKeep) services::internal::tmemcpy<T, cpu>(kept.get(), buffer.get(), nToKeep);
+    if (!buffer.reset(newSize)) return false;
+    if (nToKeep) services::internal::tmemcpy<T, cpu>(buffer.get(), kept.get(), nToKeep);
+    return true;
+}
+
+/* Gathers the rows with the given indices of the sparse data into the arrays of one-based CSR format,
+   only the rows of the batch are read from the data */
+template <typename algorithmFPType, CpuType cpu>
+services::Status getXYCSR(CSRNumericTableIface * dataNT, NumericTable * dependentVariablesNT, const NumericTable * indNT,
+                          TArrayScalable<algorithmFPType, cpu> & aValues, TArrayScalable<size_t, cpu> & aCols, TArrayScalable<size_t, cpu> & aRows,
+                          algorithmFPType * aY, size_t nRows, size_t n)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(getXYCSR);
+    DAAL_ASSERT(indNT != nullptr);
+    DAAL_ASSERT(dataNT != nullptr);
+    DAAL_ASSERT(dependentVariablesNT != nullptr);
+    DAAL_ASSERT(aY != nullptr);
+
+    ReadRows<int, cpu> rInd(*const_cast<NumericTable *>(indNT), 0, n);
+    DAAL_CHECK_BLOCK_STATUS(rInd);
+    const int * ind = rInd.get();
+
+    ReadRows<algorithmFPType, cpu> yr(*dependentVariablesNT, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(yr);
+
+    if (aRows.size() < n + 1)
+    {
+        aRows.reset(n + 1);
+        DAAL_CHECK_MALLOC(aRows.get());
+    }
+    size_t * const batchRows = aRows.get();
+    batchRows[0]             = 1;
+
+    ReadRowsCSR<algorithmFPType, cpu> xr(dataNT);
+    for (size_t i = 0; i < n; ++i)
+    {
+        xr.next(ind[i], 1);
+        DAAL_CHECK_BLOCK_STATUS(xr);
+        const size_t nInRow   = xr.rows()[1] - xr.rows()[0];
+        const size_t dstStart = batchRows[i] - 1;
+        batchRows[i + 1]      = batchRows[i] + nInRow;
+
+        DAAL_CHECK_MALLOC((growBuffer<algorithmFPType, cpu>(aValues, dstStart + nInRow, dstStart)));
+        DAAL_CHECK_MALLOC((growBuffer<size_t, cpu>(aCols, dstStart + nInRow, dstStart)));
+        services::internal::tmemcpy<algorithmFPType, cpu>(aValues.get() + dstStart, xr.values(), nInRow);
+        services::internal::tmemcpy<size_t, cpu>(aCols.get() + dstStart, xr.cols(), nInRow);
+        aY[i] = yr.get()[ind[i]];
+    }
+    return services::Status();
+}
+
+/**
+ *  Computes xb = X * beta for the rows of X in one-based CSR format.
+ *  beta holds nClasses rows of nBetaPerClass coefficients, the first one of each row being the intercept; xb is nRows x nClasses
+ */
+template <typename algorithmFPType, CpuType cpu>
+void applyBetaCSR(const algorithmFPType * values, const size_t * cols, const size_t * rows, const algorithmFPType * beta, algorithmFPType * xb,
+                  size_t nRows, size_t nClasses, size_t nBetaPerClass, bool bIntercept)
+{
+    for (size_t i = 0; i < nRows; ++i)
+    {
+        algorithmFPType * const xbi = xb + i * nClasses;
+        for (size_t c = 0; c < nClasses; ++c)
+        {
+            xbi[c] = bIntercept ? beta[c * nBetaPerClass] : algorithmFPType(0);
+        }
+        for (size_t k = rows[i] - 1; k < rows[i + 1] - 1; ++k)
+        {
+            /* One-based column index is the index of the coefficient of the feature in the row of beta */
+            const algorithmFPType * const betaCol = beta + cols[k];
+            const algorithmFPType value           = values[k];
+            for (size_t c = 0; c < nClasses; ++c)
+            {
+                xbi[c] += value * betaCol[c * nBetaPerClass];
+            }
+        }
+    }
+}
+
+/**
+ *  Accumulates g += X^T * r for the rows of X in one-based CSR format.
+ *  r is nRows x nClasses, g points to the coefficient of the first feature of nClasses rows with the stride ldg
+ */
+template <typename algorithmFPType, CpuType cpu>
+void applyGradientCSR(const algorithmFPType * values, const size_t * cols, const size_t * rows, const algorithmFPType * r, algorithmFPType * g,
+                      size_t nRows, size_t nClasses, size_t ldg)
+{
+    for (size_t i = 0; i < nRows; ++i)
+    {
+        const algorithmFPType * const ri = r + i * nClasses;
+        for (size_t k = rows[i] - 1; k < rows[i + 1] - 1; ++k)
+        {
+            algorithmFPType * const gCol = g + cols[k] - 1;
+            const algorithmFPType value  = values[k];
+            for (size_t c = 0; c < nClasses; ++c)
+            {
+                gCol[c * ldg] += value * ri[c];
+            }
+        }
+    }
+}
+
+/* Returns the maximal squared Euclidean norm of the rows in one-based CSR format */
+template <typename algorithmFPType, CpuType cpu>
+algorithmFPType maxRowNormCSR(const algorithmFPType * values, const size_t * rows, size_t nRows)
+{
+    algorithmFPType maxNorm = 0;
+    for (size_t i = 0; i < nRows; ++i)
+    {
+        algorithmFPType norm = 0;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t k = rows[i] - 1; k < rows[i + 1] - 1; ++k)
+        {
+            norm += values[k] * values[k];
+        }
+        if (norm > maxNorm)
+        {
+            maxNorm = norm;
+        }
+    }
+    return maxNorm;
+}
+
 } // namespace internal
 
 } // namespace objective_function
@@ -209,6 +209,9 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
                                                                                  NumericTable * lipschitzConstant, Parameter * parameter)
 {
     const size_t nClasses = parameter->nClasses;
+    /* Sparse data is processed in CSR format without conversion to the dense one */
+    CSRNumericTableIface * const csrData =
+        (dataNT->getDataLayout() == NumericTableIface::csrArray) ? dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(dataNT)) : nullptr;
 
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, nClasses);
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n * nClasses, sizeof(algorithmFPType));
@@ -286,6 +289,17 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
             const size_t startRow      = iBlock * blockSize;
             const size_t finishRow     = (iBlock + 1 == nBlocks ? n : (iBlock + 1) * blockSize);
             algorithmFPType curentNorm = 0;
+            if (csrData)
+            {
+                ReadRowsCSR<algorithmFPType, cpu> xr(csrData, startRow, finishRow - startRow);
+                DAAL_CHECK_BLOCK_STATUS_THR(xr);
+                curentNorm = objective_function::internal::maxRowNormCSR<algorithmFPType, cpu>(xr.values(), xr.rows(), finishRow - startRow);
+                if (curentNorm > _maxNorm)
+                {
+                    _maxNorm = curentNorm;
+                }
+                return;
+            }
             ReadRows<algorithmFPType, cpu> xr(const_cast<NumericTable *>(dataNT), startRow, finishRow - startRow);
             DAAL_CHECK_BLOCK_STATUS_THR(xr);
             const algorithmFPType * const x = xr.get();
@@ -350,8 +364,18 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
             const size_t iStartRow      = iBlock * nRowsInBlock;
             const size_t nRowsToProcess = (iBlock == nDataBlocks - 1) ? n - iBlock * nRowsInBlock : nRowsInBlock;
 
-            ReadRows<algorithmFPType, cpu> xr(const_cast<NumericTable *>(dataNT), iStartRow, nRowsToProcess);
-            DAAL_CHECK_BLOCK_STATUS_THR(xr);
+            ReadRows<algorithmFPType, cpu> xr;
+            ReadRowsCSR<algorithmFPType, cpu> xrCSR;
+            if (csrData)
+            {
+                xrCSR.set(csrData, iStartRow, nRowsToProcess);
+                DAAL_CHECK_BLOCK_STATUS_THR(xrCSR);
+            }
+            else
+            {
+                xr.set(const_cast<NumericTable *>(dataNT), iStartRow, nRowsToProcess);
+                DAAL_CHECK_BLOCK_STATUS_THR(xr);
+            }
             const algorithmFPType * const xLocal = xr.get();
 
             ReadRows<algorithmFPType, cpu> yr(const_cast<NumericTable *>(dependentVariablesNT), iStartRow, nRowsToProcess);
@@ -363,7 +387,15 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
             //f = X*b + b0
             {
                 DAAL_ITTNOTIFY_SCOPED_TASK(applyBeta);
-                applyBeta(xLocal, b, fPtrLocal, nRowsToProcess, nClasses, p, interceptFlag);
+                if (csrData)
+                {
+                    objective_function::internal::applyBetaCSR<algorithmFPType, cpu>(xrCSR.values(), xrCSR.cols(), xrCSR.rows(), b, fPtrLocal,
+                                                                                     nRowsToProcess, nClasses, nBetaPerClass, interceptFlag);
+                }
+                else
+                {
+                    applyBeta(xLocal, b, fPtrLocal, nRowsToProcess, nClasses, p, interceptFlag);
+                }
             }
 
             //f = softmax(f)
@@ -424,8 +456,17 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
                 DAAL_ASSERT((m + 1) <= services::internal::MaxVal<DAAL_INT>::get());
                 const DAAL_INT ldc = m + 1;
 
-                daal::internal::Blas<algorithmFPType, cpu>::xxgemm(&notrans, &trans, &m, &n, &k, &one, xLocal, &lda, fPtrLocal, &ldb, &zero, g + 1,
-                                                                   &ldc);
+                if (csrData)
+                {
+                    services::internal::service_memset_seq<algorithmFPType, cpu>(g, algorithmFPType(0), nBeta);
+                    objective_function::internal::applyGradientCSR<algorithmFPType, cpu>(xrCSR.values(), xrCSR.cols(), xrCSR.rows(), fPtrLocal, g + 1,
+                                                                                         nRowsToProcess, nClasses, nBetaPerClass);
+                }
+                else
+                {
+                    daal::internal::Blas<algorithmFPType, cpu>::xxgemm(&notrans, &trans, &m, &n, &k, &one, xLocal, &lda, fPtrLocal, &ldb, &zero,
+                                                                       g + 1, &ldc);
+                }
 
                 if (interceptFlag)
                 {
@@ -542,8 +583,28 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
             const algorithmFPType interceptFactor = (parameter->interceptFlag ? 1 : 0);
             const auto hSize                      = nBeta * nBeta;
             TlsSum<algorithmFPType, cpu> tlsData(hSize);
+            /* Sparse rows are scattered into the dense buffer of the thread, as the hessian itself is dense */
+            TlsMem<algorithmFPType, cpu, services::internal::ScalableCalloc<algorithmFPType, cpu> > tlsRow(csrData ? p : 0);
             SafeStatus safeStat;
             daal::threader_for(n, n, [&](size_t i) {
+                if (csrData)
+                {
+                    ReadRowsCSR<algorithmFPType, cpu> xr(csrData, i, 1);
+                    DAAL_CHECK_BLOCK_STATUS_THR(xr);
+                    algorithmFPType * const x = tlsRow.local();
+                    DAAL_CHECK_THR(x, services::ErrorMemoryAllocationFailed);
+                    const size_t nNonZeros = xr.rows()[1] - xr.rows()[0];
+                    for (size_t k = 0; k < nNonZeros; ++k)
+                    {
+                        x[xr.cols()[k] - 1] = xr.values()[k];
+                    }
+                    addHessInPt<algorithmFPType, cpu>(tlsData.local(), x, pp + i * nClasses, interceptFactor, nClasses, nBetaPerClass, nBeta);
+                    for (size_t k = 0; k < nNonZeros; ++k)
+                    {
+                        x[xr.cols()[k] - 1] = algorithmFPType(0);
+                    }
+                    return;
+                }
                 ReadRows<algorithmFPType, cpu> xr(const_cast<NumericTable *>(dataNT), i, 1);
                 DAAL_CHECK_BLOCK_STATUS_THR(xr);
                 const algorithmFPType * const x = xr.get();
@@ -590,6 +651,25 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::compute(N
     if (ntInd && (ntInd->getNumberOfColumns() == nRows)) ntInd = nullptr;
     services::Status s;
     const size_t p = dataNT->getNumberOfColumns();
+    CSRNumericTableIface * const csrData =
+        (dataNT->getDataLayout() == NumericTableIface::csrArray) ? dynamic_cast<CSRNumericTableIface *>(dataNT) : nullptr;
+    if (ntInd && csrData)
+    {
+        const size_t n = ntInd->getNumberOfColumns();
+        if (_aY.size() < n)
+        {
+            _aY.reset(n);
+            DAAL_CHECK_MALLOC(_aY.get());
+        }
+        DAAL_CHECK_STATUS(s, (objective_function::internal::getXYCSR<algorithmFPType, cpu>(csrData, dependentVariablesNT, ntInd, _aX, _aCols, _aRows,
+                                                                                           _aY.get(), nRows, n)));
+        auto internalDataNT = CSRNumericTable::create(_aX.get(), _aCols.get(), _aRows.get(), p, n, CSRNumericTableIface::oneBased, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        auto internalDependentVariablesNT = HomogenNumericTableCPU<algorithmFPType, cpu>::create(_aY.get(), 1, n);
+        DAAL_CHECK_MALLOC(internalDependentVariablesNT.get());
+        return doCompute(internalDataNT.get(), internalDependentVariablesNT.get(), nRows, n, p, betaNT, valueNT, hessianNT, gradientNT,
+                         nonSmoothTermValue, proximalProjection, lipschitzConstant, parameter);
+    }
     if (ntInd)
     {
         const size_t n = ntInd->getNumberOfColumns();
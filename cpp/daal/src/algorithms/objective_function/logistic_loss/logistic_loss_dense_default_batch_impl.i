@@ -122,6 +122,67 @@ void LogLossKernel<algorithmFPType, method, cpu>::sigmoid(const algorithmFPType
     }
 }
 
+/**
+ *  Computes the hessian for the data in CSR format: only the products of the non-zero features of each row are accumulated.
+ *  sg holds the sigmoids of the rows followed by their complements to one
+ */
+template <typename algorithmFPType, CpuType cpu>
+static services::Status computeHessianCSR(CSRNumericTableIface * csrData, algorithmFPType * sg, size_t n, size_t nBeta, NumericTable * hessianNT,
+                                          const Parameter * parameter)
+{
+    ReadRowsCSR<algorithmFPType, cpu> xr(csrData, 0, n);
+    DAAL_CHECK_BLOCK_STATUS(xr);
+    const algorithmFPType * const values = xr.values();
+    const size_t * const cols            = xr.cols();
+    const size_t * const rows            = xr.rows();
+
+    WriteRows<algorithmFPType, cpu> hr(hessianNT, 0, nBeta * nBeta);
+    DAAL_CHECK_BLOCK_STATUS(hr);
+    algorithmFPType * const h = hr.get();
+    services::internal::service_memset_seq<algorithmFPType, cpu>(h, algorithmFPType(0), nBeta * nBeta);
+
+    const algorithmFPType div = static_cast<algorithmFPType>(1) / static_cast<algorithmFPType>(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        const algorithmFPType si = sg[i] * sg[i + n]; //sigmoid derivative at x[i]
+        if (parameter->interceptFlag)
+        {
+            h[0] += si;
+        }
+        for (size_t k = rows[i] - 1; k < rows[i + 1] - 1; ++k)
+        {
+            const size_t j                = cols[k];
+            const algorithmFPType sxValue = si * values[k];
+            if (parameter->interceptFlag)
+            {
+                h[j] += sxValue;
+            }
+            for (size_t l = rows[i] - 1; l < rows[i + 1] - 1; ++l)
+            {
+                /* Upper triangle only, the lower one is filled by symmetry */
+                if (cols[l] >= j)
+                {
+                    h[j * nBeta + cols[l]] += sxValue * values[l];
+                }
+            }
+        }
+    }
+
+    for (size_t j = 0; j < nBeta; ++j)
+    {
+        for (size_t k = j; k < nBeta; ++k)
+        {
+            h[j * nBeta + k] *= div;
+            h[k * nBeta + j] = h[j * nBeta + k];
+        }
+        if (j > 0)
+        {
+            h[j * nBeta + j] += 2. * parameter->penaltyL2;
+        }
+    }
+    return services::Status();
+}
+
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const NumericTable * dataNT, const NumericTable * dependentVariablesNT,
                                                                         size_t n, size_t p, NumericTable * betaNT, NumericTable * valueNT,
@@ -131,6 +192,9 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const Nu
 {
     SafeStatus safeStat;
     const size_t nBeta = p + 1;
+    /* Sparse data is processed in CSR format without conversion to the dense one */
+    CSRNumericTableIface * const csrData =
+        (dataNT->getDataLayout() == NumericTableIface::csrArray) ? dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(dataNT)) : nullptr;
     DAAL_ASSERT(betaNT->getNumberOfColumns() == 1);
     DAAL_ASSERT(betaNT->getNumberOfRows() == nBeta);
 
@@ -201,6 +265,18 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const Nu
             algorithmFPType & _maxNorm = *tlsData.local();
             const size_t startRow      = iBlock * blockSize;
             const size_t finishRow     = (iBlock + 1 == nBlocks ? n : (iBlock + 1) * blockSize);
+            if (csrData)
+            {
+                ReadRowsCSR<algorithmFPType, cpu> xr(csrData, startRow, finishRow - startRow);
+                DAAL_CHECK_BLOCK_STATUS_THR(xr);
+                const algorithmFPType maxNorm = objective_function::internal::maxRowNormCSR<algorithmFPType, cpu>(xr.values(), xr.rows(),
+                                                                                                                  finishRow - startRow);
+                if (maxNorm > _maxNorm)
+                {
+                    _maxNorm = maxNorm;
+                }
+                return;
+            }
             ReadRows<algorithmFPType, cpu> xr(const_cast<NumericTable *>(dataNT), startRow, finishRow - startRow);
             DAAL_CHECK_BLOCK_STATUS_THR(xr);
             const algorithmFPType * const x = xr.get();
@@ -311,8 +387,18 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const Nu
             const size_t iStartRow      = iBlock * nRowsInBlock;
             const size_t nRowsToProcess = (iBlock == nDataBlocks - 1) ? n - iBlock * nRowsInBlock : nRowsInBlock;
 
-            ReadRows<algorithmFPType, cpu> xr(const_cast<NumericTable *>(dataNT), iStartRow, nRowsToProcess);
-            DAAL_CHECK_BLOCK_STATUS_THR(xr);
+            ReadRows<algorithmFPType, cpu> xr;
+            ReadRowsCSR<algorithmFPType, cpu> xrCSR;
+            if (csrData)
+            {
+                xrCSR.set(csrData, iStartRow, nRowsToProcess);
+                DAAL_CHECK_BLOCK_STATUS_THR(xrCSR);
+            }
+            else
+            {
+                xr.set(const_cast<NumericTable *>(dataNT), iStartRow, nRowsToProcess);
+                DAAL_CHECK_BLOCK_STATUS_THR(xr);
+            }
             ReadRows<algorithmFPType, cpu> yr(const_cast<NumericTable *>(dependentVariablesNT), iStartRow, nRowsToProcess);
             DAAL_CHECK_BLOCK_STATUS_THR(yr);
             const algorithmFPType * const xLocal = xr.get();
@@ -324,7 +410,15 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const Nu
             //f = X*b + b0
             {
                 DAAL_ITTNOTIFY_SCOPED_TASK(applyBeta);
-                applyBeta(xLocal, b, fPtrLocal, nRowsToProcess, p, parameter->interceptFlag);
+                if (csrData)
+                {
+                    objective_function::internal::applyBetaCSR<algorithmFPType, cpu>(xrCSR.values(), xrCSR.cols(), xrCSR.rows(), b, fPtrLocal,
+                                                                                     nRowsToProcess, 1, nBeta, parameter->interceptFlag);
+                }
+                else
+                {
+                    applyBeta(xLocal, b, fPtrLocal, nRowsToProcess, p, parameter->interceptFlag);
+                }
             }
 
             {
@@ -379,8 +473,17 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const Nu
                     sgPtrLocal[i] -= yLocal[i];
                 }
 
-                daal::internal::Blas<algorithmFPType, cpu>::xxgemm(&notrans, &notrans, &dim, &yDim, &nN, &one, xLocal, &dim, sgPtrLocal, &nN, &zero,
-                                                                   pg, &dim);
+                if (csrData)
+                {
+                    services::internal::service_memset_seq<algorithmFPType, cpu>(pg, algorithmFPType(0), p);
+                    objective_function::internal::applyGradientCSR<algorithmFPType, cpu>(xrCSR.values(), xrCSR.cols(), xrCSR.rows(), sgPtrLocal, pg,
+                                                                                         nRowsToProcess, 1, p);
+                }
+                else
+                {
+                    daal::internal::Blas<algorithmFPType, cpu>::xxgemm(&notrans, &notrans, &dim, &yDim, &nN, &one, xLocal, &dim, sgPtrLocal, &nN,
+                                                                       &zero, pg, &dim);
+                }
 
                 PRAGMA_IVDEP
                 PRAGMA_VECTOR_ALWAYS
@@ -494,7 +597,13 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const Nu
             }
         }
 
-        if (hessianNT)
+        if (hessianNT && csrData)
+        {
+            DAAL_ASSERT(hessianNT->getNumberOfRows() == nBeta);
+            const services::Status hessianStatus = computeHessianCSR<algorithmFPType, cpu>(csrData, sgPtr, n, nBeta, hessianNT, parameter);
+            DAAL_CHECK_STATUS_VAR(hessianStatus);
+        }
+        else if (hessianNT)
         {
             ReadRows<algorithmFPType, cpu> xr(const_cast<NumericTable *>(dataNT), 0, n);
             DAAL_CHECK_BLOCK_STATUS(xr);
@@ -575,6 +684,26 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::compute(NumericTab
     if (ntInd && (ntInd->getNumberOfColumns() == nRows)) ntInd = nullptr;
 
     const size_t p = dataNT->getNumberOfColumns();
+    CSRNumericTableIface * const csrData =
+        (dataNT->getDataLayout() == NumericTableIface::csrArray) ? dynamic_cast<CSRNumericTableIface *>(dataNT) : nullptr;
+    if (ntInd && csrData)
+    {
+        const size_t n = ntInd->getNumberOfColumns();
+        services::Status s;
+        if (_aY.size() < n)
+        {
+            _aY.reset(n);
+            DAAL_CHECK_MALLOC(_aY.get());
+        }
+        DAAL_CHECK_STATUS(s, (objective_function::internal::getXYCSR<algorithmFPType, cpu>(csrData, dependentVariablesNT, ntInd, _aX, _aCols, _aRows,
+                                                                                           _aY.get(), nRows, n)));
+        auto internalDataNT = CSRNumericTable::create(_aX.get(), _aCols.get(), _aRows.get(), p, n, CSRNumericTableIface::oneBased, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        auto internalDependentVariablesNT = HomogenNumericTableCPU<algorithmFPType, cpu>::create(_aY.get(), 1, n);
+        DAAL_CHECK_MALLOC(internalDependentVariablesNT.get());
+        return doCompute(internalDataNT.get(), internalDependentVariablesNT.get(), n, p, betaNT, valueNT, hessianNT, gradientNT, nonSmoothTermValue,
+                         proximalProjection, lipschitzConstant, parameter);
+    }
     if (ntInd)
     {
         const size_t n = ntInd->getNumberOfColumns();
@@ -61,6 +61,8 @@ protected:
 private:
     TArrayScalable<algorithmFPType, cpu> _aX;
     TArrayScalable<algorithmFPType, cpu> _aY;
+    TArrayScalable<size_t, cpu> _aCols; /* Column indices of the sparse rows of the batch, values are kept in _aX */
+    TArrayScalable<size_t, cpu> _aRows; /* Row offsets of the sparse rows of the batch */
 };
 
 } // namespace internal
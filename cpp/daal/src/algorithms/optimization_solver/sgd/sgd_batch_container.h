@@ -28,6 +28,7 @@
 #include "src/algorithms/optimization_solver/sgd/sgd_dense_default_kernel.h"
 #include "src/algorithms/optimization_solver/sgd/sgd_dense_minibatch_kernel.h"
 #include "src/algorithms/optimization_solver/sgd/sgd_dense_momentum_kernel.h"
+#include "src/algorithms/optimization_solver/sgd/sgd_dense_hogwild_kernel.h"
 #include "src/services/service_algo_utils.h"
 #include "src/algorithms/optimization_solver/sgd/oneapi/sgd_dense_kernel_oneapi.h"
 
@@ -47,7 +48,7 @@ BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Env
     auto & context    = services::internal::getDefaultContext();
     auto & deviceInfo = context.getInfoDevice();
 
-    if (deviceInfo.isCpu || method == defaultDense || method == momentum)
+    if (deviceInfo.isCpu || method == defaultDense || method == momentum || method == hogwild)
     {
         __DAAL_INITIALIZE_KERNELS(internal::SGDKernel, algorithmFPType, method);
     }
@@ -84,7 +85,7 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     auto & context    = services::internal::getDefaultContext();
     auto & deviceInfo = context.getInfoDevice();
 
-    if (deviceInfo.isCpu || method == defaultDense || method == momentum)
+    if (deviceInfo.isCpu || method == defaultDense || method == momentum || method == hogwild)
     {
         __DAAL_CALL_KERNEL(env, internal::SGDKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
                            daal::services::internal::hostApp(*input), inputArgument, minimum.get(), nIterations, parameter, learningRateSequence,
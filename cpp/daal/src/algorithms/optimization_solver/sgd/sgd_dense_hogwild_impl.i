@@ -0,0 +1,328 @@
+/* file: sgd_dense_hogwild_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of sgd hogwild algorithm
+//
+// Feng Niu, Benjamin Recht, Christopher Re, Stephen J. Wright HOGWILD!: A Lock-Free Approach to Parallelizing Stochastic Gradient Descent
+//--
+*/
+
+#ifndef __SGD_DENSE_HOGWILD_IMPL_I__
+#define __SGD_DENSE_HOGWILD_IMPL_I__
+
+#include "src/data_management/service_numeric_table.h"
+#include "src/externals/service_math.h"
+#include "src/services/service_utils.h"
+#include "src/services/service_data_utils.h"
+#include "src/threading/threading.h"
+#include "src/algorithms/engines/engine_types_internal.h"
+#include "src/externals/service_ittnotify.h"
+
+using namespace daal::internal;
+using namespace daal::services;
+
+DAAL_ITTNOTIFY_DOMAIN(sgd.dense.hogwild);
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace sgd
+{
+namespace internal
+{
+/**
+ *  \brief Kernel for SGD hogwild calculation.
+ *  Every iteration the workers run in parallel, each of them performs innerNIterations steps on its own mini-batches.
+ *  The workers read and update the shared argument without any synchronization: the races between the updates are
+ *  benign by design of the method, as the gradients of the sparse or weakly coupled terms rarely touch the same components.
+ *  If averageUpdates is set, every worker starts the iteration from the shared argument, updates its own copy of it,
+ *  and the copies are averaged in the fixed order at the end of the iteration.
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status SGDKernel<algorithmFPType, hogwild, cpu>::compute(HostAppIface * pHost, NumericTable * inputArgument, NumericTable * minimum,
+                                                                   NumericTable * nIterations, Parameter<hogwild> * parameter,
+                                                                   NumericTable * learningRateSequence, NumericTable * batchIndices,
+                                                                   OptionalArgument * optionalArgument, OptionalArgument * optionalResult,
+                                                                   engines::BatchBase & engine)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(SGDKernel(hogwild).compute);
+
+    services::Status s;
+    const size_t argumentSize      = inputArgument->getNumberOfRows();
+    const size_t nIter             = parameter->nIterations;
+    const size_t nInnerIter        = parameter->innerNIterations;
+    const size_t batchSize         = parameter->batchSize;
+    const double accuracyThreshold = parameter->accuracyThreshold;
+    const bool averageUpdates      = parameter->averageUpdates;
+
+    WriteRows<int, cpu> nIterationsBD(nIterations, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nIterationsBD);
+    int * nProceededIterations = nIterationsBD.get();
+    nProceededIterations[0]    = 0;
+
+    WriteRows<algorithmFPType, cpu> workValueBD(minimum, 0, argumentSize);
+    DAAL_CHECK_BLOCK_STATUS(workValueBD);
+    algorithmFPType * workValue = workValueBD.get();
+    {
+        ReadRows<algorithmFPType, cpu> startValueBD(inputArgument, 0, argumentSize);
+        DAAL_CHECK_BLOCK_STATUS(startValueBD);
+        if (workValue != startValueBD.get())
+        {
+            int result = daal::services::internal::daal_memcpy_s(workValue, argumentSize * sizeof(algorithmFPType), startValueBD.get(),
+                                                                 argumentSize * sizeof(algorithmFPType));
+            DAAL_CHECK(!result, ErrorMemoryCopyFailedInternal);
+        }
+    }
+
+    /* if nIter == 0, set result as start point, the number of executed iters to 0 */
+    if (nIter == 0) return s;
+
+    size_t startIteration             = 0;
+    NumericTable * lastIterationInput = optionalArgument ? NumericTable::cast(optionalArgument->get(iterative_solver::lastIteration)).get() : nullptr;
+    if (lastIterationInput)
+    {
+        ReadRows<int, cpu> lastIterationInputBD(lastIterationInput, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(lastIterationInputBD);
+        startIteration = lastIterationInputBD.get()[0];
+    }
+
+    ReadRows<algorithmFPType, cpu> learningRateBD(learningRateSequence, 0, learningRateSequence->getNumberOfRows());
+    DAAL_CHECK_BLOCK_STATUS(learningRateBD);
+    const algorithmFPType * learningRateArray = learningRateBD.get();
+    const size_t learningRateLength           = learningRateSequence->getNumberOfRows();
+
+    sum_of_functions::BatchPtr function = parameter->function;
+    const size_t nTerms                 = function->sumOfFunctionsParameter->numberOfTerms;
+    const size_t nWorkers               = daal::threader_get_threads_number();
+
+    /* Independent streams of random numbers for the workers */
+    engines::internal::ParallelizationTechnique technique = engines::internal::family;
+    {
+        auto engineImpl = dynamic_cast<engines::internal::BatchBaseImpl *>(parameter->engine.get());
+        DAAL_CHECK(engineImpl, ErrorEngineNotSupported);
+        const engines::internal::ParallelizationTechnique techniques[] = { engines::internal::family, engines::internal::skipahead,
+                                                                           engines::internal::leapfrog };
+        bool isSupported = false;
+        for (size_t i = 0; i < 3 && !isSupported; i++)
+        {
+            isSupported = engineImpl->hasSupport(techniques[i]);
+            technique   = techniques[i];
+        }
+        DAAL_CHECK(isSupported, ErrorEngineNotSupported);
+    }
+    /* Every worker draws batchSize indices on each inner step. The streams of a resumed computation continue
+       after the numbers consumed by the previous startIteration epochs run with the same number of workers */
+    const size_t nDrawsPerEpoch = nInnerIter * batchSize;
+    engines::internal::Params<cpu> params(nWorkers);
+    DAAL_CHECK_MALLOC(params.nSkip.get());
+    for (size_t i = 0; i < nWorkers; i++)
+    {
+        params.nSkip[i] = (startIteration * nWorkers + i * nIter) * nDrawsPerEpoch;
+    }
+    engines::EnginePtr parentEngine = parameter->engine;
+    if (startIteration && technique == engines::internal::leapfrog)
+    {
+        parentEngine = parameter->engine->clone();
+        DAAL_CHECK_MALLOC(parentEngine.get());
+        DAAL_CHECK_STATUS(s, parentEngine->skipAhead(startIteration * nWorkers * nDrawsPerEpoch));
+    }
+    TArray<engines::EnginePtr, cpu> engines(nWorkers);
+    DAAL_CHECK_MALLOC(engines.get());
+    engines::internal::EnginesCollection<cpu> enginesCollection(parentEngine, technique, params, engines, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    if (startIteration && technique == engines::internal::family)
+    {
+        /* Family streams that cannot skip ahead (e.g. mt2203) restart from their beginning on resume */
+        for (size_t i = 0; i < nWorkers; i++)
+        {
+            auto workerEngineImpl = dynamic_cast<engines::internal::BatchBaseImpl *>(engines[i].get());
+            if (workerEngineImpl && workerEngineImpl->hasSupport(engines::internal::skipahead))
+            {
+                DAAL_CHECK_STATUS(s, engines[i]->skipAhead(startIteration * nDrawsPerEpoch));
+            }
+        }
+    }
+
+    typedef SGDHogwildWorker<algorithmFPType, cpu> WorkerType;
+    services::Collection<SharedPtr<WorkerType> > workers(nWorkers);
+    for (size_t i = 0; i < nWorkers; i++)
+    {
+        workers[i].reset(new WorkerType(batchSize, argumentSize));
+        DAAL_CHECK_MALLOC(workers[i].get());
+        DAAL_CHECK_STATUS(s, workers[i]->init(function, engines[i], nTerms, workValue, averageUpdates));
+    }
+
+    const algorithmFPType workerCoeff = algorithmFPType(1.0) / algorithmFPType(nWorkers);
+
+    size_t nProceededIters = 0;
+    services::internal::HostAppHelper host(pHost, 10);
+    for (size_t epoch = startIteration; epoch < (startIteration + nIter); epoch++)
+    {
+        const algorithmFPType learningRate = learningRateArray[epoch % learningRateLength];
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(runWorkers);
+            SafeStatus safeStat;
+            daal::threader_for(nWorkers, nWorkers, [&](size_t iWorker) {
+                WorkerType & worker = *workers[iWorker];
+                if (averageUpdates)
+                {
+                    DAAL_CHECK_STATUS_THR(worker.resetArgument(workValue));
+                }
+                DAAL_CHECK_STATUS_THR(worker.run(nInnerIter, learningRate));
+            });
+            DAAL_CHECK_SAFE_STATUS();
+        }
+
+        if (averageUpdates)
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(averageUpdates);
+            services::internal::service_memset_seq<algorithmFPType, cpu>(workValue, algorithmFPType(0), argumentSize);
+            for (size_t i = 0; i < nWorkers; i++)
+            {
+                const algorithmFPType * const workerArgument = workers[i]->argument;
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < argumentSize; j++)
+                {
+                    workValue[j] += workerCoeff * workerArgument[j];
+                }
+            }
+        }
+        nProceededIters++;
+
+        DAAL_CHECK_BREAK(host.isCancelled(s, 1));
+        if (nIter > 1)
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(convergence_check);
+
+            algorithmFPType gradientNorm = algorithmFPType(0);
+            for (size_t i = 0; i < nWorkers; i++)
+            {
+                gradientNorm = daal::internal::Math<algorithmFPType, cpu>::sMax(gradientNorm, workers[i]->gradientNorm);
+            }
+            algorithmFPType pointNorm;
+            DAAL_CHECK_STATUS(s, vectorNorm(workValue, argumentSize, pointNorm));
+            const algorithmFPType gradientThreshold = accuracyThreshold * daal::internal::Math<algorithmFPType, cpu>::sMax(1.0, pointNorm);
+            DAAL_CHECK_BREAK(gradientNorm < gradientThreshold);
+        }
+    }
+    DAAL_CHECK(nProceededIters <= services::internal::MaxVal<int>::get(), ErrorIterativeSolverIncorrectMaxNumberOfIterations)
+    nProceededIterations[0] = (int)nProceededIters;
+
+    NumericTable * lastIterationResult = optionalResult ? NumericTable::cast(optionalResult->get(iterative_solver::lastIteration)).get() : nullptr;
+    if (lastIterationResult)
+    {
+        WriteRows<int, cpu> lastIterationResultBD(lastIterationResult, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(lastIterationResultBD);
+        lastIterationResultBD.get()[0] = (int)(startIteration + nProceededIters);
+    }
+    return s;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+SGDHogwildWorker<algorithmFPType, cpu>::SGDHogwildWorker(size_t batchSize_, size_t argumentSize_)
+    : batchSize(batchSize_), argumentSize(argumentSize_), argument(nullptr), gradientNorm(0), rngTask(nullptr, batchSize_)
+{}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status SGDHogwildWorker<algorithmFPType, cpu>::init(const sum_of_functions::BatchPtr & objectiveFunction,
+                                                              const engines::EnginePtr & workerEngine, size_t nTerms,
+                                                              algorithmFPType * sharedArgument, bool isOwnArgument)
+{
+    services::Status s;
+    argument = sharedArgument;
+    if (isOwnArgument)
+    {
+        ownArgument.reset(argumentSize);
+        DAAL_CHECK_MALLOC(ownArgument.get());
+        argument = ownArgument.get();
+    }
+    ntArgument = HomogenNumericTableCPU<algorithmFPType, cpu>::create(argument, 1, argumentSize, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    function = objectiveFunction->clone();
+    DAAL_CHECK_MALLOC(function.get());
+    function->enableChecks(false);
+    function->sumOfFunctionsInput->set(sum_of_functions::argument, ntArgument);
+    function->sumOfFunctionsParameter->resultsToCompute = objective_function::gradient;
+    function->sumOfFunctionsParameter->batchIndices     = NumericTablePtr();
+
+    if (batchSize < nTerms)
+    {
+        engine = workerEngine;
+        DAAL_CHECK(engine.get() && rngTask.init(nTerms, *engine), ErrorEngineNotSupported);
+        ntBatchIndices = HomogenNumericTableCPU<int, cpu>::create(1, batchSize, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        function->sumOfFunctionsParameter->batchIndices = ntBatchIndices;
+    }
+    return s;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status SGDHogwildWorker<algorithmFPType, cpu>::resetArgument(const algorithmFPType * sharedArgument)
+{
+    int result = daal::services::internal::daal_memcpy_s(argument, argumentSize * sizeof(algorithmFPType), sharedArgument,
+                                                         argumentSize * sizeof(algorithmFPType));
+    return (!result) ? services::Status() : services::Status(ErrorMemoryCopyFailedInternal);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status SGDHogwildWorker<algorithmFPType, cpu>::run(size_t nSteps, algorithmFPType learningRate)
+{
+    services::Status s;
+    for (size_t step = 0; step < nSteps; step++)
+    {
+        if (ntBatchIndices)
+        {
+            const int * pValues = nullptr;
+            DAAL_CHECK_STATUS(s, rngTask.get(pValues));
+            ntBatchIndices->setArray(const_cast<int *>(pValues), batchSize);
+        }
+        DAAL_CHECK_STATUS(s, function->computeNoThrow());
+
+        NumericTable * ntGradient = function->getResult()->get(objective_function::gradientIdx).get();
+        DAAL_CHECK(ntGradient, ErrorNullNumericTable);
+        ReadRows<algorithmFPType, cpu> gradientBD(ntGradient, 0, argumentSize);
+        DAAL_CHECK_BLOCK_STATUS(gradientBD);
+        const algorithmFPType * const gradient = gradientBD.get();
+
+        /* Lock-free update: the other workers may read or write the same components at the same time */
+        algorithmFPType sumSq = algorithmFPType(0);
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < argumentSize; j++)
+        {
+            argument[j] -= learningRate * gradient[j];
+            sumSq += gradient[j] * gradient[j];
+        }
+        gradientNorm = daal::internal::Math<algorithmFPType, cpu>::sSqrt(sumSq);
+    }
+    return s;
+}
+
+} // namespace internal
+} // namespace sgd
+} // namespace optimization_solver
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,99 @@
+/* file: sgd_dense_hogwild_kernel.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+//++
+//  Declaration of template function that calculate sgd hogwild.
+//--
+
+#ifndef __SGD_DENSE_HOGWILD_KERNEL_H__
+#define __SGD_DENSE_HOGWILD_KERNEL_H__
+
+#include "algorithms/optimization_solver/sgd/sgd_batch.h"
+#include "src/algorithms/kernel.h"
+#include "data_management/data/numeric_table.h"
+#include "src/algorithms/optimization_solver/iterative_solver_kernel.h"
+#include "src/algorithms/optimization_solver/sgd/sgd_dense_kernel.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/externals/service_math.h"
+#include "src/services/service_utils.h"
+
+using namespace daal::data_management;
+using namespace daal::internal;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace sgd
+{
+namespace internal
+{
+template <typename algorithmFPType, CpuType cpu>
+class SGDKernel<algorithmFPType, hogwild, cpu> : public iterative_solver::internal::IterativeSolverKernel<algorithmFPType, cpu>
+{
+public:
+    services::Status compute(HostAppIface * pHost, NumericTable * inputArgument, NumericTable * minimum, NumericTable * nIterations,
+                             Parameter<hogwild> * parameter, NumericTable * learningRateSequence, NumericTable * batchIndices,
+                             OptionalArgument * optionalArgument, OptionalArgument * optionalResult, engines::BatchBase & engine);
+    using iterative_solver::internal::IterativeSolverKernel<algorithmFPType, cpu>::vectorNorm;
+};
+
+/**
+ *  State of one worker of the hogwild method: own copy of the objective function, own stream of random numbers
+ *  and own buffer of mini-batch indices. The argument is either shared by all the workers or owned by the worker
+ */
+template <typename algorithmFPType, CpuType cpu>
+struct SGDHogwildWorker
+{
+    SGDHogwildWorker(size_t batchSize_, size_t argumentSize_);
+
+    services::Status init(const sum_of_functions::BatchPtr & objectiveFunction, const engines::EnginePtr & workerEngine, size_t nTerms,
+                          algorithmFPType * sharedArgument, bool ownArgument);
+
+    /* Copies the shared argument into the own argument of the worker */
+    services::Status resetArgument(const algorithmFPType * sharedArgument);
+
+    /* Performs nSteps of the stochastic gradient descent on the independently drawn mini-batches */
+    services::Status run(size_t nSteps, algorithmFPType learningRate);
+
+    size_t batchSize;
+    size_t argumentSize;
+    algorithmFPType * argument;
+    algorithmFPType gradientNorm;
+
+    sum_of_functions::BatchPtr function;
+    engines::EnginePtr engine;
+    iterative_solver::internal::RngTask<int, cpu> rngTask;
+    TArray<algorithmFPType, cpu> ownArgument;
+    SharedPtr<daal::internal::HomogenNumericTableCPU<int, cpu> > ntBatchIndices;
+    NumericTablePtr ntArgument;
+};
+
+} // namespace internal
+
+} // namespace sgd
+
+} // namespace optimization_solver
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
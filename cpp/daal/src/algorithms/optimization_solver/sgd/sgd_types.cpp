@@ -143,6 +143,28 @@ services::Status Parameter<momentum>::check() const
     return s;
 }
 
+Parameter<hogwild>::Parameter(const sum_of_functions::BatchPtr & function, size_t nIterations, double accuracyThreshold, size_t batchSize,
+                              size_t innerNIterations, bool averageUpdates, NumericTablePtr learningRateSequence, size_t seed)
+    : BaseParameter(function, nIterations, accuracyThreshold, NumericTablePtr(), learningRateSequence, batchSize, seed),
+      innerNIterations(innerNIterations),
+      averageUpdates(averageUpdates)
+{}
+
+/**
+ * Checks the correctness of the parameter
+ */
+services::Status Parameter<hogwild>::check() const
+{
+    services::Status s = BaseParameter::check();
+    if (!s) return s;
+
+    /* Every thread draws its own mini-batches, so the predefined indices are not supported */
+    DAAL_CHECK_EX(batchIndices.get() == NULL, ErrorIncorrectParameter, ArgumentName, batchIndicesStr());
+    DAAL_CHECK_EX(innerNIterations > 0, ErrorIncorrectParameter, ArgumentName, "innerNIterations");
+    DAAL_CHECK_EX(batchSize <= function->sumOfFunctionsParameter->numberOfTerms && batchSize > 0, ErrorIncorrectParameter, ArgumentName, "batchSize");
+    return s;
+}
+
 Input::Input() {}
 Input::Input(const Input & other) {}
 
@@ -86,6 +86,55 @@ Status BatchContainer<algorithmFPType, svdDense, cpu>::compute()
                        parameter, *eigenvalues, *eigenvectors, *means, *variances);
 }
 
+template <typename algorithmFPType, CpuType cpu>
+BatchContainer<algorithmFPType, randomizedDense, cpu>::BatchContainer(daal::services::Environment::env * daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::PCASVDBatchKernel, algorithmFPType, interface3::BatchParameter<algorithmFPType, pca::randomizedDense>);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+BatchContainer<algorithmFPType, randomizedDense, cpu>::~BatchContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status BatchContainer<algorithmFPType, randomizedDense, cpu>::compute()
+{
+    Input * input   = static_cast<Input *>(_in);
+    Result * result = static_cast<Result *>(_res);
+    interface3::BatchParameter<algorithmFPType, pca::randomizedDense> * parameter =
+        static_cast<interface3::BatchParameter<algorithmFPType, pca::randomizedDense> *>(_par);
+
+    internal::InputDataType dtype = getInputDataType(input);
+
+    data_management::NumericTablePtr data         = input->get(pca::data);
+    data_management::NumericTablePtr eigenvalues  = result->get(pca::eigenvalues);
+    data_management::NumericTablePtr eigenvectors = result->get(pca::eigenvectors);
+    data_management::NumericTablePtr means        = result->get(pca::means);
+    data_management::NumericTablePtr variances    = result->get(pca::variances);
+
+    auto normalizationAlgorithm = parameter->normalization;
+    normalizationAlgorithm->input.set(normalization::zscore::data, data);
+
+    auto algParameter = &(normalizationAlgorithm->parameter());
+    if (parameter->resultsToCompute & mean)
+    {
+        algParameter->resultsToCompute |= normalization::zscore::mean;
+    }
+
+    if (parameter->resultsToCompute & variance)
+    {
+        algParameter->resultsToCompute |= normalization::zscore::variance;
+    }
+
+    daal::services::Environment::env & env = *_env;
+
+    __DAAL_CALL_KERNEL(env, internal::PCASVDBatchKernel,
+                       __DAAL_KERNEL_ARGUMENTS(algorithmFPType, interface3::BatchParameter<algorithmFPType, pca::randomizedDense>), compute, dtype,
+                       *data, parameter, *eigenvalues, *eigenvectors, *means, *variances);
+}
+
 } // namespace interface3
 } // namespace pca
 } // namespace algorithms
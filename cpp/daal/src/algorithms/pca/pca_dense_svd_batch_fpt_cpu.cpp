@@ -31,6 +31,7 @@ namespace pca
 namespace interface3
 {
 template class BatchContainer<DAAL_FPTYPE, svdDense, DAAL_CPU>;
+template class BatchContainer<DAAL_FPTYPE, randomizedDense, DAAL_CPU>;
 }
 } // namespace pca
 } // namespace algorithms
@@ -57,7 +57,7 @@ services::Status PCASVDBatchKernel<algorithmFPType, ParameterType, cpu>::compute
         if (!s) return s;
     }
 
-    Status s = decompose(normalizedData.get(), eigenvalues, eigenvectors);
+    Status s = decompose(normalizedData.get(), eigenvalues, eigenvectors, nullptr);
     if (s) s = this->scaleSingularValues(eigenvalues, data->getNumberOfRows());
     return s;
 }
@@ -101,7 +101,7 @@ services::Status PCASVDBatchKernel<algorithmFPType, ParameterType, cpu>::compute
         }
     }
 
-    DAAL_CHECK_STATUS(status, this->decompose(normalizedData, eigenvalues, eigenvectors));
+    DAAL_CHECK_STATUS(status, this->decompose(normalizedData, eigenvalues, eigenvectors, parameter));
     DAAL_CHECK_STATUS(status, this->scaleSingularValues(eigenvalues, data.getNumberOfRows()));
     if (parameter->isDeterministic)
     {
@@ -282,18 +282,48 @@ services::Status PCASVDBatchKernel<algorithmFPType, ParameterType, cpu>::normali
     return services::Status();
 }
 
+/* Decomposes the normalized data set with the SVD method that matches the parameters of the PCA algorithm */
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+struct PCASVDDecomposition
+{
+    static services::Status compute(const NumericTable * const * svdInputs, NumericTable ** svdResults, const ParameterType * parameter)
+    {
+        svd::Parameter params;
+        params.leftSingularMatrix = svd::notRequired;
+        daal::algorithms::svd::internal::SVDBatchKernel<algorithmFPType, svd::defaultDense, cpu> svdKernel;
+        return svdKernel.compute(1, svdInputs, 3, svdResults, &params);
+    }
+};
+
+template <typename algorithmFPType, CpuType cpu>
+struct PCASVDDecomposition<algorithmFPType, interface3::BatchParameter<algorithmFPType, randomizedDense>, cpu>
+{
+    static services::Status compute(const NumericTable * const * svdInputs, NumericTable ** svdResults,
+                                    const interface3::BatchParameter<algorithmFPType, randomizedDense> * parameter)
+    {
+        svd::RandomizedParameter params;
+        params.leftSingularMatrix = svd::notRequired;
+        if (parameter)
+        {
+            params.nOversamples     = parameter->nOversamples;
+            params.nPowerIterations = parameter->nPowerIterations;
+            params.engine           = parameter->engine;
+        }
+        daal::algorithms::svd::internal::SVDBatchKernel<algorithmFPType, svd::randomizedDense, cpu> svdKernel;
+        return svdKernel.compute(1, svdInputs, 3, svdResults, &params);
+    }
+};
+
 template <typename algorithmFPType, typename ParameterType, CpuType cpu>
 services::Status PCASVDBatchKernel<algorithmFPType, ParameterType, cpu>::decompose(const NumericTable * normalizedDataTable,
                                                                                    data_management::NumericTable & eigenvalues,
-                                                                                   data_management::NumericTable & eigenvectors)
+                                                                                   data_management::NumericTable & eigenvectors,
+                                                                                   const ParameterType * parameter)
 {
     const NumericTable * const * svdInputs = &normalizedDataTable;
 
     NumericTable * svdResults[3] = { &eigenvalues, nullptr, &eigenvectors };
-    svd::Parameter params;
-    params.leftSingularMatrix = svd::notRequired;
-    daal::algorithms::svd::internal::SVDBatchKernel<algorithmFPType, svd::defaultDense, cpu> svdKernel;
-    return svdKernel.compute(1, svdInputs, 3, svdResults, &params);
+    return PCASVDDecomposition<algorithmFPType, ParameterType, cpu>::compute(svdInputs, svdResults, parameter);
 }
 
 } // namespace internal
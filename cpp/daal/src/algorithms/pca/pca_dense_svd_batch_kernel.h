@@ -55,7 +55,7 @@ protected:
     services::Status normalizeDataset(const data_management::NumericTablePtr & data, data_management::NumericTablePtr & normalizedData);
 
     services::Status decompose(const NumericTable * normalizedDataTable, data_management::NumericTable & eigenvalues,
-                               data_management::NumericTable & eigenvectors);
+                               data_management::NumericTable & eigenvectors, const ParameterType * parameter);
 };
 
 } // namespace internal
@@ -37,6 +37,8 @@ template class DAAL_EXPORT PCASVDBatchKernel<DAAL_FPTYPE, interface2::BatchParam
 
 template class DAAL_EXPORT PCASVDBatchKernel<DAAL_FPTYPE, interface3::BatchParameter<DAAL_FPTYPE, pca::svdDense>, DAAL_CPU>;
 
+template class DAAL_EXPORT PCASVDBatchKernel<DAAL_FPTYPE, interface3::BatchParameter<DAAL_FPTYPE, pca::randomizedDense>, DAAL_CPU>;
+
 } // namespace internal
 } // namespace pca
 } // namespace algorithms
@@ -22,6 +22,7 @@
 */
 
 #include "algorithms/quantiles/quantiles_types.h"
+#include "src/algorithms/quantiles/quantiles_sketch.h"
 #include "src/services/serialization_utils.h"
 #include "src/services/daal_strings.h"
 
@@ -37,7 +38,8 @@ namespace quantiles
 namespace interface1
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_QUANTILES_RESULT_ID);
-Parameter::Parameter(const NumericTablePtr quantileOrders) : daal::algorithms::Parameter(), quantileOrders(quantileOrders)
+Parameter::Parameter(const NumericTablePtr quantileOrders, size_t sketchSize)
+    : daal::algorithms::Parameter(), quantileOrders(quantileOrders), sketchSize(sketchSize)
 {
     Status s;
     if (quantileOrders.get() == NULL)
@@ -47,8 +49,27 @@ Parameter::Parameter(const NumericTablePtr quantileOrders) : daal::algorithms::P
     }
 }
 
-Input::Input() : daal::algorithms::Input(lastInputId + 1) {}
-Input::Input(const Input & other) : daal::algorithms::Input(other) {}
+Status Parameter::check() const
+{
+    DAAL_CHECK_EX(sketchSize > 1 && sketchSize <= internal::sketchMaxSize, ErrorIncorrectParameter, ParameterName, sketchSizeStr());
+    return Status();
+}
+
+Input::Input() : InputIface(lastInputId + 1) {}
+Input::Input(const Input & other) : InputIface(other) {}
+
+/**
+ * Returns the number of columns in the input data set
+ * \param[out] nCols Number of columns in the input data set
+ * \return Status of the call
+ */
+Status Input::getNumberOfColumns(size_t & nCols) const
+{
+    NumericTablePtr dataTable = get(data);
+    Status s                  = checkNumericTable(dataTable.get(), dataStr());
+    nCols                     = s ? dataTable->getNumberOfColumns() : 0;
+    return s;
+}
 
 /**
  * Returns an input object for the quantiles algorithm
@@ -115,13 +136,31 @@ void Result::set(ResultId id, const NumericTablePtr & value)
  */
 Status Result::check(const daal::algorithms::Input * in, const daal::algorithms::Parameter * par, int method) const
 {
-    const Input * input         = static_cast<const Input *>(in);
+    const Input * input = static_cast<const Input *>(in);
+    return checkImpl(input->get(data)->getNumberOfColumns(), par);
+}
+
+/**
+ * Checks the correctness of the Result object in the online or distributed processing mode
+ * \param[in] partialResult Pointer to the partial results
+ * \param[in] par           Pointer to the parameters structure
+ * \param[in] method        Algorithm computation method
+ */
+Status Result::check(const daal::algorithms::PartialResult * partialResult, const daal::algorithms::Parameter * par, int method) const
+{
+    size_t nFeatures = 0;
+    Status s         = static_cast<const PartialResult *>(partialResult)->getNumberOfColumns(nFeatures);
+    if (!s) return s;
+    return checkImpl(nFeatures, par);
+}
+
+Status Result::checkImpl(size_t nVectors, const daal::algorithms::Parameter * par) const
+{
     const Parameter * parameter = static_cast<const Parameter *>(par);
 
     Status s = checkNumericTable(parameter->quantileOrders.get(), quantileOrdersStr(), 0, 0, 0, 1);
     if (!s) return s;
 
-    size_t nVectors  = input->get(data)->getNumberOfColumns();
     size_t nFeatures = parameter->quantileOrders->getNumberOfColumns();
 
     int unexpectedLayouts = (int)NumericTableIface::csrArray | (int)NumericTableIface::upperPackedTriangularMatrix
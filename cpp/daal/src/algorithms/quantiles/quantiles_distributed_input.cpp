@@ -0,0 +1,131 @@
+/* file: quantiles_distributed_input.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the input of the quantiles algorithm on the master node.
+//--
+*/
+
+#include "algorithms/quantiles/quantiles_types.h"
+#include "src/services/daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace interface1
+{
+template <>
+DistributedInput<step2Master>::DistributedInput() : InputIface(lastMasterInputId + 1)
+{
+    Argument::set(partialResults, DataCollectionPtr(new DataCollection()));
+}
+
+template <>
+DistributedInput<step2Master>::DistributedInput(const DistributedInput<step2Master> & other) : InputIface(other)
+{}
+
+/**
+ * Sets input object for the quantiles algorithm in the distributed processing mode
+ * \param[in] id  Identifier of the input object
+ * \param[in] ptr Pointer to the input object
+ */
+template <>
+void DistributedInput<step2Master>::set(MasterInputId id, const DataCollectionPtr & ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Returns the collection of input objects
+ * \param[in] id   Identifier of the input object, \ref MasterInputId
+ * \return Collection of distributed input objects
+ */
+template <>
+DataCollectionPtr DistributedInput<step2Master>::get(MasterInputId id) const
+{
+    return staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Returns the number of columns in the input data set
+ * \param[out] nCols Number of columns in the input data set
+ * \return Status of the call
+ */
+template <>
+Status DistributedInput<step2Master>::getNumberOfColumns(size_t & nCols) const
+{
+    DataCollectionPtr collectionOfPartialResults = get(partialResults);
+
+    DAAL_CHECK(collectionOfPartialResults, ErrorNullInputDataCollection);
+    DAAL_CHECK(collectionOfPartialResults->size(), ErrorIncorrectNumberOfInputNumericTables);
+
+    PartialResultPtr partialResult = PartialResult::cast((*collectionOfPartialResults)[0]);
+    DAAL_CHECK(partialResult.get(), ErrorIncorrectElementInPartialResultCollection);
+
+    return partialResult->getNumberOfColumns(nCols);
+}
+
+/**
+ * Adds partial result to the collection of input objects for the quantiles algorithm in the distributed processing mode
+ * \param[in] id            Identifier of the input object
+ * \param[in] partialResult Partial result obtained in the first step of the distributed algorithm
+ */
+template <>
+void DistributedInput<step2Master>::add(MasterInputId id, const PartialResultPtr & partialResult)
+{
+    DataCollectionPtr collection = get(id);
+    collection->push_back(staticPointerCast<SerializationIface, PartialResult>(partialResult));
+}
+
+/**
+ * Checks the partial results on the master node
+ * \param[in] parameter Pointer to the algorithm parameters
+ * \param[in] method    Computation method
+ */
+template <>
+Status DistributedInput<step2Master>::check(const daal::algorithms::Parameter * parameter, int method) const
+{
+    Status s;
+    DataCollectionPtr collectionPtr = get(partialResults);
+    DAAL_CHECK(collectionPtr, ErrorNullInputDataCollection);
+    const size_t nBlocks = collectionPtr->size();
+    DAAL_CHECK(nBlocks != 0, ErrorIncorrectNumberOfInputNumericTables);
+
+    size_t nFeatures = 0;
+    DAAL_CHECK_STATUS(s, getNumberOfColumns(nFeatures));
+
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        PartialResultPtr partialResult = PartialResult::cast((*collectionPtr)[i]);
+        DAAL_CHECK(partialResult.get() != 0, ErrorIncorrectElementInPartialResultCollection);
+        DAAL_CHECK_STATUS(s, partialResult->check(this, parameter, method));
+        DAAL_CHECK_STATUS(s, partialResult->check(parameter, method));
+    }
+    return s;
+}
+
+} // namespace interface1
+} // namespace quantiles
+} // namespace algorithms
+} // namespace daal
@@ -22,6 +22,8 @@
 */
 
 #include "algorithms/quantiles/quantiles_types.h"
+#include "src/algorithms/quantiles/quantiles_sketch.h"
+#include "src/data_management/service_numeric_table.h"
 
 namespace daal
 {
@@ -52,8 +54,93 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input * in
     return s;
 }
 
+/**
+ * Allocates memory to store final results of the quantile algorithms in the online or distributed processing mode
+ * \param[in] partialResult Partial results of the quantiles algorithm
+ * \param[in] parameter     Parameters of the quantiles algorithm
+ * \param[in] method        Algorithm computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::PartialResult * partialResult, const daal::algorithms::Parameter * parameter,
+                                              const int method)
+{
+    services::Status s;
+    const Parameter * par = static_cast<const Parameter *>(parameter);
+
+    size_t nFeatures = 0;
+    DAAL_CHECK_STATUS(s, static_cast<const PartialResult *>(partialResult)->getNumberOfColumns(nFeatures));
+    size_t nQuantileOrders = par->quantileOrders->getNumberOfColumns();
+
+    set(quantiles,
+        data_management::HomogenNumericTable<algorithmFPType>::create(nQuantileOrders, nFeatures, data_management::NumericTable::doAllocate, &s));
+    return s;
+}
+
+/**
+ * Allocates memory to store partial results of the quantiles algorithm
+ * \param[in] input     Pointer to the structure with input objects
+ * \param[in] parameter Pointer to the structure of algorithm parameters
+ * \param[in] method    Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter,
+                                                     const int method)
+{
+    services::Status s;
+    const Parameter * par = static_cast<const Parameter *>(parameter);
+
+    size_t nFeatures = 0;
+    DAAL_CHECK_STATUS(s, static_cast<const InputIface *>(input)->getNumberOfColumns(nFeatures));
+
+    set(sketchItems, data_management::HomogenNumericTable<algorithmFPType>::create(internal::sketchItemsWidth(par->sketchSize), nFeatures,
+                                                                                   data_management::NumericTable::doAllocate, &s));
+    DAAL_CHECK_STATUS_VAR(s);
+    set(sketchLevels,
+        data_management::HomogenNumericTable<int>::create(internal::sketchLevelsWidth, nFeatures, data_management::NumericTable::doAllocate, &s));
+    return s;
+}
+
+/**
+ * Initializes partial results of the quantiles algorithm with the empty sketches
+ * \param[in] input     Pointer to the structure with input objects
+ * \param[in] parameter Pointer to the structure of algorithm parameters
+ * \param[in] method    Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::initialize(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter,
+                                                       const int method)
+{
+    services::Status s;
+    data_management::NumericTable * itemsTable = get(sketchItems).get();
+    DAAL_CHECK_STATUS(s, itemsTable->assign((algorithmFPType)0.0));
+
+    const size_t nFeatures                      = itemsTable->getNumberOfRows();
+    const int nItems                            = (int)itemsTable->getNumberOfColumns();
+    data_management::NumericTable * levelsTable = get(sketchLevels).get();
+    DAAL_CHECK_STATUS(s, levelsTable->assign(0));
+
+    /* Every sketch has one empty level at the end of the row of items */
+    daal::internal::WriteRows<int, sse2> levelsBlock(levelsTable, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(levelsBlock);
+    int * const levels = levelsBlock.get();
+    for (size_t i = 0; i < nFeatures; i++)
+    {
+        int * const row                     = levels + i * internal::sketchLevelsWidth;
+        row[0]                              = 1;
+        row[internal::sketchOffsetsPos]     = nItems;
+        row[internal::sketchOffsetsPos + 1] = nItems;
+    }
+    return s;
+}
+
 template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par,
                                                                     const int method);
+template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::PartialResult * partialResult,
+                                                                    const daal::algorithms::Parameter * par, const int method);
+template DAAL_EXPORT services::Status PartialResult::allocate<DAAL_FPTYPE>(const daal::algorithms::Input * input,
+                                                                           const daal::algorithms::Parameter * par, const int method);
+template DAAL_EXPORT services::Status PartialResult::initialize<DAAL_FPTYPE>(const daal::algorithms::Input * input,
+                                                                             const daal::algorithms::Parameter * par, const int method);
 
 } // namespace interface1
 } // namespace quantiles
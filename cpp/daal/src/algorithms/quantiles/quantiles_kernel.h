@@ -26,6 +26,7 @@
 
 #include "data_management/data/numeric_table.h"
 #include "algorithms/quantiles/quantiles_batch.h"
+#include "algorithms/quantiles/quantiles_distributed.h"
 
 #include "src/services/service_defines.h"
 #include "src/data_management/service_micro_table.h"
@@ -47,6 +48,27 @@ struct QuantilesKernel : public Kernel
     services::Status compute(const NumericTable & dataTable, const NumericTable & quantileOrdersTable, NumericTable & quantilesTable);
 };
 
+/* Approximate quantiles computed from the mergeable KLL sketches of the features */
+template <typename algorithmFPType, CpuType cpu>
+struct QuantilesKernel<sketchDense, algorithmFPType, cpu> : public Kernel
+{
+    virtual ~QuantilesKernel() {}
+
+    /* Batch processing: builds the temporary sketches of the data and computes the quantiles from them */
+    services::Status compute(const NumericTable & dataTable, const NumericTable & quantileOrdersTable, NumericTable & quantilesTable,
+                             const Parameter & par);
+
+    /* Online processing and the first step of distributed processing: adds the observations to the sketches */
+    services::Status computeOnline(const NumericTable & dataTable, NumericTable & sketchItemsTable, NumericTable & sketchLevelsTable,
+                                   const Parameter & par);
+
+    /* Second step of distributed processing: merges the sketches computed on local nodes */
+    services::Status merge(DataCollection & partialResults, NumericTable & sketchItemsTable, NumericTable & sketchLevelsTable, const Parameter & par);
+
+    services::Status finalizeCompute(const NumericTable & sketchItemsTable, const NumericTable & sketchLevelsTable,
+                                     const NumericTable & quantileOrdersTable, NumericTable & quantilesTable);
+};
+
 } // namespace internal
 
 } // namespace quantiles
@@ -0,0 +1,100 @@
+/* file: quantiles_sketch.h */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Layout of the KLL sketches used by the sketchDense method of the quantiles algorithm.
+//--
+*/
+
+#ifndef __QUANTILES_SKETCH_H__
+#define __QUANTILES_SKETCH_H__
+
+#include "services/daal_defines.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace internal
+{
+/*
+ * The sketch of one feature consists of a row of items and a row of integers:
+ *  - items are stored at the end of the row, the level h occupies [offsets[h], offsets[h + 1]),
+ *    the free space is [0, offsets[0]), an item of the level h represents 2^h observations
+ *  - integers are the number of levels, then sketchMaxLevels + 1 offsets of the levels,
+ *    then sketchMaxLevels offsets (0 or 1) of the next compactions of the levels
+ */
+const size_t sketchMaxLevels   = 48;
+const size_t sketchMaxSize     = size_t(1) << 20;
+const size_t sketchOffsetsPos  = 1;
+const size_t sketchParitiesPos = sketchOffsetsPos + sketchMaxLevels + 1;
+const size_t sketchLevelsWidth = sketchParitiesPos + sketchMaxLevels;
+
+/* Capacity of the level that lies depth levels below the top one: sketchSize * (2/3)^depth, but not less than 2 */
+inline size_t sketchLevelCapacity(size_t sketchSize, size_t depth)
+{
+    size_t capacity = sketchSize;
+    for (size_t i = 0; i < depth && capacity > 2; i++)
+    {
+        capacity = (2 * capacity + 2) / 3;
+    }
+    return (capacity < 2) ? 2 : capacity;
+}
+
+/* Total capacity of the sketch that consists of nLevels levels */
+inline size_t sketchCapacity(size_t sketchSize, size_t nLevels)
+{
+    size_t capacity = 0;
+    for (size_t depth = 0; depth < nLevels; depth++)
+    {
+        capacity += sketchLevelCapacity(sketchSize, depth);
+    }
+    return capacity;
+}
+
+/* Number of items in the row of the sketch, enough for any sketch with up to sketchMaxLevels levels */
+inline size_t sketchItemsWidth(size_t sketchSize)
+{
+    return sketchCapacity(sketchSize, sketchMaxLevels);
+}
+
+/* Checks that the layout describes levels within the row of nItems items, e.g. after the deserialization */
+inline bool isSketchLayoutValid(const int * layout, size_t nItems)
+{
+    const int nLevels = layout[0];
+    if (nLevels < 1 || size_t(nLevels) > sketchMaxLevels || layout[sketchOffsetsPos] < 0) return false;
+    for (int level = 0; level < nLevels; level++)
+    {
+        if (layout[sketchOffsetsPos + level] > layout[sketchOffsetsPos + level + 1]) return false;
+    }
+    for (size_t level = 0; level < sketchMaxLevels; level++)
+    {
+        const int parity = layout[sketchParitiesPos + level];
+        if (parity != 0 && parity != 1) return false;
+    }
+    return size_t(layout[sketchOffsetsPos + nLevels]) <= nItems;
+}
+
+} // namespace internal
+} // namespace quantiles
+} // namespace algorithms
+} // namespace daal
+
+#endif
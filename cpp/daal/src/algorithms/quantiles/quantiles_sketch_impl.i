@@ -0,0 +1,534 @@
+/* file: quantiles_sketch_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the sketchDense method of the quantiles algorithm: every feature is summarized
+//  by the KLL sketch (Karnin, Lang, Liberty, "Optimal Quantile Approximation in Streams", 2016).
+//  Sketches of the same size are mergeable, which gives the online and distributed processing modes.
+//--
+*/
+
+#ifndef __QUANTILES_SKETCH_IMPL_I__
+#define __QUANTILES_SKETCH_IMPL_I__
+
+#include "src/algorithms/quantiles/quantiles_kernel.h"
+#include "src/algorithms/quantiles/quantiles_sketch.h"
+#include "src/algorithms/service_error_handling.h"
+#include "src/algorithms/service_sort.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/externals/service_memory.h"
+#include "src/services/service_unique_ptr.h"
+#include "src/threading/threading.h"
+
+using namespace daal::internal;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace internal
+{
+const size_t sketchBlockSize = 4096;
+
+/* Item of the sketch together with the number of observations it represents */
+template <typename algorithmFPType>
+struct SketchWeightedItem
+{
+    algorithmFPType value;
+    DAAL_UINT64 weight;
+};
+
+/*
+ * View of the sketch of one feature over a row of items and a row of its layout, see quantiles_sketch.h.
+ * The size of the sketch is kept within sketchCapacity(sketchSize, nLevels) by the compactions:
+ * a compaction sorts a level and promotes every other item of it to the next level,
+ * the offset of the promoted items alternates between the compactions of the same level
+ */
+template <typename algorithmFPType, CpuType cpu>
+class KllSketch
+{
+public:
+    KllSketch(algorithmFPType * items, int * layout, size_t sketchSize) : _items(items), _layout(layout), _sketchSize(sketchSize) {}
+
+    static void initialize(int * layout, size_t nItems)
+    {
+        services::internal::service_memset_seq<int, cpu>(layout, 0, sketchLevelsWidth);
+        layout[0]                    = 1;
+        layout[sketchOffsetsPos]     = int(nItems);
+        layout[sketchOffsetsPos + 1] = int(nItems);
+    }
+
+    size_t nLevels() const { return size_t(_layout[0]); }
+    size_t offset(size_t level) const { return size_t(_layout[sketchOffsetsPos + level]); }
+    size_t levelSize(size_t level) const { return offset(level + 1) - offset(level); }
+    size_t nItems() const { return offset(nLevels()) - offset(0); }
+    size_t capacity() const { return sketchCapacity(_sketchSize, nLevels()); }
+
+    /* Adds n observations placed with the given stride */
+    services::Status insert(const algorithmFPType * x, size_t n, size_t stride)
+    {
+        services::Status s;
+        while (n > 0)
+        {
+            if (nItems() >= capacity())
+            {
+                DAAL_CHECK_STATUS(s, compress());
+                continue;
+            }
+            const size_t nFree     = capacity() - nItems();
+            const size_t nInserted = (n < nFree) ? n : nFree;
+            const size_t first     = offset(0) - nInserted;
+            for (size_t i = 0; i < nInserted; i++)
+            {
+                _items[first + i] = x[i * stride];
+            }
+            _layout[sketchOffsetsPos] = int(first);
+            x += nInserted * stride;
+            n -= nInserted;
+        }
+        return s;
+    }
+
+    /* Adds the items of the other sketch, the buffer should hold nItems() + other.nItems() items */
+    services::Status merge(const KllSketch & other, algorithmFPType * buffer)
+    {
+        services::Status s;
+        const size_t nLevelsMerged = (nLevels() > other.nLevels()) ? nLevels() : other.nLevels();
+        const size_t bufferEnd     = nItems() + other.nItems();
+
+        int layout[sketchLevelsWidth];
+        initialize(layout, bufferEnd);
+        layout[0] = int(nLevelsMerged);
+        for (size_t level = 0; level < sketchMaxLevels; level++)
+        {
+            layout[sketchParitiesPos + level] = _layout[sketchParitiesPos + level];
+        }
+
+        size_t end = bufferEnd;
+        for (size_t level = nLevelsMerged; level-- > 0;)
+        {
+            layout[sketchOffsetsPos + level + 1] = int(end);
+            if (level < other.nLevels())
+            {
+                const size_t size = other.levelSize(level);
+                copyItems(buffer + end - size, other._items + other.offset(level), size);
+                end -= size;
+            }
+            if (level < nLevels())
+            {
+                const size_t size = levelSize(level);
+                copyItems(buffer + end - size, _items + offset(level), size);
+                end -= size;
+            }
+        }
+        layout[sketchOffsetsPos] = int(end);
+
+        KllSketch merged(buffer, layout, _sketchSize);
+        while (merged.nItems() > merged.capacity())
+        {
+            DAAL_CHECK_STATUS(s, merged.compress());
+        }
+
+        /* The compacted sketch fits into the row of items, see sketchItemsWidth() */
+        const size_t rowEnd = offset(nLevels());
+        _layout[0]          = layout[0];
+        for (size_t level = 0; level <= merged.nLevels(); level++)
+        {
+            _layout[sketchOffsetsPos + level] = int(rowEnd - (bufferEnd - merged.offset(level)));
+        }
+        for (size_t level = 0; level < sketchMaxLevels; level++)
+        {
+            _layout[sketchParitiesPos + level] = layout[sketchParitiesPos + level];
+        }
+        copyItems(_items + offset(0), buffer + merged.offset(0), merged.nItems());
+        return s;
+    }
+
+    /* Collects the items with their weights sorted by value, the weights are replaced by the cumulative ones */
+    DAAL_UINT64 sortedItems(SketchWeightedItem<algorithmFPType> * sorted) const
+    {
+        size_t nSorted     = 0;
+        DAAL_UINT64 weight = 1;
+        for (size_t level = 0; level < nLevels(); level++, weight <<= 1)
+        {
+            for (size_t i = offset(level); i < offset(level + 1); i++, nSorted++)
+            {
+                sorted[nSorted].value  = _items[i];
+                sorted[nSorted].weight = weight;
+            }
+        }
+        daal::algorithms::internal::introSort<cpu>(
+            sorted, sorted + nSorted,
+            [](const SketchWeightedItem<algorithmFPType> & a, const SketchWeightedItem<algorithmFPType> & b) -> bool { return a.value < b.value; });
+
+        DAAL_UINT64 totalWeight = 0;
+        for (size_t i = 0; i < nSorted; i++)
+        {
+            totalWeight += sorted[i].weight;
+            sorted[i].weight = totalWeight;
+        }
+        return totalWeight;
+    }
+
+private:
+    static void copyItems(algorithmFPType * dst, const algorithmFPType * src, size_t n)
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            dst[i] = src[i];
+        }
+    }
+
+    /* Compacts the lowest level that reached its capacity */
+    services::Status compress()
+    {
+        const size_t nLevelsCurrent = nLevels();
+        size_t level                = 0;
+        while (level + 1 < nLevelsCurrent && levelSize(level) < sketchLevelCapacity(_sketchSize, nLevelsCurrent - 1 - level))
+        {
+            level++;
+        }
+        if (level + 1 == nLevelsCurrent)
+        {
+            /* Compaction of the top level needs a new empty level above it */
+            DAAL_CHECK(nLevelsCurrent < sketchMaxLevels, services::ErrorQuantilesInternal);
+            _layout[sketchOffsetsPos + nLevelsCurrent + 1] = _layout[sketchOffsetsPos + nLevelsCurrent];
+            _layout[0]                                     = int(nLevelsCurrent + 1);
+        }
+        compact(level);
+        return services::Status();
+    }
+
+    void compact(size_t level)
+    {
+        const size_t begin = offset(level);
+        const size_t end   = offset(level + 1);
+        daal::algorithms::internal::qSort<algorithmFPType, cpu>(end - begin, _items + begin);
+
+        /* The smallest item stays on the level if the number of items is odd */
+        const size_t start = begin + ((end - begin) & 1);
+        const size_t half  = (end - start) / 2;
+        const size_t shift = size_t(_layout[sketchParitiesPos + level]);
+        _layout[sketchParitiesPos + level] ^= 1;
+
+        /* Promoted items are packed at the end of the level, so they join the next level in place */
+        for (size_t i = half; i-- > 0;)
+        {
+            _items[start + half + i] = _items[start + 2 * i + shift];
+        }
+        for (size_t i = start; i-- > offset(0);)
+        {
+            _items[i + half] = _items[i];
+        }
+        for (size_t l = 0; l <= level; l++)
+        {
+            _layout[sketchOffsetsPos + l] += int(half);
+        }
+        _layout[sketchOffsetsPos + level + 1] = int(start + half);
+    }
+
+    algorithmFPType * _items;
+    int * _layout;
+    size_t _sketchSize;
+};
+
+/* Value of the observation with the given rank among the sorted items with cumulative weights */
+template <typename algorithmFPType>
+algorithmFPType sketchValueAtRank(const SketchWeightedItem<algorithmFPType> * sorted, size_t nSorted, DAAL_UINT64 rank)
+{
+    size_t left  = 0;
+    size_t right = nSorted - 1;
+    while (left < right)
+    {
+        const size_t middle = left + (right - left) / 2;
+        if (sorted[middle].weight > rank)
+        {
+            right = middle;
+        }
+        else
+        {
+            left = middle + 1;
+        }
+    }
+    return sorted[left].value;
+}
+
+/* Set of the sketches of all the features owned by a thread */
+template <typename algorithmFPType, CpuType cpu>
+class SketchSet
+{
+public:
+    DAAL_NEW_DELETE();
+
+    static SketchSet * create(size_t nFeatures, size_t nItems)
+    {
+        SketchSet * const set = new SketchSet(nFeatures, nItems);
+        if (set && set->_items.get() && set->_layouts.get()) return set;
+        delete set;
+        return nullptr;
+    }
+
+    algorithmFPType * items() { return _items.get(); }
+    int * layouts() { return _layouts.get(); }
+
+private:
+    SketchSet(size_t nFeatures, size_t nItems) : _items(nFeatures * nItems), _layouts(nFeatures * sketchLevelsWidth)
+    {
+        if (!_layouts.get()) return;
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            KllSketch<algorithmFPType, cpu>::initialize(_layouts.get() + j * sketchLevelsWidth, nItems);
+        }
+    }
+
+    TArrayScalable<algorithmFPType, cpu> _items;
+    TArrayScalable<int, cpu> _layouts;
+};
+
+/* Checks the layouts of the sketches of all the features, they may come from the deserialized partial results */
+inline services::Status checkSketchLayouts(const int * layouts, size_t nFeatures, size_t nItems)
+{
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        DAAL_CHECK(isSketchLayoutValid(layouts + j * sketchLevelsWidth, nItems), services::ErrorIncorrectDataRange);
+    }
+    return services::Status();
+}
+
+/* Merges the sketches of all the features from the source into the destination */
+template <typename algorithmFPType, CpuType cpu>
+services::Status mergeSketches(algorithmFPType * dstItems, int * dstLayouts, const algorithmFPType * srcItems, const int * srcLayouts,
+                               size_t nFeatures, size_t nItems, size_t sketchSize)
+{
+    services::Status s;
+    DAAL_CHECK_STATUS(s, checkSketchLayouts(dstLayouts, nFeatures, nItems));
+    DAAL_CHECK_STATUS(s, checkSketchLayouts(srcLayouts, nFeatures, nItems));
+
+    SafeStatus safeStat;
+    TlsMem<algorithmFPType, cpu> tlsBuffer(2 * nItems);
+    daal::threader_for(nFeatures, nFeatures, [&](size_t j) {
+        algorithmFPType * const buffer = tlsBuffer.local();
+        DAAL_CHECK_MALLOC_THR(buffer);
+        KllSketch<algorithmFPType, cpu> dst(dstItems + j * nItems, dstLayouts + j * sketchLevelsWidth, sketchSize);
+        const KllSketch<algorithmFPType, cpu> src(const_cast<algorithmFPType *>(srcItems + j * nItems),
+                                                  const_cast<int *>(srcLayouts + j * sketchLevelsWidth), sketchSize);
+        safeStat |= dst.merge(src, buffer);
+    });
+    return safeStat.detach();
+}
+
+/* Adds all the observations of the data set to the sketches of the features */
+template <typename algorithmFPType, CpuType cpu>
+services::Status updateSketches(const NumericTable & dataTable, algorithmFPType * items, int * layouts, size_t nItems, size_t sketchSize)
+{
+    const size_t nFeatures = dataTable.getNumberOfColumns();
+    const size_t nVectors  = dataTable.getNumberOfRows();
+    const size_t nBlocks   = nVectors / sketchBlockSize + !!(nVectors % sketchBlockSize);
+    NumericTable & data    = const_cast<NumericTable &>(dataTable);
+
+    if (nBlocks < 2)
+    {
+        ReadRows<algorithmFPType, cpu> dataBlock(data, 0, nVectors);
+        DAAL_CHECK_BLOCK_STATUS(dataBlock);
+        SafeStatus safeStat;
+        daal::threader_for(nFeatures, nFeatures, [&](size_t j) {
+            KllSketch<algorithmFPType, cpu> sketch(items + j * nItems, layouts + j * sketchLevelsWidth, sketchSize);
+            safeStat |= sketch.insert(dataBlock.get() + j, nVectors, nFeatures);
+        });
+        return safeStat.detach();
+    }
+
+    typedef SketchSet<algorithmFPType, cpu> LocalSketches;
+    SafeStatus safeStat;
+    daal::tls<LocalSketches *> tlsSketches([=, &safeStat]() {
+        LocalSketches * const local = LocalSketches::create(nFeatures, nItems);
+        if (!local) safeStat.add(services::ErrorMemoryAllocationFailed);
+        return local;
+    });
+
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        LocalSketches * const local = tlsSketches.local();
+        if (!local) return;
+
+        const size_t iStart = iBlock * sketchBlockSize;
+        const size_t iSize  = (iStart + sketchBlockSize > nVectors) ? nVectors - iStart : sketchBlockSize;
+        ReadRows<algorithmFPType, cpu> dataBlock(data, iStart, iSize);
+        DAAL_CHECK_BLOCK_STATUS_THR(dataBlock);
+
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            KllSketch<algorithmFPType, cpu> sketch(local->items() + j * nItems, local->layouts() + j * sketchLevelsWidth, sketchSize);
+            safeStat |= sketch.insert(dataBlock.get() + j, iSize, nFeatures);
+        }
+    });
+
+    tlsSketches.reduce([&](LocalSketches * local) {
+        if (!local) return;
+        if (safeStat.ok())
+        {
+            safeStat |= mergeSketches<algorithmFPType, cpu>(items, layouts, local->items(), local->layouts(), nFeatures, nItems, sketchSize);
+        }
+        delete local;
+    });
+    return safeStat.detach();
+}
+
+/* Computes the quantiles of the features from their sketches */
+template <typename algorithmFPType, CpuType cpu>
+services::Status computeSketchQuantiles(const algorithmFPType * items, const int * layouts, size_t nFeatures, size_t nItems, size_t sketchSize,
+                                        const algorithmFPType * quantileOrders, size_t nQuantileOrders, algorithmFPType * quantiles)
+{
+    for (size_t k = 0; k < nQuantileOrders; k++)
+    {
+        DAAL_CHECK(quantileOrders[k] >= algorithmFPType(0) && quantileOrders[k] <= algorithmFPType(1), services::ErrorQuantileOrderValueIsInvalid);
+    }
+
+    SafeStatus safeStat;
+    TlsMem<SketchWeightedItem<algorithmFPType>, cpu> tlsSorted(nItems);
+    daal::threader_for(nFeatures, nFeatures, [&](size_t j) {
+        SketchWeightedItem<algorithmFPType> * const sorted = tlsSorted.local();
+        DAAL_CHECK_MALLOC_THR(sorted);
+
+        const KllSketch<algorithmFPType, cpu> sketch(const_cast<algorithmFPType *>(items + j * nItems),
+                                                     const_cast<int *>(layouts + j * sketchLevelsWidth), sketchSize);
+        const size_t nSorted          = sketch.nItems();
+        const DAAL_UINT64 totalWeight = sketch.sortedItems(sorted);
+        DAAL_CHECK_THR(totalWeight > 0, services::ErrorEmptyInputNumericTable);
+
+        /* Linear interpolation between the order statistics, the same as for the defaultDense method */
+        for (size_t k = 0; k < nQuantileOrders; k++)
+        {
+            const double rank          = double(quantileOrders[k]) * double(totalWeight - 1);
+            const DAAL_UINT64 lower    = static_cast<DAAL_UINT64>(rank);
+            const DAAL_UINT64 upper    = (lower + 1 < totalWeight) ? lower + 1 : lower;
+            const algorithmFPType frac = algorithmFPType(rank - double(lower));
+            const algorithmFPType low  = sketchValueAtRank<algorithmFPType>(sorted, nSorted, lower);
+            const algorithmFPType high = sketchValueAtRank<algorithmFPType>(sorted, nSorted, upper);
+            quantiles[j * nQuantileOrders + k] = low + frac * (high - low);
+        }
+    });
+    return safeStat.detach();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status QuantilesKernel<sketchDense, algorithmFPType, cpu>::compute(const NumericTable & dataTable, const NumericTable & quantileOrdersTable,
+                                                                             NumericTable & quantilesTable, const Parameter & par)
+{
+    const size_t nFeatures = dataTable.getNumberOfColumns();
+    const size_t nItems    = sketchItemsWidth(par.sketchSize);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nFeatures, nItems);
+
+    daal::internal::UniquePtr<SketchSet<algorithmFPType, cpu>, cpu> sketches(SketchSet<algorithmFPType, cpu>::create(nFeatures, nItems));
+    DAAL_CHECK_MALLOC(sketches.get());
+
+    services::Status s;
+    DAAL_CHECK_STATUS(s, (updateSketches<algorithmFPType, cpu>(dataTable, sketches->items(), sketches->layouts(), nItems, par.sketchSize)));
+
+    ReadRows<algorithmFPType, cpu> quantileOrdersBlock(const_cast<NumericTable &>(quantileOrdersTable), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(quantileOrdersBlock);
+    WriteOnlyRows<algorithmFPType, cpu> quantilesBlock(quantilesTable, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(quantilesBlock);
+
+    return computeSketchQuantiles<algorithmFPType, cpu>(sketches->items(), sketches->layouts(), nFeatures, nItems, par.sketchSize,
+                                                        quantileOrdersBlock.get(), quantilesTable.getNumberOfColumns(), quantilesBlock.get());
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status QuantilesKernel<sketchDense, algorithmFPType, cpu>::computeOnline(const NumericTable & dataTable, NumericTable & sketchItemsTable,
+                                                                                   NumericTable & sketchLevelsTable, const Parameter & par)
+{
+    const size_t nFeatures = dataTable.getNumberOfColumns();
+    const size_t nItems    = sketchItemsTable.getNumberOfColumns();
+
+    WriteRows<algorithmFPType, cpu> itemsBlock(sketchItemsTable, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(itemsBlock);
+    WriteRows<int, cpu> layoutsBlock(sketchLevelsTable, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(layoutsBlock);
+
+    services::Status s;
+    DAAL_CHECK_STATUS(s, checkSketchLayouts(layoutsBlock.get(), nFeatures, nItems));
+    return updateSketches<algorithmFPType, cpu>(dataTable, itemsBlock.get(), layoutsBlock.get(), nItems, par.sketchSize);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status QuantilesKernel<sketchDense, algorithmFPType, cpu>::merge(DataCollection & partialResults, NumericTable & sketchItemsTable,
+                                                                           NumericTable & sketchLevelsTable, const Parameter & par)
+{
+    const size_t nFeatures = sketchLevelsTable.getNumberOfRows();
+    const size_t nItems    = sketchItemsTable.getNumberOfColumns();
+
+    WriteOnlyRows<algorithmFPType, cpu> itemsBlock(sketchItemsTable, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(itemsBlock);
+    WriteOnlyRows<int, cpu> layoutsBlock(sketchLevelsTable, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(layoutsBlock);
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        KllSketch<algorithmFPType, cpu>::initialize(layoutsBlock.get() + j * sketchLevelsWidth, nItems);
+    }
+
+    services::Status s;
+    for (size_t i = 0; i < partialResults.size(); i++)
+    {
+        PartialResult * const partialResult = static_cast<PartialResult *>(partialResults[i].get());
+
+        ReadRows<algorithmFPType, cpu> partialItemsBlock(partialResult->get(sketchItems).get(), 0, nFeatures);
+        DAAL_CHECK_BLOCK_STATUS(partialItemsBlock);
+        ReadRows<int, cpu> partialLayoutsBlock(partialResult->get(sketchLevels).get(), 0, nFeatures);
+        DAAL_CHECK_BLOCK_STATUS(partialLayoutsBlock);
+
+        DAAL_CHECK_STATUS(s, (mergeSketches<algorithmFPType, cpu>(itemsBlock.get(), layoutsBlock.get(), partialItemsBlock.get(),
+                                                                  partialLayoutsBlock.get(), nFeatures, nItems, par.sketchSize)));
+    }
+    return s;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status QuantilesKernel<sketchDense, algorithmFPType, cpu>::finalizeCompute(const NumericTable & sketchItemsTable,
+                                                                                     const NumericTable & sketchLevelsTable,
+                                                                                     const NumericTable & quantileOrdersTable,
+                                                                                     NumericTable & quantilesTable)
+{
+    const size_t nFeatures = sketchLevelsTable.getNumberOfRows();
+    const size_t nItems    = sketchItemsTable.getNumberOfColumns();
+
+    ReadRows<algorithmFPType, cpu> itemsBlock(const_cast<NumericTable &>(sketchItemsTable), 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(itemsBlock);
+    ReadRows<int, cpu> layoutsBlock(const_cast<NumericTable &>(sketchLevelsTable), 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(layoutsBlock);
+    ReadRows<algorithmFPType, cpu> quantileOrdersBlock(const_cast<NumericTable &>(quantileOrdersTable), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(quantileOrdersBlock);
+    WriteOnlyRows<algorithmFPType, cpu> quantilesBlock(quantilesTable, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(quantilesBlock);
+
+    services::Status s;
+    DAAL_CHECK_STATUS(s, checkSketchLayouts(layoutsBlock.get(), nFeatures, nItems));
+
+    /* The sketch size only affects the capacities of the levels, which are not needed here */
+    return computeSketchQuantiles<algorithmFPType, cpu>(itemsBlock.get(), layoutsBlock.get(), nFeatures, nItems, 2, quantileOrdersBlock.get(),
+                                                        quantilesTable.getNumberOfColumns(), quantilesBlock.get());
+}
+
+} // namespace internal
+} // namespace quantiles
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -102,7 +102,7 @@ DAAL_FORCEINLINE void sortMaxHeap(RandomAccessIterator first, RandomAccessIterat
 {
     while (1 < last - first)
     {
-        popMaxHeap<cpu>(first, --last, compare);
+        popMaxHeap<cpu>(first, last--, compare);
     }
 }
 
@@ -32,6 +32,10 @@
 #include "src/externals/service_blas.h"
 #include "src/externals/service_memory.h"
 #include "src/externals/service_math.h"
+#include "src/services/service_environment.h"
+#include "src/threading/threading.h"
+#include "src/algorithms/service_threading.h"
+#include "src/algorithms/service_heap.h"
 
 using namespace daal::internal;
 using namespace daal::services;
@@ -261,6 +265,517 @@ protected:
     TArray<FPType, cpu> normBufferB;
 };
 
+// compute: 1 - A*B' / (sqrt(sum(A^2, 2)) * sqrt(sum(B^2, 2))')
+// If centered, rows of A and B are centered by their means first, that gives the correlation distance.
+// Rows with zero norm are treated as orthogonal to any other row
+template <typename FPType, CpuType cpu>
+class CosineDistances : public EuclideanDistances<FPType, cpu>
+{
+    typedef EuclideanDistances<FPType, cpu> super;
+
+public:
+    CosineDistances(const NumericTable & a, const NumericTable & b, bool centered = false) : super(a, b, true), _centered(centered) {}
+
+    virtual ~CosineDistances() {}
+
+    virtual services::Status init()
+    {
+        DAAL_CHECK_STATUS_VAR(super::init());
+
+        DAAL_CHECK_STATUS_VAR(prepareNorm(this->_a, this->normBufferA.get(), sumBufferA));
+        if (&this->_a != &this->_b)
+        {
+            DAAL_CHECK_STATUS_VAR(prepareNorm(this->_b, this->normBufferB.get(), sumBufferB));
+        }
+
+        return services::Status();
+    }
+
+    using super::computeBatch;
+
+    // output:  Row-major matrix of size { aSize x bSize }
+    virtual services::Status computeBatch(const FPType * const a, const FPType * const b, size_t aOffset, size_t aSize, size_t bOffset, size_t bSize,
+                                          FPType * const res)
+    {
+        const size_t nColsA = this->_a.getNumberOfColumns();
+        const bool isSame   = (&this->_a == &this->_b);
+
+        this->computeABt(a, b, aSize, nColsA, bSize, res);
+
+        const FPType * const aa = this->normBufferA.get() + aOffset;
+        const FPType * const bb = isSame ? this->normBufferA.get() + bOffset : this->normBufferB.get() + bOffset;
+
+        if (_centered)
+        {
+            const FPType invP       = FPType(1) / FPType(nColsA);
+            const FPType * const sa = sumBufferA.get() + aOffset;
+            const FPType * const sb = isSame ? sumBufferA.get() + bOffset : sumBufferB.get() + bOffset;
+
+            for (size_t i = 0; i < aSize; i++)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < bSize; j++)
+                {
+                    res[i * bSize + j] = FPType(1) - (res[i * bSize + j] - sa[i] * sb[j] * invP) * aa[i] * bb[j];
+                }
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < aSize; i++)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < bSize; j++)
+                {
+                    res[i * bSize + j] = FPType(1) - res[i * bSize + j] * aa[i] * bb[j];
+                }
+            }
+        }
+
+        return services::Status();
+    }
+
+protected:
+    // replace sum(A^2, 2) with 1 / sqrt(sum(A^2, 2)) so that the batch correction is multiplicative,
+    // for centered rows the squared norm is sum(A^2, 2) - sum(A, 2)^2 / p
+    services::Status prepareNorm(const NumericTable & ntData, FPType * const norm, TArray<FPType, cpu> & sumBuffer)
+    {
+        const size_t nRows = ntData.getNumberOfRows();
+
+        if (_centered)
+        {
+            sumBuffer.reset(nRows);
+            DAAL_CHECK_MALLOC(sumBuffer.get());
+            DAAL_CHECK_STATUS_VAR(computeSum(ntData, sumBuffer.get()));
+
+            const FPType invP        = FPType(1) / FPType(ntData.getNumberOfColumns());
+            const FPType * const sum = sumBuffer.get();
+            for (size_t i = 0; i < nRows; i++)
+            {
+                norm[i] -= sum[i] * sum[i] * invP;
+            }
+        }
+
+        for (size_t i = 0; i < nRows; i++)
+        {
+            norm[i] = (norm[i] > FPType(0)) ? FPType(1) / daal::internal::Math<FPType, cpu>::sSqrt(norm[i]) : FPType(0);
+        }
+
+        return services::Status();
+    }
+
+    // compute (sum(A, 2))
+    services::Status computeSum(const NumericTable & ntData, FPType * const res)
+    {
+        const size_t nRows = ntData.getNumberOfRows();
+        const size_t nCols = ntData.getNumberOfColumns();
+
+        const size_t blockSize = 512;
+        const size_t nBlocks   = nRows / blockSize + !!(nRows % blockSize);
+
+        SafeStatus safeStat;
+
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            size_t begin = iBlock * blockSize;
+            size_t end   = services::internal::min<cpu, size_t>(begin + blockSize, nRows);
+
+            ReadRows<FPType, cpu> dataRows(const_cast<NumericTable &>(ntData), begin, end - begin);
+            DAAL_CHECK_BLOCK_STATUS_THR(dataRows);
+            const FPType * const data = dataRows.get();
+
+            FPType * r = res + begin;
+
+            for (size_t i = 0; i < end - begin; i++)
+            {
+                FPType sum = FPType(0);
+                PRAGMA_IVDEP
+                PRAGMA_ICC_NO16(omp simd reduction(+ : sum))
+                for (size_t j = 0; j < nCols; j++)
+                {
+                    sum += data[i * nCols + j];
+                }
+                r[i] = sum;
+            }
+        });
+
+        return safeStat.detach();
+    }
+
+    const bool _centered;
+
+    TArray<FPType, cpu> sumBufferA;
+    TArray<FPType, cpu> sumBufferB;
+};
+
+// Number of rows of B processed at once, so that the tile of B, aSize rows of A
+// and the { aSize x tile } block of distances fit into L2 cache together
+template <typename FPType, CpuType cpu>
+size_t getPairwiseTileSize(const size_t l2Size, const size_t aSize, const size_t dim)
+{
+    const size_t minTileSize = 16;
+    const size_t maxTileSize = 2048;
+    const size_t cacheSize   = l2Size / sizeof(FPType) * 4 / 5;
+    const size_t aElements   = aSize * dim;
+
+    if (cacheSize <= aElements + minTileSize * (dim + aSize))
+    {
+        return minTileSize;
+    }
+
+    return services::internal::min<cpu, size_t>((cacheSize - aElements) / (dim + aSize), maxTileSize);
+}
+
+// sum(|A - B|^p, 2), the power 1/p is applied only if powered is false
+template <typename FPType, CpuType cpu>
+class MinkowskiMetric
+{
+public:
+    MinkowskiMetric(FPType p, bool powered) : _p(p), _powered(powered) {}
+
+    FPType operator()(const FPType * const a, const FPType * const b, const size_t dim) const
+    {
+        FPType sum = FPType(0);
+
+        if (_p == FPType(2))
+        {
+            PRAGMA_IVDEP
+            PRAGMA_ICC_NO16(omp simd reduction(+ : sum))
+            for (size_t k = 0; k < dim; k++)
+            {
+                const FPType d = a[k] - b[k];
+                sum += d * d;
+            }
+        }
+        else if (_p == FPType(1))
+        {
+            PRAGMA_IVDEP
+            PRAGMA_ICC_NO16(omp simd reduction(+ : sum))
+            for (size_t k = 0; k < dim; k++)
+            {
+                const FPType d = a[k] - b[k];
+                sum += (d < FPType(0) ? -d : d);
+            }
+        }
+        else
+        {
+            for (size_t k = 0; k < dim; k++)
+            {
+                sum += daal::internal::Math<FPType, cpu>::sPowx(daal::internal::Math<FPType, cpu>::sFabs(a[k] - b[k]), _p);
+            }
+        }
+
+        return sum;
+    }
+
+    void finalize(FPType * const res, const size_t n) const
+    {
+        if (!_powered && _p != FPType(1))
+        {
+            daal::internal::Math<FPType, cpu>::vPowx(n, res, FPType(1) / _p, res);
+        }
+    }
+
+private:
+    FPType _p;
+    bool _powered;
+};
+
+// max(|A - B|, 2)
+template <typename FPType, CpuType cpu>
+class ChebyshevMetric
+{
+public:
+    FPType operator()(const FPType * const a, const FPType * const b, const size_t dim) const
+    {
+        FPType res = FPType(0);
+
+        PRAGMA_IVDEP
+        PRAGMA_ICC_NO16(omp simd reduction(max : res))
+        for (size_t k = 0; k < dim; k++)
+        {
+            const FPType d    = a[k] - b[k];
+            const FPType absD = (d < FPType(0) ? -d : d);
+            res               = (absD > res ? absD : res);
+        }
+
+        return res;
+    }
+
+    void finalize(FPType * const, const size_t) const {}
+};
+
+// Number of features that are non-zero in exactly one of two binary rows
+template <typename FPType, CpuType cpu>
+class HammingMetric
+{
+public:
+    FPType operator()(const FPType * const a, const FPType * const b, const size_t dim) const
+    {
+        FPType sum = FPType(0);
+
+        PRAGMA_IVDEP
+        PRAGMA_ICC_NO16(omp simd reduction(+ : sum))
+        for (size_t k = 0; k < dim; k++)
+        {
+            sum += FPType((a[k] != FPType(0)) != (b[k] != FPType(0)));
+        }
+
+        return sum;
+    }
+
+    void finalize(FPType * const, const size_t) const {}
+};
+
+// Distances computed directly from the features. B is processed by tiles that fit
+// L2 cache together with the block of rows of A, Metric defines the reduction over features
+template <typename FPType, CpuType cpu, typename Metric>
+class TiledDistances : public PairwiseDistances<FPType, cpu>
+{
+public:
+    TiledDistances(const NumericTable & a, const NumericTable & b, const Metric & metric)
+        : _a(a), _b(b), _metric(metric), _l2Size(getL2CacheSize())
+    {}
+
+    virtual ~TiledDistances() {}
+
+    virtual services::Status init() { return services::Status(); }
+
+    // output:  Row-major matrix of size { aSize x bSize }
+    virtual services::Status computeBatch(const FPType * const a, const FPType * const b, size_t aOffset, size_t aSize, size_t bOffset, size_t bSize,
+                                          FPType * const res)
+    {
+        // B may have trailing columns that are not compared
+        const size_t dim      = _a.getNumberOfColumns();
+        const size_t bDim     = _b.getNumberOfColumns();
+        const size_t tileSize = getPairwiseTileSize<FPType, cpu>(_l2Size, aSize, dim);
+
+        for (size_t j1 = 0; j1 < bSize; j1 += tileSize)
+        {
+            const size_t j2 = services::internal::min<cpu, size_t>(j1 + tileSize, bSize);
+
+            for (size_t i = 0; i < aSize; i++)
+            {
+                const FPType * const ai = a + i * dim;
+                FPType * const ri       = res + i * bSize;
+
+                for (size_t j = j1; j < j2; j++)
+                {
+                    ri[j] = _metric(ai, b + j * bDim, dim);
+                }
+            }
+        }
+
+        _metric.finalize(res, aSize * bSize);
+
+        return services::Status();
+    }
+
+    // output:  Row-major matrix of size { aSize x bSize }
+    virtual services::Status computeBatch(size_t aOffset, size_t aSize, size_t bOffset, size_t bSize, FPType * const res)
+    {
+        ReadRows<FPType, cpu> aDataRows(const_cast<NumericTable *>(&_a), aOffset, aSize);
+        DAAL_CHECK_BLOCK_STATUS(aDataRows);
+        const FPType * const aData = aDataRows.get();
+
+        ReadRows<FPType, cpu> bDataRows(const_cast<NumericTable *>(&_b), bOffset, bSize);
+        DAAL_CHECK_BLOCK_STATUS(bDataRows);
+        const FPType * const bData = bDataRows.get();
+
+        return computeBatch(aData, bData, aOffset, aSize, bOffset, bSize, res);
+    }
+
+    // output:  Row-major matrix of size { nrows(A) x nrows(B) }
+    virtual services::Status computeFull(FPType * const res)
+    {
+        SafeStatus safeStat;
+
+        const size_t nRowsA    = _a.getNumberOfRows();
+        const size_t blockSize = 256;
+        const size_t nBlocks   = nRowsA / blockSize + (nRowsA % blockSize > 0);
+
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            const size_t i1    = iBlock * blockSize;
+            const size_t i2    = (iBlock + 1 == nBlocks ? nRowsA : i1 + blockSize);
+            const size_t iSize = i2 - i1;
+
+            const size_t nRowsB = _b.getNumberOfRows();
+
+            DAAL_CHECK_STATUS_THR(computeBatch(i1, iSize, 0, nRowsB, res + i1 * nRowsB));
+        });
+
+        return safeStat.detach();
+    }
+
+protected:
+    const NumericTable & _a;
+    const NumericTable & _b;
+    const Metric _metric;
+    const size_t _l2Size;
+};
+
+// compute: sum(|A - B|^p, 2)^(1/p) or, if powered, sum(|A - B|^p, 2)
+template <typename FPType, CpuType cpu>
+class MinkowskiDistances : public TiledDistances<FPType, cpu, MinkowskiMetric<FPType, cpu> >
+{
+    typedef TiledDistances<FPType, cpu, MinkowskiMetric<FPType, cpu> > super;
+
+public:
+    MinkowskiDistances(const NumericTable & a, const NumericTable & b, FPType p, bool powered = true)
+        : super(a, b, MinkowskiMetric<FPType, cpu>(p, powered))
+    {}
+};
+
+// compute: max(|A - B|, 2)
+template <typename FPType, CpuType cpu>
+class ChebyshevDistances : public TiledDistances<FPType, cpu, ChebyshevMetric<FPType, cpu> >
+{
+    typedef TiledDistances<FPType, cpu, ChebyshevMetric<FPType, cpu> > super;
+
+public:
+    ChebyshevDistances(const NumericTable & a, const NumericTable & b) : super(a, b, ChebyshevMetric<FPType, cpu>()) {}
+};
+
+// compute: sum((A != 0) xor (B != 0), 2)
+template <typename FPType, CpuType cpu>
+class HammingDistances : public TiledDistances<FPType, cpu, HammingMetric<FPType, cpu> >
+{
+    typedef TiledDistances<FPType, cpu, HammingMetric<FPType, cpu> > super;
+
+public:
+    HammingDistances(const NumericTable & a, const NumericTable & b) : super(a, b, HammingMetric<FPType, cpu>()) {}
+};
+
+// Candidates are ordered by distance, ties are resolved in favor of the smaller index
+template <typename FPType>
+struct NearestCandidate
+{
+    FPType distance;
+    size_t index;
+
+    inline bool operator<(const NearestCandidate & rhs) const { return (distance < rhs.distance) || (distance == rhs.distance && index < rhs.index); }
+};
+
+// Merges n distances to the rows offset, ..., offset + n - 1 of B into the max-heap
+// of k nearest candidates, first nFilled elements of which are already occupied.
+// The offsets must grow from call to call, so an equal distance never displaces an earlier row
+template <typename FPType, CpuType cpu>
+void updateKNearest(NearestCandidate<FPType> * const heap, const size_t k, size_t nFilled, const size_t offset, const FPType * const distances,
+                    const size_t n)
+{
+    auto compare = [](const NearestCandidate<FPType> & lhs, const NearestCandidate<FPType> & rhs) { return lhs < rhs; };
+
+    const bool wasFull = (nFilled == k);
+
+    size_t j = 0;
+    for (; j < n && nFilled < k; j++, nFilled++)
+    {
+        heap[nFilled].distance = distances[j];
+        heap[nFilled].index    = offset + j;
+    }
+
+    if (!wasFull && nFilled == k)
+    {
+        makeMaxHeap<cpu>(heap, heap + k, compare);
+    }
+
+    for (; j < n; j++)
+    {
+        if (distances[j] < heap[0].distance)
+        {
+            heap[0].distance = distances[j];
+            heap[0].index    = offset + j;
+            internalAdjustMaxHeap<cpu>(heap, heap + k, k, size_t(0), compare);
+        }
+    }
+}
+
+// Number of rows of A processed by one task of computeKNearest,
+// so the consumer never gets more than kNearestBlockSize rows at once
+const size_t kNearestBlockSize = 128;
+
+// Computes k nearest rows of B for every row of A. The selection is fused into the
+// tiled distance computation, so the full { nrows(A) x nrows(B) } matrix is never stored.
+// If k exceeds nrows(B), all rows of B are returned, so nNeighbors = min(k, nrows(B)).
+// Results are streamed by blocks of rows of A: consumer(aOffset, aSize, nNeighbors, indices, distances)
+// gets row-major { aSize x nNeighbors } arrays sorted by increasing distance, and then by index,
+// and returns services::Status. The consumer is called concurrently for different blocks.
+template <typename FPType, CpuType cpu, typename Consumer>
+services::Status computeKNearest(PairwiseDistances<FPType, cpu> & metric, const NumericTable & a, const NumericTable & b, const size_t k,
+                                 const Consumer & consumer)
+{
+    const size_t nRowsA = a.getNumberOfRows();
+    const size_t nRowsB = b.getNumberOfRows();
+    const size_t dim    = a.getNumberOfColumns();
+
+    DAAL_CHECK(k > 0 && nRowsB > 0, services::ErrorIncorrectParameter);
+
+    const size_t nNeighbors = services::internal::min<cpu, size_t>(k, nRowsB);
+    const size_t aBlockSize = kNearestBlockSize;
+    const size_t nABlocks   = nRowsA / aBlockSize + !!(nRowsA % aBlockSize);
+    const size_t bTileSize  = services::internal::min<cpu, size_t>(getPairwiseTileSize<FPType, cpu>(getL2CacheSize(), aBlockSize, dim), nRowsB);
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, aBlockSize, bTileSize);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, aBlockSize, nNeighbors);
+
+    TlsMem<FPType, cpu> tlsDistances(aBlockSize * bTileSize);
+    TlsMem<NearestCandidate<FPType>, cpu> tlsHeaps(aBlockSize * nNeighbors);
+    TlsMem<size_t, cpu> tlsKIndices(aBlockSize * nNeighbors);
+    TlsMem<FPType, cpu> tlsKDistances(aBlockSize * nNeighbors);
+
+    auto compare = [](const NearestCandidate<FPType> & lhs, const NearestCandidate<FPType> & rhs) { return lhs < rhs; };
+
+    SafeStatus safeStat;
+    daal::threader_for(nABlocks, nABlocks, [&](size_t iBlock) {
+        const size_t i1    = iBlock * aBlockSize;
+        const size_t i2    = (iBlock + 1 == nABlocks ? nRowsA : i1 + aBlockSize);
+        const size_t iSize = i2 - i1;
+
+        FPType * const distances               = tlsDistances.local();
+        NearestCandidate<FPType> * const heaps = tlsHeaps.local();
+        size_t * const kIndices                = tlsKIndices.local();
+        FPType * const kDistances              = tlsKDistances.local();
+        DAAL_CHECK_MALLOC_THR(distances && heaps && kIndices && kDistances);
+
+        ReadRows<FPType, cpu> aDataRows(const_cast<NumericTable *>(&a), i1, iSize);
+        DAAL_CHECK_BLOCK_STATUS_THR(aDataRows);
+        const FPType * const aData = aDataRows.get();
+
+        for (size_t j1 = 0; j1 < nRowsB; j1 += bTileSize)
+        {
+            const size_t jSize = services::internal::min<cpu, size_t>(bTileSize, nRowsB - j1);
+
+            ReadRows<FPType, cpu> bDataRows(const_cast<NumericTable *>(&b), j1, jSize);
+            DAAL_CHECK_BLOCK_STATUS_THR(bDataRows);
+
+            DAAL_CHECK_STATUS_THR(metric.computeBatch(aData, bDataRows.get(), i1, iSize, j1, jSize, distances));
+
+            const size_t nFilled = services::internal::min<cpu, size_t>(j1, nNeighbors);
+            for (size_t i = 0; i < iSize; i++)
+            {
+                updateKNearest<FPType, cpu>(heaps + i * nNeighbors, nNeighbors, nFilled, j1, distances + i * jSize, jSize);
+            }
+        }
+
+        for (size_t i = 0; i < iSize; i++)
+        {
+            NearestCandidate<FPType> * const heap = heaps + i * nNeighbors;
+            sortMaxHeap<cpu>(heap, heap + nNeighbors, compare);
+
+            for (size_t kk = 0; kk < nNeighbors; kk++)
+            {
+                kIndices[i * nNeighbors + kk]   = heap[kk].index;
+                kDistances[i * nNeighbors + kk] = heap[kk].distance;
+            }
+        }
+
+        DAAL_CHECK_STATUS_THR(consumer(i1, iSize, nNeighbors, kIndices, kDistances));
+    });
+
+    return safeStat.detach();
+}
+
 } // namespace internal
 } // namespace algorithms
 } // namespace daal
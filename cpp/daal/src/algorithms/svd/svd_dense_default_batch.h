@@ -46,7 +46,14 @@ template <typename algorithmFPType>
 DAAL_EXPORT Status Result::allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, const int method)
 {
     const Input * in = static_cast<const Input *>(input);
-    return allocateImpl<algorithmFPType>(in->get(data)->getNumberOfColumns(), in->get(data)->getNumberOfRows());
+    const size_t m   = in->get(data)->getNumberOfColumns();
+    const size_t n   = in->get(data)->getNumberOfRows();
+    if (method == randomizedDense && parameter)
+    {
+        const RandomizedParameter * svdPar = static_cast<const RandomizedParameter *>(parameter);
+        return allocateImpl<algorithmFPType>(m, n, svdPar->nComponents ? svdPar->nComponents : m);
+    }
+    return allocateImpl<algorithmFPType>(m, n);
 }
 
 /**
@@ -59,7 +66,14 @@ template <typename algorithmFPType>
 DAAL_EXPORT Status Result::allocate(const daal::algorithms::PartialResult * partialResult, daal::algorithms::Parameter * parameter, const int method)
 {
     const OnlinePartialResult * in = static_cast<const OnlinePartialResult *>(partialResult);
-    return allocateImpl<algorithmFPType>(in->getNumberOfColumns(), in->getNumberOfRows());
+    const size_t m                 = in->getNumberOfColumns();
+    const size_t n                 = in->getNumberOfRows();
+    if (method == randomizedDense && parameter)
+    {
+        const RandomizedParameter * svdPar = static_cast<const RandomizedParameter *>(parameter);
+        return allocateImpl<algorithmFPType>(m, n, svdPar->nComponents ? svdPar->nComponents : m);
+    }
+    return allocateImpl<algorithmFPType>(m, n);
 }
 
 /**
@@ -70,13 +84,26 @@ DAAL_EXPORT Status Result::allocate(const daal::algorithms::PartialResult * part
  */
 template <typename algorithmFPType>
 DAAL_EXPORT Status Result::allocateImpl(size_t m, size_t n)
+{
+    return allocateImpl<algorithmFPType>(m, n, m);
+}
+
+/**
+ * Allocates memory to store the leading singular values and vectors computed by the SVD algorithm
+ * \tparam     algorithmFPType  Data type to use for storage in the resulting HomogenNumericTable
+ * \param[in]  m            Number of columns in the input data set
+ * \param[in]  n            Number of rows in the input data set
+ * \param[in]  nComponents  Number of singular values and vectors to store
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT Status Result::allocateImpl(size_t m, size_t n, size_t nComponents)
 {
     Status st;
-    set(singularValues, HomogenNumericTable<algorithmFPType>::create(m, 1, NumericTable::doAllocate, &st));
-    set(rightSingularMatrix, HomogenNumericTable<algorithmFPType>::create(m, m, NumericTable::doAllocate, &st));
+    set(singularValues, HomogenNumericTable<algorithmFPType>::create(nComponents, 1, NumericTable::doAllocate, &st));
+    set(rightSingularMatrix, HomogenNumericTable<algorithmFPType>::create(m, nComponents, NumericTable::doAllocate, &st));
     if (n != 0)
     {
-        set(leftSingularMatrix, HomogenNumericTable<algorithmFPType>::create(m, n, NumericTable::doAllocate, &st));
+        set(leftSingularMatrix, HomogenNumericTable<algorithmFPType>::create(nComponents, n, NumericTable::doAllocate, &st));
     }
     return st;
 }
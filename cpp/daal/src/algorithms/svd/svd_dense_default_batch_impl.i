@@ -167,13 +167,6 @@ Status SVDBatchKernel<algorithmFPType, method, cpu>::compute_seq(const size_t na
     return Status();
 }
 
-/* Max number of blocks depending on arch */
-#if (__CPUID__(DAAL_CPU) >= __avx512_mic__)
-    #define DEF_MAX_BLOCKS 256
-#else
-    #define DEF_MAX_BLOCKS 128
-#endif
-
 /*
     Algorithm for parallel SVD computation:
     -------------------------------------
@@ -237,24 +230,8 @@ Status SVDBatchKernel<algorithmFPType, method, cpu>::compute_thr(const size_t na
         DAAL_CHECK_BLOCK_STATUS(bkV_output);
     }
 
-    /* Block size calculation (empirical) */
-    const int bshift = (rows <= 10000) ? 11 : 12;
-    int bsize        = ((rows * cols) >> bshift) & (~0xf);
-    bsize            = (bsize < 200) ? 200 : bsize;
-
-    /*
-    Calculate sizes:
-    blocks     = number of blocks,
-    brows      = number of rows in blocks,
-    brows_last = number of rows in last block,
-    */
-    size_t def_min_brows = rows / DEF_MAX_BLOCKS;                           // min block size
-    size_t brows         = (rows > bsize) ? bsize : rows;                   /* brows cannot be less than rows */
-    brows                = (brows < cols) ? cols : brows;                   /* brows cannot be less than cols */
-    brows                = (brows < def_min_brows) ? def_min_brows : brows; /* brows cannot be less than n/DEF_MAX_BLOCKS */
-    size_t blocks        = rows / brows;
-
-    size_t brows_last = brows + (rows - blocks * brows); /* last block is generally biggest */
+    size_t blocks, brows, brows_last;
+    compute_tsqr_blocking(rows, cols, blocks, brows, brows_last);
 
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, n);
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n * n, sizeof(algorithmFPType));
@@ -300,26 +277,14 @@ Status SVDBatchKernel<algorithmFPType, method, cpu>::compute_thr(const size_t na
 
             TArrayScalable<algorithmFPType, cpu> QT_local_Arr(cols_local * brows_local);
             algorithmFPType * QT_local = QT_local_Arr.get();
-            TArrayScalable<algorithmFPType, cpu> RT_local_Arr(cols_local * cols_local);
-            algorithmFPType * RT_local = RT_local_Arr.get();
 
-            if (!(QT_local && RT_local))
+            if (!QT_local)
             {
                 safeStat.add(services::ErrorMemoryAllocationFailed);
                 return;
             }
-            /* Get transposed Q from A */
-            for (size_t i = 0; i < cols_local; i++)
-            {
-                PRAGMA_IVDEP
-                for (size_t j = 0; j < brows_local; j++)
-                {
-                    QT_local[i * brows_local + j] = A_block[i + j * cols_local];
-                }
-            }
 
-            /* Call QR on local nodes */
-            const auto ec = compute_QR_on_one_node_seq<algorithmFPType, cpu>(brows_local, cols_local, QT_local, brows_local, RT_local, cols_local);
+            const auto ec = compute_tsqr_block_seq<algorithmFPType, cpu>(k, blocks, brows_local, cols_local, A_block, QT_local, RT_buff);
             if (!ec)
             {
                 safeStat.add(ec);
@@ -335,22 +300,6 @@ Status SVDBatchKernel<algorithmFPType, method, cpu>::compute_thr(const size_t na
                     Q_block[i + j * cols_local] = QT_local[i * brows_local + j];
                 }
             }
-
-            /* Transpose R and zero lower values */
-            for (size_t i = 0; i < cols_local; i++)
-            {
-                size_t j;
-                PRAGMA_IVDEP
-                for (j = 0; j <= i; j++)
-                {
-                    RT_buff[k * cols_local + i * cols_local * blocks + j] = RT_local[i * cols_local + j];
-                }
-                PRAGMA_IVDEP
-                for (; j < cols_local; j++)
-                {
-                    RT_buff[k * cols_local + i * cols_local * blocks + j] = 0.0;
-                }
-            }
         });
     }
     if (!safeStat) return safeStat.detach();
@@ -102,7 +102,21 @@ Status OnlineContainer<algorithmFPType, method, cpu>::compute()
     size_t m = a0->getNumberOfColumns();
     size_t n = a0->getNumberOfRows();
 
-    Status s = partialResult->addPartialResultStorage<algorithmFPType>(m, n, svdPar);
+    Status s;
+    if (method == randomizedDense)
+    {
+        /* Every block keeps the l x m sketch of its rows and the n x l basis of its range */
+        const RandomizedParameter & randomizedPar = static_cast<const RandomizedParameter &>(svdPar);
+        const size_t k                            = randomizedPar.nComponents ? randomizedPar.nComponents : m;
+        size_t l                                  = k + randomizedPar.nOversamples;
+        if (l > m) l = m;
+        if (l > n) l = n;
+        s = partialResult->addPartialResultStorage<algorithmFPType>(m, n, l, svdPar);
+    }
+    else
+    {
+        s = partialResult->addPartialResultStorage<algorithmFPType>(m, n, svdPar);
+    }
     DAAL_CHECK_STATUS_VAR(s)
 
     const size_t nr                               = 2;
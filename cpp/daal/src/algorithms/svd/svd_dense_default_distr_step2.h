@@ -48,6 +48,11 @@ DAAL_EXPORT Status DistributedPartialResult::allocate(const daal::algorithms::In
     Argument::set(finalResultFromStep2Master, ResultPtr(new Result()));
     KeyValueDataCollectionPtr inCollection = static_cast<const DistributedStep2Input *>(input)->get(inputOfStep2FromStep1);
     size_t nBlocks                         = 0;
+    if (method == randomizedDense && parameter)
+    {
+        const RandomizedParameter * svdPar = static_cast<const RandomizedParameter *>(parameter);
+        return setPartialResultStorage<algorithmFPType>(inCollection.get(), nBlocks, svdPar->nComponents);
+    }
     return setPartialResultStorage<algorithmFPType>(inCollection.get(), nBlocks);
 }
 
@@ -105,6 +110,62 @@ DAAL_EXPORT Status DistributedPartialResult::setPartialResultStorage(KeyValueDat
     return st;
 }
 
+/**
+ * Allocates memory to store partial results of the randomizedDense method of the SVD algorithm based on the known structure
+ * of partial results from step 1 in the distributed processing mode.
+ * Every block gets the table that maps the sketch of the block range to the leading left singular vectors
+ * \tparam     algorithmFPType Data type to use for storage in the resulting HomogenNumericTable
+ * \param[in]  inCollection    KeyValueDataCollection of all partial results from the first step of  the SVD algorithm in the distributed
+ *                             processing mode
+ * \param[out] nBlocks         Number of rows in the input data set
+ * \param[in]  nComponents     Number of the leading singular values and vectors to compute, 0 means all of them
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT Status DistributedPartialResult::setPartialResultStorage(KeyValueDataCollection * inCollection, size_t & nBlocks, size_t nComponents)
+{
+    KeyValueDataCollectionPtr partialCollection = staticPointerCast<KeyValueDataCollection, SerializationIface>(Argument::get(outputOfStep2ForStep3));
+    if (!partialCollection)
+    {
+        return Status();
+    }
+
+    ResultPtr result = staticPointerCast<Result, SerializationIface>(Argument::get(finalResultFromStep2Master));
+
+    const size_t inSize = inCollection->size();
+    DAAL_CHECK(inSize <= services::internal::MaxVal<int>::get(), ErrorIncorrectNumberOfElementsInInputCollection)
+
+    DataCollection * fisrtNodeCollection = static_cast<DataCollection *>((*inCollection).getValueByIndex(0).get());
+    NumericTable * firstNumericTable     = static_cast<NumericTable *>((*fisrtNodeCollection)[0].get());
+
+    const size_t m = firstNumericTable->getNumberOfColumns();
+    const size_t k = nComponents ? nComponents : m;
+    if (result->get(singularValues).get() == nullptr)
+    {
+        Status s = result->allocateImpl<algorithmFPType>(m, 0, k);
+        DAAL_CHECK_STATUS_VAR(s)
+    }
+
+    nBlocks = 0;
+    Status st;
+    for (size_t i = 0; i < inSize; i++)
+    {
+        DataCollection * nodeCollection = static_cast<DataCollection *>((*inCollection).getValueByIndex((int)i).get());
+        size_t nodeKey                  = (*inCollection).getKeyByIndex((int)i);
+        size_t nodeSize                 = nodeCollection->size();
+        nBlocks += nodeSize;
+
+        DataCollectionPtr nodePartialResult(new DataCollection());
+        DAAL_CHECK_MALLOC(nodePartialResult)
+        for (size_t j = 0; j < nodeSize; j++)
+        {
+            const size_t l = static_cast<NumericTable *>((*nodeCollection)[j].get())->getNumberOfRows();
+            nodePartialResult->push_back(HomogenNumericTable<algorithmFPType>::create(k, l, NumericTable::doAllocate, &st));
+        }
+        (*partialCollection)[nodeKey] = nodePartialResult;
+    }
+    return st;
+}
+
 } // namespace interface1
 } // namespace svd
 } // namespace algorithms
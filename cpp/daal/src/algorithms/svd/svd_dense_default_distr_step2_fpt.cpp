@@ -35,6 +35,8 @@ template DAAL_EXPORT services::Status DistributedPartialResult::allocate<DAAL_FP
                                                                                       const int method);
 template DAAL_EXPORT services::Status DistributedPartialResult::setPartialResultStorage<DAAL_FPTYPE>(
     data_management::KeyValueDataCollection * inCollection, size_t & nBlocks);
+template DAAL_EXPORT services::Status DistributedPartialResult::setPartialResultStorage<DAAL_FPTYPE>(
+    data_management::KeyValueDataCollection * inCollection, size_t & nBlocks, size_t nComponents);
 
 } // namespace interface1
 } // namespace svd
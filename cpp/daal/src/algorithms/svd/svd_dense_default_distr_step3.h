@@ -71,6 +71,34 @@ DAAL_EXPORT Status DistributedPartialResultStep3::setPartialResultStorage(data_m
     return result->allocateImpl<algorithmFPType>(m, n);
 }
 
+/**
+ * Allocates memory to store partial results of the SVD algorithm obtained in the third step in the distributed processing mode
+ * \tparam     algorithmFPType  Data type to use for storage in the resulting HomogenNumericTable
+ * \param[in]  qCollection  DataCollection of all partial results from step 1 of the SVD algorithm in the distributed processing mode
+ * \param[in]  rCollection  DataCollection of all partial results from step 2 of the SVD algorithm in the distributed processing mode
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT Status DistributedPartialResultStep3::setPartialResultStorage(data_management::DataCollection * qCollection,
+                                                                          data_management::DataCollection * rCollection)
+{
+    if (!rCollection || rCollection->size() == 0)
+    {
+        return setPartialResultStorage<algorithmFPType>(qCollection);
+    }
+
+    size_t qSize = qCollection->size();
+    size_t n     = 0;
+    for (size_t i = 0; i < qSize; i++)
+    {
+        n += static_cast<data_management::NumericTable *>((*qCollection)[i].get())->getNumberOfRows();
+    }
+    /* The number of columns in the tables from step 2 is the number of the computed left singular vectors */
+    const size_t m   = static_cast<data_management::NumericTable *>((*rCollection)[0].get())->getNumberOfColumns();
+    ResultPtr result = services::staticPointerCast<Result, data_management::SerializationIface>(Argument::get(finalResultFromStep3));
+
+    return result->allocateImpl<algorithmFPType>(m, n);
+}
+
 } // namespace interface1
 } // namespace svd
 } // namespace algorithms
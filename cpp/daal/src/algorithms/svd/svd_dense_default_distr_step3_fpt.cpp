@@ -35,6 +35,8 @@ template DAAL_EXPORT services::Status DistributedPartialResultStep3::allocate<DA
                                                                                            const int method);
 template DAAL_EXPORT services::Status DistributedPartialResultStep3::setPartialResultStorage<DAAL_FPTYPE>(
     data_management::DataCollection * qCollection);
+template DAAL_EXPORT services::Status DistributedPartialResultStep3::setPartialResultStorage<DAAL_FPTYPE>(
+    data_management::DataCollection * qCollection, data_management::DataCollection * rCollection);
 
 } // namespace interface1
 } // namespace svd
@@ -28,5 +28,6 @@ namespace daal
 namespace algorithms
 {
 __DAAL_INSTANTIATE_DISPATCH_CONTAINER(svd::DistributedContainer, distributed, step3Local, DAAL_FPTYPE, svd::defaultDense)
+__DAAL_INSTANTIATE_DISPATCH_CONTAINER(svd::DistributedContainer, distributed, step3Local, DAAL_FPTYPE, svd::randomizedDense)
 }
 } // namespace daal
@@ -29,6 +29,7 @@
 #include "src/data_management/service_numeric_table.h"
 #include "src/externals/service_blas.h"
 #include "src/externals/service_lapack.h"
+#include "src/services/service_arrays.h"
 
 #include "src/threading/threading.h"
 
@@ -306,6 +307,84 @@ Status compute_gemm_on_one_node_seq(DAAL_INT m, DAAL_INT n, algorithmFPType * a,
     return Status();
 }
 
+/* Max number of blocks depending on arch */
+#if (__CPUID__(DAAL_CPU) >= __avx512_mic__)
+    #define DEF_MAX_BLOCKS 256
+#else
+    #define DEF_MAX_BLOCKS 128
+#endif
+
+/*
+    Splitting of the tall-and-skinny matrix A[rows,cols] into the blocks of rows for the blocked QR decomposition:
+    blocks     = number of blocks,
+    brows      = number of rows in blocks,
+    brows_last = number of rows in last block
+*/
+inline void compute_tsqr_blocking(size_t rows, size_t cols, size_t & blocks, size_t & brows, size_t & brows_last)
+{
+    /* Block size calculation (empirical) */
+    const int bshift = (rows <= 10000) ? 11 : 12;
+    size_t bsize     = ((rows * cols) >> bshift) & (~0xf);
+    bsize            = (bsize < 200) ? 200 : bsize;
+
+    size_t def_min_brows = rows / DEF_MAX_BLOCKS;                           // min block size
+    brows                = (rows > bsize) ? bsize : rows;                   /* brows cannot be less than rows */
+    brows                = (brows < cols) ? cols : brows;                   /* brows cannot be less than cols */
+    brows                = (brows < def_min_brows) ? def_min_brows : brows; /* brows cannot be less than n/DEF_MAX_BLOCKS */
+    blocks               = rows / brows;
+
+    brows_last = brows + (rows - blocks * brows); /* last block is generally biggest */
+}
+
+/*
+    QR decomposition of the k-th block A_k[brows_local,cols] of the tall-and-skinny matrix split into the blocks of rows
+    Input:
+      A_block   : A_k in row-major order
+    Output:
+      QT_block  : Q_k in column-major order
+      RT_stacked: R_k is written into the k-th block of the column-major (cols * blocks) x cols matrix of the stacked R factors,
+                  the values below the diagonal are zeroed
+*/
+template <typename algorithmFPType, CpuType cpu>
+Status compute_tsqr_block_seq(size_t k, size_t blocks, size_t brows_local, size_t cols, const algorithmFPType * A_block, algorithmFPType * QT_block,
+                              algorithmFPType * RT_stacked)
+{
+    TArrayScalable<algorithmFPType, cpu> RT_local_Arr(cols * cols);
+    algorithmFPType * RT_local = RT_local_Arr.get();
+    DAAL_CHECK_MALLOC(RT_local);
+
+    /* Get transposed Q from A */
+    for (size_t i = 0; i < cols; i++)
+    {
+        PRAGMA_IVDEP
+        for (size_t j = 0; j < brows_local; j++)
+        {
+            QT_block[i * brows_local + j] = A_block[i + j * cols];
+        }
+    }
+
+    /* Call QR on local nodes */
+    Status s = compute_QR_on_one_node_seq<algorithmFPType, cpu>(brows_local, cols, QT_block, brows_local, RT_local, cols);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    /* Transpose R and zero lower values */
+    for (size_t i = 0; i < cols; i++)
+    {
+        size_t j;
+        PRAGMA_IVDEP
+        for (j = 0; j <= i; j++)
+        {
+            RT_stacked[k * cols + i * cols * blocks + j] = RT_local[i * cols + j];
+        }
+        PRAGMA_IVDEP
+        for (; j < cols; j++)
+        {
+            RT_stacked[k * cols + i * cols * blocks + j] = 0.0;
+        }
+    }
+    return s;
+}
+
 } // namespace internal
 } // namespace svd
 } // namespace algorithms
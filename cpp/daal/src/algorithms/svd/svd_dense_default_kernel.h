@@ -75,6 +75,39 @@ public:
     Status compute(const size_t na, const NumericTable * const * a, const size_t nr, NumericTable * r[], const daal::algorithms::Parameter * par = 0);
 };
 
+/**
+ *  \brief Kernels of the randomizedDense method that sketch the range of the input data set before the decomposition
+ */
+template <typename algorithmFPType, CpuType cpu>
+class SVDBatchKernel<algorithmFPType, randomizedDense, cpu> : public Kernel
+{
+public:
+    Status compute(const size_t na, const NumericTable * const * a, const size_t nr, NumericTable * r[], const daal::algorithms::Parameter * par = 0);
+};
+
+template <typename algorithmFPType, CpuType cpu>
+class SVDOnlineKernel<algorithmFPType, randomizedDense, cpu> : public Kernel
+{
+public:
+    Status compute(const size_t na, const NumericTable * const * a, const size_t nr, NumericTable * r[], const daal::algorithms::Parameter * par = 0);
+    Status finalizeCompute(const size_t na, const NumericTable * const * a, const size_t nr, NumericTable * r[],
+                           const daal::algorithms::Parameter * par = 0);
+};
+
+template <typename algorithmFPType, CpuType cpu>
+class SVDDistributedStep2Kernel<algorithmFPType, randomizedDense, cpu> : public Kernel
+{
+public:
+    Status compute(const size_t na, const NumericTable * const * a, const size_t nr, NumericTable * r[], const daal::algorithms::Parameter * par = 0);
+};
+
+template <typename algorithmFPType, CpuType cpu>
+class SVDDistributedStep3Kernel<algorithmFPType, randomizedDense, cpu> : public Kernel
+{
+public:
+    Status compute(const size_t na, const NumericTable * const * a, const size_t nr, NumericTable * r[], const daal::algorithms::Parameter * par = 0);
+};
+
 } // namespace internal
 } // namespace svd
 } // namespace algorithms
@@ -102,6 +102,32 @@ DAAL_EXPORT Status OnlinePartialResult::addPartialResultStorage(size_t m, size_t
     return st;
 }
 
+/**
+ * Allocates additional memory to store partial results of the randomizedDense method of the SVD algorithm
+ * for each subsequent compute() method
+ * \tparam     algorithmFPType    Data type to use for storage in the resulting HomogenNumericTable
+ * \param[in]  m    Number of columns in the input data set
+ * \param[in]  n    Number of rows in the input data set
+ * \param[in]  l    Number of vectors in the sketch of the range of the input data set
+ * \param[in]  par  Reference to the object with the algorithm parameters
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT Status OnlinePartialResult::addPartialResultStorage(size_t m, size_t n, size_t l, Parameter & par)
+{
+    DataCollectionPtr rCollection = staticPointerCast<DataCollection, SerializationIface>(Argument::get(outputOfStep1ForStep2));
+    DAAL_CHECK_EX(rCollection, ErrorNullOutputDataCollection, ArgumentName, outputOfStep1ForStep2Str());
+    Status st;
+    rCollection->push_back(HomogenNumericTable<algorithmFPType>::create(m, l, NumericTable::doAllocate, &st));
+
+    if (par.leftSingularMatrix != notRequired)
+    {
+        DataCollectionPtr qCollection = staticPointerCast<DataCollection, SerializationIface>(Argument::get(outputOfStep1ForStep3));
+        DAAL_CHECK_EX(qCollection, ErrorNullOutputDataCollection, ArgumentName, outputOfStep1ForStep3Str());
+        qCollection->push_back(HomogenNumericTable<algorithmFPType>::create(l, n, NumericTable::doAllocate, &st));
+    }
+    return st;
+}
+
 } // namespace interface1
 } // namespace svd
 } // namespace algorithms
@@ -35,6 +35,7 @@ template DAAL_EXPORT Status OnlinePartialResult::allocate<DAAL_FPTYPE>(const daa
 template DAAL_EXPORT Status OnlinePartialResult::initialize<DAAL_FPTYPE>(const daal::algorithms::Input * input,
                                                                          const daal::algorithms::Parameter * parameter, const int method);
 template DAAL_EXPORT Status OnlinePartialResult::addPartialResultStorage<DAAL_FPTYPE>(size_t m, size_t n, Parameter & par);
+template DAAL_EXPORT Status OnlinePartialResult::addPartialResultStorage<DAAL_FPTYPE>(size_t m, size_t n, size_t l, Parameter & par);
 
 } // namespace interface1
 } // namespace svd
@@ -0,0 +1,150 @@
+/* file: svd_dense_randomized_batch_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the randomized SVD in the batch processing mode
+//--
+*/
+
+#ifndef __SVD_DENSE_RANDOMIZED_BATCH_IMPL_I__
+#define __SVD_DENSE_RANDOMIZED_BATCH_IMPL_I__
+
+#include "src/algorithms/svd/svd_dense_randomized_impl.i"
+#include "src/data_management/service_numeric_table.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace svd
+{
+namespace internal
+{
+/**
+ *  \brief Kernel for the randomized SVD calculation
+ */
+template <typename algorithmFPType, CpuType cpu>
+Status SVDBatchKernel<algorithmFPType, randomizedDense, cpu>::compute(const size_t na, const NumericTable * const * a, const size_t nr,
+                                                                      NumericTable * r[], const daal::algorithms::Parameter * par)
+{
+    const RandomizedParameter * svdPar = static_cast<const RandomizedParameter *>(par);
+    DAAL_CHECK(svdPar->engine, ErrorIncorrectEngineParameter);
+
+    NumericTable * ntA     = const_cast<NumericTable *>(a[0]);
+    NumericTable * ntSigma = r[0];
+
+    const size_t n = ntA->getNumberOfRows();
+    const size_t p = ntA->getNumberOfColumns();
+    const size_t k = ntSigma->getNumberOfColumns();
+    DAAL_CHECK(k <= n && k <= p, ErrorIncorrectNComponents);
+
+    /* Size of the sketch of the range of A */
+    size_t l = k + svdPar->nOversamples;
+    l        = (l > p) ? p : l;
+    l        = (l > n) ? n : l;
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, l);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, p, l);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, l, l);
+    TArray<algorithmFPType, cpu> qPtr(n * l);
+    TArray<algorithmFPType, cpu> zPtr(p * l);
+    TArrayCalloc<algorithmFPType, cpu> rPtr(l * l);
+    TArray<algorithmFPType, cpu> mPtr(l * l);
+    TArray<algorithmFPType, cpu> sPtr(l);
+    TArray<algorithmFPType, cpu> uPtr(l * l);
+    TArray<algorithmFPType, cpu> vtPtr(l * l);
+    DAAL_CHECK(qPtr.get() && zPtr.get() && rPtr.get() && mPtr.get() && sPtr.get() && uPtr.get() && vtPtr.get(), ErrorMemoryAllocationFailed);
+    algorithmFPType * const q  = qPtr.get();
+    algorithmFPType * const z  = zPtr.get();
+    algorithmFPType * const rz = rPtr.get();
+    algorithmFPType * const m  = mPtr.get();
+    algorithmFPType * const u  = uPtr.get();
+    algorithmFPType * const vt = vtPtr.get();
+
+    Status s;
+    {
+        ReadRows<algorithmFPType, cpu, NumericTable> aBlock(ntA, 0, n);
+        DAAL_CHECK_BLOCK_STATUS(aBlock);
+        const algorithmFPType * const aData = aBlock.get();
+
+        DAAL_CHECK_STATUS(s, (compute_range_basis<algorithmFPType, cpu>(n, p, l, aData, svdPar->nPowerIterations, *svdPar->engine, q)));
+
+        /* A ~ Q * Q^T * A = Q * Z^T, where Z = A^T * Q = Q_Z * R_Z */
+        const DAAL_INT nn = n;
+        const DAAL_INT pp = p;
+        const DAAL_INT ll = l;
+        const algorithmFPType one(1.0);
+        const algorithmFPType zero(0.0);
+        const char notrans = 'N';
+        const char trans   = 'T';
+        Blas<algorithmFPType, cpu>::xgemm(&notrans, &trans, &ll, &pp, &nn, &one, q, &ll, aData, &pp, &zero, z, &ll);
+    }
+    DAAL_CHECK_STATUS(s, (compute_tsqr_on_one_node<algorithmFPType, cpu>(p, l, z, rz)));
+
+    /* R_Z^T = U_M * S * V_M^T, so that A ~ (Q * U_M) * S * (Q_Z * V_M)^T */
+    for (size_t i = 0; i < l; i++)
+    {
+        PRAGMA_IVDEP
+        for (size_t j = 0; j < l; j++)
+        {
+            m[j * l + i] = rz[i * l + j];
+        }
+    }
+    DAAL_CHECK_STATUS(s, (compute_svd_on_one_node<algorithmFPType, cpu>(l, l, m, l, sPtr.get(), u, l, vt, l)));
+
+    {
+        WriteOnlyRows<algorithmFPType, cpu, NumericTable> sigmaBlock(ntSigma, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(sigmaBlock);
+        algorithmFPType * const sigma = sigmaBlock.get();
+        for (size_t i = 0; i < k; i++)
+        {
+            sigma[i] = sPtr[i];
+        }
+    }
+
+    const DAAL_INT pp = p;
+    const DAAL_INT ll = l;
+    const DAAL_INT kk = k;
+    const algorithmFPType one(1.0);
+    const algorithmFPType zero(0.0);
+    const char notrans = 'N';
+    const char trans   = 'T';
+
+    if (svdPar->rightSingularMatrix == requiredInPackedForm)
+    {
+        WriteOnlyRows<algorithmFPType, cpu, NumericTable> vBlock(r[2], 0, k);
+        DAAL_CHECK_BLOCK_STATUS(vBlock);
+        Blas<algorithmFPType, cpu>::xgemm(&trans, &trans, &pp, &kk, &ll, &one, z, &ll, vt, &ll, &zero, vBlock.get(), &pp);
+    }
+
+    if (svdPar->leftSingularMatrix == requiredInPackedForm)
+    {
+        const DAAL_INT nn = n;
+        WriteOnlyRows<algorithmFPType, cpu, NumericTable> uBlock(r[1], 0, n);
+        DAAL_CHECK_BLOCK_STATUS(uBlock);
+        Blas<algorithmFPType, cpu>::xgemm(&trans, &notrans, &kk, &nn, &ll, &one, u, &ll, q, &ll, &zero, uBlock.get(), &kk);
+    }
+    return s;
+}
+
+} // namespace internal
+} // namespace svd
+} // namespace algorithms
+} // namespace daal
+
+#endif
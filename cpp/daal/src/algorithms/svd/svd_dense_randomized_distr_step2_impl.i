@@ -0,0 +1,74 @@
+/* file: svd_dense_randomized_distr_step2_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the randomized SVD in the second step of the distributed processing mode
+//--
+*/
+
+#ifndef __SVD_DENSE_RANDOMIZED_DISTR_STEP2_IMPL_I__
+#define __SVD_DENSE_RANDOMIZED_DISTR_STEP2_IMPL_I__
+
+#include "src/algorithms/svd/svd_dense_randomized_impl.i"
+#include "src/data_management/service_numeric_table.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace svd
+{
+namespace internal
+{
+/**
+ *  \brief Decomposes the stacked sketches from all the nodes and splits their left singular vectors between the data blocks
+ */
+template <typename algorithmFPType, CpuType cpu>
+Status SVDDistributedStep2Kernel<algorithmFPType, randomizedDense, cpu>::compute(const size_t na, const NumericTable * const * a, const size_t nr,
+                                                                                 NumericTable * r[], const daal::algorithms::Parameter * par)
+{
+    const svd::Parameter * svdPar = static_cast<const svd::Parameter *>(par);
+
+    const size_t nBlocks   = na;
+    NumericTable * ntSigma = r[0];
+    NumericTable * ntV     = (svdPar->rightSingularMatrix == requiredInPackedForm) ? r[1] : nullptr;
+    const size_t k         = ntSigma->getNumberOfColumns();
+
+    TArray<algorithmFPType, cpu> uB;
+    Status s;
+    DAAL_CHECK_STATUS(s, (compute_stacked_sketch_svd<algorithmFPType, cpu>(nBlocks, a, ntSigma, ntV, true, uB)));
+
+    size_t offset = 0;
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        const size_t nRows = a[i]->getNumberOfRows();
+        WriteOnlyRows<algorithmFPType, cpu, NumericTable> uBlock(r[i + 2], 0, nRows);
+        DAAL_CHECK_BLOCK_STATUS(uBlock);
+        const size_t size = nRows * k * sizeof(algorithmFPType);
+        DAAL_CHECK(!daal::services::internal::daal_memcpy_s(uBlock.get(), size, uB.get() + offset * k, size), ErrorMemoryCopyFailedInternal);
+        offset += nRows;
+    }
+    return s;
+}
+
+} // namespace internal
+} // namespace svd
+} // namespace algorithms
+} // namespace daal
+
+#endif
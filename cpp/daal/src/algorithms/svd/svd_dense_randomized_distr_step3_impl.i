@@ -0,0 +1,86 @@
+/* file: svd_dense_randomized_distr_step3_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the randomized SVD in the third step of the distributed processing mode
+//--
+*/
+
+#ifndef __SVD_DENSE_RANDOMIZED_DISTR_STEP3_IMPL_I__
+#define __SVD_DENSE_RANDOMIZED_DISTR_STEP3_IMPL_I__
+
+#include "src/algorithms/svd/svd_dense_randomized_impl.i"
+#include "src/data_management/service_numeric_table.h"
+#include "src/algorithms/service_error_handling.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace svd
+{
+namespace internal
+{
+/**
+ *  \brief Maps the left singular vectors of the stacked sketches back to the local data blocks: U_i = Q_i * U_B_i
+ */
+template <typename algorithmFPType, CpuType cpu>
+Status SVDDistributedStep3Kernel<algorithmFPType, randomizedDense, cpu>::compute(const size_t na, const NumericTable * const * a, const size_t nr,
+                                                                                 NumericTable * r[], const daal::algorithms::Parameter * par)
+{
+    const size_t nBlocks              = na / 2;
+    const NumericTable * const * ntQ  = a;
+    const NumericTable * const * ntUB = a + nBlocks;
+    const size_t k                    = ntUB[0]->getNumberOfColumns();
+
+    TArray<size_t, cpu> rowOffsetsPtr(nBlocks);
+    size_t * const rowOffsets = rowOffsetsPtr.get();
+    DAAL_CHECK_MALLOC(rowOffsets);
+    size_t nRows = 0;
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        rowOffsets[i] = nRows;
+        nRows += ntQ[i]->getNumberOfRows();
+    }
+
+    WriteOnlyRows<algorithmFPType, cpu, NumericTable> uBlock(r[0], 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(uBlock);
+    algorithmFPType * const u = uBlock.get();
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        NumericTable * ntQi  = const_cast<NumericTable *>(ntQ[iBlock]);
+        NumericTable * ntUBi = const_cast<NumericTable *>(ntUB[iBlock]);
+        const size_t ni      = ntQi->getNumberOfRows();
+        const size_t li      = ntQi->getNumberOfColumns();
+
+        ReadRows<algorithmFPType, cpu, NumericTable> qBlock(ntQi, 0, ni);
+        DAAL_CHECK_BLOCK_STATUS_THR(qBlock);
+        ReadRows<algorithmFPType, cpu, NumericTable> ubBlock(ntUBi, 0, li);
+        DAAL_CHECK_BLOCK_STATUS_THR(ubBlock);
+        compute_block_left_vectors_seq<algorithmFPType, cpu>(ni, li, k, qBlock.get(), ubBlock.get(), u + rowOffsets[iBlock] * k);
+    });
+    return safeStat.detach();
+}
+
+} // namespace internal
+} // namespace svd
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,350 @@
+/* file: svd_dense_randomized_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Common functions of the randomized SVD: the blocked tall-and-skinny QR decomposition,
+//  the randomized range finder with power iterations and the decomposition of the stacked sketches.
+//  All the matrices are stored in row-major order unless stated otherwise.
+//--
+*/
+
+#ifndef __SVD_DENSE_RANDOMIZED_IMPL_I__
+#define __SVD_DENSE_RANDOMIZED_IMPL_I__
+
+#include "algorithms/engines/engine.h"
+#include "src/algorithms/svd/svd_dense_default_impl.i"
+#include "src/algorithms/distributions/normal/normal_kernel.h"
+#include "src/algorithms/distributions/normal/normal_impl.i"
+#include "src/externals/service_memory.h"
+#include "src/externals/service_blas.h"
+#include "src/data_management/service_numeric_table.h"
+#include "src/threading/threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace svd
+{
+namespace internal
+{
+using namespace daal::algorithms::distributions::normal::internal;
+
+/*
+  Blocked tall-and-skinny QR decomposition of A (nRows x nCols, nRows >= nCols)
+  Input:
+    a at input : A
+  Output:
+    a at output: Q (nRows x nCols) with orthonormal columns
+    r at output: R (nCols x nCols) upper triangular matrix in column-major order, optional
+*/
+template <typename algorithmFPType, CpuType cpu>
+Status compute_tsqr_on_one_node(size_t nRows, size_t nCols, algorithmFPType * a, algorithmFPType * r)
+{
+    size_t blocks, brows, browsLast;
+    compute_tsqr_blocking(nRows, nCols, blocks, brows, browsLast);
+    const size_t ldRt = nCols * blocks;
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows, nCols);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, ldRt, nCols);
+    TArray<algorithmFPType, cpu> qtPtr(nRows * nCols);
+    TArray<algorithmFPType, cpu> rtPtr(ldRt * nCols);
+    TArrayCalloc<algorithmFPType, cpu> rMasterPtr(nCols * nCols);
+    algorithmFPType * const qt      = qtPtr.get();
+    algorithmFPType * const rt      = rtPtr.get();
+    algorithmFPType * const rMaster = rMasterPtr.get();
+    DAAL_CHECK(qt && rt && rMaster, ErrorMemoryAllocationFailed);
+
+    SafeStatus safeStat;
+    /* Step 1: QR decompositions of the blocks, R factors are stacked into the column-major (nCols * blocks) x nCols matrix */
+    daal::threader_for(blocks, blocks, [&](size_t iBlock) {
+        const size_t browsLocal         = (iBlock == blocks - 1) ? browsLast : brows;
+        const algorithmFPType * aBlock  = a + iBlock * brows * nCols;
+        algorithmFPType * const qtBlock = qt + iBlock * brows * nCols;
+
+        const Status localStatus = compute_tsqr_block_seq<algorithmFPType, cpu>(iBlock, blocks, browsLocal, nCols, aBlock, qtBlock, rt);
+        DAAL_CHECK_STATUS_THR(localStatus);
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    /* Step 2: QR decomposition of the stacked R factors */
+    Status s = compute_QR_on_one_node<algorithmFPType, cpu>(ldRt, nCols, rt, ldRt, rMaster, nCols);
+    DAAL_CHECK_STATUS_VAR(s);
+    if (r)
+    {
+        const size_t size = nCols * nCols * sizeof(algorithmFPType);
+        DAAL_CHECK(!daal::services::internal::daal_memcpy_s(r, size, rMaster, size), ErrorMemoryCopyFailedInternal);
+    }
+
+    /* Step 3: Q of every block is multiplied by the corresponding block of Q of the stacked R factors */
+    daal::threader_for(blocks, blocks, [&](size_t iBlock) {
+        const DAAL_INT browsLocal = (iBlock == blocks - 1) ? browsLast : brows;
+        const DAAL_INT ldq        = ldRt;
+        const DAAL_INT cols       = nCols;
+        const algorithmFPType one(1.0);
+        const algorithmFPType zero(0.0);
+        const char trans = 'T';
+
+        Blas<algorithmFPType, cpu>::xxgemm(&trans, &trans, &cols, &browsLocal, &cols, &one, rt + iBlock * nCols, &ldq, qt + iBlock * brows * nCols,
+                                           &browsLocal, &zero, a + iBlock * brows * nCols, &cols);
+    });
+    return s;
+}
+
+/*
+  Randomized range finder with power iterations
+  Input:
+    a: A (n x p)
+  Output:
+    q: Q (n x l) with orthonormal columns that approximately span the range of A
+*/
+template <typename algorithmFPType, CpuType cpu>
+Status compute_range_basis(size_t n, size_t p, size_t l, const algorithmFPType * a, size_t nPowerIterations, engines::BatchBase & engine,
+                           algorithmFPType * q)
+{
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, p, l);
+    TArray<algorithmFPType, cpu> zPtr(p * l);
+    algorithmFPType * const z = zPtr.get();
+    DAAL_CHECK_MALLOC(z);
+
+    Status s;
+    const distributions::normal::Parameter<algorithmFPType> normalPar(algorithmFPType(0.0), algorithmFPType(1.0));
+    DAAL_CHECK_STATUS(s, (NormalKernelDefault<algorithmFPType, cpu>::compute(&normalPar, engine, p * l, z)));
+
+    const DAAL_INT nn = n;
+    const DAAL_INT pp = p;
+    const DAAL_INT ll = l;
+    const algorithmFPType one(1.0);
+    const algorithmFPType zero(0.0);
+    const char notrans = 'N';
+    const char trans   = 'T';
+
+    /* Y = A * Omega */
+    Blas<algorithmFPType, cpu>::xgemm(&notrans, &notrans, &ll, &nn, &pp, &one, z, &ll, a, &pp, &zero, q, &ll);
+    DAAL_CHECK_STATUS(s, (compute_tsqr_on_one_node<algorithmFPType, cpu>(n, l, q, nullptr)));
+
+    for (size_t iter = 0; iter < nPowerIterations; iter++)
+    {
+        /* Z = A^T * Q */
+        Blas<algorithmFPType, cpu>::xgemm(&notrans, &trans, &ll, &pp, &nn, &one, q, &ll, a, &pp, &zero, z, &ll);
+        DAAL_CHECK_STATUS(s, (compute_tsqr_on_one_node<algorithmFPType, cpu>(p, l, z, nullptr)));
+
+        /* Y = A * Z */
+        Blas<algorithmFPType, cpu>::xgemm(&notrans, &notrans, &ll, &nn, &pp, &one, z, &ll, a, &pp, &zero, q, &ll);
+        DAAL_CHECK_STATUS(s, (compute_tsqr_on_one_node<algorithmFPType, cpu>(n, l, q, nullptr)));
+    }
+    return s;
+}
+
+/*
+  Projection of the data onto the basis of its range
+  Input:
+    a: A (n x p)
+    q: Q (n x l)
+  Output:
+    b: B = Q^T * A (l x p)
+*/
+template <typename algorithmFPType, CpuType cpu>
+void compute_range_projection(size_t n, size_t p, size_t l, const algorithmFPType * a, const algorithmFPType * q, algorithmFPType * b)
+{
+    const DAAL_INT nn = n;
+    const DAAL_INT pp = p;
+    const DAAL_INT ll = l;
+    const algorithmFPType one(1.0);
+    const algorithmFPType zero(0.0);
+    const char notrans = 'N';
+    const char trans   = 'T';
+
+    Blas<algorithmFPType, cpu>::xgemm(&notrans, &trans, &pp, &ll, &nn, &one, a, &pp, q, &ll, &zero, b, &pp);
+}
+
+/*
+  Leading singular triplets of the stacked sketches of the data blocks
+  Input:
+    b at input : B (nSketchRows x p), contents are destroyed
+  Output:
+    sigma: k leading singular values of B
+    v    : V (k x p), rows are the leading right singular vectors of B
+    uB   : U_B (nSketchRows x k), columns are the leading left singular vectors of B, optional
+*/
+template <typename algorithmFPType, CpuType cpu>
+Status compute_sketch_svd(size_t nSketchRows, size_t p, size_t k, algorithmFPType * b, algorithmFPType * sigma, algorithmFPType * v,
+                          algorithmFPType * uB)
+{
+    const DAAL_INT pp = p;
+    const DAAL_INT kk = k;
+    const DAAL_INT ll = nSketchRows;
+    const algorithmFPType one(1.0);
+    const algorithmFPType zero(0.0);
+    const char notrans = 'N';
+    const char trans   = 'T';
+
+    Status s;
+    if (nSketchRows > p)
+    {
+        /* B = Q_B * R_B, R_B = U_R * S * V^T, U_B = Q_B * U_R */
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, p, p);
+        TArray<algorithmFPType, cpu> rPtr(p * p);
+        TArray<algorithmFPType, cpu> sPtr(p);
+        TArray<algorithmFPType, cpu> uPtr(p * p);
+        TArray<algorithmFPType, cpu> vtPtr(p * p);
+        DAAL_CHECK(rPtr.get() && sPtr.get() && uPtr.get() && vtPtr.get(), ErrorMemoryAllocationFailed);
+        algorithmFPType * const rFactor = rPtr.get();
+        algorithmFPType * const u       = uPtr.get();
+        algorithmFPType * const vt      = vtPtr.get();
+
+        service_memset<algorithmFPType, cpu>(rFactor, zero, p * p);
+        DAAL_CHECK_STATUS(s, (compute_tsqr_on_one_node<algorithmFPType, cpu>(nSketchRows, p, b, rFactor)));
+        DAAL_CHECK_STATUS(s, (compute_svd_on_one_node<algorithmFPType, cpu>(pp, pp, rFactor, pp, sPtr.get(), u, pp, vt, pp)));
+
+        for (size_t i = 0; i < k; i++)
+        {
+            sigma[i] = sPtr[i];
+            PRAGMA_IVDEP
+            for (size_t j = 0; j < p; j++)
+            {
+                v[i * p + j] = vt[j * p + i];
+            }
+        }
+        if (uB)
+        {
+            Blas<algorithmFPType, cpu>::xgemm(&trans, &notrans, &kk, &ll, &pp, &one, u, &pp, b, &pp, &zero, uB, &kk);
+        }
+        return s;
+    }
+
+    /* B^T = V * S * U_B^T is decomposed directly as the row-major B is the column-major B^T */
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, p, nSketchRows);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nSketchRows, nSketchRows);
+    TArray<algorithmFPType, cpu> sPtr(nSketchRows);
+    TArray<algorithmFPType, cpu> uPtr(p * nSketchRows);
+    TArray<algorithmFPType, cpu> vtPtr(nSketchRows * nSketchRows);
+    DAAL_CHECK(sPtr.get() && uPtr.get() && vtPtr.get(), ErrorMemoryAllocationFailed);
+    const algorithmFPType * const u  = uPtr.get();
+    const algorithmFPType * const vt = vtPtr.get();
+
+    DAAL_CHECK_STATUS(s, (compute_svd_on_one_node<algorithmFPType, cpu>(pp, ll, b, pp, sPtr.get(), uPtr.get(), pp, vtPtr.get(), ll)));
+
+    for (size_t i = 0; i < k; i++)
+    {
+        sigma[i] = sPtr[i];
+    }
+    const size_t size = k * p * sizeof(algorithmFPType);
+    DAAL_CHECK(!daal::services::internal::daal_memcpy_s(v, size, u, size), ErrorMemoryCopyFailedInternal);
+    if (uB)
+    {
+        for (size_t i = 0; i < nSketchRows; i++)
+        {
+            PRAGMA_IVDEP
+            for (size_t j = 0; j < k; j++)
+            {
+                uB[i * k + j] = vt[i * nSketchRows + j];
+            }
+        }
+    }
+    return s;
+}
+
+/*
+  Leading singular triplets of the sketches of all the data blocks stacked one under another
+  Input:
+    ntB    : sketches B_i (l_i x p) of the data blocks
+  Output:
+    ntSigma: k leading singular values
+    ntV    : V (k x p), optional
+    uB     : U_B (sum(l_i) x k), leading left singular vectors of the stacked sketches, computed if requested
+*/
+template <typename algorithmFPType, CpuType cpu>
+Status compute_stacked_sketch_svd(size_t nBlocks, const NumericTable * const * ntB, NumericTable * ntSigma, NumericTable * ntV, bool computeLeft,
+                                  TArray<algorithmFPType, cpu> & uB)
+{
+    const size_t p = ntB[0]->getNumberOfColumns();
+    const size_t k = ntSigma->getNumberOfColumns();
+
+    size_t nSketchRows = 0;
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        nSketchRows += ntB[i]->getNumberOfRows();
+    }
+    DAAL_CHECK(k <= nSketchRows && k <= p, ErrorIncorrectNComponents);
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nSketchRows, p);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nSketchRows, k);
+    TArray<algorithmFPType, cpu> bPtr(nSketchRows * p);
+    TArray<algorithmFPType, cpu> vPtr(k * p);
+    DAAL_CHECK(bPtr.get() && vPtr.get(), ErrorMemoryAllocationFailed);
+    if (computeLeft)
+    {
+        uB.reset(nSketchRows * k);
+        DAAL_CHECK_MALLOC(uB.get());
+    }
+
+    size_t offset = 0;
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        const size_t nRows = ntB[i]->getNumberOfRows();
+        ReadRows<algorithmFPType, cpu, NumericTable> bBlock(const_cast<NumericTable *>(ntB[i]), 0, nRows);
+        DAAL_CHECK_BLOCK_STATUS(bBlock);
+        const size_t size = nRows * p * sizeof(algorithmFPType);
+        DAAL_CHECK(!daal::services::internal::daal_memcpy_s(bPtr.get() + offset * p, size, bBlock.get(), size), ErrorMemoryCopyFailedInternal);
+        offset += nRows;
+    }
+
+    WriteOnlyRows<algorithmFPType, cpu, NumericTable> sigmaBlock(ntSigma, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(sigmaBlock);
+
+    Status s;
+    DAAL_CHECK_STATUS(s, (compute_sketch_svd<algorithmFPType, cpu>(nSketchRows, p, k, bPtr.get(), sigmaBlock.get(), vPtr.get(), uB.get())));
+
+    if (ntV)
+    {
+        WriteOnlyRows<algorithmFPType, cpu, NumericTable> vBlock(ntV, 0, k);
+        DAAL_CHECK_BLOCK_STATUS(vBlock);
+        const size_t size = k * p * sizeof(algorithmFPType);
+        DAAL_CHECK(!daal::services::internal::daal_memcpy_s(vBlock.get(), size, vPtr.get(), size), ErrorMemoryCopyFailedInternal);
+    }
+    return s;
+}
+
+/*
+  Leading left singular vectors that correspond to a data block
+  Input:
+    q : Q (n x l), basis of the range of the block
+    uB: U_B (l x k), block of the left singular vectors of the stacked sketches
+  Output:
+    u : U = Q * U_B (n x k)
+*/
+template <typename algorithmFPType, CpuType cpu>
+void compute_block_left_vectors_seq(size_t n, size_t l, size_t k, const algorithmFPType * q, const algorithmFPType * uB, algorithmFPType * u)
+{
+    const DAAL_INT nn = n;
+    const DAAL_INT kk = k;
+    const DAAL_INT ll = l;
+    const algorithmFPType one(1.0);
+    const algorithmFPType zero(0.0);
+    const char notrans = 'N';
+
+    Blas<algorithmFPType, cpu>::xxgemm(&notrans, &notrans, &kk, &nn, &ll, &one, uB, &kk, q, &ll, &zero, u, &kk);
+}
+
+} // namespace internal
+} // namespace svd
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,145 @@
+/* file: svd_dense_randomized_online_impl.i */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the randomized SVD in the online processing mode and
+//  the first step of the distributed processing mode
+//--
+*/
+
+#ifndef __SVD_DENSE_RANDOMIZED_ONLINE_IMPL_I__
+#define __SVD_DENSE_RANDOMIZED_ONLINE_IMPL_I__
+
+#include "src/algorithms/svd/svd_dense_randomized_impl.i"
+#include "src/data_management/service_numeric_table.h"
+#include "src/algorithms/service_error_handling.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace svd
+{
+namespace internal
+{
+/**
+ *  \brief Computes the basis Q_i of the range of the data block A_i and the sketch B_i = Q_i^T * A_i of the block
+ */
+template <typename algorithmFPType, CpuType cpu>
+Status SVDOnlineKernel<algorithmFPType, randomizedDense, cpu>::compute(const size_t na, const NumericTable * const * a, const size_t nr,
+                                                                       NumericTable * r[], const daal::algorithms::Parameter * par)
+{
+    const RandomizedParameter * svdPar = static_cast<const RandomizedParameter *>(par);
+    DAAL_CHECK(svdPar->engine, ErrorIncorrectEngineParameter);
+
+    NumericTable * ntA = const_cast<NumericTable *>(a[0]);
+    NumericTable * ntB = r[1];
+
+    const size_t n = ntA->getNumberOfRows();
+    const size_t p = ntA->getNumberOfColumns();
+    const size_t l = ntB->getNumberOfRows();
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, l);
+    TArray<algorithmFPType, cpu> qPtr(n * l);
+    algorithmFPType * const q = qPtr.get();
+    DAAL_CHECK_MALLOC(q);
+
+    ReadRows<algorithmFPType, cpu, NumericTable> aBlock(ntA, 0, n);
+    DAAL_CHECK_BLOCK_STATUS(aBlock);
+    const algorithmFPType * const aData = aBlock.get();
+
+    Status s;
+    DAAL_CHECK_STATUS(s, (compute_range_basis<algorithmFPType, cpu>(n, p, l, aData, svdPar->nPowerIterations, *svdPar->engine, q)));
+
+    {
+        WriteOnlyRows<algorithmFPType, cpu, NumericTable> bBlock(ntB, 0, l);
+        DAAL_CHECK_BLOCK_STATUS(bBlock);
+        compute_range_projection<algorithmFPType, cpu>(n, p, l, aData, q, bBlock.get());
+    }
+
+    if (svdPar->leftSingularMatrix != notRequired && r[0])
+    {
+        WriteOnlyRows<algorithmFPType, cpu, NumericTable> qBlock(r[0], 0, n);
+        DAAL_CHECK_BLOCK_STATUS(qBlock);
+        const size_t size = n * l * sizeof(algorithmFPType);
+        DAAL_CHECK(!daal::services::internal::daal_memcpy_s(qBlock.get(), size, q, size), ErrorMemoryCopyFailedInternal);
+    }
+    return s;
+}
+
+/**
+ *  \brief Decomposes the stacked sketches of all the blocks and maps their left singular vectors back to the data blocks
+ */
+template <typename algorithmFPType, CpuType cpu>
+Status SVDOnlineKernel<algorithmFPType, randomizedDense, cpu>::finalizeCompute(const size_t na, const NumericTable * const * a, const size_t nr,
+                                                                               NumericTable * r[], const daal::algorithms::Parameter * par)
+{
+    const svd::Parameter * svdPar = static_cast<const svd::Parameter *>(par);
+
+    const size_t nBlocks             = na / 2;
+    const NumericTable * const * ntB = a;
+    const NumericTable * const * ntQ = a + nBlocks;
+    NumericTable * ntSigma           = r[0];
+    NumericTable * ntU               = r[1];
+    NumericTable * ntV               = (svdPar->rightSingularMatrix == requiredInPackedForm) ? r[2] : nullptr;
+    const bool computeLeft           = (svdPar->leftSingularMatrix == requiredInPackedForm);
+    const size_t k                   = ntSigma->getNumberOfColumns();
+
+    TArray<algorithmFPType, cpu> uB;
+    Status s;
+    DAAL_CHECK_STATUS(s, (compute_stacked_sketch_svd<algorithmFPType, cpu>(nBlocks, ntB, ntSigma, ntV, computeLeft, uB)));
+    if (!computeLeft) return s;
+
+    TArray<size_t, cpu> offsetsPtr(2 * nBlocks);
+    size_t * const sketchOffsets = offsetsPtr.get();
+    DAAL_CHECK_MALLOC(sketchOffsets);
+    size_t * const rowOffsets = sketchOffsets + nBlocks;
+    size_t nSketchRows        = 0;
+    size_t nRows              = 0;
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        sketchOffsets[i] = nSketchRows;
+        rowOffsets[i]    = nRows;
+        nSketchRows += ntB[i]->getNumberOfRows();
+        nRows += ntQ[i]->getNumberOfRows();
+    }
+
+    WriteOnlyRows<algorithmFPType, cpu, NumericTable> uBlock(ntU, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(uBlock);
+    algorithmFPType * const u        = uBlock.get();
+    const algorithmFPType * const ub = uB.get();
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        NumericTable * ntQi = const_cast<NumericTable *>(ntQ[iBlock]);
+        const size_t ni     = ntQi->getNumberOfRows();
+        const size_t li     = ntQi->getNumberOfColumns();
+
+        ReadRows<algorithmFPType, cpu, NumericTable> qBlock(ntQi, 0, ni);
+        DAAL_CHECK_BLOCK_STATUS_THR(qBlock);
+        compute_block_left_vectors_seq<algorithmFPType, cpu>(ni, li, k, qBlock.get(), ub + sketchOffsets[iBlock] * k, u + rowOffsets[iBlock] * k);
+    });
+    return safeStat.detach();
+}
+
+} // namespace internal
+} // namespace svd
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -171,8 +171,10 @@ Status DistributedStep2Input::check(const daal::algorithms::Parameter * paramete
             DAAL_CHECK_EX((*nodeCollection)[j], ErrorNullNumericTable, ArgumentName, SVDNodeCollectionNTStr());
             NumericTablePtr numTableInNodeCollection = NumericTable::cast((*nodeCollection)[j]);
             DAAL_CHECK_EX(numTableInNodeCollection, ErrorIncorrectElementInNumericTableCollection, ArgumentName, SVDNodeCollectionStr());
+            /* The randomizedDense method passes l_j x p sketches of the data blocks instead of p x p R factors */
             int unexpectedLayouts = (int)packed_mask;
-            s |= checkNumericTable(numTableInNodeCollection.get(), SVDNodeCollectionNTStr(), unexpectedLayouts, 0, nFeatures, nFeatures);
+            const size_t nRows    = (method == randomizedDense) ? 0 : nFeatures;
+            s |= checkNumericTable(numTableInNodeCollection.get(), SVDNodeCollectionNTStr(), unexpectedLayouts, 0, nFeatures, nRows);
             if (!s)
             {
                 return s;
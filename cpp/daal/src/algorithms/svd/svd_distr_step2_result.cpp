@@ -117,7 +117,10 @@ Status DistributedPartialResult::check(const daal::algorithms::Parameter * param
 
     Status s = checkNumericTable(firstNumTableInFirstNodeCollection.get(), SVDNodeCollectionNTStr());
     DAAL_CHECK_STATUS_VAR(s)
-    size_t nFeatures = firstNumTableInFirstNodeCollection->getNumberOfColumns();
+    /* For the randomizedDense method the tables hold l_j x k blocks of the left singular vectors of the stacked sketches */
+    const bool isRandomized = (method == randomizedDense);
+    size_t nFeatures        = firstNumTableInFirstNodeCollection->getNumberOfColumns();
+    const size_t nRows      = isRandomized ? 0 : nFeatures;
     DAAL_CHECK(nNodes <= services::internal::MaxVal<int>::get(), ErrorIncorrectNumberOfNodes)
     // check all dataCollection in key-value dataCollection
     for (size_t i = 0; i < nNodes; i++)
@@ -134,7 +137,7 @@ Status DistributedPartialResult::check(const daal::algorithms::Parameter * param
             NumericTablePtr rNumTableInNodeCollection = NumericTable::cast((*nodeCollection)[j]);
             DAAL_CHECK_EX(rNumTableInNodeCollection, ErrorIncorrectElementInNumericTableCollection, ArgumentName, SVDNodeCollectionStr());
             int unexpectedLayouts = (int)packed_mask;
-            s |= checkNumericTable(rNumTableInNodeCollection.get(), SVDNodeCollectionNTStr(), unexpectedLayouts, 0, nFeatures, nFeatures);
+            s |= checkNumericTable(rNumTableInNodeCollection.get(), SVDNodeCollectionNTStr(), unexpectedLayouts, 0, nFeatures, nRows);
             DAAL_CHECK_STATUS_VAR(s)
         }
     }
@@ -147,7 +150,7 @@ Status DistributedPartialResult::check(const daal::algorithms::Parameter * param
         if (get(finalResultFromStep2Master))
         {
             s |= checkNumericTable(get(finalResultFromStep2Master)->get(rightSingularMatrix).get(), rightSingularMatrixStr(), unexpectedLayouts, 0,
-                                   nFeatures, nFeatures);
+                                   isRandomized ? 0 : nFeatures, nFeatures);
             DAAL_CHECK_STATUS_VAR(s)
         }
     }
@@ -117,6 +117,22 @@ Status DistributedStep3Input::check(const daal::algorithms::Parameter * paramete
         DAAL_CHECK_EX(numTableInRCollection, ErrorIncorrectElementInNumericTableCollection, ArgumentName, inputOfStep3FromStep1Str());
 
         int unexpectedLayouts = (int)packed_mask;
+        if (method == randomizedDense)
+        {
+            /* Q_i is n_i x l_i basis of the block range, R_i is l_i x k block of the left singular vectors of the stacked sketches */
+            const size_t nComponents = NumericTable::cast((*rCollection)[0]) ? NumericTable::cast((*rCollection)[0])->getNumberOfColumns() : 0;
+            s |= checkNumericTable(numTableInRCollection.get(), rCollectionStr(), unexpectedLayouts, 0, nComponents);
+            if (!s)
+            {
+                return s;
+            }
+            s |= checkNumericTable(numTableInQCollection.get(), qCollectionStr(), unexpectedLayouts, 0, numTableInRCollection->getNumberOfRows());
+            if (!s)
+            {
+                return s;
+            }
+            continue;
+        }
         s |= checkNumericTable(numTableInQCollection.get(), qCollectionStr(), unexpectedLayouts, 0, nFeatures);
         if (!s)
         {
@@ -82,6 +82,14 @@ Status DistributedPartialResultStep3::check(const daal::algorithms::Input * inpu
         nFeatures                            = numTableInQCollection->getNumberOfColumns();
         nVectors += numTableInQCollection->getNumberOfRows();
     }
+    if (method == randomizedDense)
+    {
+        /* Left singular vectors of the randomizedDense method have as many columns as the blocks received from step 2 */
+        DataCollectionPtr rCollection = svdInput->get(inputOfStep3FromStep2);
+        NumericTablePtr firstRTable   = (rCollection && rCollection->size()) ? NumericTable::cast((*rCollection)[0]) : NumericTablePtr();
+        DAAL_CHECK_EX(firstRTable, ErrorNullNumericTable, ArgumentName, rCollectionStr());
+        nFeatures = firstRTable->getNumberOfColumns();
+    }
     if (svdPar->leftSingularMatrix == requiredInPackedForm)
     {
         if (get(finalResultFromStep3))
@@ -99,7 +99,14 @@ Status Input::getNumberOfRows(size_t * nRows) const
 Status Input::check(const daal::algorithms::Parameter * parameter, int method) const
 {
     NumericTablePtr dataTable = get(data);
-    return checkNumericTable(dataTable.get(), dataStr());
+    Status s                  = checkNumericTable(dataTable.get(), dataStr());
+    DAAL_CHECK_STATUS_VAR(s);
+    if (method == randomizedDense)
+    {
+        const RandomizedParameter * svdPar = static_cast<const RandomizedParameter *>(parameter);
+        DAAL_CHECK_EX(svdPar->nComponents <= dataTable->getNumberOfColumns(), ErrorIncorrectNComponents, ParameterName, nComponentsStr());
+    }
+    return s;
 }
 
 } // namespace interface1
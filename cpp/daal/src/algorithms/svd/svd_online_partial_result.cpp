@@ -156,12 +156,15 @@ Status OnlinePartialResult::checkImpl(const daal::algorithms::Parameter * parame
         NumericTablePtr numTableInRCollection = NumericTable::cast((*rCollection)[i]);
         DAAL_CHECK_EX(numTableInRCollection, ErrorIncorrectElementInNumericTableCollection, ArgumentName, outputOfStep1ForStep2Str());
 
+        /* R factors of the randomizedDense method are l_i x p sketches of the data blocks */
         int unexpectedLayouts = (int)packed_mask;
-        s |= checkNumericTable(numTableInRCollection.get(), rCollectionStr(), unexpectedLayouts, 0, nFeatures, nFeatures);
+        const size_t nRowsR   = (method == randomizedDense) ? 0 : nFeatures;
+        s |= checkNumericTable(numTableInRCollection.get(), rCollectionStr(), unexpectedLayouts, 0, nFeatures, nRowsR);
         if (!s)
         {
             return s;
         }
+        const size_t nColsQ = (method == randomizedDense) ? numTableInRCollection->getNumberOfRows() : nFeatures;
 
         if (svdPar->leftSingularMatrix != notRequired)
         {
@@ -169,7 +172,7 @@ Status OnlinePartialResult::checkImpl(const daal::algorithms::Parameter * parame
             NumericTablePtr numTableInQCollection = NumericTable::cast((*qCollection)[i]);
             DAAL_CHECK_EX(numTableInQCollection, ErrorIncorrectElementInNumericTableCollection, ArgumentName, outputOfStep1ForStep3Str());
 
-            s |= checkNumericTable(numTableInQCollection.get(), qCollectionStr(), unexpectedLayouts, 0, nFeatures);
+            s |= checkNumericTable(numTableInQCollection.get(), qCollectionStr(), unexpectedLayouts, 0, nColsQ);
             if (!s)
             {
                 return s;
@@ -0,0 +1,58 @@
+/* file: svd_parameter.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of svd classes.
+//--
+*/
+
+#include "algorithms/svd/svd_types.h"
+
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace svd
+{
+namespace interface1
+{
+/**
+ *  Constructs parameters of the randomizedDense method of the SVD algorithm
+ *  \param[in] _leftSingularMatrix  Format of the matrix of left singular vectors
+ *  \param[in] _rightSingularMatrix Format of the matrix of right singular vectors
+ */
+RandomizedParameter::RandomizedParameter(SVDResultFormat _leftSingularMatrix, SVDResultFormat _rightSingularMatrix)
+    : Parameter(_leftSingularMatrix, _rightSingularMatrix),
+      nComponents(0),
+      nOversamples(10),
+      nPowerIterations(2),
+      engine(engines::mt19937::Batch<>::create())
+{}
+
+Status RandomizedParameter::check() const
+{
+    DAAL_CHECK(engine, ErrorIncorrectEngineParameter);
+    return Status();
+}
+
+} // namespace interface1
+} // namespace svd
+} // namespace algorithms
+} // namespace daal
@@ -73,18 +73,7 @@ Status Result::check(const daal::algorithms::Input * input, const daal::algorith
     Parameter * svdPar     = static_cast<Parameter *>(const_cast<daal::algorithms::Parameter *>(par));
     size_t nVectors        = algInput->get(data)->getNumberOfRows();
     size_t nFeatures       = algInput->get(data)->getNumberOfColumns();
-    int unexpectedLayouts  = (int)packed_mask;
-
-    Status s = checkNumericTable(get(singularValues).get(), singularValuesStr(), unexpectedLayouts, 0, nFeatures, 1);
-    if (svdPar->rightSingularMatrix == requiredInPackedForm)
-    {
-        s |= checkNumericTable(get(rightSingularMatrix).get(), rightSingularMatrixStr(), unexpectedLayouts, 0, nFeatures, nFeatures);
-    }
-    if (svdPar->leftSingularMatrix == requiredInPackedForm)
-    {
-        s |= checkNumericTable(get(leftSingularMatrix).get(), leftSingularMatrixStr(), unexpectedLayouts, 0, nFeatures, nVectors);
-    }
-    return s;
+    return checkImpl(svdPar, method, nFeatures, nVectors);
 }
 /**
  * Checks the result parameter of the SVD algorithm
@@ -96,18 +85,29 @@ Status Result::check(const daal::algorithms::PartialResult * pres, const daal::a
 {
     const OnlinePartialResult * algPartRes = static_cast<const OnlinePartialResult *>(pres);
     Parameter * svdPar                     = static_cast<Parameter *>(const_cast<daal::algorithms::Parameter *>(par));
-    int unexpectedLayouts                  = (int)packed_mask;
     size_t nVectors                        = algPartRes->getNumberOfRows();
     size_t nFeatures                       = algPartRes->getNumberOfColumns();
+    return checkImpl(svdPar, method, nFeatures, nVectors);
+}
+
+Status Result::checkImpl(const Parameter * svdPar, int method, size_t nFeatures, size_t nVectors) const
+{
+    int unexpectedLayouts = (int)packed_mask;
+    size_t nComponents    = nFeatures;
+    if (method == randomizedDense)
+    {
+        const size_t nRequested = static_cast<const RandomizedParameter *>(svdPar)->nComponents;
+        if (nRequested) nComponents = nRequested;
+    }
 
-    Status s = checkNumericTable(get(singularValues).get(), singularValuesStr(), unexpectedLayouts, 0, nFeatures, 1);
+    Status s = checkNumericTable(get(singularValues).get(), singularValuesStr(), unexpectedLayouts, 0, nComponents, 1);
     if (svdPar->rightSingularMatrix == requiredInPackedForm)
     {
-        s |= checkNumericTable(get(rightSingularMatrix).get(), rightSingularMatrixStr(), unexpectedLayouts, 0, nFeatures, nFeatures);
+        s |= checkNumericTable(get(rightSingularMatrix).get(), rightSingularMatrixStr(), unexpectedLayouts, 0, nFeatures, nComponents);
     }
     if (svdPar->leftSingularMatrix == requiredInPackedForm)
     {
-        s |= checkNumericTable(get(leftSingularMatrix).get(), leftSingularMatrixStr(), unexpectedLayouts, 0, nFeatures, nVectors);
+        s |= checkNumericTable(get(leftSingularMatrix).get(), leftSingularMatrixStr(), unexpectedLayouts, 0, nComponents, nVectors);
     }
     return s;
 }
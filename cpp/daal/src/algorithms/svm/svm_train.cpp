@@ -76,6 +76,11 @@ services::Status Parameter::check() const
     }
     return s;
 }
+
+TrainParameter::TrainParameter(const services::SharedPtr<kernel_function::KernelIface> & kernelForParameter, double C, double accuracyThreshold,
+                               double tau, size_t maxIterations, size_t cacheSize, bool doShrinking, size_t shrinkingStep, bool useLruCache)
+    : Parameter(kernelForParameter, C, accuracyThreshold, tau, maxIterations, cacheSize, doShrinking, shrinkingStep), useLruCache(useLruCache)
+{}
 } // namespace interface2
 
 namespace training
@@ -87,6 +87,10 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     kernelPar.doShrinking       = par->doShrinking;
     kernelPar.cacheSize         = par->cacheSize;
 
+    /* The algorithms built with the former parameter type do not use the LRU cache */
+    const svm::interface2::TrainParameter * const trainPar = dynamic_cast<const svm::interface2::TrainParameter *>(par);
+    kernelPar.useLruCache                                  = trainPar && trainPar->useLruCache;
+
     daal::services::Environment::env & env = *_env;
 
     auto & context    = services::internal::getDefaultContext();
@@ -78,6 +78,24 @@ public:
     virtual Status getTwoRowsBlock(size_t rowIndex1, size_t rowIndex2, size_t startColIndex, size_t blockSize, const algorithmFPType *& block1,
                                    const algorithmFPType *& block2) = 0;
 
+    /**
+     * Get the diagonal elements of the matrix Q (kernel(x[i], x[i]))
+     * \param[in] nVectors      Number of observations in a training data set
+     * \param[out] diag         Array of the diagonal elements
+     * \return status of the call
+     */
+    virtual Status getDiagonal(size_t nVectors, algorithmFPType * diag)
+    {
+        Status s;
+        for (size_t i = 0; s.ok() && (i < nVectors); i++)
+        {
+            const algorithmFPType * KiiPtr = nullptr;
+            s                              = getRowBlock(i, i, 1, KiiPtr);
+            if (s) diag[i] = *KiiPtr;
+        }
+        return s;
+    }
+
     /**
      * Move the indices of the shrunk feature vector to the end of the array
      *
@@ -353,6 +371,151 @@ protected:
     services::SharedPtr<HomogenNumericTableCPU<algorithmFPType, cpu> > _cacheTable;
 };
 
+/**
+ * LRU cache: rows of kernel matrix are cached, the least recently used row is replaced with the requested one.
+ * In case of shrinking the rows keep the values of the active (not shrunk) feature vectors only and
+ * the rows of the shrunk feature vectors are removed, so more rows fit into the cache as the active set decreases
+ */
+template <typename algorithmFPType, CpuType cpu>
+class SVMCache<boser, lruCache, algorithmFPType, cpu> : public SVMCacheImpl<algorithmFPType, cpu>
+{
+    typedef SVMCacheImpl<algorithmFPType, cpu> super;
+    typedef SVMCache<boser, lruCache, algorithmFPType, cpu> this_type;
+    using super::_cache;
+    using super::_kernel;
+    using super::_lineSize;
+    using super::_shrinkingRowIndices;
+    using super::_doShrinking;
+
+public:
+    DAAL_NEW_DELETE();
+    /**
+     * Constructs LRU cache
+     *
+     * \param[in] cacheSize     Size of the cache in bytes
+     * \param[in] lineSize      Number of elements in the cache line
+     * \param[in] doShrinking   Flag that enables use of the shrinking optimization technique
+     * \param[in] xTable        Input data set
+     * \param[in] kernel        Kernel function
+     */
+    static SVMCache * create(size_t cacheSize, size_t lineSize, bool doShrinking, const NumericTablePtr & xTable,
+                             const kernel_function::KernelIfacePtr & kernel, Status & s)
+    {
+        s.clear();
+        this_type * res = new this_type(lineSize, doShrinking, xTable, kernel);
+        if (!res)
+            s.add(ErrorMemoryAllocationFailed);
+        else
+        {
+            s = res->init(cacheSize);
+            if (!s)
+            {
+                delete res;
+                res = nullptr;
+            }
+        }
+        return res;
+    }
+
+    virtual Status getRowBlock(size_t rowIndex, size_t startColIndex, size_t blockSize, const algorithmFPType *& block) DAAL_C11_OVERRIDE
+    {
+        Status s;
+        DAAL_CHECK_STATUS(s, checkActiveSet(rowIndex, startColIndex + blockSize));
+        algorithmFPType * line = nullptr;
+        DAAL_CHECK_STATUS(s, getLines(&rowIndex, 1, &line));
+        block = line + startColIndex;
+        return s;
+    }
+
+    virtual Status getTwoRowsBlock(size_t rowIndex1, size_t rowIndex2, size_t startColIndex, size_t blockSize, const algorithmFPType *& block1,
+                                   const algorithmFPType *& block2) DAAL_C11_OVERRIDE
+    {
+        Status s;
+        DAAL_CHECK_STATUS(s, checkActiveSet(rowIndex1 > rowIndex2 ? rowIndex1 : rowIndex2, startColIndex + blockSize));
+        const size_t rows[2]       = { rowIndex1, rowIndex2 };
+        algorithmFPType * lines[2] = { nullptr, nullptr };
+        DAAL_CHECK_STATUS(s, getLines(rows, 2, lines));
+        block1 = lines[0] + startColIndex;
+        block2 = lines[1] + startColIndex;
+        return s;
+    }
+
+    virtual Status getDiagonal(size_t nVectors, algorithmFPType * diag) DAAL_C11_OVERRIDE;
+
+    virtual Status updateShrinkingRowIndices(size_t nActiveVectors, const char * I) DAAL_C11_OVERRIDE;
+
+    ~SVMCache() {}
+
+protected:
+    /**
+     * Constructs the cache that keeps the least recently used rows of the matrix Q
+     *
+     * \param[in] lineSize      Number of elements in the cache line
+     * \param[in] doShrinking   Flag that enables use of the shrinking optimization technique
+     * \param[in] xTable        Input data set
+     * \param[in] kernel        Kernel function
+     */
+    SVMCache(size_t lineSize, bool doShrinking, const NumericTablePtr & xTable, const kernel_function::KernelIfacePtr & kernel)
+        : super(lineSize, doShrinking, kernel),
+          _xTable(xTable),
+          _nActive(lineSize),
+          _capacity(0),
+          _stride(0),
+          _nLines(0),
+          _head(-1),
+          _tail(-1),
+          _bPermuted(false)
+    {}
+
+    Status init(size_t cacheSize);
+
+    /* Number of elements in the cache line keeping the given number of values, lines are aligned on 64 bytes */
+    static size_t alignedLineSize(size_t nValues)
+    {
+        const size_t bytes            = (nValues ? nValues : 1) * sizeof(algorithmFPType);
+        const size_t alignedBytesSize = bytes & 63 ? (bytes & (~63)) + 64 : bytes;
+        return alignedBytesSize / sizeof(algorithmFPType);
+    }
+
+    algorithmFPType * linePtr(int line) { return _cache.get() + line * _stride; }
+
+    /* Doubly linked list of the cache lines from the most recently used (head) to the least recently used (tail) */
+    void unlink(int line);
+    void linkHead(int line);
+    void linkTail(int line);
+
+    /* Resets the set of active feature vectors to the whole data set if the requested values are out of the active set */
+    Status checkActiveSet(size_t rowIndex, size_t endColIndex)
+    {
+        if ((rowIndex < _nActive) && (endColIndex <= _nActive)) return Status();
+        return resetActiveSet();
+    }
+    Status resetActiveSet();
+    Status compactLines(size_t nNewActiveVectors);
+
+    void resetLines();
+    Status getLines(const size_t * rows, size_t nRows, algorithmFPType ** lines);
+    Status computeLines(size_t nMissed, const uint32_t * missedRows, const int * missedLines);
+
+protected:
+    NumericTablePtr _xTable;
+    SubDataTaskBasePtr<algorithmFPType, cpu> _rowTask;    /*!< Feature vectors of the rows to be computed */
+    size_t _nActive;                                      /*!< Number of the values in the cache line */
+    size_t _capacity;                                     /*!< Number of elements in the cache */
+    size_t _stride;                                       /*!< Distance between the cache lines */
+    size_t _nLines;                                       /*!< Number of the cache lines */
+    int _head;                                            /*!< Most recently used cache line */
+    int _tail;                                            /*!< Least recently used cache line */
+    bool _bPermuted;                                      /*!< Flag that rows of the matrix Q are not in the order of the data set */
+    TArray<int, cpu> _rowToLine;                          /*!< Cache line of the row, -1 if the row is not cached */
+    TArray<int, cpu> _lineToRow;                          /*!< Row kept in the cache line, -1 if the line is free */
+    TArray<int, cpu> _prev;                               /*!< Previous cache line in the list */
+    TArray<int, cpu> _next;                               /*!< Next cache line in the list */
+    TArray<size_t, cpu> _perm;                            /*!< Former positions of the active feature vectors after shrinking */
+    TArray<algorithmFPType, cpu> _fullRows;               /*!< Kernel function values of the missed rows and all the feature vectors */
+    TArray<algorithmFPType, cpu> _tmp;                    /*!< Buffer used to compact the cache line */
+};
+
 } // namespace internal
 } // namespace training
 } // namespace svm
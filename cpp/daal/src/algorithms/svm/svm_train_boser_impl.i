@@ -472,6 +472,10 @@ services::Status SVMTrainTask<algorithmFPType, cpu>::setup(const KernelParameter
     {
         _cache = SVMCache<boser, simpleCache, algorithmFPType, cpu>::create(_nVectors, svmPar.doShrinking, xTable, kernel, s);
     }
+    else if (svmPar.useLruCache && (cacheSize >= 2 * _nVectors * sizeof(algorithmFPType)))
+    {
+        _cache = SVMCache<boser, lruCache, algorithmFPType, cpu>::create(cacheSize, _nVectors, svmPar.doShrinking, xTable, kernel, s);
+    }
     else
     {
         cacheSize = kernelFunctionBlockSize;
@@ -517,15 +521,7 @@ services::Status SVMTrainTask<algorithmFPType, cpu>::init(algorithmFPType C, con
         updateFlag(i);
     }
 
-    services::Status s;
-    algorithmFPType * kernelDiag = _kernelDiag.get();
-    for (size_t i = 0; s.ok() && (i < _nVectors); i++)
-    {
-        const algorithmFPType * KiiPtr = nullptr;
-        s                              = _cache->getRowBlock(i, i, 1, KiiPtr);
-        kernelDiag[i]                  = *KiiPtr;
-    }
-    return s;
+    return _cache->getDiagonal(_nVectors, _kernelDiag.get());
 }
 
 /**
@@ -622,6 +618,321 @@ services::Status SVMCache<boser, simpleCache, algorithmFPType, cpu>::updateShrin
     }
     return (!result) ? services::Status() : services::Status(ErrorMemoryCopyFailedInternal);
 }
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status SVMCache<boser, lruCache, algorithmFPType, cpu>::init(size_t cacheSize)
+{
+    services::Status s = super::init();
+    if (!s) return s;
+
+    const size_t minCapacity = 2 * alignedLineSize(_lineSize);
+    _capacity                = cacheSize / sizeof(algorithmFPType);
+    if (_capacity < minCapacity) _capacity = minCapacity;
+    _cache.reset(_capacity);
+    _rowToLine.reset(_lineSize);
+    _lineToRow.reset(_lineSize);
+    _prev.reset(_lineSize);
+    _next.reset(_lineSize);
+    _perm.reset(_lineSize);
+    _fullRows.reset(2 * _lineSize);
+    _tmp.reset(_lineSize);
+    DAAL_CHECK_MALLOC(_cache.get() && _rowToLine.get() && _lineToRow.get() && _prev.get() && _next.get() && _perm.get() && _fullRows.get()
+                      && _tmp.get());
+
+    SubDataTaskBase<algorithmFPType, cpu> * rowTask = nullptr;
+    if (_xTable->getDataLayout() == NumericTableIface::csrArray)
+        rowTask = SubDataTaskCSR<algorithmFPType, cpu>::create(_xTable, 2);
+    else
+        rowTask = SubDataTaskDense<algorithmFPType, cpu>::create(_xTable->getNumberOfColumns(), 2);
+    _rowTask = SubDataTaskBasePtr<algorithmFPType, cpu>(rowTask);
+    DAAL_CHECK_MALLOC(rowTask);
+
+    _nActive = _lineSize;
+    _stride  = alignedLineSize(_nActive);
+    _nLines  = _capacity / _stride;
+    if (_nLines > _lineSize) _nLines = _lineSize;
+    resetLines();
+    return s;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void SVMCache<boser, lruCache, algorithmFPType, cpu>::unlink(int line)
+{
+    const int prev = _prev[line];
+    const int next = _next[line];
+    if (prev >= 0)
+        _next[prev] = next;
+    else
+        _head = next;
+    if (next >= 0)
+        _prev[next] = prev;
+    else
+        _tail = prev;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void SVMCache<boser, lruCache, algorithmFPType, cpu>::linkHead(int line)
+{
+    _prev[line] = -1;
+    _next[line] = _head;
+    if (_head >= 0)
+        _prev[_head] = line;
+    else
+        _tail = line;
+    _head = line;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void SVMCache<boser, lruCache, algorithmFPType, cpu>::linkTail(int line)
+{
+    _next[line] = -1;
+    _prev[line] = _tail;
+    if (_tail >= 0)
+        _next[_tail] = line;
+    else
+        _head = line;
+    _tail = line;
+}
+
+/**
+ * \brief Mark all the cache lines as free
+ */
+template <typename algorithmFPType, CpuType cpu>
+void SVMCache<boser, lruCache, algorithmFPType, cpu>::resetLines()
+{
+    for (size_t i = 0; i < _lineSize; i++) _rowToLine[i] = -1;
+    _head = -1;
+    _tail = -1;
+    for (size_t i = 0; i < _nLines; i++)
+    {
+        _lineToRow[i] = -1;
+        linkTail(int(i));
+    }
+}
+
+/**
+ * \brief Return all the feature vectors to the active set. Cached values of the shrunk feature vectors
+ *        are not available, so the cache is flushed
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status SVMCache<boser, lruCache, algorithmFPType, cpu>::resetActiveSet()
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(LRU_CACHE.unshrink);
+    _nActive = _lineSize;
+    _stride  = alignedLineSize(_nActive);
+    _nLines  = _capacity / _stride;
+    if (_nLines > _lineSize) _nLines = _lineSize;
+    resetLines();
+    return services::Status();
+}
+
+/**
+ * \brief Get the cache lines of the given rows of the matrix Q. The rows missed in the cache replace
+ *        the least recently used ones and are computed by one call of the kernel function
+ *
+ * \param[in]  rows     Indices of the rows of the matrix Q, at most two
+ * \param[in]  nRows    Number of the rows
+ * \param[out] lines    Pointers to the cache lines of the rows
+ * \return              services::Status of the call
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status SVMCache<boser, lruCache, algorithmFPType, cpu>::getLines(const size_t * rows, size_t nRows, algorithmFPType ** lines)
+{
+    DAAL_ASSERT(nRows <= 2);
+    uint32_t missedRows[2];
+    int missedLines[2];
+    size_t nMissed = 0;
+    for (size_t i = 0; i < nRows; i++)
+    {
+        const size_t row = rows[i];
+        int line         = _rowToLine[row];
+        if (line < 0)
+        {
+            line = _tail;
+            if (_lineToRow[line] >= 0) _rowToLine[_lineToRow[line]] = -1;
+            _lineToRow[line]     = int(row);
+            _rowToLine[row]      = line;
+            missedRows[nMissed]  = uint32_t(this->getDataRowIndex(row));
+            missedLines[nMissed] = line;
+            ++nMissed;
+        }
+        unlink(line);
+        linkHead(line);
+        lines[i] = linePtr(line);
+    }
+    if (!nMissed) return services::Status();
+
+    services::Status s = computeLines(nMissed, missedRows, missedLines);
+    if (!s)
+    {
+        for (size_t i = 0; i < nMissed; i++)
+        {
+            const int line               = missedLines[i];
+            _rowToLine[_lineToRow[line]] = -1;
+            _lineToRow[line]             = -1;
+            unlink(line);
+            linkTail(line);
+        }
+    }
+    return s;
+}
+
+/**
+ * \brief Compute the kernel function values of the feature vectors and the missed rows.
+ *        While the rows of the matrix Q are in the order of the data set, the values are computed directly
+ *        into the cache lines, otherwise the full rows are computed and the values of the active feature vectors
+ *        are gathered into the cache lines, so the data set is never copied
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status SVMCache<boser, lruCache, algorithmFPType, cpu>::computeLines(size_t nMissed, const uint32_t * missedRows, const int * missedLines)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(LRU_CACHE.computeKernel);
+    const bool bGather = _bPermuted || (_nActive < _lineSize);
+    services::Status s;
+    auto kernelComputeTable = SOANumericTableCPU<cpu>::create(nMissed, _lineSize, DictionaryIface::FeaturesEqual::equal, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    for (size_t i = 0; i < nMissed; i++)
+    {
+        algorithmFPType * const values = bGather ? _fullRows.get() + i * _lineSize : linePtr(missedLines[i]);
+        DAAL_CHECK_STATUS(s, kernelComputeTable->template setArray<algorithmFPType>(values, i));
+    }
+    DAAL_CHECK_STATUS(s, _rowTask->copyDataByIndices(missedRows, nMissed, _xTable));
+
+    _kernel->getParameter()->computationMode = kernel_function::matrixMatrix;
+    _kernel->getInput()->set(kernel_function::X, _xTable);
+    _kernel->getInput()->set(kernel_function::Y, _rowTask->getTableData());
+
+    kernel_function::ResultPtr shRes(new kernel_function::Result());
+    DAAL_CHECK_MALLOC(shRes.get());
+    shRes->set(kernel_function::values, kernelComputeTable);
+    _kernel->setResult(shRes);
+    DAAL_CHECK_STATUS(s, _kernel->computeNoThrow());
+    if (!bGather) return s;
+
+    /* Rows of the matrix Q are reordered by shrinking only */
+    const size_t * const dataRowIndices = _shrinkingRowIndices.get();
+    for (size_t i = 0; i < nMissed; i++)
+    {
+        const algorithmFPType * const fullRow = _fullRows.get() + i * _lineSize;
+        algorithmFPType * const line          = linePtr(missedLines[i]);
+        for (size_t j = 0; j < _nActive; j++) line[j] = fullRow[dataRowIndices[j]];
+    }
+    return s;
+}
+
+/**
+ * \brief Compute the diagonal of the matrix Q without filling the cache with the full rows
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status SVMCache<boser, lruCache, algorithmFPType, cpu>::getDiagonal(size_t nVectors, algorithmFPType * diag)
+{
+    services::Status s;
+    auto diagTable = HomogenNumericTableCPU<algorithmFPType, cpu>::create(diag, 1, nVectors, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    _kernel->getParameter()->computationMode = kernel_function::vectorVector;
+    _kernel->getInput()->set(kernel_function::X, _xTable);
+    _kernel->getInput()->set(kernel_function::Y, _xTable);
+
+    kernel_function::ResultPtr shRes(new kernel_function::Result());
+    DAAL_CHECK_MALLOC(shRes.get());
+    shRes->set(kernel_function::values, diagTable);
+    _kernel->setResult(shRes);
+    for (size_t i = 0; s.ok() && (i < nVectors); i++)
+    {
+        const size_t dataRowIndex               = this->getDataRowIndex(i);
+        _kernel->getParameter()->rowIndexX      = dataRowIndex;
+        _kernel->getParameter()->rowIndexY      = dataRowIndex;
+        _kernel->getParameter()->rowIndexResult = i;
+        s |= _kernel->computeNoThrow();
+    }
+    return s;
+}
+
+/**
+ * \brief Remove the values of the shrunk feature vectors from the cached lines of the active ones.
+ *        Lines are moved to the shorter stride in increasing order, so the line is never
+ *        overwritten before it is moved
+ *
+ * \param[in] nNewActiveVectors Number of the active feature vectors after shrinking
+ * \return                      services::Status of the call
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status SVMCache<boser, lruCache, algorithmFPType, cpu>::compactLines(size_t nNewActiveVectors)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(LRU_CACHE.compact);
+    const size_t newStride = alignedLineSize(nNewActiveVectors);
+    const size_t nBytes    = nNewActiveVectors * sizeof(algorithmFPType);
+    int result             = 0;
+    for (size_t line = 0; line < _nLines; line++)
+    {
+        const int row = _lineToRow[line];
+        if (row < 0) continue;
+        if (size_t(row) >= nNewActiveVectors)
+        {
+            _rowToLine[row]  = -1;
+            _lineToRow[line] = -1;
+            unlink(int(line));
+            linkTail(int(line));
+            continue;
+        }
+        const algorithmFPType * const oldLine = _cache.get() + line * _stride;
+        for (size_t j = 0; j < nNewActiveVectors; j++) _tmp[j] = oldLine[_perm[j]];
+        result |= daal::services::internal::daal_memcpy_s(_cache.get() + line * newStride, nBytes, _tmp.get(), nBytes);
+    }
+
+    /* Shorter lines leave room for more lines in the cache */
+    size_t nNewLines = _capacity / newStride;
+    if (nNewLines > _lineSize) nNewLines = _lineSize;
+    for (size_t line = _nLines; line < nNewLines; line++)
+    {
+        _lineToRow[line] = -1;
+        linkTail(int(line));
+    }
+    _nLines  = nNewLines;
+    _stride  = newStride;
+    _nActive = nNewActiveVectors;
+    return (!result) ? services::Status() : services::Status(ErrorMemoryCopyFailedInternal);
+}
+
+/**
+ * \brief Move the indices of the shrunk feature vector to the end of the array,
+ *        remove the rows of the shrunk feature vectors from the cache and
+ *        compact the remaining rows to the active feature vectors
+ *
+ * \param[in] nActiveVectors Number of observations in a training data set that are used
+ *                           in sequential minimum optimization at the current iteration
+ * \param[in] flags          Array of flags that describe the status of feature vectors
+ * \return                   services::Status of the call
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status SVMCache<boser, lruCache, algorithmFPType, cpu>::updateShrinkingRowIndices(size_t nActiveVectors, const char * flags)
+{
+    services::Status s;
+    if (nActiveVectors > _nActive) DAAL_CHECK_STATUS(s, resetActiveSet());
+
+    for (size_t k = 0; k < nActiveVectors; k++) _perm[k] = k;
+    size_t i = 0;
+    size_t j = nActiveVectors - 1;
+    while (i < j)
+    {
+        while (!(flags[i] & shrink) && i < nActiveVectors - 1) i++;
+        while ((flags[j] & shrink) && j > 0) j--;
+        if (i >= j) break;
+        daal::services::internal::swap<cpu, size_t>(_shrinkingRowIndices[i], _shrinkingRowIndices[j]);
+        daal::services::internal::swap<cpu, size_t>(_perm[i], _perm[j]);
+        daal::services::internal::swap<cpu, int>(_rowToLine[i], _rowToLine[j]);
+        if (_rowToLine[i] >= 0) _lineToRow[_rowToLine[i]] = int(i);
+        if (_rowToLine[j] >= 0) _lineToRow[_rowToLine[j]] = int(j);
+        _bPermuted = true;
+        i++;
+        j--;
+    }
+
+    size_t nNewActiveVectors = 0;
+    for (size_t k = 0; k < nActiveVectors; k++) nNewActiveVectors += (flags[k] & shrink) ? 0 : 1;
+
+    return compactLines(nNewActiveVectors);
+}
 } // namespace internal
 } // namespace training
 } // namespace svm
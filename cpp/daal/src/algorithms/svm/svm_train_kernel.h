@@ -60,7 +60,8 @@ struct KernelParameter
     bool doShrinking;
     size_t shrinkingStep;
     algorithms::kernel_function::KernelIfacePtr kernel;
-    SvmType svmType = SvmType::classification;
+    SvmType svmType  = SvmType::classification;
+    bool useLruCache = false;
 };
 
 template <Method method, typename algorithmFPType, CpuType cpu>
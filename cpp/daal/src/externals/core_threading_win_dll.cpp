@@ -284,6 +284,11 @@ typedef void (*_daal_del_task_group_t)(void * taskGroupPtr);
 typedef void (*_daal_run_task_group_t)(void * taskGroupPtr, daal::task * t);
 typedef void (*_daal_wait_task_group_t)(void * taskGroupPtr);
 
+typedef void * (*_daal_new_task_arena_t)(int nThreads, const int * cpus, int nCpus);
+typedef void (*_daal_del_task_arena_t)(void * taskArenaPtr);
+typedef void (*_daal_execute_task_arena_t)(void * taskArenaPtr, const void * a, daal::functype_arena func);
+typedef int (*_daal_task_arena_max_concurrency_t)(void * taskArenaPtr);
+
 typedef bool (*_daal_is_in_parallel_t)();
 typedef void (*_daal_tbb_task_scheduler_free_t)(void *& globalControl);
 typedef size_t (*_setNumberOfThreads_t)(const size_t, void **);
@@ -347,6 +352,11 @@ static _daal_del_task_group_t _daal_del_task_group_ptr   = NULL;
 static _daal_run_task_group_t _daal_run_task_group_ptr   = NULL;
 static _daal_wait_task_group_t _daal_wait_task_group_ptr = NULL;
 
+static _daal_new_task_arena_t _daal_new_task_arena_ptr                         = NULL;
+static _daal_del_task_arena_t _daal_del_task_arena_ptr                         = NULL;
+static _daal_execute_task_arena_t _daal_execute_task_arena_ptr                 = NULL;
+static _daal_task_arena_max_concurrency_t _daal_task_arena_max_concurrency_ptr = NULL;
+
 static _daal_is_in_parallel_t _daal_is_in_parallel_ptr                   = NULL;
 static _daal_tbb_task_scheduler_free_t _daal_tbb_task_scheduler_free_ptr = NULL;
 static _setNumberOfThreads_t _setNumberOfThreads_ptr                     = NULL;
@@ -758,6 +768,46 @@ DAAL_EXPORT void _daal_wait_task_group(void * taskGroupPtr)
     _daal_wait_task_group_ptr(taskGroupPtr);
 }
 
+DAAL_EXPORT void * _daal_new_task_arena(int nThreads, const int * cpus, int nCpus)
+{
+    load_daal_thr_dll();
+    if (_daal_new_task_arena_ptr == NULL)
+    {
+        _daal_new_task_arena_ptr = (_daal_new_task_arena_t)load_daal_thr_func("_daal_new_task_arena");
+    }
+    return _daal_new_task_arena_ptr(nThreads, cpus, nCpus);
+}
+
+DAAL_EXPORT void _daal_del_task_arena(void * taskArenaPtr)
+{
+    load_daal_thr_dll();
+    if (_daal_del_task_arena_ptr == NULL)
+    {
+        _daal_del_task_arena_ptr = (_daal_del_task_arena_t)load_daal_thr_func("_daal_del_task_arena");
+    }
+    _daal_del_task_arena_ptr(taskArenaPtr);
+}
+
+DAAL_EXPORT void _daal_execute_task_arena(void * taskArenaPtr, const void * a, daal::functype_arena func)
+{
+    load_daal_thr_dll();
+    if (_daal_execute_task_arena_ptr == NULL)
+    {
+        _daal_execute_task_arena_ptr = (_daal_execute_task_arena_t)load_daal_thr_func("_daal_execute_task_arena");
+    }
+    _daal_execute_task_arena_ptr(taskArenaPtr, a, func);
+}
+
+DAAL_EXPORT int _daal_task_arena_max_concurrency(void * taskArenaPtr)
+{
+    load_daal_thr_dll();
+    if (_daal_task_arena_max_concurrency_ptr == NULL)
+    {
+        _daal_task_arena_max_concurrency_ptr = (_daal_task_arena_max_concurrency_t)load_daal_thr_func("_daal_task_arena_max_concurrency");
+    }
+    return _daal_task_arena_max_concurrency_ptr(taskArenaPtr);
+}
+
 DAAL_EXPORT bool _daal_is_in_parallel()
 {
     load_daal_thr_dll();
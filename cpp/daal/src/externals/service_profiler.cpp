@@ -16,17 +16,379 @@
 *******************************************************************************/
 
 #include "src/externals/service_profiler.h"
+#include "src/algorithms/service_threading.h"
+#include "services/daal_atomic_int.h"
+#include "services/daal_memory.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
 
 namespace daal
 {
 namespace internal
 {
+namespace
+{
+const size_t maxTaskDepth       = 128;
+const size_t nStatBuckets       = 1024; /* Power of 2 */
+const size_t defaultBufferSize  = 65536;
+const int64_t nanosecondsInUsec = 1000;
+
+bool isEnabledByEnvironment()
+{
+    const char * enabled = getenv("DAAL_PROFILER");
+    return enabled && strcmp(enabled, "0");
+}
+
+const bool profilerEnabledByEnvironment = isEnabledByEnvironment();
+bool profilerEnabled                    = profilerEnabledByEnvironment;
+
+int64_t profilerTime()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+struct ProfilerEvent
+{
+    const char * name;
+    int64_t start;
+    int64_t duration;
+    size_t depth;
+};
+
+struct ProfilerStat
+{
+    const char * name;
+    size_t count;
+    int64_t total;
+    int64_t self;
+    int64_t max;
+};
+
+struct ProfilerOpenTask
+{
+    const char * name;
+    int64_t start;
+    int64_t childTime;
+};
+
+/* Tasks of one thread. Only the owner thread writes to the buffer */
+class ProfilerThreadBuffer
+{
+public:
+    DAAL_NEW_DELETE();
+
+    ProfilerThreadBuffer(size_t threadIndex, size_t capacity)
+        : _threadIndex(threadIndex), _capacity(capacity), _depth(0), _nDroppedStats(0), next(nullptr)
+    {
+        _events = (ProfilerEvent *)daal::services::daal_calloc(_capacity * sizeof(ProfilerEvent));
+        if (!_events) _capacity = 0;
+        reset();
+    }
+
+    ~ProfilerThreadBuffer() { daal::services::daal_free(_events); }
+
+    void reset()
+    {
+        _nWritten.set(0);
+        _nDroppedStats = 0;
+        for (size_t i = 0; i < nStatBuckets; i++) _stats[i].name = nullptr;
+    }
+
+    void begin(const char * name, int64_t time)
+    {
+        if (_depth < maxTaskDepth)
+        {
+            _stack[_depth].name      = name;
+            _stack[_depth].start     = time;
+            _stack[_depth].childTime = 0;
+        }
+        ++_depth;
+    }
+
+    void end(int64_t time)
+    {
+        if (!_depth) return;
+        --_depth;
+        if (_depth >= maxTaskDepth) return;
+
+        const ProfilerOpenTask & task = _stack[_depth];
+        const int64_t duration        = time - task.start;
+        if (_depth > 0 && _depth - 1 < maxTaskDepth) _stack[_depth - 1].childTime += duration;
+        addStat(task.name, duration, duration - task.childTime);
+
+        if (!_capacity) return;
+        const size_t nWritten = _nWritten.get();
+        ProfilerEvent & event = _events[nWritten % _capacity];
+        event.name            = task.name;
+        event.start           = task.start;
+        event.duration        = duration;
+        event.depth           = _depth;
+        _nWritten.set(nWritten + 1);
+    }
+
+    size_t threadIndex() const { return _threadIndex; }
+    size_t capacity() const { return _capacity; }
+    size_t nWritten() const { return _nWritten.get(); }
+    const ProfilerEvent & event(size_t i) const { return _events[i % _capacity]; }
+    const ProfilerStat & stat(size_t i) const { return _stats[i]; }
+    size_t nDroppedStats() const { return _nDroppedStats; }
+
+private:
+    void addStat(const char * name, int64_t duration, int64_t self)
+    {
+        /* Task names are string literals, so the pointer identifies the task in the translation unit */
+        size_t h = (size_t(name) >> 3) & (nStatBuckets - 1);
+        for (size_t i = 0; i < nStatBuckets; i++, h = (h + 1) & (nStatBuckets - 1))
+        {
+            ProfilerStat & stat = _stats[h];
+            if (!stat.name)
+            {
+                stat.name  = name;
+                stat.count = 0;
+                stat.total = 0;
+                stat.self  = 0;
+                stat.max   = 0;
+            }
+            if (stat.name != name) continue;
+            ++stat.count;
+            stat.total += duration;
+            stat.self += self;
+            if (duration > stat.max) stat.max = duration;
+            return;
+        }
+        ++_nDroppedStats;
+    }
+
+    size_t _threadIndex;
+    size_t _capacity;
+    ProfilerEvent * _events;
+    services::Atomic<size_t> _nWritten;
+    ProfilerOpenTask _stack[maxTaskDepth];
+    size_t _depth;
+    ProfilerStat _stats[nStatBuckets];
+    size_t _nDroppedStats;
+
+public:
+    ProfilerThreadBuffer * next;
+};
+
+/* Registry of the buffers of all the threads that have recorded tasks, the buffers are kept until the process exits.
+ * The session is created by the first recorded task, the results are written at exit if the profiler is enabled by environment */
+class ProfilerSession
+{
+public:
+    ProfilerSession() : _head(nullptr), _nThreads(0), _bufferSize(defaultBufferSize), _startTime(profilerTime())
+    {
+        const char * bufferSize = getenv("DAAL_PROFILER_BUFFER_SIZE");
+        if (bufferSize && atol(bufferSize) > 0) _bufferSize = size_t(atol(bufferSize));
+    }
+
+    /* The buffers are not freed: the thread local pointers to them may still be used by the tasks
+     * that end on other threads or during the destruction of other static objects */
+    ~ProfilerSession()
+    {
+        profilerEnabled = false;
+        if (profilerEnabledByEnvironment)
+        {
+            const char * traceFile  = getenv("DAAL_PROFILER_TRACE");
+            const char * summaryOut = getenv("DAAL_PROFILER_SUMMARY");
+            if (traceFile) writeChromeTrace(traceFile);
+            writeSummary(summaryOut);
+        }
+    }
+
+    ProfilerThreadBuffer * threadBuffer()
+    {
+        static thread_local ProfilerThreadBuffer * buffer = nullptr;
+        if (!buffer)
+        {
+            AUTOLOCK(_mutex);
+            buffer = new ProfilerThreadBuffer(_nThreads++, _bufferSize);
+            if (buffer)
+            {
+                buffer->next = _head;
+                _head        = buffer;
+            }
+        }
+        return buffer;
+    }
+
+    void reset()
+    {
+        AUTOLOCK(_mutex);
+        for (ProfilerThreadBuffer * buffer = _head; buffer; buffer = buffer->next) buffer->reset();
+        _startTime = profilerTime();
+    }
+
+    bool writeSummary(const char * fileName);
+    bool writeChromeTrace(const char * fileName);
+
+private:
+    ProfilerThreadBuffer * _head;
+    size_t _nThreads;
+    size_t _bufferSize;
+    int64_t _startTime;
+    Mutex _mutex;
+};
+
+ProfilerSession & session()
+{
+    static ProfilerSession instance;
+    return instance;
+}
+
+int compareStatsByTotal(const void * a, const void * b)
+{
+    const int64_t ta = static_cast<const ProfilerStat *>(a)->total;
+    const int64_t tb = static_cast<const ProfilerStat *>(b)->total;
+    return ta < tb ? 1 : (ta > tb ? -1 : 0);
+}
+
+double toMilliseconds(int64_t time)
+{
+    return double(time) / 1e6;
+}
+
+bool ProfilerSession::writeSummary(const char * fileName)
+{
+    AUTOLOCK(_mutex);
+    size_t nStats = 0;
+    for (ProfilerThreadBuffer * buffer = _head; buffer; buffer = buffer->next) nStats += nStatBuckets;
+
+    ProfilerStat * stats = (ProfilerStat *)daal::services::daal_malloc((nStats ? nStats : 1) * sizeof(ProfilerStat));
+    if (!stats) return false;
+
+    /* Tasks with the same name from different translation units and threads are merged */
+    size_t nMerged       = 0;
+    size_t nDroppedStats = 0;
+    for (ProfilerThreadBuffer * buffer = _head; buffer; buffer = buffer->next)
+    {
+        nDroppedStats += buffer->nDroppedStats();
+        for (size_t i = 0; i < nStatBuckets; i++)
+        {
+            const ProfilerStat & stat = buffer->stat(i);
+            if (!stat.name) continue;
+            size_t j = 0;
+            for (; j < nMerged && strcmp(stats[j].name, stat.name); j++)
+                ;
+            if (j == nMerged)
+            {
+                stats[nMerged++] = stat;
+                continue;
+            }
+            stats[j].count += stat.count;
+            stats[j].total += stat.total;
+            stats[j].self += stat.self;
+            if (stat.max > stats[j].max) stats[j].max = stat.max;
+        }
+    }
+    qsort(stats, nMerged, sizeof(ProfilerStat), compareStatsByTotal);
+
+    FILE * f = fileName ? fopen(fileName, "w") : stderr;
+    if (!f)
+    {
+        daal::services::daal_free(stats);
+        return false;
+    }
+    fprintf(f, "oneDAL profiler summary: %zu threads, %.3f ms since start, times are summed over threads\n", _nThreads,
+            toMilliseconds(profilerTime() - _startTime));
+    fprintf(f, "%-60s %10s %14s %14s %12s %12s\n", "Task", "Calls", "Total, ms", "Self, ms", "Avg, ms", "Max, ms");
+    for (size_t i = 0; i < nMerged; i++)
+    {
+        const ProfilerStat & s = stats[i];
+        fprintf(f, "%-60s %10zu %14.3f %14.3f %12.3f %12.3f\n", s.name, s.count, toMilliseconds(s.total), toMilliseconds(s.self),
+                toMilliseconds(s.total) / double(s.count), toMilliseconds(s.max));
+    }
+    if (nDroppedStats) fprintf(f, "%zu task calls are not counted: too many different tasks\n", nDroppedStats);
+    if (fileName) fclose(f);
+
+    daal::services::daal_free(stats);
+    return true;
+}
+
+void writeJsonString(FILE * f, const char * str)
+{
+    fputc('"', f);
+    for (; *str; ++str)
+    {
+        if (*str == '"' || *str == '\\') fputc('\\', f);
+        fputc(*str, f);
+    }
+    fputc('"', f);
+}
+
+bool ProfilerSession::writeChromeTrace(const char * fileName)
+{
+    AUTOLOCK(_mutex);
+    FILE * f = fopen(fileName, "w");
+    if (!f) return false;
+
+    fprintf(f, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    bool first = true;
+    for (ProfilerThreadBuffer * buffer = _head; buffer; buffer = buffer->next)
+    {
+        const size_t nWritten = buffer->nWritten();
+        const size_t iStart   = nWritten > buffer->capacity() ? nWritten - buffer->capacity() : 0;
+        for (size_t i = iStart; i < nWritten; i++)
+        {
+            const ProfilerEvent & event = buffer->event(i);
+            fprintf(f, first ? "\n{\"name\":" : ",\n{\"name\":");
+            writeJsonString(f, event.name);
+            fprintf(f, ",\"ph\":\"X\",\"pid\":0,\"tid\":%zu,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"depth\":%zu}}", buffer->threadIndex(),
+                    double(event.start - _startTime) / nanosecondsInUsec, double(event.duration) / nanosecondsInUsec, event.depth);
+            first = false;
+        }
+    }
+    fprintf(f, "\n]}\n");
+    fclose(f);
+    return true;
+}
+
+} // namespace
+
 ProfilerTask Profiler::startTask(const char * taskName)
 {
+    if (!profilerEnabled) return ProfilerTask(nullptr);
+    ProfilerThreadBuffer * buffer = session().threadBuffer();
+    if (!buffer) return ProfilerTask(nullptr);
+    buffer->begin(taskName, profilerTime());
     return ProfilerTask(taskName);
 }
 
-void Profiler::endTask(const char * taskName) {}
+void Profiler::endTask(const char * taskName)
+{
+    if (!taskName) return;
+    ProfilerThreadBuffer * buffer = session().threadBuffer();
+    if (buffer) buffer->end(profilerTime());
+}
+
+void Profiler::enable(bool enableFlag)
+{
+    profilerEnabled = enableFlag;
+}
+
+bool Profiler::isEnabled()
+{
+    return profilerEnabled;
+}
+
+void Profiler::reset()
+{
+    session().reset();
+}
+
+bool Profiler::writeSummary(const char * fileName)
+{
+    return session().writeSummary(fileName);
+}
+
+bool Profiler::writeChromeTrace(const char * fileName)
+{
+    return fileName && session().writeChromeTrace(fileName);
+}
 
 ProfilerTask::ProfilerTask(const char * taskName) : _taskName(taskName) {}
 
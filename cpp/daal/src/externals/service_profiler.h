@@ -21,6 +21,9 @@
 //--
 */
 
+#ifndef __SERVICE_PROFILER_H__
+#define __SERVICE_PROFILER_H__
+
 namespace daal
 {
 namespace internal
@@ -35,13 +38,34 @@ private:
     const char * _taskName;
 };
 
-// This class is a stub in the library. Its redefinition will be in Bechmarks
+/*
+ * Hierarchical profiler of the tasks marked with DAAL_ITTNOTIFY_SCOPED_TASK.
+ * The profiler is disabled by default, it is enabled by enable() or with the environment variables:
+ *   DAAL_PROFILER=1                        - enable the profiler, print the summary to stderr at exit
+ *   DAAL_PROFILER_SUMMARY=<file>           - write the summary to the file instead of stderr
+ *   DAAL_PROFILER_TRACE=<file>             - write the timeline in Chrome trace format at exit
+ *   DAAL_PROFILER_BUFFER_SIZE=<nEvents>    - number of the latest events kept for the timeline per thread
+ * Every thread records its tasks into its own ring buffer without locks, the timeline keeps the latest events only,
+ * while the summary aggregates all the recorded tasks by name.
+ * The results are to be written when no computations are running.
+ */
 class Profiler
 {
 public:
     static ProfilerTask startTask(const char * taskName);
     static void endTask(const char * taskName);
+
+    static void enable(bool enableFlag = true);
+    static bool isEnabled();
+    /* Removes the recorded tasks */
+    static void reset();
+    /* Writes the summary by task name: number of calls, total and self time summed over threads. Writes to stderr if fileName is null */
+    static bool writeSummary(const char * fileName = 0);
+    /* Writes the recorded events in Chrome trace event format (chrome://tracing, Perfetto) */
+    static bool writeChromeTrace(const char * fileName);
 };
 
 } // namespace internal
 } // namespace daal
+
+#endif
@@ -70,6 +70,9 @@
     DECLARE_DAAL_STRING_CONST(cosineDistance)                    \
     DECLARE_DAAL_STRING_CONST(quantiles)                         \
     DECLARE_DAAL_STRING_CONST(quantileOrders)                    \
+    DECLARE_DAAL_STRING_CONST(sketchItems)                       \
+    DECLARE_DAAL_STRING_CONST(sketchLevels)                      \
+    DECLARE_DAAL_STRING_CONST(sketchSize)                        \
     DECLARE_DAAL_STRING_CONST(covariance)                        \
     DECLARE_DAAL_STRING_CONST(correlation)                       \
     DECLARE_DAAL_STRING_CONST(mean)                              \
@@ -171,6 +174,11 @@
     DECLARE_DAAL_STRING_CONST(inputWeights)                      \
     DECLARE_DAAL_STRING_CONST(inputCovariances)                  \
     DECLARE_DAAL_STRING_CONST(inputMeans)                        \
+    DECLARE_DAAL_STRING_CONST(partialMeans)                      \
+    DECLARE_DAAL_STRING_CONST(partialCovariances)                \
+    DECLARE_DAAL_STRING_CONST(partialGoalFunction)               \
+    DECLARE_DAAL_STRING_CONST(partialNBlocks)                    \
+    DECLARE_DAAL_STRING_CONST(stepSizeDecay)                     \
     DECLARE_DAAL_STRING_CONST(inputOfStep2)                      \
     DECLARE_DAAL_STRING_CONST(inputOfStep2FromStep1)             \
     DECLARE_DAAL_STRING_CONST(inputOfStep3FromStep1)             \
@@ -239,6 +247,8 @@
     DECLARE_DAAL_STRING_CONST(featuresPerNode)                   \
     DECLARE_DAAL_STRING_CONST(lambda)                            \
     DECLARE_DAAL_STRING_CONST(preferenceThreshold)               \
+    DECLARE_DAAL_STRING_CONST(solverMethod)                      \
+    DECLARE_DAAL_STRING_CONST(nCGIterations)                     \
     DECLARE_DAAL_STRING_CONST(pyramidHeight)                     \
     DECLARE_DAAL_STRING_CONST(itemsFactors)                      \
     DECLARE_DAAL_STRING_CONST(partialModels)                     \
@@ -269,6 +279,12 @@
     DECLARE_DAAL_STRING_CONST(retainRatio)                       \
     DECLARE_DAAL_STRING_CONST(k)                                 \
     DECLARE_DAAL_STRING_CONST(kdTreeTable)                       \
+    DECLARE_DAAL_STRING_CONST(maxDegree)                         \
+    DECLARE_DAAL_STRING_CONST(efConstruction)                    \
+    DECLARE_DAAL_STRING_CONST(efSearch)                          \
+    DECLARE_DAAL_STRING_CONST(engine)                            \
+    DECLARE_DAAL_STRING_CONST(metric)                            \
+    DECLARE_DAAL_STRING_CONST(minkowskiPower)                    \
     DECLARE_DAAL_STRING_CONST(distances)                         \
     DECLARE_DAAL_STRING_CONST(auxRetainMask)                     \
     DECLARE_DAAL_STRING_CONST(auxValue)                          \
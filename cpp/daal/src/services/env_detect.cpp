@@ -25,6 +25,7 @@
 
 #include "services/env_detect.h"
 #include "services/daal_defines.h"
+#include "services/daal_memory.h"
 #include "src/services/service_defines.h"
 #include "src/externals/service_service.h"
 #include "src/threading/threading.h"
@@ -184,6 +185,17 @@ DAAL_EXPORT int daal::services::Environment::setMemoryLimit(MemType type, size_t
     return daal::internal::Service<>::serv_set_memory_limit(type, limit);
 }
 
+DAAL_EXPORT void daal::services::Environment::setMemoryPlacement(MemoryPlacement placement)
+{
+    initNumberOfThreads();
+    daal::services::internal::setMemoryPlacement(placement);
+}
+
+DAAL_EXPORT daal::MemoryPlacement daal::services::Environment::getMemoryPlacement() const
+{
+    return daal::services::internal::getMemoryPlacement();
+}
+
 DAAL_EXPORT void daal::services::Environment::enableThreadPinning(const bool enableThreadPinningFlag)
 {
     initNumberOfThreads();
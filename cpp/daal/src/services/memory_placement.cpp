@@ -0,0 +1,197 @@
+/* file: memory_placement.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the placement of numeric table memory on NUMA nodes.
+//--
+*/
+
+#include "services/daal_memory.h"
+#include "src/threading/threading.h"
+#include "src/services/service_topo.h"
+
+namespace daal
+{
+namespace services
+{
+namespace internal
+{
+namespace
+{
+const size_t placementPageSize = 4096;
+/* Smaller buffers are not worth the parallel initialization */
+const size_t placementMinSize = 1 << 20;
+
+MemoryPlacement globalMemoryPlacement = defaultPlacement;
+
+/* Number of rows in the blocks processed by parallel loops of the algorithms */
+const size_t placementRowsInBlock = 256;
+
+/* Writes the memory by blocks of rows with the same partitioning of the blocks over the threads as threader_for uses */
+void touchRows(byte * ptr, size_t nRows, size_t rowSize)
+{
+    const size_t nBlocks = nRows / placementRowsInBlock + !!(nRows % placementRowsInBlock);
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t iStart = iBlock * placementRowsInBlock;
+        const size_t iEnd   = (iStart + placementRowsInBlock > nRows) ? nRows : iStart + placementRowsInBlock;
+        for (size_t i = iStart * rowSize; i < iEnd * rowSize; i++)
+        {
+            ptr[i] = 0;
+        }
+    });
+}
+
+/* Writes the pages i, i + nNodes, i + 2 * nNodes, ... of the buffer from the threads bound to the node i */
+struct InterleaveTask
+{
+    byte * ptr;
+    size_t size;
+    size_t node;
+    size_t nNodes;
+
+    static void run(const void * a)
+    {
+        const InterleaveTask & task = *static_cast<const InterleaveTask *>(a);
+
+        const size_t offset = size_t(task.ptr) % placementPageSize;
+        const size_t nPages = (offset + task.size) / placementPageSize + !!((offset + task.size) % placementPageSize);
+        const size_t nNodePages = (nPages > task.node) ? (nPages - task.node) / task.nNodes + !!((nPages - task.node) % task.nNodes) : 0;
+
+        daal::threader_for(nNodePages, nNodePages, [&](size_t i) {
+            const size_t page  = task.node + i * task.nNodes;
+            const size_t begin = (page == 0) ? 0 : page * placementPageSize - offset;
+            const size_t end   = ((page + 1) * placementPageSize - offset > task.size) ? task.size : (page + 1) * placementPageSize - offset;
+            for (size_t j = begin; j < end; j++)
+            {
+                task.ptr[j] = 0;
+            }
+        });
+    }
+};
+
+#if !(defined DAAL_CPU_TOPO_DISABLED)
+/* Task arenas bound to the logical processors of the NUMA nodes, created once and reused by all the allocations */
+class NodeArenas
+{
+public:
+    static const NodeArenas & get()
+    {
+        static const NodeArenas arenas;
+        return arenas;
+    }
+
+    size_t size() const { return _nNodes; }
+    void * operator[](size_t node) const { return _arenas[node]; }
+
+private:
+    NodeArenas() : _arenas(nullptr), _nNodes(0)
+    {
+        const size_t nNodes = _internal_daal_GetSysProcessorPackageCount();
+        if (nNodes < 2) return;
+
+        int * cpus = (int *)daal_malloc(_internal_daal_GetSysLogicalProcessorCount() * sizeof(int));
+        _arenas    = (void **)daal_calloc(nNodes * sizeof(void *));
+        if (cpus && _arenas)
+        {
+            bool ok = true;
+            for (size_t node = 0; node < nNodes && ok; node++)
+            {
+                const int nCpus = int(_internal_daal_GetPackageLogicalProcessors(unsigned(node), cpus));
+                _arenas[node]   = (nCpus > 0) ? _daal_new_task_arena(nCpus, cpus, nCpus) : nullptr;
+                ok              = (_arenas[node] != nullptr);
+            }
+            if (ok) _nNodes = nNodes;
+        }
+        daal_free(cpus);
+        if (!_nNodes) release(nNodes);
+    }
+
+    ~NodeArenas() { release(_nNodes); }
+
+    void release(size_t nNodes)
+    {
+        if (!_arenas) return;
+        for (size_t node = 0; node < nNodes; node++)
+        {
+            if (_arenas[node]) _daal_del_task_arena(_arenas[node]);
+        }
+        daal_free(_arenas);
+        _arenas = nullptr;
+    }
+
+    NodeArenas(const NodeArenas &);
+    NodeArenas & operator=(const NodeArenas &);
+
+    void ** _arenas;
+    size_t _nNodes;
+};
+#endif
+
+/* Interleaves the pages over the NUMA nodes, returns false if the system has a single node or the topology is unknown */
+bool interleavePages(byte * ptr, size_t size)
+{
+#if !(defined DAAL_CPU_TOPO_DISABLED)
+    const NodeArenas & arenas = NodeArenas::get();
+    const size_t nNodes       = arenas.size();
+    if (nNodes < 2) return false;
+
+    for (size_t node = 0; node < nNodes; node++)
+    {
+        InterleaveTask task;
+        task.ptr    = ptr;
+        task.size   = size;
+        task.node   = node;
+        task.nNodes = nNodes;
+        _daal_execute_task_arena(arenas[node], &task, InterleaveTask::run);
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+} // namespace
+
+DAAL_EXPORT void * daal_malloc_rows(size_t nRows, size_t rowSize, size_t alignment)
+{
+    const size_t size = nRows * rowSize;
+    byte * const ptr  = (byte *)daal_malloc(size, alignment);
+
+    const MemoryPlacement placement = globalMemoryPlacement;
+    if (!ptr || placement == defaultPlacement || size < placementMinSize || _daal_is_in_parallel()) return ptr;
+
+    /* Pages that were not placed on the nodes in the round-robin manner are placed by the first touch */
+    if (placement == firstTouchPlacement || !interleavePages(ptr, size))
+    {
+        touchRows(ptr, nRows, rowSize);
+    }
+    return ptr;
+}
+
+DAAL_EXPORT void setMemoryPlacement(MemoryPlacement placement)
+{
+    globalMemoryPlacement = placement;
+}
+
+DAAL_EXPORT MemoryPlacement getMemoryPlacement()
+{
+    return globalMemoryPlacement;
+}
+
+} // namespace internal
+} // namespace services
+} // namespace daal
@@ -1914,6 +1914,29 @@ unsigned _internal_daal_GetLogicalProcessorQueue(int * queue)
     return glbl_obj.error;
 }
 
+/*
+ * _internal_daal_GetPackageLogicalProcessors
+ *
+ * Fills the array with OS indices of the logical processors of the processor package
+ *
+ * Arguments: package ordinal, array of at least _internal_daal_GetSysLogicalProcessorCount() elements
+ * Return: number of logical processors in the package, 0 if can not calculate
+ */
+unsigned _internal_daal_GetPackageLogicalProcessors(unsigned package_ordinal, int * cpus)
+{
+    if (!glbl_obj.isInit) __internal_daal_initCpuTopology();
+
+    if (glbl_obj.error || package_ordinal >= _internal_daal_GetSysProcessorPackageCount()) return 0;
+
+    unsigned n = 0;
+    for (unsigned j = 0; j < _internal_daal_GetSysLogicalProcessorCount(); j++)
+    {
+        if (glbl_obj.pApicAffOrdMapping[j].packageORD == package_ordinal) cpus[n++] = j;
+    }
+
+    return n;
+}
+
 unsigned _internal_daal_GetStatus()
 {
     return glbl_obj.error;
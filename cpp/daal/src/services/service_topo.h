@@ -354,6 +354,7 @@ unsigned _internal_daal_GetLogicalPerCoreProcessorCount();
 unsigned _internal_daal_GetCoreCount(unsigned long package_ordinal);
 unsigned _internal_daal_GetThreadCount(unsigned long package_ordinal, unsigned long core_ordinal);
 unsigned _internal_daal_GetLogicalProcessorQueue(int * queue);
+unsigned _internal_daal_GetPackageLogicalProcessors(unsigned package_ordinal, int * cpus);
 unsigned _internal_daal_GetStatus();
 
 unsigned _internal_daal_GetSysLogicalProcessorCount();
@@ -0,0 +1,85 @@
+/* file: task_arena.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the class that confines computations to an isolated set of threads.
+//--
+*/
+
+#include "services/task_arena.h"
+#include "services/daal_memory.h"
+#include "src/threading/threading.h"
+#include "src/services/service_topo.h"
+
+DAAL_EXPORT daal::services::TaskArena::TaskArena(size_t nThreads, int numaNode) : _impl(nullptr), _nThreads(nThreads), _numaNode(-1)
+{
+    int * cpus = nullptr;
+    int nCpus  = 0;
+#if !(defined DAAL_CPU_TOPO_DISABLED)
+    if (numaNode >= 0 && size_t(numaNode) < getNumberOfNumaNodes())
+    {
+        const unsigned nLogicalProcessors = daal::services::internal::_internal_daal_GetSysLogicalProcessorCount();
+        cpus                              = (int *)daal::services::daal_malloc(nLogicalProcessors * sizeof(int));
+        if (cpus) nCpus = int(daal::services::internal::_internal_daal_GetPackageLogicalProcessors(unsigned(numaNode), cpus));
+        if (nCpus > 0) _numaNode = numaNode;
+        if (!_nThreads) _nThreads = size_t(nCpus);
+    }
+#endif
+
+    _impl     = _daal_new_task_arena(int(_nThreads), nCpus > 0 ? cpus : nullptr, nCpus);
+    _nThreads = _impl ? size_t(_daal_task_arena_max_concurrency(_impl)) : 1;
+
+    daal::services::daal_free(cpus);
+}
+
+DAAL_EXPORT daal::services::TaskArena::~TaskArena()
+{
+    if (_impl) _daal_del_task_arena(_impl);
+}
+
+DAAL_EXPORT size_t daal::services::TaskArena::getNumberOfThreads() const
+{
+    return _nThreads;
+}
+
+DAAL_EXPORT int daal::services::TaskArena::getNumaNode() const
+{
+    return _numaNode;
+}
+
+DAAL_EXPORT size_t daal::services::TaskArena::getNumberOfNumaNodes()
+{
+#if !(defined DAAL_CPU_TOPO_DISABLED)
+    return daal::services::internal::_internal_daal_GetSysProcessorPackageCount();
+#else
+    return 0;
+#endif
+}
+
+void daal::services::TaskArena::runFunctor(const void * a)
+{
+    static_cast<const Functor *>(a)->run();
+}
+
+DAAL_EXPORT void daal::services::TaskArena::executeImpl(const Functor & f)
+{
+    if (_impl)
+        _daal_execute_task_arena(_impl, &f, runFunctor);
+    else
+        f.run();
+}
@@ -215,7 +215,8 @@ public:
 
     void execute(daal::services::internal::thread_pinner_task_t & task)
     {
-        if (do_pinning && (status == 0) && (is_pinning.get() == 0))
+        /* Computations inside the user task arena stay in that arena */
+        if (do_pinning && (status == 0) && (is_pinning.get() == 0) && !_daal_is_in_task_arena())
         {
             is_pinning.set(1);
             pinner_arena.execute(task);
@@ -27,6 +27,7 @@
 #if defined(__DO_TBB_LAYER__)
     #define TBB_PREVIEW_GLOBAL_CONTROL 1
     #define TBB_PREVIEW_TASK_ARENA     1
+    #define TBB_PREVIEW_LOCAL_OBSERVER 1
 
     #include <stdlib.h> // malloc and free
     #include <tbb/tbb.h>
@@ -34,8 +35,16 @@
     #include <tbb/scalable_allocator.h>
     #include <tbb/global_control.h>
     #include <tbb/task_arena.h>
+    #include <tbb/task_scheduler_observer.h>
     #include "services/daal_atomic_int.h"
 
+    #if defined(__linux__)
+        #include <sched.h>
+        #include <pthread.h>
+    #elif defined(_WIN32) || defined(_WIN64)
+        #include <Windows.h>
+    #endif
+
     #if defined(TBB_INTERFACE_VERSION) && TBB_INTERFACE_VERSION >= 12002
         #include <tbb/task.h>
     #endif
@@ -814,6 +823,125 @@ DAAL_EXPORT void _daal_wait_task_group(void * taskGroupPtr)
     ((tbb::task_group *)taskGroupPtr)->wait();
 }
 
+namespace
+{
+/* Number of the nested task arenas the current thread executes in */
+tbb::enumerable_thread_specific<int> taskArenaDepth(0);
+
+/* Counts the current thread as executing in the task arena until the end of the scope */
+class task_arena_depth_guard
+{
+public:
+    task_arena_depth_guard() : _depth(taskArenaDepth.local()) { ++_depth; }
+    ~task_arena_depth_guard() { --_depth; }
+
+private:
+    task_arena_depth_guard(const task_arena_depth_guard &);
+    task_arena_depth_guard & operator=(const task_arena_depth_guard &);
+
+    int & _depth;
+};
+
+/* Binds the threads entering the task arena to the given logical processors */
+class task_arena_binder : public tbb::task_scheduler_observer
+{
+public:
+    task_arena_binder(tbb::task_arena & arena, const int * cpus, int nCpus) : tbb::task_scheduler_observer(arena)
+    {
+    #if defined(__linux__)
+        CPU_ZERO(&_mask);
+        for (int i = 0; i < nCpus; i++)
+        {
+            if (cpus[i] < CPU_SETSIZE) CPU_SET(cpus[i], &_mask);
+        }
+    #elif defined(_WIN32) || defined(_WIN64)
+        const int bitsInMask = int(sizeof(KAFFINITY) * 8);
+        _mask                = GROUP_AFFINITY();
+        _mask.Group = WORD(cpus[0] / bitsInMask);
+        for (int i = 0; i < nCpus; i++)
+        {
+            if (cpus[i] / bitsInMask == _mask.Group) _mask.Mask |= KAFFINITY(1) << (cpus[i] % bitsInMask);
+        }
+    #endif
+        observe(true);
+    }
+
+    ~task_arena_binder() { observe(false); }
+
+    void on_scheduler_entry(bool) /*override*/
+    {
+    #if defined(__linux__)
+        cpu_set_t & saved = _savedMask.local();
+        if (!pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), &saved)) pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &_mask);
+    #elif defined(_WIN32) || defined(_WIN64)
+        GROUP_AFFINITY & saved = _savedMask.local();
+        if (GetThreadGroupAffinity(GetCurrentThread(), &saved)) SetThreadGroupAffinity(GetCurrentThread(), &_mask, NULL);
+    #endif
+    }
+
+    void on_scheduler_exit(bool) /*override*/
+    {
+    #if defined(__linux__)
+        pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &_savedMask.local());
+    #elif defined(_WIN32) || defined(_WIN64)
+        SetThreadGroupAffinity(GetCurrentThread(), &_savedMask.local(), NULL);
+    #endif
+    }
+
+private:
+    #if defined(__linux__)
+    cpu_set_t _mask;
+    tbb::enumerable_thread_specific<cpu_set_t> _savedMask;
+    #elif defined(_WIN32) || defined(_WIN64)
+    GROUP_AFFINITY _mask;
+    tbb::enumerable_thread_specific<GROUP_AFFINITY> _savedMask;
+    #endif
+};
+
+struct task_arena_impl
+{
+    task_arena_impl(int nThreads, const int * cpus, int nCpus)
+        : arena(nThreads > 0 ? nThreads : int(tbb::task_arena::automatic)), binder(nullptr)
+    {
+        arena.initialize();
+        if (cpus && nCpus > 0) binder = new task_arena_binder(arena, cpus, nCpus);
+    }
+
+    ~task_arena_impl() { delete binder; }
+
+    tbb::task_arena arena;
+    task_arena_binder * binder;
+};
+} // namespace
+
+DAAL_EXPORT void * _daal_new_task_arena(int nThreads, const int * cpus, int nCpus)
+{
+    return new task_arena_impl(nThreads, cpus, nCpus);
+}
+
+DAAL_EXPORT void _daal_del_task_arena(void * taskArenaPtr)
+{
+    delete (task_arena_impl *)taskArenaPtr;
+}
+
+DAAL_EXPORT void _daal_execute_task_arena(void * taskArenaPtr, const void * a, daal::functype_arena func)
+{
+    ((task_arena_impl *)taskArenaPtr)->arena.execute([&]() {
+        task_arena_depth_guard depthGuard;
+        func(a);
+    });
+}
+
+DAAL_EXPORT int _daal_task_arena_max_concurrency(void * taskArenaPtr)
+{
+    return ((task_arena_impl *)taskArenaPtr)->arena.max_concurrency();
+}
+
+DAAL_EXPORT bool _daal_is_in_task_arena()
+{
+    return taskArenaDepth.local() > 0;
+}
+
 #else
 DAAL_EXPORT void * _daal_get_ls_ptr(void * a, daal::tls_functype func)
 {
@@ -845,6 +973,28 @@ DAAL_EXPORT void _daal_run_task_group(void * taskGroupPtr, daal::task * task) {}
 
 DAAL_EXPORT void _daal_wait_task_group(void * taskGroupPtr) {}
 
+DAAL_EXPORT void * _daal_new_task_arena(int nThreads, const int * cpus, int nCpus)
+{
+    return nullptr;
+}
+
+DAAL_EXPORT void _daal_del_task_arena(void * taskArenaPtr) {}
+
+DAAL_EXPORT void _daal_execute_task_arena(void * taskArenaPtr, const void * a, daal::functype_arena func)
+{
+    func(a);
+}
+
+DAAL_EXPORT int _daal_task_arena_max_concurrency(void * taskArenaPtr)
+{
+    return 1;
+}
+
+DAAL_EXPORT bool _daal_is_in_task_arena()
+{
+    return false;
+}
+
 #endif
 
 namespace daal
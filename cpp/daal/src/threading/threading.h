@@ -51,6 +51,7 @@ typedef int64_t (*loop_functype_int32_int64)(int32_t start_idx_reduce, int32_t e
 typedef int64_t (*loop_functype_int32ptr_int64)(const int32_t * start_idx_reduce, const int32_t * end_idx_reduce, int64_t value_for_reduce,
                                                 const void * a);
 typedef int64_t (*reduction_functype_int64)(int64_t a, int64_t b, const void * reduction);
+typedef void (*functype_arena)(const void * a);
 
 class task;
 } // namespace daal
@@ -99,6 +100,12 @@ extern "C"
     DAAL_EXPORT void _daal_run_task_group(void * taskGroupPtr, daal::task * t);
     DAAL_EXPORT void _daal_wait_task_group(void * taskGroupPtr);
 
+    DAAL_EXPORT void * _daal_new_task_arena(int nThreads, const int * cpus, int nCpus);
+    DAAL_EXPORT void _daal_del_task_arena(void * taskArenaPtr);
+    DAAL_EXPORT void _daal_execute_task_arena(void * taskArenaPtr, const void * a, daal::functype_arena func);
+    DAAL_EXPORT int _daal_task_arena_max_concurrency(void * taskArenaPtr);
+    DAAL_EXPORT bool _daal_is_in_task_arena();
+
     DAAL_EXPORT void _daal_tbb_task_scheduler_free(void *& globalControl);
     DAAL_EXPORT size_t _setNumberOfThreads(const size_t numThreads, void ** globalControl);
 
@@ -37,6 +37,7 @@
 #include "oneapi/dal/graph/undirected_adjacency_array_graph.hpp"
 
 /* I/O */
+#include "oneapi/dal/io/binary.hpp"
 #include "oneapi/dal/io/csv.hpp"
 #include "oneapi/dal/io/load_graph.hpp"
 
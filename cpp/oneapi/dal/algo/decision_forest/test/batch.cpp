@@ -315,6 +315,32 @@ public:
         }
     }
 
+    void check_infer_results_match(const df::infer_result<Task>& result,
+                                   const df::infer_result<Task>& reference) {
+        INFO("check if infer labels match the reference ones")
+        const auto labels = dal::row_accessor<const Float>(result.get_labels()).pull();
+        const auto ref_labels = dal::row_accessor<const Float>(reference.get_labels()).pull();
+        REQUIRE(labels.get_count() == ref_labels.get_count());
+        for (std::int64_t i = 0; i < labels.get_count(); i++) {
+            REQUIRE(labels[i] == ref_labels[i]);
+        }
+
+        constexpr bool is_cls = std::is_same_v<Task, decision_forest::task::classification>;
+        if constexpr (is_cls) {
+            if (result.get_probabilities().has_data()) {
+                INFO("check if infer probabilities match the reference ones")
+                const auto probs =
+                    dal::row_accessor<const Float>(result.get_probabilities()).pull();
+                const auto ref_probs =
+                    dal::row_accessor<const Float>(reference.get_probabilities()).pull();
+                REQUIRE(probs.get_count() == ref_probs.get_count());
+                for (std::int64_t i = 0; i < probs.get_count(); i++) {
+                    REQUIRE(probs[i] == ref_probs[i]);
+                }
+            }
+        }
+    }
+
     checker_info<double> get_cls_checker(double required_accuracy) {
         return checker_info<double>{ "cls_checker",
                                      &calculate_classification_error,
@@ -642,6 +668,50 @@ DF_BATCH_CLS_TEST_NIGHTLY_EXT("df cls oob per observation flow") {
                                                         1 - wl.required_accuracy);
 }
 
+DF_BATCH_CLS_TEST_EXT("df cls histogram subtraction flow") {
+    SKIP_IF(this->is_gpu());
+    SKIP_IF(this->not_available_on_device());
+    const workload_cls wl = { df_ds_segment, 0.738 };
+
+    const auto [data, data_test, checker_list] =
+        this->get_cls_dataframe(wl.ds_info.name, wl.required_accuracy);
+
+    // depth-first building takes the histograms of the bigger child by subtraction,
+    // best-first building with unlimited leaves computes all of them and grows the same tree,
+    // class histograms keep the counts of observations, so both ways give exactly the same splits
+    const auto make_descriptor = [&](std::int64_t max_leaf_nodes) {
+        auto desc = this->get_default_descriptor();
+        desc.set_tree_count(1);
+        desc.set_bootstrap(false);
+        desc.set_features_per_node(data.get_column_count() - 1); // skip labels column
+        desc.set_max_leaf_nodes(max_leaf_nodes);
+        desc.set_infer_mode(df::infer_mode::class_labels | df::infer_mode::class_probabilities);
+        desc.set_class_count(wl.ds_info.class_count);
+        return desc;
+    };
+
+    const auto desc = make_descriptor(0);
+    const auto desc_no_subtraction = make_descriptor(data.get_row_count());
+
+    const auto train_result = this->train_base_checks(desc, data, this->get_homogen_table_id());
+    const auto train_result_no_subtraction =
+        this->train_base_checks(desc_no_subtraction, data, this->get_homogen_table_id());
+
+    const auto infer_result = this->infer_base_checks(desc,
+                                                      data_test,
+                                                      this->get_homogen_table_id(),
+                                                      train_result.get_model(),
+                                                      checker_list);
+    const auto infer_result_no_subtraction =
+        this->infer_base_checks(desc_no_subtraction,
+                                data_test,
+                                this->get_homogen_table_id(),
+                                train_result_no_subtraction.get_model(),
+                                checker_list);
+
+    this->check_infer_results_match(infer_result, infer_result_no_subtraction);
+}
+
 DF_BATCH_CLS_TEST("df cls base check with default paarams") {
     SKIP_IF(this->not_available_on_device());
 
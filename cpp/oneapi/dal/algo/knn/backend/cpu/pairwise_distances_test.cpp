@@ -0,0 +1,327 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <mutex>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "src/algorithms/service_kernel_math.h"
+#include "gtest/gtest.h"
+
+namespace daal_dm = daal::data_management;
+namespace daal_int = daal::algorithms::internal;
+
+using reference_t = std::function<double(const float*, const float*, std::size_t)>;
+
+constexpr daal::CpuType test_cpu = daal::sse2;
+constexpr std::size_t row_count_a = 200;
+constexpr std::size_t row_count_b = 300;
+constexpr std::size_t column_count = 6;
+
+/* Small non-negative integers, so that the distances are exact and have many ties */
+static std::vector<float> make_data(std::size_t row_count, std::uint32_t seed) {
+    std::mt19937 engine(seed);
+    std::uniform_int_distribution<int> value(0, 2);
+    std::vector<float> data(row_count * column_count);
+    for (auto& x : data) {
+        x = float(value(engine));
+    }
+    return data;
+}
+
+static daal_dm::NumericTablePtr make_table(std::vector<float>& data, std::size_t row_count) {
+    return daal_dm::HomogenNumericTable<float>::create(data.data(), column_count, row_count);
+}
+
+static double minkowski_reference(const float* a, const float* b, std::size_t dim, double p) {
+    double sum = 0.0;
+    for (std::size_t k = 0; k < dim; k++) {
+        sum += std::pow(std::abs(double(a[k]) - double(b[k])), p);
+    }
+    return sum;
+}
+
+static double chebyshev_reference(const float* a, const float* b, std::size_t dim) {
+    double res = 0.0;
+    for (std::size_t k = 0; k < dim; k++) {
+        res = std::max(res, std::abs(double(a[k]) - double(b[k])));
+    }
+    return res;
+}
+
+static double hamming_reference(const float* a, const float* b, std::size_t dim) {
+    double sum = 0.0;
+    for (std::size_t k = 0; k < dim; k++) {
+        sum += double((a[k] != 0.0f) != (b[k] != 0.0f));
+    }
+    return sum;
+}
+
+static double cosine_reference(const float* a, const float* b, std::size_t dim, bool centered) {
+    double mean_a = 0.0, mean_b = 0.0;
+    if (centered) {
+        for (std::size_t k = 0; k < dim; k++) {
+            mean_a += a[k];
+            mean_b += b[k];
+        }
+        mean_a /= double(dim);
+        mean_b /= double(dim);
+    }
+
+    double ab = 0.0, aa = 0.0, bb = 0.0;
+    for (std::size_t k = 0; k < dim; k++) {
+        const double x = a[k] - mean_a;
+        const double y = b[k] - mean_b;
+        ab += x * y;
+        aa += x * x;
+        bb += y * y;
+    }
+    return (aa > 0.0 && bb > 0.0) ? 1.0 - ab / std::sqrt(aa * bb) : 1.0;
+}
+
+static void check_full(daal_int::PairwiseDistances<float, test_cpu>& distances,
+                       const std::vector<float>& a,
+                       const std::vector<float>& b,
+                       const reference_t& reference,
+                       double tolerance) {
+    ASSERT_TRUE(distances.init().ok());
+
+    std::vector<float> result(row_count_a * row_count_b);
+    ASSERT_TRUE(distances.computeFull(result.data()).ok());
+
+    for (std::size_t i = 0; i < row_count_a; i++) {
+        for (std::size_t j = 0; j < row_count_b; j++) {
+            const double expected =
+                reference(a.data() + i * column_count, b.data() + j * column_count, column_count);
+            ASSERT_NEAR(result[i * row_count_b + j], expected, tolerance)
+                << "row " << i << ", column " << j;
+        }
+    }
+}
+
+/* Checks the fused selection against sorting of all distances by (distance, index) */
+static void check_k_nearest(daal_int::PairwiseDistances<float, test_cpu>& distances,
+                            std::vector<float>& a,
+                            std::vector<float>& b,
+                            const reference_t& reference,
+                            std::size_t k,
+                            double tolerance) {
+    const auto a_table = make_table(a, row_count_a);
+    const auto b_table = make_table(b, row_count_b);
+    ASSERT_TRUE(distances.init().ok());
+
+    const std::size_t expected_count = std::min(k, row_count_b);
+    std::vector<std::size_t> indices(row_count_a * expected_count);
+    std::vector<float> nearest(row_count_a * expected_count);
+    std::vector<int> visited(row_count_a, 0);
+    std::mutex visited_mutex;
+
+    const auto status = daal_int::computeKNearest<float, test_cpu>(
+        distances,
+        *a_table,
+        *b_table,
+        k,
+        [&](std::size_t offset,
+            std::size_t size,
+            std::size_t count,
+            const std::size_t* block_indices,
+            const float* block_distances) -> daal::services::Status {
+            EXPECT_EQ(count, expected_count);
+            std::copy(block_indices, block_indices + size * count, indices.data() + offset * count);
+            std::copy(block_distances,
+                      block_distances + size * count,
+                      nearest.data() + offset * count);
+
+            std::lock_guard<std::mutex> lock(visited_mutex);
+            for (std::size_t i = offset; i < offset + size; i++) {
+                visited[i]++;
+            }
+            return daal::services::Status();
+        });
+    ASSERT_TRUE(status.ok());
+
+    for (std::size_t i = 0; i < row_count_a; i++) {
+        ASSERT_EQ(visited[i], 1) << "row " << i;
+
+        std::vector<std::pair<double, std::size_t>> all(row_count_b);
+        for (std::size_t j = 0; j < row_count_b; j++) {
+            all[j] = { reference(a.data() + i * column_count,
+                                 b.data() + j * column_count,
+                                 column_count),
+                       j };
+        }
+        std::sort(all.begin(), all.end());
+
+        for (std::size_t kk = 0; kk < expected_count; kk++) {
+            ASSERT_NEAR(nearest[i * expected_count + kk], all[kk].first, tolerance)
+                << "row " << i << ", neighbor " << kk;
+            if (tolerance == 0.0) {
+                ASSERT_EQ(indices[i * expected_count + kk], all[kk].second)
+                    << "row " << i << ", neighbor " << kk;
+            }
+        }
+    }
+}
+
+TEST(pairwise_distances_test, minkowski_matches_reference) {
+    auto a = make_data(row_count_a, 1);
+    auto b = make_data(row_count_b, 2);
+    const auto a_table = make_table(a, row_count_a);
+    const auto b_table = make_table(b, row_count_b);
+
+    for (const double p : { 1.0, 2.0, 3.0, 1.5 }) {
+        daal_int::MinkowskiDistances<float, test_cpu> powered(*a_table, *b_table, float(p), true);
+        check_full(
+            powered,
+            a,
+            b,
+            [p](const float* x, const float* y, std::size_t dim) {
+                return minkowski_reference(x, y, dim, p);
+            },
+            1e-4);
+
+        daal_int::MinkowskiDistances<float, test_cpu> distances(*a_table,
+                                                                *b_table,
+                                                                float(p),
+                                                                false);
+        check_full(
+            distances,
+            a,
+            b,
+            [p](const float* x, const float* y, std::size_t dim) {
+                return std::pow(minkowski_reference(x, y, dim, p), 1.0 / p);
+            },
+            1e-4);
+    }
+}
+
+TEST(pairwise_distances_test, chebyshev_matches_reference) {
+    auto a = make_data(row_count_a, 3);
+    auto b = make_data(row_count_b, 4);
+    const auto a_table = make_table(a, row_count_a);
+    const auto b_table = make_table(b, row_count_b);
+
+    daal_int::ChebyshevDistances<float, test_cpu> distances(*a_table, *b_table);
+    check_full(distances, a, b, chebyshev_reference, 0.0);
+}
+
+TEST(pairwise_distances_test, hamming_matches_reference) {
+    auto a = make_data(row_count_a, 5);
+    auto b = make_data(row_count_b, 6);
+    const auto a_table = make_table(a, row_count_a);
+    const auto b_table = make_table(b, row_count_b);
+
+    daal_int::HammingDistances<float, test_cpu> distances(*a_table, *b_table);
+    check_full(distances, a, b, hamming_reference, 0.0);
+}
+
+TEST(pairwise_distances_test, cosine_matches_reference) {
+    auto a = make_data(row_count_a, 7);
+    auto b = make_data(row_count_b, 8);
+    const auto a_table = make_table(a, row_count_a);
+    const auto b_table = make_table(b, row_count_b);
+
+    for (const bool centered : { false, true }) {
+        daal_int::CosineDistances<float, test_cpu> distances(*a_table, *b_table, centered);
+        check_full(
+            distances,
+            a,
+            b,
+            [centered](const float* x, const float* y, std::size_t dim) {
+                return cosine_reference(x, y, dim, centered);
+            },
+            1e-5);
+    }
+}
+
+TEST(pairwise_distances_test, k_nearest_resolves_ties_by_index) {
+    auto a = make_data(row_count_a, 9);
+    auto b = make_data(row_count_b, 10);
+    const auto a_table = make_table(a, row_count_a);
+    const auto b_table = make_table(b, row_count_b);
+
+    for (const std::size_t k : { 1, 5, 64 }) {
+        daal_int::HammingDistances<float, test_cpu> hamming(*a_table, *b_table);
+        check_k_nearest(hamming, a, b, hamming_reference, k, 0.0);
+
+        daal_int::ChebyshevDistances<float, test_cpu> chebyshev(*a_table, *b_table);
+        check_k_nearest(chebyshev, a, b, chebyshev_reference, k, 0.0);
+
+        daal_int::MinkowskiDistances<float, test_cpu> manhattan(*a_table, *b_table, 1.0f, true);
+        check_k_nearest(
+            manhattan,
+            a,
+            b,
+            [](const float* x, const float* y, std::size_t dim) {
+                return minkowski_reference(x, y, dim, 1.0);
+            },
+            k,
+            0.0);
+    }
+}
+
+TEST(pairwise_distances_test, k_nearest_matches_reference_for_cosine) {
+    auto a = make_data(row_count_a, 11);
+    auto b = make_data(row_count_b, 12);
+    const auto a_table = make_table(a, row_count_a);
+    const auto b_table = make_table(b, row_count_b);
+
+    daal_int::CosineDistances<float, test_cpu> distances(*a_table, *b_table);
+    check_k_nearest(
+        distances,
+        a,
+        b,
+        [](const float* x, const float* y, std::size_t dim) {
+            return cosine_reference(x, y, dim, false);
+        },
+        7,
+        1e-5);
+}
+
+TEST(pairwise_distances_test, k_nearest_returns_all_rows_if_k_exceeds_row_count) {
+    auto a = make_data(row_count_a, 13);
+    auto b = make_data(row_count_b, 14);
+    const auto a_table = make_table(a, row_count_a);
+    const auto b_table = make_table(b, row_count_b);
+
+    daal_int::HammingDistances<float, test_cpu> distances(*a_table, *b_table);
+    check_k_nearest(distances, a, b, hamming_reference, row_count_b + 10, 0.0);
+}
+
+TEST(pairwise_distances_test, sort_max_heap_sorts_all_elements) {
+    std::mt19937 engine(15);
+    std::uniform_int_distribution<int> value(0, 100);
+    auto compare = [](int lhs, int rhs) {
+        return lhs < rhs;
+    };
+
+    for (const std::size_t count : { 1, 2, 3, 16, 129 }) {
+        std::vector<int> data(count);
+        for (auto& x : data) {
+            x = value(engine);
+        }
+        auto expected = data;
+        std::sort(expected.begin(), expected.end());
+
+        daal_int::makeMaxHeap<test_cpu>(data.data(), data.data() + count, compare);
+        daal_int::sortMaxHeap<test_cpu>(data.data(), data.data() + count, compare);
+        EXPECT_EQ(data, expected);
+    }
+}
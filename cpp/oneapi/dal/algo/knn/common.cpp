@@ -27,6 +27,9 @@ class descriptor_impl : public base {
 public:
     std::int64_t class_count = 2;
     std::int64_t neighbor_count = 1;
+    std::int64_t max_degree = 16;
+    std::int64_t ef_construction = 200;
+    std::int64_t ef_search = 64;
 };
 
 template <typename Task>
@@ -58,6 +61,45 @@ void descriptor_base<Task>::set_neighbor_count_impl(std::int64_t value) {
     impl_->neighbor_count = value;
 }
 
+template <typename Task>
+std::int64_t descriptor_base<Task>::get_max_degree() const {
+    return impl_->max_degree;
+}
+
+template <typename Task>
+void descriptor_base<Task>::set_max_degree_impl(std::int64_t value) {
+    if (value < 2) {
+        throw domain_error(dal::detail::error_messages::max_degree_leq_one());
+    }
+    impl_->max_degree = value;
+}
+
+template <typename Task>
+std::int64_t descriptor_base<Task>::get_ef_construction() const {
+    return impl_->ef_construction;
+}
+
+template <typename Task>
+void descriptor_base<Task>::set_ef_construction_impl(std::int64_t value) {
+    if (value < 1) {
+        throw domain_error(dal::detail::error_messages::ef_construction_lt_one());
+    }
+    impl_->ef_construction = value;
+}
+
+template <typename Task>
+std::int64_t descriptor_base<Task>::get_ef_search() const {
+    return impl_->ef_search;
+}
+
+template <typename Task>
+void descriptor_base<Task>::set_ef_search_impl(std::int64_t value) {
+    if (value < 1) {
+        throw domain_error(dal::detail::error_messages::ef_search_lt_one());
+    }
+    impl_->ef_search = value;
+}
+
 template class ONEDAL_EXPORT descriptor_base<task::classification>;
 
 } // namespace v1
@@ -45,6 +45,10 @@ struct kd_tree {};
 /// method.
 struct brute_force {};
 
+/// Tag-type that denotes approximate search over the hierarchical navigable
+/// small world graph computational method.
+struct hnsw {};
+
 /// Alias tag-type for :ref:`brute-force <knn_t_math_brute_force>` computational
 /// method.
 using by_default = brute_force;
@@ -52,6 +56,7 @@ using by_default = brute_force;
 
 using v1::kd_tree;
 using v1::brute_force;
+using v1::hnsw;
 using v1::by_default;
 
 } // namespace method
@@ -70,7 +75,7 @@ constexpr bool is_valid_float_v = dal::detail::is_one_of_v<Float, float, double>
 
 template <typename Method>
 constexpr bool is_valid_method_v =
-    dal::detail::is_one_of_v<Method, method::kd_tree, method::brute_force>;
+    dal::detail::is_one_of_v<Method, method::kd_tree, method::brute_force, method::hnsw>;
 
 template <typename Task>
 constexpr bool is_valid_task_v = dal::detail::is_one_of_v<Task, task::classification>;
@@ -95,9 +100,27 @@ public:
     /// @invariant :expr:`neighbor_count > 0`
     std::int64_t get_neighbor_count() const;
 
+    /// The maximal number of graph neighbors of an observation on the upper levels,
+    /// twice as many are kept on the bottom level. Used by :expr:`method::hnsw` only
+    /// @invariant :expr:`max_degree > 1`
+    std::int64_t get_max_degree() const;
+
+    /// The size of the candidate list used to build the graph.
+    /// Used by :expr:`method::hnsw` only
+    /// @invariant :expr:`ef_construction > 0`
+    std::int64_t get_ef_construction() const;
+
+    /// The size of the candidate list used to search the graph, the effective
+    /// value is not less than :literal:`neighbor_count`. Used by :expr:`method::hnsw` only
+    /// @invariant :expr:`ef_search > 0`
+    std::int64_t get_ef_search() const;
+
 protected:
     void set_class_count_impl(std::int64_t value);
     void set_neighbor_count_impl(std::int64_t value);
+    void set_max_degree_impl(std::int64_t value);
+    void set_ef_construction_impl(std::int64_t value);
+    void set_ef_search_impl(std::int64_t value);
 
 private:
     dal::detail::pimpl<descriptor_impl<Task>> impl_;
@@ -122,7 +145,8 @@ namespace v1 {
 ///                intermediate computations. Can be :expr:`float` or
 ///                :expr:`double`.
 /// @tparam Method Tag-type that specifies an implementation of algorithm. Can
-///                be :expr:`method::v1::brute_force` or :expr:`method::v1::kd_tree`.
+///                be :expr:`method::v1::brute_force`, :expr:`method::v1::kd_tree`
+///                or :expr:`method::v1::hnsw`.
 /// @tparam Task   Tag-type that specifies type of the problem to solve. Can
 ///                be :expr:`task::v1::classification`.
 template <typename Float = detail::descriptor_base<>::float_t,
@@ -156,6 +180,21 @@ public:
         base_t::set_neighbor_count_impl(value);
         return *this;
     }
+
+    auto& set_max_degree(std::int64_t value) {
+        base_t::set_max_degree_impl(value);
+        return *this;
+    }
+
+    auto& set_ef_construction(std::int64_t value) {
+        base_t::set_ef_construction_impl(value);
+        return *this;
+    }
+
+    auto& set_ef_search(std::int64_t value) {
+        base_t::set_ef_search_impl(value);
+        return *this;
+    }
 };
 
 /// @tparam Task Tag-type that specifies type of the problem to solve. Can
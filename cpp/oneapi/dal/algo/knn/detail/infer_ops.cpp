@@ -41,6 +41,8 @@ INSTANTIATE(float, method::kd_tree, task::classification)
 INSTANTIATE(double, method::kd_tree, task::classification)
 INSTANTIATE(float, method::brute_force, task::classification)
 INSTANTIATE(double, method::brute_force, task::classification)
+INSTANTIATE(float, method::hnsw, task::classification)
+INSTANTIATE(double, method::hnsw, task::classification)
 
 } // namespace v1
 } // namespace oneapi::dal::knn::detail
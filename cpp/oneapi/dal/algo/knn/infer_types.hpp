@@ -96,9 +96,32 @@ public:
         return *this;
     }
 
+    /// The indices of the nearest neighbors in the training set, one row per
+    /// observation. Computed by :expr:`method::hnsw` only, missing neighbors are
+    /// denoted by $-1$
+    /// @remark default = table{}
+    const table& get_indices() const;
+
+    auto& set_indices(const table& value) {
+        set_indices_impl(value);
+        return *this;
+    }
+
+    /// The Euclidean distances to the nearest neighbors, one row per observation.
+    /// Computed by :expr:`method::hnsw` only
+    /// @remark default = table{}
+    const table& get_distances() const;
+
+    auto& set_distances(const table& value) {
+        set_distances_impl(value);
+        return *this;
+    }
+
 protected:
     void set_labels_impl(const table&);
     const table& get_labels_impl() const;
+    void set_indices_impl(const table&);
+    void set_distances_impl(const table&);
 
 private:
     dal::detail::pimpl<detail::infer_result_impl<Task>> impl_;
@@ -44,9 +44,11 @@ public:
 
     static constexpr bool is_kd_tree = std::is_same_v<Method, knn::method::kd_tree>;
     static constexpr bool is_brute_force = std::is_same_v<Method, knn::method::brute_force>;
+    static constexpr bool is_hnsw = std::is_same_v<Method, knn::method::hnsw>;
 
     bool not_available_on_device() {
-        return (get_policy().is_gpu() && is_kd_tree) || (get_policy().is_cpu() && is_brute_force);
+        return (get_policy().is_gpu() && (is_kd_tree || is_hnsw)) ||
+               (get_policy().is_cpu() && is_brute_force);
     }
 
     auto get_descriptor(std::int64_t override_class_count = class_count,
@@ -86,7 +88,10 @@ private:
                                                                             -2.0, -1.0 };
 };
 
-using knn_types = COMBINE_TYPES((float, double), (knn::method::brute_force, knn::method::kd_tree));
+using knn_types = COMBINE_TYPES((float, double),
+                                (knn::method::brute_force,
+                                 knn::method::kd_tree,
+                                 knn::method::hnsw));
 
 #define KNN_BADARG_TEST(name) \
     TEMPLATE_LIST_TEST_M(knn_badarg_test, name, "[knn][badarg]", knn_types)
@@ -151,6 +156,26 @@ KNN_BADARG_TEST("throws if both class_count and neighbor_count are negative in c
     REQUIRE_THROWS_AS(this->get_descriptor(-1, -1), domain_error);
 }
 
+KNN_BADARG_TEST("accepts max_degree more than one in set_max_degree") {
+    REQUIRE_NOTHROW(this->get_descriptor().set_max_degree(2));
+}
+
+KNN_BADARG_TEST("throws if max_degree is one in set_max_degree") {
+    REQUIRE_THROWS_AS(this->get_descriptor().set_max_degree(1), domain_error);
+}
+
+KNN_BADARG_TEST("throws if max_degree is negative in set_max_degree") {
+    REQUIRE_THROWS_AS(this->get_descriptor().set_max_degree(-1), domain_error);
+}
+
+KNN_BADARG_TEST("throws if ef_construction is zero in set_ef_construction") {
+    REQUIRE_THROWS_AS(this->get_descriptor().set_ef_construction(0), domain_error);
+}
+
+KNN_BADARG_TEST("throws if ef_search is zero in set_ef_search") {
+    REQUIRE_THROWS_AS(this->get_descriptor().set_ef_search(0), domain_error);
+}
+
 KNN_BADARG_TEST("accepts train data and labels") {
     CAPTURE(this->not_available_on_device());
     SKIP_IF(this->not_available_on_device());
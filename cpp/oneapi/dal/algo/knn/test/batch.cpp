@@ -52,9 +52,11 @@ public:
 
     static constexpr bool is_kd_tree = std::is_same_v<Method, knn::method::kd_tree>;
     static constexpr bool is_brute_force = std::is_same_v<Method, knn::method::brute_force>;
+    static constexpr bool is_hnsw = std::is_same_v<Method, knn::method::hnsw>;
 
     bool not_available_on_device() {
-        return (get_policy().is_gpu() && is_kd_tree) || (get_policy().is_cpu() && is_brute_force);
+        return (get_policy().is_gpu() && (is_kd_tree || is_hnsw)) ||
+               (get_policy().is_cpu() && is_brute_force);
     }
 
     te::table_id get_homogen_table_id() const {
@@ -189,7 +191,10 @@ public:
     }
 };
 
-using knn_types = COMBINE_TYPES((float, double), (knn::method::brute_force, knn::method::kd_tree));
+using knn_types = COMBINE_TYPES((float, double),
+                                (knn::method::brute_force,
+                                 knn::method::kd_tree,
+                                 knn::method::hnsw));
 
 #define KNN_SMALL_TEST(name)                                               \
     TEMPLATE_LIST_TEST_M(knn_batch_test,                                   \
@@ -244,6 +249,7 @@ KNN_SYNTHETIC_TEST("knn nearest points test random uniform 513x301x17") {
     SKIP_IF(this->not_available_on_device());
 
     SKIP_IF(this->is_kd_tree);
+    SKIP_IF(this->is_hnsw);
 
     constexpr std::int64_t train_row_count = 513;
     constexpr std::int64_t infer_row_count = 301;
@@ -272,6 +278,7 @@ KNN_SYNTHETIC_TEST("knn nearest points test random uniform 16390x20x5") {
     SKIP_IF(this->not_available_on_device());
 
     SKIP_IF(this->is_kd_tree);
+    SKIP_IF(this->is_hnsw);
 
     constexpr std::int64_t train_row_count = 16390;
     constexpr std::int64_t infer_row_count = 20;
@@ -296,6 +303,64 @@ KNN_SYNTHETIC_TEST("knn nearest points test random uniform 16390x20x5") {
     this->exact_nearest_indices_check(x_train_table, x_infer_table, infer_result);
 }
 
+KNN_SYNTHETIC_TEST("knn hnsw recall test random uniform 16390x50x5") {
+    SKIP_IF(this->not_available_on_device());
+
+    SKIP_IF(!this->is_hnsw);
+
+    constexpr std::int64_t train_row_count = 16390;
+    constexpr std::int64_t infer_row_count = 50;
+    constexpr std::int64_t column_count = 5;
+    constexpr std::int64_t neighbor_count = 10;
+    constexpr double target_recall = 0.95;
+
+    CAPTURE(train_row_count, infer_row_count, column_count, neighbor_count);
+
+    const auto train_dataframe = GENERATE_DATAFRAME(
+        te::dataframe_builder{ train_row_count, column_count }.fill_uniform(-0.2, 0.5));
+    const table x_train_table = train_dataframe.get_table(this->get_homogen_table_id());
+    const auto infer_dataframe = GENERATE_DATAFRAME(
+        te::dataframe_builder{ infer_row_count, column_count }.fill_uniform(-0.3, 1.));
+    const table x_infer_table = infer_dataframe.get_table(this->get_homogen_table_id());
+
+    const table y_train_table = this->arange(train_row_count);
+
+    const auto knn_desc = this->get_descriptor(train_row_count, neighbor_count);
+
+    auto train_result = this->train(knn_desc, x_train_table, y_train_table);
+    auto infer_result = this->infer(knn_desc, x_infer_table, train_result.get_model());
+
+    const auto indices = infer_result.get_indices();
+    const auto distances = infer_result.get_distances();
+
+    INFO("check if indices and distances shape is expected")
+    REQUIRE(indices.get_row_count() == infer_row_count);
+    REQUIRE(indices.get_column_count() == neighbor_count);
+    REQUIRE(distances.get_row_count() == infer_row_count);
+    REQUIRE(distances.get_column_count() == neighbor_count);
+    REQUIRE(te::has_no_nans(distances));
+
+    const auto gtruth = this->naive_knn_search(x_train_table, x_infer_table);
+
+    std::int64_t found_count = 0;
+    for (std::int64_t j = 0; j < infer_row_count; ++j) {
+        const auto gt_row = row_accessor<const std::int32_t>(gtruth).pull({ j, j + 1 });
+        const auto te_row = row_accessor<const std::int32_t>(indices).pull({ j, j + 1 });
+        const auto distances_row = row_accessor<const Float>(distances).pull({ j, j + 1 });
+        for (std::int64_t i = 0; i < neighbor_count; ++i) {
+            const auto* gt_end = gt_row.get_data() + neighbor_count;
+            found_count += (std::find(gt_row.get_data(), gt_end, te_row[i]) != gt_end);
+        }
+        for (std::int64_t i = 1; i < neighbor_count; ++i) {
+            REQUIRE(distances_row[i - 1] <= distances_row[i]);
+        }
+    }
+
+    const double recall = double(found_count) / double(infer_row_count * neighbor_count);
+    CAPTURE(recall);
+    REQUIRE(recall >= target_recall);
+}
+
 KNN_EXTERNAL_TEST("knn classification hepmass 50kx10k") {
     SKIP_IF(this->not_available_on_device());
 
@@ -22,6 +22,8 @@
 
 #include "oneapi/dal/table/detail/table_builder.hpp"
 #include "oneapi/dal/table/backend/interop/host_homogen_table_adapter.hpp"
+#include "oneapi/dal/table/backend/interop/host_soa_table_adapter.hpp"
+#include "oneapi/dal/table/backend/interop/host_table_adapter.hpp"
 
 namespace oneapi::dal::backend::interop {
 
@@ -75,6 +77,17 @@ inline daal::data_management::NumericTablePtr wrap_by_host_homogen_adapter(
     }
 }
 
+inline daal::data_management::NumericTablePtr wrap_by_host_soa_adapter(const homogen_table& table) {
+    const auto& dtype = table.get_metadata().get_data_type(0);
+
+    switch (dtype) {
+        case data_type::float32:
+        case data_type::float64:
+        case data_type::int32: return host_soa_table_adapter::create(table);
+        default: return daal::data_management::NumericTablePtr();
+    }
+}
+
 template <typename Float>
 inline daal::data_management::NumericTablePtr copy_to_daal_homogen_table(const table& table) {
     auto rows = row_accessor<const Float>{ table }.pull();
@@ -83,10 +96,25 @@ inline daal::data_management::NumericTablePtr copy_to_daal_homogen_table(const t
 
 template <typename Float>
 inline daal::data_management::NumericTablePtr convert_to_daal_table(const homogen_table& table) {
-    auto wrapper = wrap_by_host_homogen_adapter(table);
-    if (!wrapper) {
+    if (!table.has_data()) {
         return copy_to_daal_homogen_table<Float>(table);
     }
+
+    daal::data_management::NumericTablePtr wrapper;
+    if (table.get_data() != nullptr) {
+        if (table.get_data_layout() == data_layout::row_major) {
+            wrapper = wrap_by_host_homogen_adapter(table);
+        }
+        else if (table.get_data_layout() == data_layout::column_major) {
+            wrapper = wrap_by_host_soa_adapter(table);
+        }
+    }
+
+    // The tables that cannot be passed to DAAL as is are read by blocks,
+    // so the whole dataset is never copied
+    if (!wrapper) {
+        return host_table_adapter::create(table);
+    }
     else {
         return wrapper;
     }
@@ -98,6 +126,9 @@ inline daal::data_management::NumericTablePtr convert_to_daal_table(const table&
         const auto& homogen = static_cast<const homogen_table&>(table);
         return convert_to_daal_table<Float>(homogen);
     }
+    else if (table.has_data()) {
+        return host_table_adapter::create(table);
+    }
     else {
         return copy_to_daal_homogen_table<Float>(table);
     }
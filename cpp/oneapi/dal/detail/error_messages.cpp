@@ -92,6 +92,8 @@ MSG(max_iteration_count_lt_zero, "Max iteration count lower than zero")
 
 /* IO */
 MSG(file_not_found, "File not found")
+MSG(file_write_failed, "Failed to write the file")
+MSG(invalid_binary_table_format, "File does not contain a table in the binary format")
 
 /* K-Means */
 MSG(cluster_count_leq_zero, "Cluster count is lower than or equal to zero")
@@ -114,8 +116,12 @@ MSG(objective_function_value_lt_zero, "Objective function value is lower than ze
 /* k-NN */
 MSG(knn_brute_force_method_is_not_implemented_for_cpu,
     "k-NN brute force method is not implemented for CPU")
+MSG(knn_hnsw_method_is_not_implemented_for_gpu, "k-NN HNSW method is not implemented for GPU")
 MSG(knn_kd_tree_method_is_not_implemented_for_gpu,
     "k-NN k-d tree method is not implemented for GPU")
+MSG(max_degree_leq_one, "Max degree is lower than or equal to one")
+MSG(ef_construction_lt_one, "Construction candidate list size is lower than one")
+MSG(ef_search_lt_one, "Search candidate list size is lower than one")
 MSG(neighbor_count_lt_one, "Neighbor count lower than one")
 
 /* Jaccard */
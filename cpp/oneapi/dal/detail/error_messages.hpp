@@ -120,6 +120,8 @@ public:
 
     /* I/O */
     MSG(file_not_found);
+    MSG(file_write_failed);
+    MSG(invalid_binary_table_format);
 
     /* Decision Forest */
     MSG(bootstrap_is_incompatible_with_error_metric);
@@ -149,7 +151,11 @@ public:
 
     /* k-NN */
     MSG(knn_brute_force_method_is_not_implemented_for_cpu);
+    MSG(knn_hnsw_method_is_not_implemented_for_gpu);
     MSG(knn_kd_tree_method_is_not_implemented_for_gpu);
+    MSG(max_degree_leq_one);
+    MSG(ef_construction_lt_one);
+    MSG(ef_search_lt_one);
     MSG(neighbor_count_lt_one);
 
     /* Linear and RBF Kernels */
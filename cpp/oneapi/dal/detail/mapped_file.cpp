@@ -0,0 +1,137 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "oneapi/dal/detail/mapped_file.hpp"
+#include "oneapi/dal/exceptions.hpp"
+
+#if defined(_WIN32) || defined(_WIN64)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace oneapi::dal::detail {
+namespace v1 {
+
+#if defined(_WIN32) || defined(_WIN64)
+
+mapped_file::mapped_file(const std::string &name) {
+    HANDLE file = CreateFileA(name.c_str(),
+                              GENERIC_READ,
+                              FILE_SHARE_READ,
+                              nullptr,
+                              OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+                              nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw invalid_argument(error_messages::file_not_found());
+    }
+    file_handle_ = file;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        unmap();
+        throw invalid_argument(error_messages::file_not_found());
+    }
+    size_ = static_cast<std::int64_t>(size.QuadPart);
+    if (size_ == 0) {
+        return;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr) {
+        unmap();
+        throw invalid_argument(error_messages::file_not_found());
+    }
+    mapping_handle_ = mapping;
+
+    data_ = static_cast<const char *>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    if (data_ == nullptr) {
+        unmap();
+        throw invalid_argument(error_messages::file_not_found());
+    }
+}
+
+void mapped_file::unmap() {
+    if (data_) {
+        UnmapViewOfFile(data_);
+        data_ = nullptr;
+    }
+    if (mapping_handle_) {
+        CloseHandle(static_cast<HANDLE>(mapping_handle_));
+        mapping_handle_ = nullptr;
+    }
+    if (file_handle_) {
+        CloseHandle(static_cast<HANDLE>(file_handle_));
+        file_handle_ = nullptr;
+    }
+}
+
+#else
+
+mapped_file::mapped_file(const std::string &name) {
+    file_descriptor_ = open(name.c_str(), O_RDONLY);
+    if (file_descriptor_ < 0) {
+        throw invalid_argument(error_messages::file_not_found());
+    }
+
+    struct stat file_stat;
+    if (fstat(file_descriptor_, &file_stat) != 0) {
+        unmap();
+        throw invalid_argument(error_messages::file_not_found());
+    }
+    size_ = static_cast<std::int64_t>(file_stat.st_size);
+    if (size_ == 0) {
+        return;
+    }
+
+    void *data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, file_descriptor_, 0);
+    if (data == MAP_FAILED) {
+        unmap();
+        throw invalid_argument(error_messages::file_not_found());
+    }
+    data_ = static_cast<const char *>(data);
+
+    // Every thread reads its own chunk of the file sequentially
+    madvise(data, size_, MADV_SEQUENTIAL);
+}
+
+void mapped_file::unmap() {
+    if (data_) {
+        munmap(const_cast<char *>(data_), size_);
+        data_ = nullptr;
+    }
+    if (file_descriptor_ >= 0) {
+        close(file_descriptor_);
+        file_descriptor_ = -1;
+    }
+}
+
+#endif
+
+mapped_file::~mapped_file() {
+    unmap();
+}
+
+} // namespace v1
+} // namespace oneapi::dal::detail
@@ -0,0 +1,66 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include <string>
+
+#include "oneapi/dal/detail/common.hpp"
+
+namespace oneapi::dal::detail {
+namespace v1 {
+
+/// Read-only memory mapping of the whole file
+class ONEDAL_EXPORT mapped_file {
+public:
+    /// Maps the file into the memory
+    /// @param[in] name The name of the file
+    /// @throws invalid_argument if the file cannot be opened or mapped
+    explicit mapped_file(const std::string &name);
+    ~mapped_file();
+
+    mapped_file(const mapped_file &) = delete;
+    mapped_file &operator=(const mapped_file &) = delete;
+
+    /// The pointer to the contents of the file, `nullptr` if the file is empty
+    const char *get_data() const {
+        return data_;
+    }
+
+    /// The size of the file in bytes
+    std::int64_t get_size() const {
+        return size_;
+    }
+
+private:
+    void unmap();
+
+    const char *data_ = nullptr;
+    std::int64_t size_ = 0;
+#if defined(_WIN32) || defined(_WIN64)
+    void *file_handle_ = nullptr;
+    void *mapping_handle_ = nullptr;
+#else
+    int file_descriptor_ = -1;
+#endif
+};
+
+} // namespace v1
+
+using v1::mapped_file;
+
+} // namespace oneapi::dal::detail
@@ -16,21 +16,39 @@
 
 #pragma once
 
+#include <algorithm>
+#include <vector>
+
 #include "oneapi/dal/backend/dispatcher.hpp"
 #include "oneapi/dal/backend/interop/common.hpp"
 #include "oneapi/dal/detail/threading.hpp"
 #include "oneapi/dal/common.hpp"
 #include "oneapi/dal/detail/policy.hpp"
 #include "oneapi/dal/io/common.hpp"
+#include "oneapi/dal/io/detail/load_graph_service.hpp"
 
 namespace oneapi::dal::preview::load_graph::backend {
 
 template <typename Cpu>
 std::int64_t get_vertex_count_from_edge_list(const edge_list<std::int32_t> &edges) {
+    constexpr std::int64_t block_size = 1 << 16;
+    const std::int64_t edge_count = edges.size();
+    const std::int64_t block_count = (edge_count + block_size - 1) / block_size;
+
+    std::vector<std::int32_t> block_max_ids(block_count, edges[0].first);
+    dal::detail::threader_for_int64(block_count, [&](std::int64_t block) {
+        const std::int64_t end = std::min(edge_count, (block + 1) * block_size);
+        std::int32_t max_id = edges[block * block_size].first;
+        for (std::int64_t i = block * block_size; i < end; i++) {
+            std::int32_t edge_max = std::max(edges[i].first, edges[i].second);
+            max_id = std::max(max_id, edge_max);
+        }
+        block_max_ids[block] = max_id;
+    });
+
     std::int32_t max_id = edges[0].first;
-    for (std::int64_t i = 0; i < edges.size(); i++) {
-        std::int32_t edge_max = std::max(edges[i].first, edges[i].second);
-        max_id = std::max(max_id, edge_max);
+    for (std::int64_t block = 0; block < block_count; block++) {
+        max_id = std::max(max_id, block_max_ids[block]);
     }
     const std::int64_t vertex_count = max_id + 1;
     return vertex_count;
@@ -40,13 +58,14 @@ template <typename Cpu>
 std::int64_t compute_prefix_sum(const std::int32_t *degrees,
                                 std::int64_t degrees_count,
                                 std::int64_t *edge_offsets) {
-    std::int64_t total_sum_degrees = 0;
-    edge_offsets[0] = total_sum_degrees;
-    for (std::int64_t i = 0; i < degrees_count; ++i) {
-        total_sum_degrees += degrees[i];
-        edge_offsets[i + 1] = total_sum_degrees;
-    }
-    return total_sum_degrees;
+    return detail::parallel_prefix_sum<std::int64_t>(
+        degrees_count,
+        [&](std::int64_t i) {
+            return static_cast<std::int64_t>(degrees[i]);
+        },
+        [&](std::int64_t i, std::int64_t offset) {
+            edge_offsets[i] = offset;
+        });
 }
 
 template <typename Cpu>
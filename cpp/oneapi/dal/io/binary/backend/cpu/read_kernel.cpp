@@ -0,0 +1,52 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <memory>
+
+#include "oneapi/dal/detail/mapped_file.hpp"
+#include "oneapi/dal/io/binary/backend/cpu/read_kernel.hpp"
+#include "oneapi/dal/io/binary/detail/format.hpp"
+#include "oneapi/dal/table/homogen.hpp"
+
+namespace oneapi::dal::binary::backend {
+
+template <typename Data>
+static table wrap_mapped_payload(const std::shared_ptr<dal::detail::mapped_file>& file,
+                                 const detail::file_header& header) {
+    const auto data = reinterpret_cast<const Data*>(file->get_data() + header.payload_offset);
+    // The table keeps the file mapped for as long as it refers to the payload
+    return homogen_table{ data,
+                          header.row_count,
+                          header.column_count,
+                          [file](const Data*) {},
+                          data_layout(header.layout) };
+}
+
+template <>
+table read_kernel_cpu<table>::operator()(const dal::backend::context_cpu& ctx,
+                                         const detail::data_source_base& ds,
+                                         const read_args<table>& args) const {
+    const auto file = std::make_shared<dal::detail::mapped_file>(ds.get_file_name());
+    const detail::file_header header = detail::read_file_header(file->get_data(), file->get_size());
+
+    switch (data_type(header.dtype)) {
+        case data_type::float32: return wrap_mapped_payload<float>(file, header);
+        case data_type::float64: return wrap_mapped_payload<double>(file, header);
+        default: return wrap_mapped_payload<std::int32_t>(file, header);
+    }
+}
+
+} // namespace oneapi::dal::binary::backend
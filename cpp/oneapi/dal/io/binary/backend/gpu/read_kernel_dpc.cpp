@@ -0,0 +1,58 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/detail/mapped_file.hpp"
+#include "oneapi/dal/detail/memory.hpp"
+#include "oneapi/dal/io/binary/backend/gpu/read_kernel.hpp"
+#include "oneapi/dal/io/binary/detail/format.hpp"
+#include "oneapi/dal/table/detail/table_builder.hpp"
+
+namespace oneapi::dal::binary::backend {
+
+template <typename Data>
+static table copy_mapped_payload(sycl::queue& queue,
+                                 const dal::detail::mapped_file& file,
+                                 const detail::file_header& header) {
+    const std::int64_t element_count = header.row_count * header.column_count;
+    auto arr = array<Data>::empty(queue, element_count);
+    dal::detail::memcpy(queue,
+                        arr.get_mutable_data(),
+                        file.get_data() + header.payload_offset,
+                        header.payload_size);
+
+    return dal::detail::homogen_table_builder{}
+        .reset(arr, header.row_count, header.column_count)
+        .set_layout(data_layout(header.layout))
+        .build();
+}
+
+template <>
+table read_kernel_gpu<table>::operator()(const dal::backend::context_gpu& ctx,
+                                         const detail::data_source_base& ds,
+                                         const read_args<table>& args) const {
+    auto& queue = ctx.get_queue();
+
+    const dal::detail::mapped_file file(ds.get_file_name());
+    const detail::file_header header = detail::read_file_header(file.get_data(), file.get_size());
+
+    switch (data_type(header.dtype)) {
+        case data_type::float32: return copy_mapped_payload<float>(queue, file, header);
+        case data_type::float64: return copy_mapped_payload<double>(queue, file, header);
+        default: return copy_mapped_payload<std::int32_t>(queue, file, header);
+    }
+}
+
+} // namespace oneapi::dal::binary::backend
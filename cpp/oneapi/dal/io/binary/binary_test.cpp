@@ -0,0 +1,186 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "oneapi/dal/io/binary.hpp"
+#include "oneapi/dal/io/binary/detail/format.hpp"
+#include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/table/homogen.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+#include "gtest/gtest.h"
+
+using namespace oneapi::dal;
+namespace binary_detail = oneapi::dal::binary::detail;
+
+class binary_table_test : public ::testing::Test {
+protected:
+    void SetUp() override {
+        const auto info = ::testing::UnitTest::GetInstance()->current_test_info();
+        file_name_ = std::string("binary_table_test_") + info->name() + ".bin";
+    }
+
+    void TearDown() override {
+        std::remove(file_name_.c_str());
+    }
+
+    const std::string& get_file_name() const {
+        return file_name_;
+    }
+
+    table read_table() const {
+        return read<table>(binary::data_source{ file_name_ });
+    }
+
+    std::vector<char> read_bytes() const {
+        std::ifstream file(file_name_, std::ios::in | std::ios::binary);
+        return std::vector<char>(std::istreambuf_iterator<char>(file),
+                                 std::istreambuf_iterator<char>());
+    }
+
+    void write_bytes(const std::vector<char>& bytes) const {
+        std::ofstream file(file_name_, std::ios::out | std::ios::binary | std::ios::trunc);
+        file.write(bytes.data(), bytes.size());
+    }
+
+    template <typename Data>
+    void check_round_trip(const Data* data,
+                          std::int64_t row_count,
+                          std::int64_t column_count,
+                          data_layout layout) const {
+        const homogen_table original{ data,
+                                      row_count,
+                                      column_count,
+                                      detail::empty_delete<const Data>(),
+                                      layout };
+        binary::write(original, binary::data_source{ file_name_ });
+
+        const auto t = read_table();
+        ASSERT_TRUE(t.has_data());
+        ASSERT_EQ(t.get_kind(), homogen_table::kind());
+        ASSERT_EQ(t.get_row_count(), row_count);
+        ASSERT_EQ(t.get_column_count(), column_count);
+        ASSERT_EQ(t.get_data_layout(), layout);
+        ASSERT_EQ(t.get_metadata().get_data_type(0), detail::make_data_type<Data>());
+        ASSERT_EQ(t.get_metadata().get_feature_type(0),
+                  original.get_metadata().get_feature_type(0));
+
+        const auto expected = row_accessor<const Data>{ original }.pull();
+        const auto actual = row_accessor<const Data>{ t }.pull();
+        ASSERT_EQ(actual.get_count(), expected.get_count());
+        for (std::int64_t i = 0; i < expected.get_count(); ++i) {
+            ASSERT_EQ(actual[i], expected[i]) << "element " << i;
+        }
+    }
+
+private:
+    std::string file_name_;
+};
+
+TEST_F(binary_table_test, can_read_written_float_table) {
+    const float data[] = { 1.0f, 2.0f, 3.0f, -1.0f, -2.0f, -3.0f };
+    check_round_trip(data, 2, 3, data_layout::row_major);
+    check_round_trip(data, 3, 2, data_layout::column_major);
+}
+
+TEST_F(binary_table_test, can_read_written_double_table) {
+    const double data[] = { 1.5, 2.5, 3.5, -1.5, -2.5, -3.5, 0.0, 1e-300 };
+    check_round_trip(data, 4, 2, data_layout::row_major);
+    check_round_trip(data, 2, 4, data_layout::column_major);
+}
+
+TEST_F(binary_table_test, can_read_written_int32_table) {
+    const std::int32_t data[] = { 1, -2, 3, 2147483647, -2147483647, 0 };
+    check_round_trip(data, 3, 2, data_layout::row_major);
+    check_round_trip(data, 1, 6, data_layout::column_major);
+}
+
+TEST_F(binary_table_test, payload_is_aligned) {
+    const float data[] = { 1.0f, 2.0f, 3.0f };
+    binary::write(homogen_table{ data, 1, 3, detail::empty_delete<const float>() },
+                  binary::data_source{ get_file_name() });
+
+    const auto bytes = read_bytes();
+    const auto header = binary_detail::read_file_header(bytes.data(), bytes.size());
+    ASSERT_EQ(header.payload_offset % binary_detail::payload_alignment, 0);
+    ASSERT_EQ(header.payload_offset + header.payload_size, std::int64_t(bytes.size()));
+}
+
+TEST_F(binary_table_test, cannot_write_empty_table) {
+    ASSERT_THROW(binary::write(table{}, binary::data_source{ get_file_name() }), invalid_argument);
+}
+
+TEST_F(binary_table_test, cannot_read_file_with_bad_magic) {
+    const float data[] = { 1.0f, 2.0f, 3.0f, 4.0f };
+    binary::write(homogen_table{ data, 2, 2, detail::empty_delete<const float>() },
+                  binary::data_source{ get_file_name() });
+
+    auto bytes = read_bytes();
+    bytes[offsetof(binary_detail::file_header, magic)] = 'X';
+    write_bytes(bytes);
+
+    ASSERT_THROW(read_table(), invalid_argument);
+}
+
+TEST_F(binary_table_test, cannot_read_file_with_bad_version) {
+    const float data[] = { 1.0f, 2.0f, 3.0f, 4.0f };
+    binary::write(homogen_table{ data, 2, 2, detail::empty_delete<const float>() },
+                  binary::data_source{ get_file_name() });
+
+    auto bytes = read_bytes();
+    bytes[offsetof(binary_detail::file_header, version)] += 1;
+    write_bytes(bytes);
+
+    ASSERT_THROW(read_table(), invalid_argument);
+}
+
+TEST_F(binary_table_test, cannot_read_file_with_bad_column_data_type) {
+    const float data[] = { 1.0f, 2.0f, 3.0f, 4.0f };
+    binary::write(homogen_table{ data, 2, 2, detail::empty_delete<const float>() },
+                  binary::data_source{ get_file_name() });
+
+    auto bytes = read_bytes();
+    const auto header = binary_detail::read_file_header(bytes.data(), bytes.size());
+    binary_detail::column_info column;
+    column.dtype = std::int32_t(data_type::float64);
+    std::copy(reinterpret_cast<const char*>(&column),
+              reinterpret_cast<const char*>(&column) + sizeof(column),
+              bytes.begin() + header.dictionary_offset + sizeof(column));
+    write_bytes(bytes);
+
+    ASSERT_THROW(read_table(), invalid_argument);
+}
+
+TEST_F(binary_table_test, cannot_read_truncated_file) {
+    const double data[] = { 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 };
+    binary::write(homogen_table{ data, 3, 2, detail::empty_delete<const double>() },
+                  binary::data_source{ get_file_name() });
+
+    const auto bytes = read_bytes();
+    for (const std::size_t size : { bytes.size() - 1,
+                                    std::size_t(sizeof(binary_detail::file_header)),
+                                    std::size_t(sizeof(binary_detail::file_header) - 1) }) {
+        write_bytes(std::vector<char>(bytes.begin(), bytes.begin() + size));
+        ASSERT_THROW(read_table(), invalid_argument) << "size " << size;
+    }
+}
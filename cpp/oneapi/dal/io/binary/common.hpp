@@ -0,0 +1,85 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <string>
+
+#include "oneapi/dal/detail/common.hpp"
+#include "oneapi/dal/table/common.hpp"
+
+namespace oneapi::dal::binary {
+
+namespace detail {
+namespace v1 {
+
+struct data_source_tag {};
+class data_source_impl;
+
+class ONEDAL_EXPORT data_source_base : public base {
+public:
+    using tag_t = data_source_tag;
+
+    explicit data_source_base(const char* file_name);
+
+    std::string get_file_name() const {
+        return std::string(get_file_name_impl());
+    }
+
+protected:
+    const char* get_file_name_impl() const;
+
+    void set_file_name_impl(const char*);
+
+    dal::detail::pimpl<data_source_impl> impl_;
+};
+
+} // namespace v1
+
+using v1::data_source_tag;
+using v1::data_source_impl;
+using v1::data_source_base;
+
+} // namespace detail
+
+namespace v1 {
+
+/// The file that stores a table in the binary format. The format consists of a fixed-size
+/// header, the dictionary with the data types of the columns, and the payload
+/// aligned to 64 bytes. Files are memory-mapped on reading, so the host tables refer
+/// to the contents of the file and no parsing or copying is performed.
+class data_source : public detail::data_source_base {
+public:
+    explicit data_source(const char* file_name) : data_source_base(file_name) {}
+
+    explicit data_source(const std::string& file_name) : data_source_base(file_name.c_str()) {}
+
+    auto& set_file_name(const char* value) {
+        set_file_name_impl(value);
+        return *this;
+    }
+
+    auto& set_file_name(const std::string& value) {
+        set_file_name_impl(value.c_str());
+        return *this;
+    }
+};
+
+} // namespace v1
+
+using v1::data_source;
+
+} // namespace oneapi::dal::binary
@@ -0,0 +1,110 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+
+#include "oneapi/dal/io/binary/detail/format.hpp"
+#include "oneapi/dal/exceptions.hpp"
+
+namespace oneapi::dal::binary::detail {
+namespace v1 {
+
+constexpr char file_magic[8] = { 'O', 'N', 'E', 'D', 'A', 'L', 'T', 'B' };
+constexpr std::uint32_t file_version = 1;
+constexpr std::uint32_t file_byte_order_mark = 0x01020304;
+
+static bool is_supported_data_type(std::int32_t dtype) {
+    return dtype == std::int32_t(data_type::float32) ||
+           dtype == std::int32_t(data_type::float64) || dtype == std::int32_t(data_type::int32);
+}
+
+file_header make_file_header(std::int64_t row_count,
+                             std::int64_t column_count,
+                             data_type dtype,
+                             data_layout layout) {
+    dal::detail::check_mul_overflow(row_count, column_count);
+    const std::int64_t element_count = row_count * column_count;
+    dal::detail::check_mul_overflow(element_count, dal::detail::get_data_type_size(dtype));
+
+    file_header header;
+    std::memcpy(header.magic, file_magic, sizeof(file_magic));
+    header.version = file_version;
+    header.byte_order_mark = file_byte_order_mark;
+    header.row_count = row_count;
+    header.column_count = column_count;
+    header.dtype = std::int32_t(dtype);
+    header.layout = std::int32_t(layout);
+    header.dictionary_offset = sizeof(file_header);
+
+    const std::int64_t dictionary_end =
+        header.dictionary_offset + column_count * std::int64_t(sizeof(column_info));
+    header.payload_offset =
+        (dictionary_end + payload_alignment - 1) / payload_alignment * payload_alignment;
+    header.payload_size = element_count * dal::detail::get_data_type_size(dtype);
+    return header;
+}
+
+file_header read_file_header(const char* data, std::int64_t size) {
+    using error_msg = dal::detail::error_messages;
+
+    file_header header;
+    if (size < std::int64_t(sizeof(file_header))) {
+        throw invalid_argument(error_msg::invalid_binary_table_format());
+    }
+    std::memcpy(&header, data, sizeof(file_header));
+
+    if (std::memcmp(header.magic, file_magic, sizeof(file_magic)) != 0 ||
+        header.version != file_version || header.byte_order_mark != file_byte_order_mark) {
+        throw invalid_argument(error_msg::invalid_binary_table_format());
+    }
+    if (!is_supported_data_type(header.dtype)) {
+        throw invalid_argument(error_msg::unsupported_data_type());
+    }
+    if (header.layout != std::int32_t(data_layout::row_major) &&
+        header.layout != std::int32_t(data_layout::column_major)) {
+        throw invalid_argument(error_msg::unsupported_data_layout());
+    }
+    if (header.row_count <= 0 || header.column_count <= 0) {
+        throw invalid_argument(error_msg::invalid_binary_table_format());
+    }
+
+    // The header written for the same shape must match the one read from the file
+    const file_header expected = make_file_header(header.row_count,
+                                                  header.column_count,
+                                                  data_type(header.dtype),
+                                                  data_layout(header.layout));
+    if (header.dictionary_offset != expected.dictionary_offset ||
+        header.payload_offset != expected.payload_offset ||
+        header.payload_size != expected.payload_size ||
+        header.payload_offset + header.payload_size > size) {
+        throw invalid_argument(error_msg::invalid_binary_table_format());
+    }
+
+    for (std::int64_t i = 0; i < header.column_count; ++i) {
+        column_info column;
+        std::memcpy(&column,
+                    data + header.dictionary_offset + i * std::int64_t(sizeof(column_info)),
+                    sizeof(column_info));
+        if (column.dtype != header.dtype) {
+            throw invalid_argument(error_msg::invalid_binary_table_format());
+        }
+    }
+
+    return header;
+}
+
+} // namespace v1
+} // namespace oneapi::dal::binary::detail
@@ -0,0 +1,71 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+
+#include "oneapi/dal/detail/common.hpp"
+#include "oneapi/dal/table/common.hpp"
+
+namespace oneapi::dal::binary::detail {
+namespace v1 {
+
+/// Alignment of the payload relative to the beginning of the file
+constexpr std::int64_t payload_alignment = 64;
+
+/// Fixed-size header at the beginning of the file. It is followed by the dictionary
+/// of `column_count` entries and by the payload that starts at `payload_offset`.
+struct file_header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byte_order_mark;
+    std::int64_t row_count;
+    std::int64_t column_count;
+    std::int32_t dtype;
+    std::int32_t layout;
+    std::int64_t dictionary_offset;
+    std::int64_t payload_offset;
+    std::int64_t payload_size;
+};
+
+static_assert(sizeof(file_header) == 64, "Binary table header must be 64 bytes long");
+
+/// Dictionary entry that describes a column of the table. Feature types are not stored:
+/// the homogen table created on reading derives them from the data type.
+struct column_info {
+    std::int32_t dtype;
+};
+
+/// Creates the header of the table with the given shape and element type
+file_header make_file_header(std::int64_t row_count,
+                             std::int64_t column_count,
+                             data_type dtype,
+                             data_layout layout);
+
+/// Reads and validates the header and the dictionary of the memory-mapped file
+/// @throws invalid_argument if the file does not contain a table in the binary format
+file_header read_file_header(const char* data, std::int64_t size);
+
+} // namespace v1
+
+using v1::payload_alignment;
+using v1::file_header;
+using v1::column_info;
+using v1::make_file_header;
+using v1::read_file_header;
+
+} // namespace oneapi::dal::binary::detail
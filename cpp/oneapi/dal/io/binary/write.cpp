@@ -0,0 +1,105 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <fstream>
+#include <vector>
+
+#include "oneapi/dal/io/binary/write.hpp"
+#include "oneapi/dal/io/binary/detail/format.hpp"
+#include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/table/column_accessor.hpp"
+#include "oneapi/dal/table/homogen.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+
+namespace oneapi::dal::binary {
+namespace v1 {
+
+using error_msg = dal::detail::error_messages;
+
+template <typename Data>
+static void write_payload(std::ofstream& file, const table& t, data_layout layout) {
+    if (layout == data_layout::column_major) {
+        for (std::int64_t column = 0; column < t.get_column_count(); ++column) {
+            const auto column_data = column_accessor<const Data>{ t }.pull(column);
+            file.write(reinterpret_cast<const char*>(column_data.get_data()),
+                       column_data.get_count() * sizeof(Data));
+        }
+    }
+    else {
+        const auto rows = row_accessor<const Data>{ t }.pull();
+        file.write(reinterpret_cast<const char*>(rows.get_data()), rows.get_count() * sizeof(Data));
+    }
+}
+
+void write(const table& t, const detail::data_source_base& ds) {
+    if (!t.has_data()) {
+        throw invalid_argument(error_msg::input_data_is_empty());
+    }
+
+    const table_metadata& meta = t.get_metadata();
+    const data_type dtype = meta.get_data_type(0);
+    if (dtype != data_type::float32 && dtype != data_type::float64 &&
+        dtype != data_type::int32) {
+        throw invalid_argument(error_msg::unsupported_data_type());
+    }
+    for (std::int64_t i = 1; i < t.get_column_count(); ++i) {
+        if (meta.get_data_type(i) != dtype) {
+            throw invalid_argument(error_msg::only_homogen_table_is_supported());
+        }
+    }
+
+    const data_layout layout = (t.get_kind() == homogen_table::kind() &&
+                                t.get_data_layout() == data_layout::column_major)
+                                   ? data_layout::column_major
+                                   : data_layout::row_major;
+
+    const detail::file_header header =
+        detail::make_file_header(t.get_row_count(), t.get_column_count(), dtype, layout);
+
+    std::vector<detail::column_info> dictionary(t.get_column_count());
+    for (std::int64_t i = 0; i < t.get_column_count(); ++i) {
+        dictionary[i].dtype = std::int32_t(meta.get_data_type(i));
+    }
+
+    std::ofstream file(ds.get_file_name(), std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        throw invalid_argument(error_msg::file_write_failed());
+    }
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(dictionary.data()),
+               dictionary.size() * sizeof(detail::column_info));
+
+    const std::int64_t dictionary_end =
+        header.dictionary_offset + dictionary.size() * sizeof(detail::column_info);
+    const std::vector<char> padding(header.payload_offset - dictionary_end, 0);
+    file.write(padding.data(), padding.size());
+
+    switch (dtype) {
+        case data_type::float32: write_payload<float>(file, t, layout); break;
+        case data_type::float64: write_payload<double>(file, t, layout); break;
+        case data_type::int32: write_payload<std::int32_t>(file, t, layout); break;
+        default: throw invalid_argument(error_msg::unsupported_data_type());
+    }
+
+    file.close();
+    if (file.fail()) {
+        throw invalid_argument(error_msg::file_write_failed());
+    }
+}
+
+} // namespace v1
+} // namespace oneapi::dal::binary
@@ -0,0 +1,38 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/io/binary/common.hpp"
+
+namespace oneapi::dal::binary {
+namespace v1 {
+
+/// Writes the table into the file in the binary format. Homogen tables keep their data layout,
+/// other tables are written in the row-major layout. The feature types of the columns
+/// are not stored: the table read from the file has the default feature types of its data type.
+/// The table should contain :expr:`float`, :expr:`double` or :expr:`std::int32_t` data.
+/// @param t  The table to write
+/// @param ds The data source that specifies the file name
+/// @throws invalid_argument if the table is empty, its data type is not supported,
+///         or the file cannot be written
+ONEDAL_EXPORT void write(const table& t, const detail::data_source_base& ds);
+
+} // namespace v1
+
+using v1::write;
+
+} // namespace oneapi::dal::binary
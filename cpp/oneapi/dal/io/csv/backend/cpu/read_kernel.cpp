@@ -27,6 +27,7 @@
 #include "oneapi/dal/backend/interop/error_converter.hpp"
 #include "oneapi/dal/backend/interop/table_conversion.hpp"
 #include "oneapi/dal/io/csv/backend/cpu/read_kernel.hpp"
+#include "oneapi/dal/io/csv/backend/cpu/read_parallel.hpp"
 #include "oneapi/dal/table/common.hpp"
 
 namespace oneapi::dal::csv::backend {
@@ -38,6 +39,11 @@ template <>
 table read_kernel_cpu<table>::operator()(const dal::backend::context_cpu& ctx,
                                          const detail::data_source_base& ds,
                                          const read_args<table>& args) const {
+    const table parallel_result = read_parallel<DAAL_DATA_TYPE>(ds);
+    if (parallel_result.has_data()) {
+        return parallel_result;
+    }
+
     daal_dm::CsvDataSourceOptions csv_options(daal_dm::operator|(
         daal_dm::operator|(daal_dm::CsvDataSourceOptions::allocateNumericTable,
                            daal_dm::CsvDataSourceOptions::createDictionaryFromContext),
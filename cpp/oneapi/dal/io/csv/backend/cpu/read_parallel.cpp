@@ -0,0 +1,368 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "daal/include/services/daal_memory.h"
+
+#include "oneapi/dal/detail/mapped_file.hpp"
+#include "oneapi/dal/detail/threading.hpp"
+#include "oneapi/dal/io/csv/backend/cpu/read_parallel.hpp"
+#include "oneapi/dal/table/detail/table_builder.hpp"
+
+namespace oneapi::dal::csv::backend {
+
+namespace {
+
+constexpr std::int64_t min_chunk_size = 1 << 20;
+constexpr std::int64_t row_block_size = 1 << 12;
+
+/// Offsets of the lines of the file: the i-th line occupies [begins[i], begins[i + 1])
+/// including its line break
+struct line_index {
+    std::vector<std::int64_t> begins;
+    bool has_null_symbols = false;
+
+    std::int64_t get_line_count() const {
+        return std::int64_t(begins.size()) - 1;
+    }
+};
+
+/// Splits [0, size) into byte ranges, each of them starts after a newline
+/// @return The begins of the ranges followed by size
+std::vector<std::int64_t> split_by_lines(const char* data, std::int64_t size) {
+    const std::int64_t max_chunk_count = 4 * dal::detail::threader_get_max_threads();
+    const std::int64_t chunk_count =
+        std::max<std::int64_t>(1, std::min(max_chunk_count, size / min_chunk_size));
+
+    std::vector<std::int64_t> bounds;
+    bounds.reserve(chunk_count + 1);
+    bounds.push_back(0);
+    for (std::int64_t i = 1; i < chunk_count; ++i) {
+        const std::int64_t pos = std::max(bounds.back(), size / chunk_count * i);
+        const void* newline = std::memchr(data + pos, '\n', size - pos);
+        if (newline) {
+            bounds.push_back(static_cast<const char*>(newline) - data + 1);
+        }
+    }
+    bounds.push_back(size);
+    return bounds;
+}
+
+line_index index_lines(const char* data, std::int64_t size) {
+    const std::vector<std::int64_t> bounds = split_by_lines(data, size);
+    const std::int64_t chunk_count = bounds.size() - 1;
+
+    std::vector<std::int64_t> newline_offsets(chunk_count + 1, 0);
+    std::vector<char> has_null_symbols(chunk_count, 0);
+    dal::detail::threader_for_int64(chunk_count, [&](std::int64_t chunk) {
+        const char* const begin = data + bounds[chunk];
+        const char* const end = data + bounds[chunk + 1];
+        newline_offsets[chunk + 1] = std::count(begin, end, '\n');
+        has_null_symbols[chunk] = (std::memchr(begin, '\0', end - begin) != nullptr);
+    });
+    for (std::int64_t chunk = 0; chunk < chunk_count; ++chunk) {
+        newline_offsets[chunk + 1] += newline_offsets[chunk];
+    }
+
+    const std::int64_t newline_count = newline_offsets[chunk_count];
+    const std::int64_t line_count = newline_count + (data[size - 1] != '\n');
+
+    line_index index;
+    index.has_null_symbols =
+        std::find(has_null_symbols.begin(), has_null_symbols.end(), 1) != has_null_symbols.end();
+    index.begins.resize(line_count + 1);
+    index.begins[0] = 0;
+    index.begins[line_count] = size;
+
+    std::int64_t* const begins = index.begins.data();
+    dal::detail::threader_for_int64(chunk_count, [&](std::int64_t chunk) {
+        std::int64_t line = newline_offsets[chunk];
+        for (std::int64_t pos = bounds[chunk]; pos < bounds[chunk + 1]; ++pos) {
+            if (data[pos] == '\n') {
+                begins[++line] = pos + 1;
+            }
+        }
+    });
+    return index;
+}
+
+/// Returns the end of the line with the trailing line breaks removed
+inline const char* get_line_end(const char* data, const line_index& index, std::int64_t line) {
+    const char* const begin = data + index.begins[line];
+    const char* end = data + index.begins[line + 1];
+    while (end > begin && (end[-1] == '\n' || end[-1] == '\r')) {
+        --end;
+    }
+    return end;
+}
+
+/// Returns the index of the first empty line in [first, line_count) or line_count
+std::int64_t find_first_empty_line(const char* data, const line_index& index, std::int64_t first) {
+    const std::int64_t line_count = index.get_line_count();
+    const std::int64_t block_count = (line_count - first + row_block_size - 1) / row_block_size;
+
+    std::vector<std::int64_t> block_empty_lines(block_count, line_count);
+    dal::detail::threader_for_int64(block_count, [&](std::int64_t block) {
+        const std::int64_t begin = first + block * row_block_size;
+        const std::int64_t end = std::min(line_count, begin + row_block_size);
+        for (std::int64_t line = begin; line < end; ++line) {
+            if (get_line_end(data, index, line) == data + index.begins[line]) {
+                block_empty_lines[block] = line;
+                break;
+            }
+        }
+    });
+
+    const auto it = std::min_element(block_empty_lines.begin(), block_empty_lines.end());
+    return (it == block_empty_lines.end()) ? line_count : *it;
+}
+
+/// Calls body(token_begin, token_end) for every token of the line. The tokens are split the
+/// same way as the sequential data source does it: the trailing empty token is skipped.
+template <typename Body>
+inline std::int64_t for_each_token(const char* begin,
+                                   const char* end,
+                                   char delimiter,
+                                   const Body& body) {
+    std::int64_t count = 0;
+    for (const char* p = begin; p < end;) {
+        const char* token_end = static_cast<const char*>(std::memchr(p, delimiter, end - p));
+        token_end = token_end ? token_end : end;
+        body(p, token_end);
+        ++count;
+        p = token_end + 1;
+    }
+    return count;
+}
+
+inline bool is_blank(char c) {
+    return c == ' ' || c == '\t';
+}
+
+/// Parses decimal numbers that are exactly representable via the double precision fast path:
+/// the mantissa fits into 53 bits and the absolute value of the decimal exponent
+/// is at most 22. The result is rounded the same way strtod rounds it.
+/// @return false if the token is not such a number, the value is not assigned in this case
+template <typename Float>
+inline bool parse_number_fast(const char* begin, const char* end, Float& value) {
+    static constexpr double powers_of_ten[] = { 1e0,  1e1,  1e2,  1e3,  1e4,  1e5,
+                                                1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                                1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+                                                1e18, 1e19, 1e20, 1e21, 1e22 };
+    constexpr std::uint64_t max_mantissa = std::uint64_t(1) << 53;
+
+    const char* p = begin;
+    while (p < end && is_blank(*p)) {
+        ++p;
+    }
+
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        ++p;
+    }
+
+    std::uint64_t mantissa = 0;
+    std::int64_t exponent = 0;
+    std::int64_t digit_count = 0;
+    for (; p < end && *p >= '0' && *p <= '9'; ++p, ++digit_count) {
+        mantissa = mantissa * 10 + (*p - '0');
+        if (mantissa > max_mantissa) {
+            return false;
+        }
+    }
+    if (p < end && *p == '.') {
+        for (++p; p < end && *p >= '0' && *p <= '9'; ++p, ++digit_count) {
+            mantissa = mantissa * 10 + (*p - '0');
+            if (mantissa > max_mantissa) {
+                return false;
+            }
+            --exponent;
+        }
+    }
+    if (digit_count == 0) {
+        return false;
+    }
+
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        ++p;
+        bool negative_exponent = false;
+        if (p < end && (*p == '-' || *p == '+')) {
+            negative_exponent = (*p == '-');
+            ++p;
+        }
+        if (p == end || *p < '0' || *p > '9') {
+            return false;
+        }
+        std::int64_t exponent_value = 0;
+        for (; p < end && *p >= '0' && *p <= '9'; ++p) {
+            exponent_value = exponent_value * 10 + (*p - '0');
+            if (exponent_value > 1000) {
+                return false;
+            }
+        }
+        exponent += negative_exponent ? -exponent_value : exponent_value;
+    }
+
+    while (p < end && is_blank(*p)) {
+        ++p;
+    }
+    if (p != end || exponent < -22 || exponent > 22) {
+        return false;
+    }
+
+    double result = static_cast<double>(mantissa);
+    result = (exponent < 0) ? result / powers_of_ten[-exponent] : result * powers_of_ten[exponent];
+    result = negative ? -result : result;
+
+    if constexpr (std::is_same_v<Float, float>) {
+        // Rounding of the rounded double to float is correct unless the double is exactly
+        // halfway between two floats, or the result is out of the normal float range
+        const double magnitude = std::abs(result);
+        if (magnitude != 0.0 && (magnitude < FLT_MIN || magnitude > FLT_MAX)) {
+            return false;
+        }
+        std::uint64_t bits;
+        std::memcpy(&bits, &result, sizeof(bits));
+        constexpr std::uint64_t dropped_bits_mask = (std::uint64_t(1) << 29) - 1;
+        if ((bits & dropped_bits_mask) == (std::uint64_t(1) << 28)) {
+            return false;
+        }
+    }
+
+    value = static_cast<Float>(result);
+    return true;
+}
+
+inline float string_to_number(const char* str, char** end, float) {
+    return daal::services::daal_string_to_float(str, end);
+}
+
+inline double string_to_number(const char* str, char** end, double) {
+    return daal::services::daal_string_to_double(str, end);
+}
+
+/// Parses the token with the conversion routine of the sequential data source
+/// @return false if no conversion can be performed
+template <typename Float>
+inline bool parse_number_slow(const char* begin, const char* end, Float& value) {
+    const std::string token(begin, end);
+    char* number_end = nullptr;
+    value = string_to_number(token.c_str(), &number_end, Float(0));
+    return number_end != token.c_str();
+}
+
+template <typename Float>
+inline Float parse_number(const char* begin, const char* end) {
+    Float value;
+    if (!parse_number_fast(begin, end, value)) {
+        parse_number_slow(begin, end, value);
+    }
+    return value;
+}
+
+} // namespace
+
+template <typename Float>
+table read_parallel(const detail::data_source_base& ds) {
+    const dal::detail::mapped_file file(ds.get_file_name());
+    const char* const data = file.get_data();
+    const std::int64_t size = file.get_size();
+    if (size == 0) {
+        return table{};
+    }
+
+    const line_index index = index_lines(data, size);
+    if (index.has_null_symbols) {
+        return table{};
+    }
+
+    const char delimiter = ds.get_delimiter();
+    const std::int64_t first_row_line = ds.get_parse_header() ? 1 : 0;
+    if (index.get_line_count() <= first_row_line) {
+        return table{};
+    }
+
+    // The sequential data source stops reading at the first empty line
+    const std::int64_t end_row_line = find_first_empty_line(data, index, first_row_line);
+    const std::int64_t row_count = end_row_line - first_row_line;
+    if (row_count == 0) {
+        return table{};
+    }
+
+    // Column types are detected by the first row, only continuous ones are supported here
+    bool all_numeric = true;
+    const std::int64_t column_count =
+        for_each_token(data + index.begins[first_row_line],
+                       get_line_end(data, index, first_row_line),
+                       delimiter,
+                       [&](const char* begin, const char* end) {
+                           Float value;
+                           all_numeric = all_numeric && parse_number_slow(begin, end, value);
+                       });
+    if (!all_numeric || column_count == 0) {
+        return table{};
+    }
+    if (ds.get_parse_header()) {
+        const std::int64_t header_column_count = for_each_token(data,
+                                                                get_line_end(data, index, 0),
+                                                                delimiter,
+                                                                [](const char*, const char*) {});
+        if (header_column_count != column_count) {
+            return table{};
+        }
+    }
+
+    auto arr = array<Float>::empty(row_count * column_count);
+    Float* const rows = arr.get_mutable_data();
+
+    const std::int64_t block_count = (row_count + row_block_size - 1) / row_block_size;
+    dal::detail::threader_for_int64(block_count, [&](std::int64_t block) {
+        const std::int64_t begin = block * row_block_size;
+        const std::int64_t end = std::min(row_count, begin + row_block_size);
+        for (std::int64_t row = begin; row < end; ++row) {
+            const std::int64_t line = first_row_line + row;
+            Float* const row_data = rows + row * column_count;
+            std::int64_t column = 0;
+            for_each_token(data + index.begins[line],
+                           get_line_end(data, index, line),
+                           delimiter,
+                           [&](const char* token_begin, const char* token_end) {
+                               if (column < column_count) {
+                                   row_data[column++] = parse_number<Float>(token_begin, token_end);
+                               }
+                           });
+            for (; column < column_count; ++column) {
+                row_data[column] = Float(0);
+            }
+        }
+    });
+
+    return dal::detail::homogen_table_builder{}.reset(arr, row_count, column_count).build();
+}
+
+template table read_parallel<float>(const detail::data_source_base& ds);
+template table read_parallel<double>(const detail::data_source_base& ds);
+
+} // namespace oneapi::dal::csv::backend
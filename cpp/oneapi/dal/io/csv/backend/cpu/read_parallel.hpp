@@ -0,0 +1,32 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/io/csv/common.hpp"
+
+namespace oneapi::dal::csv::backend {
+
+/// Reads the CSV file in parallel directly into the homogen table. The file is memory-mapped
+/// and split into byte ranges at line boundaries, then the rows are parsed by several threads.
+/// The result is the same as the one of the sequential DAAL data source.
+/// @return The empty table if the file cannot be read by this method: it is empty, it has
+///         categorical columns or its header does not match the data. The caller is expected
+///         to fall back to the sequential data source in this case.
+template <typename Float>
+table read_parallel(const detail::data_source_base& ds);
+
+} // namespace oneapi::dal::csv::backend
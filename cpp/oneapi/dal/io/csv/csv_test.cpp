@@ -0,0 +1,184 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "oneapi/dal/io/csv.hpp"
+#include "oneapi/dal/io/csv/backend/cpu/read_parallel.hpp"
+#include "oneapi/dal/table/row_accessor.hpp"
+#include "gtest/gtest.h"
+
+using namespace oneapi::dal;
+
+class csv_read_test : public ::testing::Test {
+protected:
+    void SetUp() override {
+        const auto info = ::testing::UnitTest::GetInstance()->current_test_info();
+        file_name_ = std::string("csv_read_test_") + info->name() + ".csv";
+    }
+
+    void TearDown() override {
+        std::remove(file_name_.c_str());
+    }
+
+    csv::data_source get_data_source(char delimiter = ',', bool parse_header = false) const {
+        return csv::data_source{ file_name_ }
+            .set_delimiter(delimiter)
+            .set_parse_header(parse_header);
+    }
+
+    void write_text(const std::string& text) const {
+        std::ofstream file(file_name_, std::ios::out | std::ios::binary | std::ios::trunc);
+        file.write(text.data(), text.size());
+    }
+
+    /// Values of the file as the sequential data source reads them: the rows end at the first
+    /// empty line, the number of columns is given by the first row, missing values are zeros
+    std::vector<std::vector<float>> parse_reference(const std::string& text,
+                                                    char delimiter,
+                                                    bool parse_header) const {
+        std::vector<std::vector<float>> rows;
+        std::size_t column_count = 0;
+        std::size_t pos = 0;
+        for (bool is_header = parse_header; pos < text.size(); is_header = false) {
+            std::size_t line_end = text.find('\n', pos);
+            line_end = (line_end == std::string::npos) ? text.size() : line_end;
+            std::string line = text.substr(pos, line_end - pos);
+            pos = line_end + 1;
+            while (!line.empty() && line.back() == '\r') {
+                line.pop_back();
+            }
+            if (is_header) {
+                continue;
+            }
+            if (line.empty()) {
+                break;
+            }
+
+            std::vector<float> row;
+            for (std::size_t begin = 0; begin < line.size();) {
+                std::size_t end = line.find(delimiter, begin);
+                end = (end == std::string::npos) ? line.size() : end;
+                row.push_back(std::strtof(line.substr(begin, end - begin).c_str(), nullptr));
+                begin = end + 1;
+            }
+            column_count = rows.empty() ? row.size() : column_count;
+            row.resize(column_count, 0.0f);
+            rows.push_back(row);
+        }
+        return rows;
+    }
+
+    void check_table(const table& t, const std::vector<std::vector<float>>& expected) const {
+        ASSERT_TRUE(t.has_data());
+        ASSERT_EQ(t.get_row_count(), std::int64_t(expected.size()));
+        ASSERT_EQ(t.get_column_count(), std::int64_t(expected[0].size()));
+
+        const auto actual = row_accessor<const float>{ t }.pull();
+        const std::int64_t column_count = t.get_column_count();
+        for (std::int64_t i = 0; i < t.get_row_count(); ++i) {
+            for (std::int64_t j = 0; j < column_count; ++j) {
+                ASSERT_EQ(actual[i * column_count + j], expected[i][j])
+                    << "row " << i << ", column " << j;
+            }
+        }
+    }
+
+    void check_read(const std::string& text, char delimiter = ',', bool parse_header = false) {
+        write_text(text);
+        const auto ds = get_data_source(delimiter, parse_header);
+        const auto expected = parse_reference(text, delimiter, parse_header);
+
+        // The parallel reader must accept the file instead of falling back to the data source
+        check_table(csv::backend::read_parallel<float>(ds), expected);
+        check_table(read<table>(ds), expected);
+    }
+
+private:
+    std::string file_name_;
+};
+
+TEST_F(csv_read_test, reads_numbers_in_various_formats) {
+    check_read("1,2.5,-3e2,0.1\n"
+               "+4,1e-5,1E+3,-0.0\n"
+               "123456789012345678901234567890,0.12345678901234567890123,7.,.5\n"
+               "3.4028234e38,1e-40,16777217,-2.5e-3\n");
+}
+
+TEST_F(csv_read_test, reads_header_and_custom_delimiter) {
+    check_read("a;b;c\n1;2;3\n4;5;6\n", ';', true);
+}
+
+TEST_F(csv_read_test, reads_crlf_line_breaks_and_last_line_without_break) {
+    check_read("1,2\r\n3,4\r\n5,6");
+}
+
+TEST_F(csv_read_test, stops_at_first_empty_line) {
+    check_read("1,2\n3,4\n\n5,6\n");
+}
+
+TEST_F(csv_read_test, fills_missing_values_with_zeros) {
+    check_read("1,2,3\n4,5\n6,7,8,9\n");
+}
+
+TEST_F(csv_read_test, reads_file_split_into_several_chunks) {
+    // The file is larger than several minimal chunks and has more rows than one row block,
+    // so its lines are indexed and parsed by several threads
+    constexpr std::int64_t row_count = 200000;
+    constexpr std::int64_t column_count = 5;
+
+    std::string text;
+    std::uint64_t state = 777;
+    for (std::int64_t i = 0; i < row_count; ++i) {
+        for (std::int64_t j = 0; j < column_count; ++j) {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            const std::int64_t value = std::int64_t(state >> 40) - (std::int64_t(1) << 23);
+            switch (j) {
+                case 0: text += std::to_string(value); break;
+                case 1: text += std::to_string(value) + "e-7"; break;
+                case 2: text += std::to_string(double(value) / 3.0); break;
+                case 3: text += "0." + std::to_string(state) + std::to_string(state); break;
+                default: text += std::to_string(value % 1000) + ".25"; break;
+            }
+            text += (j + 1 < column_count) ? "," : "";
+        }
+        text += (i % 7 == 0) ? "\r\n" : "\n";
+    }
+    check_read(text);
+}
+
+TEST_F(csv_read_test, falls_back_to_data_source_for_categorical_columns) {
+    write_text("a,1\nb,2\na,3\n");
+    const auto ds = get_data_source();
+
+    ASSERT_FALSE(csv::backend::read_parallel<float>(ds).has_data());
+
+    const auto t = read<table>(ds);
+    ASSERT_EQ(t.get_row_count(), 3);
+    ASSERT_EQ(t.get_column_count(), 2);
+}
+
+TEST_F(csv_read_test, falls_back_to_data_source_for_mismatched_header) {
+    write_text("a,b,c\n1,2\n3,4\n");
+    const auto ds = get_data_source(',', true);
+
+    ASSERT_FALSE(csv::backend::read_parallel<float>(ds).has_data());
+}
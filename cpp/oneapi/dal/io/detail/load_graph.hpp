@@ -18,8 +18,9 @@
 
 #include <algorithm>
 #include <atomic>
-#include <fstream>
+#include <vector>
 
+#include "oneapi/dal/detail/mapped_file.hpp"
 #include "oneapi/dal/detail/threading.hpp"
 #include "oneapi/dal/exceptions.hpp"
 #include "oneapi/dal/graph/common.hpp"
@@ -35,24 +36,120 @@ namespace oneapi::dal::preview::load_graph::detail {
 template <typename Vertex>
 inline edge_list<Vertex> load_edge_list(const std::string &name);
 
+inline bool is_edge_list_space(char c) {
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t' || c == '\v' || c == '\f';
+}
+
+/// Splits [0, size) into at most chunk_count ranges, each of them starts after a newline
+/// @return The begins of the ranges followed by size
+inline std::vector<std::int64_t> split_edge_list_by_lines(const char *data,
+                                                          std::int64_t size,
+                                                          std::int64_t chunk_count) {
+    std::vector<std::int64_t> bounds;
+    bounds.reserve(chunk_count + 1);
+    bounds.push_back(0);
+    for (std::int64_t i = 1; i < chunk_count; ++i) {
+        std::int64_t pos = std::max(bounds.back(), size / chunk_count * i);
+        while (pos < size && data[pos] != '\n') {
+            ++pos;
+        }
+        if (pos < size) {
+            bounds.push_back(pos + 1);
+        }
+    }
+    bounds.push_back(size);
+    return bounds;
+}
+
+/// Counts whitespace-separated tokens in [begin, end)
+inline std::int64_t count_edge_list_tokens(const char *begin, const char *end) {
+    std::int64_t count = 0;
+    bool in_token = false;
+    for (const char *p = begin; p < end; ++p) {
+        const bool is_space = is_edge_list_space(*p);
+        count += (!is_space && !in_token);
+        in_token = !is_space;
+    }
+    return count;
+}
+
+/// Parses the integer at the beginning of the token the way strtol does and moves p past the token
+template <typename Index>
+inline Index parse_edge_list_token(const char *&p, const char *end) {
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        ++p;
+    }
+    std::int64_t value = 0;
+    for (; p < end && *p >= '0' && *p <= '9'; ++p) {
+        value = value * 10 + (*p - '0');
+    }
+    while (p < end && !is_edge_list_space(*p)) {
+        ++p;
+    }
+    return static_cast<Index>(negative ? -value : value);
+}
+
+/// Reads the memory-mapped file in parallel: the file is split into chunks at newlines,
+/// the tokens of every chunk are counted, and then every chunk parses its tokens directly
+/// into their positions in the edge list. The i-th token of the file is the first vertex
+/// of the edge i / 2 if i is even, and the second vertex otherwise.
 template <>
 inline edge_list<std::int32_t> load_edge_list(const std::string &name) {
     using int_t = std::int32_t;
 
-    std::ifstream file(name);
-    if (!file.is_open()) {
-        throw invalid_argument(dal::detail::error_messages::file_not_found());
+    const dal::detail::mapped_file file(name);
+    const char *const data = file.get_data();
+    const std::int64_t size = file.get_size();
+
+    constexpr std::int64_t min_chunk_size = 1 << 20;
+    const std::int64_t max_chunk_count = 4 * dal::detail::threader_get_max_threads();
+    const std::int64_t chunk_count =
+        std::max<std::int64_t>(1, std::min(max_chunk_count, size / min_chunk_size));
+
+    const std::vector<std::int64_t> chunk_bounds =
+        split_edge_list_by_lines(data, size, chunk_count);
+    const std::int64_t actual_chunk_count = chunk_bounds.size() - 1;
+
+    std::vector<std::int64_t> token_offsets(actual_chunk_count + 1, 0);
+    dal::detail::threader_for_int64(actual_chunk_count, [&](std::int64_t chunk) {
+        token_offsets[chunk + 1] =
+            count_edge_list_tokens(data + chunk_bounds[chunk], data + chunk_bounds[chunk + 1]);
+    });
+    for (std::int64_t chunk = 0; chunk < actual_chunk_count; ++chunk) {
+        token_offsets[chunk + 1] += token_offsets[chunk];
     }
+
+    const std::int64_t edge_count = token_offsets[actual_chunk_count] / 2;
+
     edge_list<int_t> elist;
-    elist.reserve(1024);
-    char source_vertex[32], destination_vertex[32];
-    while (file >> source_vertex >> destination_vertex) {
-        auto edge = std::make_pair(daal_string_to_int(&source_vertex[0], 0),
-                                   daal_string_to_int(&destination_vertex[0], 0));
-        elist.push_back(edge);
-    }
+    elist.reserve(std::max<std::int64_t>(edge_count, 1));
+    elist.resize(edge_count);
+    std::pair<int_t, int_t> *const edges = elist.begin();
+
+    dal::detail::threader_for_int64(actual_chunk_count, [&](std::int64_t chunk) {
+        const char *p = data + chunk_bounds[chunk];
+        const char *const end = data + chunk_bounds[chunk + 1];
+        std::int64_t token = token_offsets[chunk];
+        for (;;) {
+            while (p < end && is_edge_list_space(*p)) {
+                ++p;
+            }
+            if (p == end || token / 2 >= edge_count) {
+                break;
+            }
+            const int_t vertex = parse_edge_list_token<int_t>(p, end);
+            if (token % 2 == 0) {
+                edges[token / 2].first = vertex;
+            }
+            else {
+                edges[token / 2].second = vertex;
+            }
+            ++token;
+        }
+    });
 
-    file.close();
     return elist;
 }
 
@@ -84,26 +181,28 @@ template <typename EdgeIndex, typename AtomicVertex, typename AtomicEdge>
 EdgeIndex compute_prefix_sum_atomic(const AtomicVertex *degrees,
                                     std::int64_t degrees_count,
                                     AtomicEdge *edge_offsets_atomic) {
-    EdgeIndex total_sum_degrees = 0;
-    edge_offsets_atomic[0] = total_sum_degrees;
-    for (std::int64_t i = 0; i < degrees_count; ++i) {
-        total_sum_degrees += degrees[i].load();
-        edge_offsets_atomic[i + 1] = total_sum_degrees;
-    }
-    return total_sum_degrees;
+    return parallel_prefix_sum<EdgeIndex>(
+        degrees_count,
+        [&](std::int64_t i) {
+            return static_cast<EdgeIndex>(degrees[i].load(std::memory_order_relaxed));
+        },
+        [&](std::int64_t i, EdgeIndex offset) {
+            edge_offsets_atomic[i].store(offset, std::memory_order_relaxed);
+        });
 }
 
 template <typename EdgeIndex, typename VertexIndex>
 EdgeIndex compute_prefix_sum(const VertexIndex *degrees,
                              std::int64_t degrees_count,
                              EdgeIndex *edge_offsets) {
-    EdgeIndex total_sum_degrees = 0;
-    edge_offsets[0] = total_sum_degrees;
-    for (std::int64_t i = 0; i < degrees_count; ++i) {
-        total_sum_degrees += degrees[i];
-        edge_offsets[i + 1] = total_sum_degrees;
-    }
-    return total_sum_degrees;
+    return parallel_prefix_sum<EdgeIndex>(
+        degrees_count,
+        [&](std::int64_t i) {
+            return static_cast<EdgeIndex>(degrees[i]);
+        },
+        [&](std::int64_t i, EdgeIndex offset) {
+            edge_offsets[i] = offset;
+        });
 }
 
 template <typename Index, typename AtomicIndex>
@@ -16,8 +16,48 @@
 
 #pragma once
 
+#include <algorithm>
+#include <vector>
+
 #include "oneapi/dal/detail/common.hpp"
+#include "oneapi/dal/detail/threading.hpp"
 
 namespace oneapi::dal::preview::load_graph::detail {
 ONEDAL_EXPORT std::int32_t daal_string_to_int(const char *nptr, char **endptr);
+
+/// Computes offsets[0] = 0 and offsets[i + 1] = offsets[i] + value(i) for i in [0, count)
+/// by blocks in parallel: the sums of the blocks are scanned first, then every block
+/// is scanned starting from the sum of the previous blocks
+/// @return The sum of all the values
+template <typename Offset, typename GetValue, typename SetOffset>
+Offset parallel_prefix_sum(std::int64_t count, const GetValue &value, const SetOffset &set_offset) {
+    constexpr std::int64_t block_size = 1 << 16;
+    const std::int64_t block_count = (count + block_size - 1) / block_size;
+
+    std::vector<Offset> block_offsets(block_count + 1, 0);
+    dal::detail::threader_for_int64(block_count, [&](std::int64_t block) {
+        const std::int64_t end = std::min(count, (block + 1) * block_size);
+        Offset sum = 0;
+        for (std::int64_t i = block * block_size; i < end; ++i) {
+            sum += value(i);
+        }
+        block_offsets[block + 1] = sum;
+    });
+
+    for (std::int64_t block = 0; block < block_count; ++block) {
+        block_offsets[block + 1] += block_offsets[block];
+    }
+
+    set_offset(0, Offset(0));
+    dal::detail::threader_for_int64(block_count, [&](std::int64_t block) {
+        const std::int64_t end = std::min(count, (block + 1) * block_size);
+        Offset sum = block_offsets[block];
+        for (std::int64_t i = block * block_size; i < end; ++i) {
+            sum += value(i);
+            set_offset(i + 1, sum);
+        }
+    });
+
+    return block_offsets[block_count];
+}
 } // namespace oneapi::dal::preview::load_graph::detail
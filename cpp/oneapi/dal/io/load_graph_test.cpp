@@ -0,0 +1,179 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "oneapi/dal/exceptions.hpp"
+#include "oneapi/dal/graph/service_functions.hpp"
+#include "oneapi/dal/graph/undirected_adjacency_vector_graph.hpp"
+#include "oneapi/dal/io/graph_csv_data_source.hpp"
+#include "oneapi/dal/io/load_graph.hpp"
+#include "gtest/gtest.h"
+
+namespace dal = oneapi::dal;
+namespace load_graph = oneapi::dal::preview::load_graph;
+
+using graph_t = dal::preview::undirected_adjacency_vector_graph<>;
+using edge_t = std::pair<std::int32_t, std::int32_t>;
+
+class load_graph_test : public ::testing::Test {
+protected:
+    void SetUp() override {
+        const auto info = ::testing::UnitTest::GetInstance()->current_test_info();
+        file_name_ = std::string("load_graph_test_") + info->name() + ".csv";
+    }
+
+    void TearDown() override {
+        std::remove(file_name_.c_str());
+    }
+
+    void write_text(const std::string& text) const {
+        std::ofstream file(file_name_, std::ios::out | std::ios::binary | std::ios::trunc);
+        file.write(text.data(), text.size());
+    }
+
+    /// Edges of the file as the sequential stream-based reader pairs the tokens
+    std::vector<edge_t> read_reference_edges(const std::string& text) const {
+        std::istringstream stream(text);
+        std::vector<std::int32_t> tokens;
+        std::string token;
+        while (stream >> token) {
+            tokens.push_back(std::int32_t(std::strtol(token.c_str(), nullptr, 10)));
+        }
+        std::vector<edge_t> edges;
+        for (std::size_t i = 0; i + 1 < tokens.size(); i += 2) {
+            edges.emplace_back(tokens[i], tokens[i + 1]);
+        }
+        return edges;
+    }
+
+    std::vector<edge_t> load_edges() const {
+        const auto elist = load_graph::detail::load_edge_list<std::int32_t>(file_name_);
+        std::vector<edge_t> edges;
+        for (std::int64_t i = 0; i < elist.size(); ++i) {
+            edges.push_back(elist[i]);
+        }
+        return edges;
+    }
+
+    graph_t load_graph() const {
+        const load_graph::descriptor<dal::preview::edge_list<std::int32_t>, graph_t> desc;
+        return load_graph::load(desc, dal::preview::graph_csv_data_source{ file_name_ });
+    }
+
+    /// Checks that the neighbors of every vertex are sorted, unique and have no self-loops
+    void check_graph_matches_edges(const graph_t& graph, const std::vector<edge_t>& edges) const {
+        std::int32_t max_vertex = 0;
+        for (const auto& e : edges) {
+            max_vertex = std::max(max_vertex, std::max(e.first, e.second));
+        }
+        std::vector<std::set<std::int32_t>> neighbors(max_vertex + 1);
+        for (const auto& e : edges) {
+            if (e.first != e.second) {
+                neighbors[e.first].insert(e.second);
+                neighbors[e.second].insert(e.first);
+            }
+        }
+
+        ASSERT_EQ(dal::preview::get_vertex_count(graph), max_vertex + 1);
+        std::int64_t degree_sum = 0;
+        for (std::int32_t v = 0; v <= max_vertex; ++v) {
+            const auto range = dal::preview::get_vertex_neighbors(graph, v);
+            const std::vector<std::int32_t> actual(range.first, range.second);
+            const std::vector<std::int32_t> expected(neighbors[v].begin(), neighbors[v].end());
+            ASSERT_EQ(actual, expected) << "vertex " << v;
+            degree_sum += expected.size();
+        }
+        ASSERT_EQ(dal::preview::get_edge_count(graph), degree_sum / 2);
+    }
+
+private:
+    std::string file_name_;
+};
+
+TEST_F(load_graph_test, reads_edges_separated_by_any_whitespace) {
+    const std::string text = "0 1\n1\t2\r\n2  3\n\n  3 0 \n4 4\n0 2";
+    write_text(text);
+
+    const auto edges = load_edges();
+    ASSERT_EQ(edges, read_reference_edges(text));
+    ASSERT_EQ(edges.size(), std::size_t(6));
+
+    check_graph_matches_edges(load_graph(), edges);
+}
+
+TEST_F(load_graph_test, ignores_unpaired_last_token) {
+    const std::string text = "0 1\n1 2\n3\n";
+    write_text(text);
+
+    const auto edges = load_edges();
+    ASSERT_EQ(edges, read_reference_edges(text));
+    ASSERT_EQ(edges.size(), std::size_t(2));
+}
+
+TEST_F(load_graph_test, pairs_tokens_across_lines) {
+    // The parallel reader splits the file at newlines, the token pairing must not depend on it
+    const std::string text = "0\n1 2\n3\n4 5 6\n7\n";
+    write_text(text);
+
+    ASSERT_EQ(load_edges(), read_reference_edges(text));
+}
+
+TEST_F(load_graph_test, reads_file_split_into_several_chunks) {
+    // The file is larger than several minimal chunks, so it is parsed by several threads
+    constexpr std::int32_t vertex_count = 10000;
+    constexpr std::int64_t edge_count = 500000;
+
+    std::string text;
+    text.reserve(edge_count * 12);
+    std::uint64_t state = 777;
+    for (std::int64_t i = 0; i < edge_count; ++i) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        const std::int32_t u = std::int32_t((state >> 33) % vertex_count);
+        const std::int32_t v = std::int32_t((state >> 13) % vertex_count);
+        text += std::to_string(u);
+        text += (i % 3 == 0) ? "\t" : " ";
+        text += std::to_string(v);
+        text += (i % 5 == 0) ? "\r\n" : "\n";
+    }
+    write_text(text);
+
+    const auto edges = load_edges();
+    ASSERT_EQ(std::int64_t(edges.size()), edge_count);
+    ASSERT_EQ(edges, read_reference_edges(text));
+
+    check_graph_matches_edges(load_graph(), edges);
+}
+
+TEST_F(load_graph_test, throws_on_empty_file) {
+    write_text("");
+
+    ASSERT_TRUE(load_edges().empty());
+    ASSERT_THROW(load_graph(), dal::invalid_argument);
+}
+
+TEST_F(load_graph_test, throws_on_missing_file) {
+    ASSERT_THROW(load_graph(), dal::invalid_argument);
+}
@@ -0,0 +1,46 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <daal/include/data_management/data/numeric_table.h>
+
+#include "oneapi/dal/table/common.hpp"
+#include "oneapi/dal/backend/interop/daal_object_owner.hpp"
+
+namespace oneapi::dal::backend::interop {
+
+template <typename Accessor, typename BlockData, typename... Args>
+inline void pull_values(daal::data_management::BlockDescriptor<BlockData>& block,
+                        std::int64_t row_count,
+                        std::int64_t column_count,
+                        const Accessor& acc,
+                        array<BlockData>& values,
+                        Args&&... args) {
+    // The following const_cast operation is safe only when this class is used for read-only
+    // operations. Use on write leads to undefined behaviour.
+
+    if (block.getBlockPtr() != acc.pull(values, std::forward<Args>(args)...)) {
+        auto raw_ptr = const_cast<BlockData*>(values.get_data());
+        auto data_shared = daal::services::SharedPtr<BlockData>(raw_ptr, daal_object_owner(values));
+        block.setSharedPtr(data_shared, column_count, row_count);
+    }
+}
+
+void convert_feature_information_to_daal(const table_metadata& src,
+                                         daal::data_management::NumericTableDictionary& dst);
+
+} // namespace oneapi::dal::backend::interop
@@ -18,44 +18,6 @@
 
 namespace oneapi::dal::backend::interop {
 
-template <typename Accessor, typename BlockData, typename... Args>
-void pull_values(daal::data_management::BlockDescriptor<BlockData>& block,
-                 std::int64_t row_count,
-                 std::int64_t column_count,
-                 const Accessor& acc,
-                 array<BlockData>& values,
-                 Args&&... args) {
-    // The following const_cast operation is safe only when this class is used for read-only
-    // operations. Use on write leads to undefined behaviour.
-
-    if (block.getBlockPtr() != acc.pull(values, std::forward<Args>(args)...)) {
-        auto raw_ptr = const_cast<BlockData*>(values.get_data());
-        auto data_shared = daal::services::SharedPtr<BlockData>(raw_ptr, daal_object_owner(values));
-        block.setSharedPtr(data_shared, column_count, row_count);
-    }
-}
-
-daal::data_management::features::FeatureType get_daal_feature_type(feature_type t) {
-    namespace daal_dm = daal::data_management;
-
-    switch (t) {
-        case feature_type::nominal: return daal_dm::features::DAAL_CATEGORICAL;
-        case feature_type::ordinal: return daal_dm::features::DAAL_ORDINAL;
-        case feature_type::interval: return daal_dm::features::DAAL_CONTINUOUS;
-        case feature_type::ratio: return daal_dm::features::DAAL_CONTINUOUS;
-        default: throw dal::internal_error(detail::error_messages::unsupported_feature_type());
-    }
-}
-
-void convert_feature_information_to_daal(const table_metadata& src,
-                                         daal::data_management::NumericTableDictionary& dst) {
-    ONEDAL_ASSERT(std::size_t(src.get_feature_count()) == dst.getNumberOfFeatures());
-    for (std::int64_t i = 0; i < src.get_feature_count(); i++) {
-        auto& daal_feature = dst[i];
-        daal_feature.featureType = get_daal_feature_type(src.get_feature_type(i));
-    }
-}
-
 template <typename Data>
 auto host_homogen_table_adapter<Data>::create(const homogen_table& table) -> ptr_t {
     status_t internal_stat;
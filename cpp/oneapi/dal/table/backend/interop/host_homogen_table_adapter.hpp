@@ -24,6 +24,7 @@
 #include "oneapi/dal/backend/interop/error_converter.hpp"
 #include "oneapi/dal/backend/interop/daal_object_owner.hpp"
 #include "oneapi/dal/table/backend/interop/block_info.hpp"
+#include "oneapi/dal/table/backend/interop/common.hpp"
 
 namespace oneapi::dal::backend::interop {
 
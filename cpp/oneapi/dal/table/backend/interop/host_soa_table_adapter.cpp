@@ -0,0 +1,163 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/table/backend/interop/host_soa_table_adapter.hpp"
+
+namespace oneapi::dal::backend::interop {
+
+auto host_soa_table_adapter::create(const homogen_table& table) -> ptr_t {
+    status_t internal_stat;
+    auto result = ptr_t{ new host_soa_table_adapter(table, internal_stat) };
+    status_to_exception(internal_stat);
+    return result;
+}
+
+auto host_soa_table_adapter::getBlockOfRows(std::size_t vector_idx,
+                                            std::size_t vector_num,
+                                            rw_mode_t rwflag,
+                                            block_desc_t<double>& block) -> status_t {
+    if (rwflag != daal::data_management::readOnly) {
+        return daal::services::ErrorMethodNotImplemented;
+    }
+    return base::getBlockOfRows(vector_idx, vector_num, rwflag, block);
+}
+
+auto host_soa_table_adapter::getBlockOfRows(std::size_t vector_idx,
+                                            std::size_t vector_num,
+                                            rw_mode_t rwflag,
+                                            block_desc_t<float>& block) -> status_t {
+    if (rwflag != daal::data_management::readOnly) {
+        return daal::services::ErrorMethodNotImplemented;
+    }
+    return base::getBlockOfRows(vector_idx, vector_num, rwflag, block);
+}
+
+auto host_soa_table_adapter::getBlockOfRows(std::size_t vector_idx,
+                                            std::size_t vector_num,
+                                            rw_mode_t rwflag,
+                                            block_desc_t<int>& block) -> status_t {
+    if (rwflag != daal::data_management::readOnly) {
+        return daal::services::ErrorMethodNotImplemented;
+    }
+    return base::getBlockOfRows(vector_idx, vector_num, rwflag, block);
+}
+
+auto host_soa_table_adapter::getBlockOfColumnValues(std::size_t feature_idx,
+                                                    std::size_t vector_idx,
+                                                    std::size_t value_num,
+                                                    rw_mode_t rwflag,
+                                                    block_desc_t<double>& block) -> status_t {
+    if (rwflag != daal::data_management::readOnly) {
+        return daal::services::ErrorMethodNotImplemented;
+    }
+    return base::getBlockOfColumnValues(feature_idx, vector_idx, value_num, rwflag, block);
+}
+
+auto host_soa_table_adapter::getBlockOfColumnValues(std::size_t feature_idx,
+                                                    std::size_t vector_idx,
+                                                    std::size_t value_num,
+                                                    rw_mode_t rwflag,
+                                                    block_desc_t<float>& block) -> status_t {
+    if (rwflag != daal::data_management::readOnly) {
+        return daal::services::ErrorMethodNotImplemented;
+    }
+    return base::getBlockOfColumnValues(feature_idx, vector_idx, value_num, rwflag, block);
+}
+
+auto host_soa_table_adapter::getBlockOfColumnValues(std::size_t feature_idx,
+                                                    std::size_t vector_idx,
+                                                    std::size_t value_num,
+                                                    rw_mode_t rwflag,
+                                                    block_desc_t<int>& block) -> status_t {
+    if (rwflag != daal::data_management::readOnly) {
+        return daal::services::ErrorMethodNotImplemented;
+    }
+    return base::getBlockOfColumnValues(feature_idx, vector_idx, value_num, rwflag, block);
+}
+
+auto host_soa_table_adapter::allocateDataMemoryImpl(daal::MemType) -> status_t {
+    return daal::services::ErrorMethodNotImplemented;
+}
+
+auto host_soa_table_adapter::setNumberOfColumnsImpl(std::size_t) -> status_t {
+    return daal::services::ErrorMethodNotImplemented;
+}
+
+int host_soa_table_adapter::getSerializationTag() const {
+    ONEDAL_ASSERT(!"host_soa_table_adapter: getSerializationTag() is not implemented");
+    return -1;
+}
+
+auto host_soa_table_adapter::serializeImpl(daal::data_management::InputDataArchive* arch)
+    -> status_t {
+    return daal::services::ErrorMethodNotImplemented;
+}
+
+auto host_soa_table_adapter::deserializeImpl(const daal::data_management::OutputDataArchive* arch)
+    -> status_t {
+    return daal::services::ErrorMethodNotImplemented;
+}
+
+template <typename Data>
+auto host_soa_table_adapter::set_columns(const homogen_table& table) -> status_t {
+    const std::int64_t row_count = table.get_row_count();
+    const std::int64_t column_count = table.get_column_count();
+    const Data* data = table.get_data<Data>();
+
+    status_t stat;
+    for (std::int64_t j = 0; j < column_count && stat.ok(); j++) {
+        // The following const_cast is safe only when this class is used for read-only
+        // operations. Use on write leads to undefined behaviour.
+        const auto column_data = const_cast<Data*>(data) + j * row_count;
+        const auto column =
+            daal::services::SharedPtr<Data>{ column_data, daal_object_owner(table) };
+        stat |= this->setArray(column, dal::detail::integral_cast<std::size_t>(j));
+    }
+    return stat;
+}
+
+host_soa_table_adapter::host_soa_table_adapter(const homogen_table& table, status_t& stat)
+        : base(dal::detail::integral_cast<std::size_t>(table.get_column_count()),
+               dal::detail::integral_cast<std::size_t>(table.get_row_count()),
+               daal::data_management::DictionaryIface::equal,
+               stat) {
+    if (!stat.ok()) {
+        return;
+    }
+    else if (!table.has_data() || table.get_data_layout() != data_layout::column_major) {
+        stat.add(daal::services::ErrorIncorrectParameter);
+        return;
+    }
+
+    switch (table.get_metadata().get_data_type(0)) {
+        case data_type::float32: stat |= set_columns<float>(table); break;
+        case data_type::float64: stat |= set_columns<double>(table); break;
+        case data_type::int32: stat |= set_columns<std::int32_t>(table); break;
+        default: stat.add(daal::services::ErrorDataTypeNotSupported); return;
+    }
+    if (!stat.ok()) {
+        return;
+    }
+
+    this->_memStatus = daal::data_management::NumericTableIface::userAllocated;
+
+    // The types of the features are reset by setArray(), so feature information
+    // is converted after all the columns are set
+    auto& daal_dictionary = *this->getDictionarySharedPtr();
+    convert_feature_information_to_daal(table.get_metadata(), daal_dictionary);
+}
+
+} // namespace oneapi::dal::backend::interop
@@ -0,0 +1,289 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/table/backend/interop/host_table_adapter.hpp"
+
+namespace oneapi::dal::backend::interop {
+
+auto host_table_adapter::create(const table& table) -> ptr_t {
+    status_t internal_stat;
+    auto result = ptr_t{ new host_table_adapter(table, internal_stat) };
+    status_to_exception(internal_stat);
+    return result;
+}
+
+auto host_table_adapter::getBlockOfRows(std::size_t vector_idx,
+                                        std::size_t vector_num,
+                                        rw_mode_t rwflag,
+                                        block_desc_t<double>& block) -> status_t {
+    return read_rows_impl(vector_idx, vector_num, rwflag, block);
+}
+
+auto host_table_adapter::getBlockOfRows(std::size_t vector_idx,
+                                        std::size_t vector_num,
+                                        rw_mode_t rwflag,
+                                        block_desc_t<float>& block) -> status_t {
+    return read_rows_impl(vector_idx, vector_num, rwflag, block);
+}
+
+auto host_table_adapter::getBlockOfRows(std::size_t vector_idx,
+                                        std::size_t vector_num,
+                                        rw_mode_t rwflag,
+                                        block_desc_t<int>& block) -> status_t {
+    return read_rows_impl(vector_idx, vector_num, rwflag, block);
+}
+
+auto host_table_adapter::getBlockOfColumnValues(std::size_t feature_idx,
+                                                std::size_t vector_idx,
+                                                std::size_t value_num,
+                                                rw_mode_t rwflag,
+                                                block_desc_t<double>& block) -> status_t {
+    return read_column_values_impl(feature_idx, vector_idx, value_num, rwflag, block);
+}
+
+auto host_table_adapter::getBlockOfColumnValues(std::size_t feature_idx,
+                                                std::size_t vector_idx,
+                                                std::size_t value_num,
+                                                rw_mode_t rwflag,
+                                                block_desc_t<float>& block) -> status_t {
+    return read_column_values_impl(feature_idx, vector_idx, value_num, rwflag, block);
+}
+
+auto host_table_adapter::getBlockOfColumnValues(std::size_t feature_idx,
+                                                std::size_t vector_idx,
+                                                std::size_t value_num,
+                                                rw_mode_t rwflag,
+                                                block_desc_t<int>& block) -> status_t {
+    return read_column_values_impl(feature_idx, vector_idx, value_num, rwflag, block);
+}
+
+auto host_table_adapter::releaseBlockOfRows(block_desc_t<double>& block) -> status_t {
+    block.reset();
+    return status_t();
+}
+
+auto host_table_adapter::releaseBlockOfRows(block_desc_t<float>& block) -> status_t {
+    block.reset();
+    return status_t();
+}
+
+auto host_table_adapter::releaseBlockOfRows(block_desc_t<int>& block) -> status_t {
+    block.reset();
+    return status_t();
+}
+
+auto host_table_adapter::releaseBlockOfColumnValues(block_desc_t<double>& block) -> status_t {
+    block.reset();
+    return status_t();
+}
+
+auto host_table_adapter::releaseBlockOfColumnValues(block_desc_t<float>& block) -> status_t {
+    block.reset();
+    return status_t();
+}
+
+auto host_table_adapter::releaseBlockOfColumnValues(block_desc_t<int>& block) -> status_t {
+    block.reset();
+    return status_t();
+}
+
+auto host_table_adapter::assign(float) -> status_t {
+    return daal::services::ErrorMethodNotImplemented;
+}
+
+auto host_table_adapter::assign(double) -> status_t {
+    return daal::services::ErrorMethodNotImplemented;
+}
+
+auto host_table_adapter::assign(int) -> status_t {
+    return daal::services::ErrorMethodNotImplemented;
+}
+
+auto host_table_adapter::allocateDataMemoryImpl(daal::MemType) -> status_t {
+    return daal::services::ErrorMethodNotImplemented;
+}
+
+auto host_table_adapter::setNumberOfColumnsImpl(std::size_t) -> status_t {
+    return daal::services::ErrorMethodNotImplemented;
+}
+
+int host_table_adapter::getSerializationTag() const {
+    ONEDAL_ASSERT(!"host_table_adapter: getSerializationTag() is not implemented");
+    return -1;
+}
+
+auto host_table_adapter::serializeImpl(daal::data_management::InputDataArchive* arch) -> status_t {
+    return daal::services::ErrorMethodNotImplemented;
+}
+
+auto host_table_adapter::deserializeImpl(
+    const daal::data_management::OutputDataArchive* arch) -> status_t {
+    return daal::services::ErrorMethodNotImplemented;
+}
+
+void host_table_adapter::freeDataMemoryImpl() {
+    base::freeDataMemoryImpl();
+    original_table_ = table{};
+}
+
+template <typename BlockData>
+auto host_table_adapter::read_rows_impl(std::size_t vector_idx,
+                                        std::size_t vector_num,
+                                        rw_mode_t rwflag,
+                                        block_desc_t<BlockData>& block) -> status_t {
+    if (rwflag != daal::data_management::readOnly) {
+        return daal::services::ErrorMethodNotImplemented;
+    }
+
+    const std::int64_t column_count = original_table_.get_column_count();
+    const block_info info{ block, vector_idx, vector_num };
+
+    if (!check_row_indexes_in_range(info)) {
+        return daal::services::ErrorIncorrectIndex;
+    }
+
+    block.setDetails(0, vector_idx, rwflag);
+
+    try {
+        array<BlockData> values;
+        auto block_ptr = block.getBlockPtr();
+
+        // multiplication is safe due to checks with 'info' variable
+        const std::int64_t requested_element_count = info.row_count * column_count;
+
+        if (block_ptr != nullptr && info.allocated_element_count >= requested_element_count) {
+            values.reset(block_ptr,
+                         info.allocated_element_count,
+                         detail::empty_delete<BlockData>());
+        }
+
+        const row_accessor<const BlockData> acc{ original_table_ };
+        pull_values(block,
+                    info.row_count,
+                    column_count,
+                    acc,
+                    values,
+                    range{ info.row_begin_index, info.row_end_index });
+    }
+    catch (const bad_alloc&) {
+        return daal::services::ErrorMemoryAllocationFailed;
+    }
+    catch (const out_of_range&) {
+        return daal::services::ErrorIncorrectDataRange;
+    }
+    catch (const std::exception&) {
+        return daal::services::UnknownError;
+    }
+
+    return status_t();
+}
+
+template <typename BlockData>
+auto host_table_adapter::read_column_values_impl(std::size_t feature_idx,
+                                                 std::size_t vector_idx,
+                                                 std::size_t value_num,
+                                                 rw_mode_t rwflag,
+                                                 block_desc_t<BlockData>& block) -> status_t {
+    if (rwflag != daal::data_management::readOnly) {
+        return daal::services::ErrorMethodNotImplemented;
+    }
+
+    const block_info info{ block, vector_idx, value_num, feature_idx };
+
+    if (!check_row_indexes_in_range(info) || !check_column_index_in_range(info)) {
+        return daal::services::ErrorIncorrectIndex;
+    }
+
+    block.setDetails(feature_idx, vector_idx, rwflag);
+
+    try {
+        array<BlockData> values;
+        auto block_ptr = block.getBlockPtr();
+        if (block_ptr != nullptr && info.allocated_element_count >= info.row_count) {
+            values.reset(block_ptr,
+                         info.allocated_element_count,
+                         detail::empty_delete<BlockData>());
+        }
+
+        const column_accessor<const BlockData> acc{ original_table_ };
+        pull_values(block,
+                    info.row_count,
+                    1,
+                    acc,
+                    values,
+                    info.column_index,
+                    range{ info.row_begin_index, info.row_end_index });
+    }
+    catch (const bad_alloc&) {
+        return daal::services::ErrorMemoryAllocationFailed;
+    }
+    catch (const out_of_range&) {
+        return daal::services::ErrorIncorrectDataRange;
+    }
+    catch (const std::exception&) {
+        return daal::services::UnknownError;
+    }
+    return status_t();
+}
+
+bool host_table_adapter::check_row_indexes_in_range(const block_info& info) const {
+    const std::int64_t row_count = original_table_.get_row_count();
+    return info.row_begin_index < row_count && info.row_end_index <= row_count;
+}
+
+bool host_table_adapter::check_column_index_in_range(const block_info& info) const {
+    const std::int64_t column_count = original_table_.get_column_count();
+    return info.single_column_requested && info.column_index < column_count;
+}
+
+template <typename T>
+inline void set_daal_feature(daal::data_management::NumericTableDictionary& dictionary,
+                             std::int64_t feature_index) {
+    dictionary.setFeature<T>(dal::detail::integral_cast<std::size_t>(feature_index));
+}
+
+host_table_adapter::host_table_adapter(const table& table, status_t& stat)
+        : base(dal::detail::integral_cast<std::size_t>(table.get_column_count()),
+               dal::detail::integral_cast<std::size_t>(table.get_row_count()),
+               daal::data_management::DictionaryIface::notEqual,
+               stat) {
+    if (!stat.ok()) {
+        return;
+    }
+    else if (!table.has_data()) {
+        stat.add(daal::services::ErrorIncorrectParameter);
+        return;
+    }
+
+    original_table_ = table;
+
+    this->_memStatus = daal::data_management::NumericTableIface::userAllocated;
+
+    // The values of the types that are not representable on DAAL side
+    // are converted to double when the blocks are read
+    const auto& metadata = original_table_.get_metadata();
+    auto& daal_dictionary = *this->getDictionarySharedPtr();
+    for (std::int64_t i = 0; i < metadata.get_feature_count(); i++) {
+        switch (metadata.get_data_type(i)) {
+            case data_type::float32: set_daal_feature<float>(daal_dictionary, i); break;
+            case data_type::int32: set_daal_feature<std::int32_t>(daal_dictionary, i); break;
+            default: set_daal_feature<double>(daal_dictionary, i); break;
+        }
+    }
+    convert_feature_information_to_daal(metadata, daal_dictionary);
+}
+
+} // namespace oneapi::dal::backend::interop
@@ -0,0 +1,117 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "oneapi/dal/table/row_accessor.hpp"
+#include "oneapi/dal/table/column_accessor.hpp"
+#include "oneapi/dal/backend/interop/error_converter.hpp"
+#include "oneapi/dal/table/backend/interop/block_info.hpp"
+#include "oneapi/dal/table/backend/interop/common.hpp"
+
+namespace oneapi::dal::backend::interop {
+
+// This class shall be used only to represent immutable data on DAAL side.
+// Any attempts to change the data inside objects of that class lead to undefined behavior.
+// The table of any kind, layout and data type is read by blocks of rows or columns
+// converted on the fly, the whole table is never copied.
+class host_table_adapter : public daal::data_management::NumericTable {
+    using base = daal::data_management::NumericTable;
+    using ptr_t = daal::services::SharedPtr<host_table_adapter>;
+    using status_t = daal::services::Status;
+    using rw_mode_t = daal::data_management::ReadWriteMode;
+
+    template <typename T>
+    using block_desc_t = daal::data_management::BlockDescriptor<T>;
+
+public:
+    static ptr_t create(const table& table);
+
+private:
+    status_t getBlockOfRows(std::size_t vector_idx,
+                            std::size_t vector_num,
+                            rw_mode_t rwflag,
+                            block_desc_t<double>& block) override;
+    status_t getBlockOfRows(std::size_t vector_idx,
+                            std::size_t vector_num,
+                            rw_mode_t rwflag,
+                            block_desc_t<float>& block) override;
+    status_t getBlockOfRows(std::size_t vector_idx,
+                            std::size_t vector_num,
+                            rw_mode_t rwflag,
+                            block_desc_t<int>& block) override;
+
+    status_t getBlockOfColumnValues(std::size_t feature_idx,
+                                    std::size_t vector_idx,
+                                    std::size_t value_num,
+                                    rw_mode_t rwflag,
+                                    block_desc_t<double>& block) override;
+    status_t getBlockOfColumnValues(std::size_t feature_idx,
+                                    std::size_t vector_idx,
+                                    std::size_t value_num,
+                                    rw_mode_t rwflag,
+                                    block_desc_t<float>& block) override;
+    status_t getBlockOfColumnValues(std::size_t feature_idx,
+                                    std::size_t vector_idx,
+                                    std::size_t value_num,
+                                    rw_mode_t rwflag,
+                                    block_desc_t<int>& block) override;
+
+    status_t releaseBlockOfRows(block_desc_t<double>& block) override;
+    status_t releaseBlockOfRows(block_desc_t<float>& block) override;
+    status_t releaseBlockOfRows(block_desc_t<int>& block) override;
+
+    status_t releaseBlockOfColumnValues(block_desc_t<double>& block) override;
+    status_t releaseBlockOfColumnValues(block_desc_t<float>& block) override;
+    status_t releaseBlockOfColumnValues(block_desc_t<int>& block) override;
+
+    status_t assign(float value) override;
+    status_t assign(double value) override;
+    status_t assign(int value) override;
+
+    status_t allocateDataMemoryImpl(daal::MemType /*type*/ = daal::dram) override;
+
+    status_t setNumberOfColumnsImpl(std::size_t ncol) override;
+
+    int getSerializationTag() const override;
+    status_t serializeImpl(daal::data_management::InputDataArchive* arch) override;
+    status_t deserializeImpl(const daal::data_management::OutputDataArchive* arch) override;
+
+    void freeDataMemoryImpl() override;
+
+    template <typename BlockData>
+    status_t read_rows_impl(std::size_t vector_idx,
+                            std::size_t vector_num,
+                            rw_mode_t rwflag,
+                            block_desc_t<BlockData>& block);
+
+    template <typename BlockData>
+    status_t read_column_values_impl(std::size_t feature_idx,
+                                     std::size_t vector_idx,
+                                     std::size_t value_num,
+                                     rw_mode_t rwflag,
+                                     block_desc_t<BlockData>& block);
+
+    bool check_row_indexes_in_range(const block_info& info) const;
+    bool check_column_index_in_range(const block_info& info) const;
+
+    host_table_adapter(const table& table, status_t& stat);
+
+private:
+    table original_table_;
+};
+
+} // namespace oneapi::dal::backend::interop
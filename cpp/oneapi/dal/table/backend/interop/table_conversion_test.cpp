@@ -0,0 +1,99 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dal/backend/interop/table_conversion.hpp"
+#include "gtest/gtest.h"
+
+using namespace oneapi::dal;
+namespace interop = oneapi::dal::backend::interop;
+namespace daal_dm = daal::data_management;
+
+TEST(table_conversion_test, can_wrap_row_major_table_without_copy) {
+    float data[] = { 1.0f, 2.0f, 3.0f, -1.0f, -2.0f, -3.0f };
+
+    homogen_table t{ data, 2, 3, detail::empty_delete<const float>() };
+    const auto nt = interop::convert_to_daal_table<float>(t);
+
+    ASSERT_EQ(nt->getNumberOfRows(), std::size_t(2));
+    ASSERT_EQ(nt->getNumberOfColumns(), std::size_t(3));
+
+    daal_dm::BlockDescriptor<float> block;
+    nt->getBlockOfRows(0, 2, daal_dm::readOnly, block);
+    ASSERT_EQ(block.getBlockPtr(), data);
+    nt->releaseBlockOfRows(block);
+}
+
+TEST(table_conversion_test, can_wrap_column_major_table_without_copy) {
+    double data[] = { 1.0, 2.0, 3.0, -1.0, -2.0, -3.0 };
+
+    homogen_table t{ data, 3, 2, detail::empty_delete<const double>(), data_layout::column_major };
+    const auto nt = interop::convert_to_daal_table<double>(t);
+
+    ASSERT_EQ(nt->getNumberOfRows(), std::size_t(3));
+    ASSERT_EQ(nt->getNumberOfColumns(), std::size_t(2));
+    ASSERT_EQ(nt->getDataLayout(), daal_dm::NumericTableIface::soa);
+
+    daal_dm::BlockDescriptor<double> column;
+    nt->getBlockOfColumnValues(1, 0, 3, daal_dm::readOnly, column);
+    ASSERT_EQ(column.getBlockPtr(), data + 3);
+    nt->releaseBlockOfColumnValues(column);
+
+    daal_dm::BlockDescriptor<double> rows;
+    nt->getBlockOfRows(1, 2, daal_dm::readOnly, rows);
+    const double* rows_data = rows.getBlockPtr();
+    ASSERT_EQ(rows_data[0], 2.0);
+    ASSERT_EQ(rows_data[1], -2.0);
+    ASSERT_EQ(rows_data[2], 3.0);
+    ASSERT_EQ(rows_data[3], -3.0);
+    nt->releaseBlockOfRows(rows);
+}
+
+TEST(table_conversion_test, can_read_table_of_unsupported_type_by_blocks) {
+    std::int64_t data[] = { 1, 2, 3, 4, 5, 6 };
+
+    homogen_table t{ data, 3, 2, detail::empty_delete<const std::int64_t>() };
+    const auto nt = interop::convert_to_daal_table<float>(t);
+
+    ASSERT_EQ(nt->getNumberOfRows(), std::size_t(3));
+    ASSERT_EQ(nt->getNumberOfColumns(), std::size_t(2));
+
+    daal_dm::BlockDescriptor<float> rows;
+    nt->getBlockOfRows(1, 2, daal_dm::readOnly, rows);
+    const float* rows_data = rows.getBlockPtr();
+    for (std::int64_t i = 0; i < 4; i++) {
+        ASSERT_EQ(rows_data[i], float(data[2 + i]));
+    }
+    nt->releaseBlockOfRows(rows);
+
+    daal_dm::BlockDescriptor<float> column;
+    nt->getBlockOfColumnValues(1, 0, 3, daal_dm::readOnly, column);
+    const float* column_data = column.getBlockPtr();
+    for (std::int64_t i = 0; i < 3; i++) {
+        ASSERT_EQ(column_data[i], float(data[2 * i + 1]));
+    }
+    nt->releaseBlockOfColumnValues(column);
+}
+
+TEST(table_conversion_test, cannot_write_to_wrapped_table) {
+    float data[] = { 1.0f, 2.0f, 3.0f, -1.0f, -2.0f, -3.0f };
+
+    homogen_table t{ data, 3, 2, detail::empty_delete<const float>(), data_layout::column_major };
+    const auto nt = interop::convert_to_daal_table<float>(t);
+
+    daal_dm::BlockDescriptor<float> rows;
+    const auto status = nt->getBlockOfRows(0, 3, daal_dm::readWrite, rows);
+    ASSERT_FALSE(status.ok());
+}
@@ -0,0 +1,171 @@
+/* file: assoc_rules_fpgrowth_batch.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of association rules mining with the FP-Growth method
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-FPGROWTH_BATCH"></a>
+ * \example assoc_rules_fpgrowth_batch.cpp
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "daal.h"
+#include "service.h"
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+string datasetFileName = "../data/batch/apriori.csv";
+
+/* Association rules algorithm parameters */
+const double minSupport    = 0.001; /* Minimum support */
+const double minConfidence = 0.7;   /* Minimum confidence */
+
+typedef vector<int> Itemset;
+
+template <association_rules::Method method>
+association_rules::ResultPtr mineRules(const NumericTablePtr & data)
+{
+    association_rules::Batch<float, method> algorithm;
+    algorithm.input.set(association_rules::data, data);
+    algorithm.parameter.minSupport    = minSupport;
+    algorithm.parameter.minConfidence = minConfidence;
+    algorithm.compute();
+    return algorithm.getResult();
+}
+
+/* Collects the items of each item set or rule part stored as (id, item) pairs */
+vector<Itemset> readItemsets(const NumericTablePtr & table, size_t nItemsets)
+{
+    const size_t nRows = table->getNumberOfRows();
+    BlockDescriptor<int> block;
+    table->getBlockOfRows(0, nRows, readOnly, block);
+    const int * pairs = block.getBlockPtr();
+
+    vector<Itemset> itemsets(nItemsets);
+    for (size_t i = 0; i < nRows; i++)
+    {
+        itemsets[pairs[2 * i]].push_back(pairs[2 * i + 1]);
+    }
+    table->releaseBlockOfRows(block);
+
+    for (size_t i = 0; i < nItemsets; i++)
+    {
+        sort(itemsets[i].begin(), itemsets[i].end());
+    }
+    return itemsets;
+}
+
+/* Large item sets with their supports, independent of the order in which the method finds them */
+map<Itemset, int> getItemsets(const association_rules::ResultPtr & res)
+{
+    NumericTablePtr supportTable = res->get(association_rules::largeItemsetsSupport);
+    const size_t nItemsets       = supportTable->getNumberOfRows();
+    const vector<Itemset> items  = readItemsets(res->get(association_rules::largeItemsets), nItemsets);
+
+    BlockDescriptor<int> block;
+    supportTable->getBlockOfRows(0, nItemsets, readOnly, block);
+    const int * support = block.getBlockPtr();
+
+    map<Itemset, int> itemsets;
+    for (size_t i = 0; i < nItemsets; i++)
+    {
+        itemsets[items[support[2 * i]]] = support[2 * i + 1];
+    }
+    supportTable->releaseBlockOfRows(block);
+    return itemsets;
+}
+
+/* Association rules with their confidences, independent of the order in which the method finds them */
+map<pair<Itemset, Itemset>, float> getRules(const association_rules::ResultPtr & res)
+{
+    NumericTablePtr confidenceTable = res->get(association_rules::confidence);
+    const size_t nRules             = confidenceTable->getNumberOfRows();
+    const vector<Itemset> left      = readItemsets(res->get(association_rules::antecedentItemsets), nRules);
+    const vector<Itemset> right     = readItemsets(res->get(association_rules::consequentItemsets), nRules);
+
+    BlockDescriptor<float> block;
+    confidenceTable->getBlockOfRows(0, nRules, readOnly, block);
+    const float * confidence = block.getBlockPtr();
+
+    map<pair<Itemset, Itemset>, float> rules;
+    for (size_t i = 0; i < nRules; i++)
+    {
+        rules[make_pair(left[i], right[i])] = confidence[i];
+    }
+    confidenceTable->releaseBlockOfRows(block);
+    return rules;
+}
+
+bool equalResults(const association_rules::ResultPtr & fpGrowthRes, const association_rules::ResultPtr & aprioriRes)
+{
+    if (getItemsets(fpGrowthRes) != getItemsets(aprioriRes)) return false;
+
+    const map<pair<Itemset, Itemset>, float> fpGrowthRules = getRules(fpGrowthRes);
+    const map<pair<Itemset, Itemset>, float> aprioriRules  = getRules(aprioriRes);
+    if (fpGrowthRules.size() != aprioriRules.size()) return false;
+
+    map<pair<Itemset, Itemset>, float>::const_iterator it1 = fpGrowthRules.begin();
+    map<pair<Itemset, Itemset>, float>::const_iterator it2 = aprioriRules.begin();
+    for (; it1 != fpGrowthRules.end(); ++it1, ++it2)
+    {
+        if (it1->first != it2->first || fabs(it1->second - it2->second) > 1e-6f) return false;
+    }
+    return true;
+}
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock();
+
+    /* Find large item sets and construct association rules using the FP-Growth method */
+    association_rules::ResultPtr res = mineRules<association_rules::fpGrowth>(dataSource.getNumericTable());
+
+    /* Print the large item sets */
+    printAprioriItemsets(res->get(association_rules::largeItemsets), res->get(association_rules::largeItemsetsSupport));
+
+    /* Print the association rules */
+    printAprioriRules(res->get(association_rules::antecedentItemsets), res->get(association_rules::consequentItemsets),
+                      res->get(association_rules::confidence));
+
+    /* FP-Growth finds the same large item sets and rules as Apriori, possibly in a different order */
+    association_rules::ResultPtr aprioriRes = mineRules<association_rules::apriori>(dataSource.getNumericTable());
+    if (!equalResults(res, aprioriRes))
+    {
+        std::cout << std::endl << "FP-Growth and Apriori results differ" << std::endl;
+        return -1;
+    }
+    std::cout << std::endl << "FP-Growth and Apriori results match" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,84 @@
+/* file: em_gmm_dense_online.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the expectation-maximization (EM) algorithm for the
+!    Gaussian mixture model (GMM) in the online processing mode
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-EM_GMM_ONLINE"></a>
+ * \example em_gmm_dense_online.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+const std::string datasetFileName = "../data/batch/em_gmm.csv";
+const size_t nComponents          = 2;
+const size_t nVectorsInBlock      = 25;
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Retrieve the first block of the data */
+    dataSource.loadDataBlock(nVectorsInBlock);
+
+    /* Compute initial values for the EM algorithm for the GMM from the first block of the data */
+    em_gmm::init::Batch<> initAlgorihm(nComponents);
+    initAlgorihm.input.set(em_gmm::init::data, dataSource.getNumericTable());
+    initAlgorihm.compute();
+
+    /* Create an algorithm object for the EM algorithm for the GMM in the online processing mode */
+    em_gmm::Online<> algorithm(nComponents);
+    algorithm.input.set(em_gmm::inputValues, initAlgorihm.getResult());
+
+    do
+    {
+        /* Set an input data table for the algorithm */
+        algorithm.input.set(em_gmm::data, dataSource.getNumericTable());
+
+        /* Update the model with one EM iteration on the current block of the data */
+        algorithm.compute();
+    } while (dataSource.loadDataBlock(nVectorsInBlock) == nVectorsInBlock);
+
+    /* Finalize the result in the online processing mode */
+    algorithm.finalizeCompute();
+
+    em_gmm::ResultPtr result = algorithm.getResult();
+
+    /* Print the results */
+    printNumericTable(result->get(em_gmm::weights), "Weights");
+    printNumericTable(result->get(em_gmm::means), "Means");
+    for (size_t i = 0; i < nComponents; i++)
+    {
+        printNumericTable(result->get(em_gmm::covariances, i), "Covariance");
+    }
+
+    return 0;
+}
@@ -0,0 +1,127 @@
+/* file: gbt_reg_quick_scorer_batch.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of gradient boosted trees regression in the batch processing mode.
+!
+!    The program trains the gradient boosted trees regression model on a training
+!    datasetFileName and computes regression for the test data with the QuickScorer
+!    prediction method.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-GBT_REG_QUICK_SCORER_BATCH"></a>
+ * \example gbt_reg_quick_scorer_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::data_management;
+using namespace daal::algorithms::gbt::regression;
+
+/* Input data set parameters */
+const string trainDatasetFileName         = "../data/batch/df_regression_train.csv";
+const string testDatasetFileName          = "../data/batch/df_regression_test.csv";
+const size_t categoricalFeaturesIndices[] = { 3 };
+const size_t nFeatures                    = 13; /* Number of features in training and testing data sets */
+
+/* Gradient boosted trees training parameters */
+const size_t maxIterations = 40;
+
+training::ResultPtr trainModel();
+void testModel(const training::ResultPtr & res);
+void loadData(const std::string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    training::ResultPtr trainingResult = trainModel();
+    testModel(trainingResult);
+
+    return 0;
+}
+
+training::ResultPtr trainModel()
+{
+    /* Create Numeric Tables for training data and dependent variables */
+    NumericTablePtr trainData;
+    NumericTablePtr trainDependentVariable;
+
+    loadData(trainDatasetFileName, trainData, trainDependentVariable);
+
+    /* Create an algorithm object to train the gradient boosted trees regression model with the default method */
+    training::Batch<> algorithm;
+
+    /* Pass a training data set and dependent values to the algorithm */
+    algorithm.input.set(training::data, trainData);
+    algorithm.input.set(training::dependentVariable, trainDependentVariable);
+
+    algorithm.parameter().maxIterations = maxIterations;
+
+    /* Build the gradient boosted trees regression model */
+    algorithm.compute();
+
+    /* Retrieve the algorithm results */
+    return algorithm.getResult();
+}
+
+void testModel(const training::ResultPtr & trainingResult)
+{
+    /* Create Numeric Tables for testing data and ground truth values */
+    NumericTablePtr testData;
+    NumericTablePtr testGroundTruth;
+
+    loadData(testDatasetFileName, testData, testGroundTruth);
+
+    /* Create an algorithm object to predict values of gradient boosted trees regression with the QuickScorer method */
+    prediction::Batch<DAAL_ALGORITHM_FP_TYPE, prediction::quickScorerDense> algorithm;
+
+    /* Pass a testing data set and the trained model to the algorithm */
+    algorithm.input.set(prediction::data, testData);
+    algorithm.input.set(prediction::model, trainingResult->get(training::model));
+
+    /* Predict values of gradient boosted trees regression */
+    algorithm.compute();
+
+    /* Retrieve the algorithm results */
+    prediction::ResultPtr predictionResult = algorithm.getResult();
+    printNumericTable(predictionResult->get(prediction::prediction), "Gradient boosted trees prediction results (first 10 rows):", 10);
+    printNumericTable(testGroundTruth, "Ground truth (first 10 rows):", 10);
+}
+
+void loadData(const std::string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(fileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for training data and dependent variables */
+    pData.reset(new HomogenNumericTable<>(nFeatures, 0, NumericTable::notAllocate));
+    pDependentVar.reset(new HomogenNumericTable<>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(pData, pDependentVar));
+
+    /* Retrieve the data from input file */
+    trainDataSource.loadDataBlock(mergedData.get());
+
+    NumericTableDictionaryPtr pDictionary = pData->getDictionarySharedPtr();
+    for (size_t i = 0, n = sizeof(categoricalFeaturesIndices) / sizeof(categoricalFeaturesIndices[0]); i < n; ++i)
+        (*pDictionary)[categoricalFeaturesIndices[i]].featureType = data_feature_utils::DAAL_CATEGORICAL;
+}
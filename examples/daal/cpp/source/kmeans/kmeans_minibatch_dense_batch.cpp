@@ -0,0 +1,81 @@
+/* file: kmeans_minibatch_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of dense mini-batch K-Means clustering in the batch processing mode
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-KMEANS_MINIBATCH_DENSE_BATCH"></a>
+ * \example kmeans_minibatch_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+string datasetFileName = "../data/batch/kmeans_dense.csv";
+
+/* K-Means algorithm parameters */
+const size_t nClusters   = 20;
+const size_t nIterations = 50;
+const size_t batchSize   = 500;
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock();
+
+    /* Get initial clusters for the K-Means algorithm */
+    kmeans::init::Batch<float, kmeans::init::randomDense> init(nClusters);
+
+    init.input.set(kmeans::init::data, dataSource.getNumericTable());
+    init.compute();
+
+    NumericTablePtr centroids = init.getResult()->get(kmeans::init::centroids);
+
+    /* Create an algorithm object for the K-Means algorithm with the mini-batch method */
+    kmeans::Batch<float, kmeans::miniBatchDense> algorithm(nClusters, nIterations);
+
+    algorithm.input.set(kmeans::data, dataSource.getNumericTable());
+    algorithm.input.set(kmeans::inputCentroids, centroids);
+
+    /* Every iteration updates the centroids with batchSize observations sampled by the engine */
+    algorithm.parameter().batchSize         = batchSize;
+    algorithm.parameter().engine            = engines::mt19937::Batch<>::create(777);
+    algorithm.parameter().resultsToEvaluate = kmeans::computeCentroids | kmeans::computeAssignments | kmeans::computeExactObjectiveFunction;
+
+    algorithm.compute();
+
+    /* Print the clusterization results */
+    printNumericTable(algorithm.getResult()->get(kmeans::assignments), "First 10 cluster assignments:", 10);
+    printNumericTable(algorithm.getResult()->get(kmeans::centroids), "First 10 dimensions of centroids:", 20, 10);
+    printNumericTable(algorithm.getResult()->get(kmeans::objectiveFunction), "Objective function value:");
+
+    return 0;
+}
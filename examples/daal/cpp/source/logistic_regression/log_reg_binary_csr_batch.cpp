@@ -0,0 +1,200 @@
+/* file: log_reg_binary_csr_batch.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of logistic regression 2 classes in the batch processing mode
+!    for the data in the compressed sparse row (CSR) format.
+!
+!    The program trains the logistic regression model on the sparse training
+!    data set, checks that the model matches the one trained on the dense data
+!    and computes classification for the sparse test data.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-LOG_REG_BINARY_CSR_BATCH"></a>
+ * \example log_reg_binary_csr_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+using namespace daal::algorithms::logistic_regression;
+
+/* Input data set parameters */
+string trainDatasetFileName = "../data/batch/binary_cls_train.csv";
+string testDatasetFileName  = "../data/batch/binary_cls_test.csv";
+const size_t nFeatures      = 20; /* Number of features in training and testing data sets */
+
+/* Logistic regression training parameters */
+const size_t nClasses = 2; /* Number of classes */
+
+/* Sparse copy of the dense data set, the arrays are kept while the table is used */
+struct SparseData
+{
+    std::vector<float> values;
+    std::vector<size_t> colIndices;
+    std::vector<size_t> rowOffsets;
+    CSRNumericTablePtr table;
+};
+
+template <training::Method method>
+logistic_regression::ModelPtr trainModel(const NumericTablePtr & data, const NumericTablePtr & dependentVariable);
+void testModel(const logistic_regression::ModelPtr & model, const NumericTablePtr & testData, const NumericTablePtr & testGroundTruth);
+bool equalCoefficients(const logistic_regression::ModelPtr & a, const logistic_regression::ModelPtr & b);
+void loadData(const std::string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar);
+void toCSR(const NumericTablePtr & dense, SparseData & sparse);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    NumericTablePtr trainData;
+    NumericTablePtr trainDependentVariable;
+    loadData(trainDatasetFileName, trainData, trainDependentVariable);
+
+    SparseData sparseTrainData;
+    toCSR(trainData, sparseTrainData);
+
+    /* Stochastic solvers gather the rows of each batch of the sparse data set */
+    logistic_regression::ModelPtr model      = trainModel<training::fastCSR>(sparseTrainData.table, trainDependentVariable);
+    logistic_regression::ModelPtr denseModel = trainModel<training::defaultDense>(trainData, trainDependentVariable);
+    printNumericTable(model->getBeta(), "Logistic Regression coefficients:");
+
+    if (!equalCoefficients(model, denseModel))
+    {
+        std::cout << "Coefficients trained on the sparse and dense data differ" << std::endl;
+        return -1;
+    }
+    std::cout << "Coefficients trained on the sparse and dense data match" << std::endl;
+
+    NumericTablePtr testData;
+    NumericTablePtr testGroundTruth;
+    loadData(testDatasetFileName, testData, testGroundTruth);
+
+    SparseData sparseTestData;
+    toCSR(testData, sparseTestData);
+    testModel(model, sparseTestData.table, testGroundTruth);
+
+    return 0;
+}
+
+template <training::Method method>
+logistic_regression::ModelPtr trainModel(const NumericTablePtr & data, const NumericTablePtr & dependentVariable)
+{
+    /* Create an algorithm object to train the logistic regression model */
+    training::Batch<float, method> algorithm(nClasses);
+
+    /* Pass a training data set and dependent values to the algorithm */
+    algorithm.input.set(classifier::training::data, data);
+    algorithm.input.set(classifier::training::labels, dependentVariable);
+
+    /* Build the logistic regression model */
+    algorithm.compute();
+
+    /* Retrieve the algorithm results */
+    return algorithm.getResult()->get(classifier::training::model);
+}
+
+void testModel(const logistic_regression::ModelPtr & model, const NumericTablePtr & testData, const NumericTablePtr & testGroundTruth)
+{
+    /* Create an algorithm object to predict values of logistic regression */
+    prediction::Batch<float, prediction::fastCSR> algorithm(nClasses);
+
+    /* Pass a testing data set and the trained model to the algorithm */
+    algorithm.input.set(classifier::prediction::data, testData);
+    algorithm.input.set(classifier::prediction::model, model);
+
+    /* Predict values of logistic regression */
+    algorithm.compute();
+
+    /* Retrieve the algorithm results */
+    classifier::prediction::ResultPtr predictionResult = algorithm.getResult();
+    printNumericTable(predictionResult->get(classifier::prediction::prediction), "Logistic regression prediction results (first 10 rows):", 10);
+    printNumericTable(testGroundTruth, "Ground truth (first 10 rows):", 10);
+}
+
+bool equalCoefficients(const logistic_regression::ModelPtr & a, const logistic_regression::ModelPtr & b)
+{
+    NumericTablePtr betaA = a->getBeta();
+    NumericTablePtr betaB = b->getBeta();
+
+    BlockDescriptor<float> blockA, blockB;
+    betaA->getBlockOfRows(0, betaA->getNumberOfRows(), readOnly, blockA);
+    betaB->getBlockOfRows(0, betaB->getNumberOfRows(), readOnly, blockB);
+
+    /* The sums over the sparse and dense rows differ by the rounding errors only */
+    const float eps = 1e-3f;
+    const size_t n  = betaA->getNumberOfRows() * betaA->getNumberOfColumns();
+    bool equal      = true;
+    for (size_t i = 0; i < n; i++)
+    {
+        const float valueA = blockA.getBlockPtr()[i];
+        const float valueB = blockB.getBlockPtr()[i];
+        const float scale  = (valueB > 1.0f || valueB < -1.0f) ? valueB : 1.0f;
+        const float diff   = (valueA - valueB) / scale;
+        equal &= (diff < eps && diff > -eps);
+    }
+
+    betaA->releaseBlockOfRows(blockA);
+    betaB->releaseBlockOfRows(blockB);
+    return equal;
+}
+
+void loadData(const std::string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(fileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for training data and dependent variables */
+    pData.reset(new HomogenNumericTable<>(nFeatures, 0, NumericTable::notAllocate));
+    pDependentVar.reset(new HomogenNumericTable<>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(pData, pDependentVar));
+
+    /* Retrieve the data from input file */
+    trainDataSource.loadDataBlock(mergedData.get());
+}
+
+void toCSR(const NumericTablePtr & dense, SparseData & sparse)
+{
+    const size_t nRows = dense->getNumberOfRows();
+    const size_t nCols = dense->getNumberOfColumns();
+
+    BlockDescriptor<float> block;
+    dense->getBlockOfRows(0, nRows, readOnly, block);
+    const float * const data = block.getBlockPtr();
+
+    /* One-based indices of the CSR format */
+    sparse.rowOffsets.push_back(1);
+    for (size_t i = 0; i < nRows; i++)
+    {
+        for (size_t j = 0; j < nCols; j++)
+        {
+            if (data[i * nCols + j] == 0.0f) continue;
+            sparse.values.push_back(data[i * nCols + j]);
+            sparse.colIndices.push_back(j + 1);
+        }
+        sparse.rowOffsets.push_back(sparse.values.size() + 1);
+    }
+    dense->releaseBlockOfRows(block);
+
+    sparse.table = CSRNumericTable::create(&sparse.values[0], &sparse.colIndices[0], &sparse.rowOffsets[0], nCols, nRows);
+}
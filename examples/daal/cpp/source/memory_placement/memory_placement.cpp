@@ -0,0 +1,110 @@
+/* file: memory_placement.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of placing the memory of numeric tables on NUMA nodes
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-MEMORY_PLACEMENT"></a>
+ * \example memory_placement.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Numeric table parameters, the table is big enough to have its memory placed */
+const size_t nFeatures     = 20;
+const size_t nObservations = 100000;
+
+/* Allocates the table with the given placement policy and computes low order moments of its data */
+NumericTablePtr computeMeans(MemoryPlacement placement, bool & zeroInitialized)
+{
+    services::Environment::getInstance()->setMemoryPlacement(placement);
+
+    services::Status s;
+    services::SharedPtr<HomogenNumericTable<> > dataTable = HomogenNumericTable<>::create(nFeatures, nObservations, NumericTable::doAllocate, &s);
+    checkStatus(s);
+
+    /* Restore the default policy for the tables allocated next */
+    services::Environment::getInstance()->setMemoryPlacement(defaultPlacement);
+
+    float * data    = dataTable->getArray();
+    zeroInitialized = true;
+    for (size_t i = 0; i < nObservations; i++)
+    {
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            zeroInitialized &= (data[i * nFeatures + j] == 0.0f);
+            data[i * nFeatures + j] = float((i * 7 + j * 13) % 101) / 101.0f;
+        }
+    }
+
+    low_order_moments::Batch<> algorithm;
+    algorithm.input.set(low_order_moments::data, dataTable);
+    algorithm.compute();
+
+    return algorithm.getResult()->get(low_order_moments::mean);
+}
+
+bool equalTables(const NumericTablePtr & a, const NumericTablePtr & b)
+{
+    BlockDescriptor<float> blockA, blockB;
+    a->getBlockOfRows(0, a->getNumberOfRows(), readOnly, blockA);
+    b->getBlockOfRows(0, b->getNumberOfRows(), readOnly, blockB);
+
+    bool equal      = true;
+    const size_t nA = a->getNumberOfRows() * a->getNumberOfColumns();
+    for (size_t i = 0; i < nA; i++)
+    {
+        equal &= (blockA.getBlockPtr()[i] == blockB.getBlockPtr()[i]);
+    }
+
+    a->releaseBlockOfRows(blockA);
+    b->releaseBlockOfRows(blockB);
+    return equal;
+}
+
+int main(int argc, char * argv[])
+{
+    bool zeroInitialized  = false;
+    NumericTablePtr means = computeMeans(defaultPlacement, zeroInitialized);
+
+    const MemoryPlacement placements[] = { firstTouchPlacement, interleavedPlacement };
+    const char * names[]               = { "first touch", "interleaved" };
+    for (size_t i = 0; i < 2; i++)
+    {
+        /* The memory placed on the nodes is zeroed, the results do not depend on the placement */
+        NumericTablePtr placedMeans = computeMeans(placements[i], zeroInitialized);
+        if (!zeroInitialized || !equalTables(means, placedMeans))
+        {
+            std::cout << "Results with " << names[i] << " memory placement differ from the default ones" << std::endl;
+            return -1;
+        }
+        std::cout << "Results with " << names[i] << " memory placement match the default ones" << std::endl;
+    }
+
+    printNumericTable(means, "Means:");
+
+    return 0;
+}
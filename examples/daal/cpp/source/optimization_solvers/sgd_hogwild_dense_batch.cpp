@@ -0,0 +1,104 @@
+/* file: sgd_hogwild_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the parallel lock-free (Hogwild) Stochastic gradient descent algorithm
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-SGD_HOGWILD_BATCH"></a>
+ * \example sgd_hogwild_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+string datasetFileName = "../data/batch/mse.csv";
+
+const size_t nFeatures            = 3;
+const double accuracyThreshold    = 0.0000001;
+const size_t nIterations          = 200;
+const size_t innerNIterations     = 5;
+const size_t batchSize            = 4;
+const float learningRate          = 0.5;
+float initialPoint[nFeatures + 1] = { 8, 2, 1, 4 };
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for data and values for dependent variable */
+    NumericTablePtr data(new HomogenNumericTable<>(nFeatures, 0, NumericTable::doNotAllocate));
+    NumericTablePtr dependentVariables(new HomogenNumericTable<>(1, 0, NumericTable::doNotAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(data, dependentVariables));
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock(mergedData.get());
+
+    size_t nVectors = data->getNumberOfRows();
+
+    services::SharedPtr<optimization_solver::mse::Batch<> > mseObjectiveFunction(new optimization_solver::mse::Batch<>(nVectors));
+    mseObjectiveFunction->input.set(optimization_solver::mse::data, data);
+    mseObjectiveFunction->input.set(optimization_solver::mse::dependentVariables, dependentVariables);
+
+    /* Create objects to compute the Stochastic gradient descent result using the Hogwild method */
+    optimization_solver::sgd::Batch<float, optimization_solver::sgd::hogwild> sgdHogwildAlgorithm(mseObjectiveFunction);
+
+    /* Set input objects for the the Stochastic gradient descent algorithm.
+     * The threads average their updates, so the result does not depend on their scheduling,
+     * but it depends on the number of threads */
+    sgdHogwildAlgorithm.input.set(optimization_solver::iterative_solver::inputArgument,
+                                  NumericTablePtr(new HomogenNumericTable<>(initialPoint, 1, nFeatures + 1)));
+    sgdHogwildAlgorithm.parameter.learningRateSequence   = NumericTablePtr(new HomogenNumericTable<>(1, 1, NumericTable::doAllocate, learningRate));
+    sgdHogwildAlgorithm.parameter.nIterations            = nIterations / 2;
+    sgdHogwildAlgorithm.parameter.innerNIterations       = innerNIterations;
+    sgdHogwildAlgorithm.parameter.batchSize              = batchSize;
+    sgdHogwildAlgorithm.parameter.accuracyThreshold      = accuracyThreshold;
+    sgdHogwildAlgorithm.parameter.averageUpdates         = true;
+    sgdHogwildAlgorithm.parameter.optionalResultRequired = true;
+
+    /* Compute the Stochastic gradient descent result */
+    sgdHogwildAlgorithm.compute();
+
+    /* Print computed the Stochastic gradient descent result */
+    printNumericTable(sgdHogwildAlgorithm.getResult()->get(optimization_solver::iterative_solver::minimum), "Minimum after first compute():");
+    printNumericTable(sgdHogwildAlgorithm.getResult()->get(optimization_solver::iterative_solver::nIterations), "Number of iterations performed:");
+
+    /* Continue the computation from the last iteration, the threads continue their streams of random numbers */
+    sgdHogwildAlgorithm.input.set(optimization_solver::iterative_solver::inputArgument,
+                                  sgdHogwildAlgorithm.getResult()->get(optimization_solver::iterative_solver::minimum));
+    sgdHogwildAlgorithm.input.set(optimization_solver::iterative_solver::optionalArgument,
+                                  sgdHogwildAlgorithm.getResult()->get(optimization_solver::iterative_solver::optionalResult));
+
+    /* Compute the Stochastic gradient descent result */
+    sgdHogwildAlgorithm.compute();
+
+    /* Print computed the Stochastic gradient descent result */
+    printNumericTable(sgdHogwildAlgorithm.getResult()->get(optimization_solver::iterative_solver::minimum), "Minimum after second compute():");
+    printNumericTable(sgdHogwildAlgorithm.getResult()->get(optimization_solver::iterative_solver::nIterations), "Number of iterations performed:");
+
+    return 0;
+}
@@ -0,0 +1,151 @@
+/* file: svd_randomized_dense_distr.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of computation of the leading singular values and vectors
+!    with the randomized singular value decomposition (SVD) in the distributed
+!    processing mode
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-SVD_RANDOMIZED_DISTRIBUTED"></a>
+ * \example svd_randomized_dense_distr.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+const size_t nBlocks     = 4;
+const size_t nComponents = 5;
+
+const string datasetFileNames[] = { "../data/distributed/svd_1.csv", "../data/distributed/svd_2.csv", "../data/distributed/svd_3.csv",
+                                    "../data/distributed/svd_4.csv" };
+
+void computestep1Local(size_t block);
+void computeOnMasterNode();
+void finalizeComputestep1Local(size_t block);
+
+DataCollectionPtr dataFromStep1ForStep2[nBlocks];
+DataCollectionPtr dataFromStep1ForStep3[nBlocks];
+DataCollectionPtr dataFromStep2ForStep3[nBlocks];
+NumericTablePtr Sigma;
+NumericTablePtr V;
+NumericTablePtr Ui[nBlocks];
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 4, &datasetFileNames[0], &datasetFileNames[1], &datasetFileNames[2], &datasetFileNames[3]);
+
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        computestep1Local(i);
+    }
+
+    computeOnMasterNode();
+
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        finalizeComputestep1Local(i);
+    }
+
+    /* Print the results */
+    printNumericTable(Sigma, "Leading singular values:");
+    printNumericTable(V, "Leading right singular vectors V:");
+    printNumericTable(Ui[0], "Part of leading left singular vectors U from 1st node:", 10);
+
+    return 0;
+}
+
+void computestep1Local(size_t block)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileNames[block], DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Retrieve the input data */
+    dataSource.loadDataBlock();
+
+    /* Create an algorithm to sketch the local data with the randomized method on the local node */
+    svd::Distributed<step1Local, float, svd::randomizedDense> algorithm;
+
+    algorithm.input.set(svd::data, dataSource.getNumericTable());
+    algorithm.parameter.nComponents      = nComponents;
+    algorithm.parameter.nOversamples     = 5;
+    algorithm.parameter.nPowerIterations = 2;
+    /* Every node uses its own stream of random numbers */
+    algorithm.parameter.engine = engines::mt19937::Batch<float>::create(777 + block);
+
+    /* Compute SVD */
+    algorithm.compute();
+
+    dataFromStep1ForStep2[block] = algorithm.getPartialResult()->get(svd::outputOfStep1ForStep2);
+    dataFromStep1ForStep3[block] = algorithm.getPartialResult()->get(svd::outputOfStep1ForStep3);
+}
+
+void computeOnMasterNode()
+{
+    /* Create an algorithm to compute the leading part of SVD of the local sketches on the master node */
+    svd::Distributed<step2Master, float, svd::randomizedDense> algorithm;
+
+    algorithm.parameter.nComponents = nComponents;
+
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        algorithm.input.add(svd::inputOfStep2FromStep1, i, dataFromStep1ForStep2[i]);
+    }
+
+    /* Compute SVD */
+    algorithm.compute();
+
+    svd::DistributedPartialResultPtr pres = algorithm.getPartialResult();
+
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        dataFromStep2ForStep3[i] = pres->get(svd::outputOfStep2ForStep3, i);
+    }
+
+    svd::ResultPtr res = algorithm.getResult();
+
+    Sigma = res->get(svd::singularValues);
+    V     = res->get(svd::rightSingularMatrix);
+}
+
+void finalizeComputestep1Local(size_t block)
+{
+    /* Create an algorithm to compute the leading left singular vectors on the local node */
+    svd::Distributed<step3Local, float, svd::randomizedDense> algorithm;
+
+    algorithm.parameter.nComponents = nComponents;
+
+    algorithm.input.set(svd::inputOfStep3FromStep1, dataFromStep1ForStep3[block]);
+    algorithm.input.set(svd::inputOfStep3FromStep2, dataFromStep2ForStep3[block]);
+
+    /* Compute SVD */
+    algorithm.compute();
+
+    algorithm.finalizeCompute();
+
+    svd::ResultPtr res = algorithm.getResult();
+
+    Ui[block] = res->get(svd::leftSingularMatrix);
+}
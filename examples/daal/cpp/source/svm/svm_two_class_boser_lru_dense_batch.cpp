@@ -0,0 +1,155 @@
+/* file: svm_two_class_boser_lru_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of two-class support vector machine (SVM) classification using
+!    the Boser method with the cache of the least recently used rows of the kernel matrix
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-SVM_TWO_CLASS_BOSER_LRU_DENSE_BATCH"></a>
+ * \example svm_two_class_boser_lru_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+string trainDatasetFileName = "../data/batch/svm_two_class_train_dense.csv";
+string testDatasetFileName  = "../data/batch/svm_two_class_test_dense.csv";
+
+const size_t nFeatures = 20;
+
+/* The cache keeps 200 rows of the kernel matrix of the 2000 training observations */
+const size_t cacheSize = 200 * 2000 * sizeof(float);
+
+/* Parameters for the SVM kernel function */
+kernel_function::KernelIfacePtr kernel(new kernel_function::linear::Batch<>());
+
+NumericTablePtr testGroundTruth;
+
+svm::training::ResultPtr trainModel(bool useLruCache);
+NumericTablePtr testModel(const svm::training::ResultPtr & trainingResult);
+bool equalLabels(const NumericTablePtr & a, const NumericTablePtr & b);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    /* Rows of the kernel matrix that do not fit into the cache are computed on each request */
+    NumericTablePtr predictions = testModel(trainModel(false));
+
+    /* Rows of the kernel matrix that are used most recently are kept in the cache */
+    NumericTablePtr lruPredictions = testModel(trainModel(true));
+
+    printNumericTables<int, float>(testGroundTruth, lruPredictions, "Ground truth\t", "Classification results",
+                                   "SVM classification results (first 20 observations):", 20);
+
+    /* The cache does not change the trained model, so the classes are the same */
+    if (!equalLabels(predictions, lruPredictions))
+    {
+        std::cout << std::endl << "Results with and without the LRU cache differ" << std::endl;
+        return -1;
+    }
+    std::cout << std::endl << "Results with and without the LRU cache match" << std::endl;
+
+    return 0;
+}
+
+svm::training::ResultPtr trainModel(bool useLruCache)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(trainDatasetFileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for training data and labels */
+    NumericTablePtr trainData        = HomogenNumericTable<>::create(nFeatures, 0, NumericTable::doNotAllocate);
+    NumericTablePtr trainGroundTruth = HomogenNumericTable<>::create(1, 0, NumericTable::doNotAllocate);
+    NumericTablePtr mergedData       = MergedNumericTable::create(trainData, trainGroundTruth);
+
+    /* Retrieve the data from the input file */
+    trainDataSource.loadDataBlock(mergedData.get());
+
+    /* Create an algorithm object to train the SVM model */
+    svm::training::Batch<float, svm::training::boser> algorithm;
+
+    algorithm.parameter.kernel      = kernel;
+    algorithm.parameter.cacheSize   = cacheSize;
+    algorithm.parameter.useLruCache = useLruCache;
+
+    /* Pass a training data set and dependent values to the algorithm */
+    algorithm.input.set(classifier::training::data, trainData);
+    algorithm.input.set(classifier::training::labels, trainGroundTruth);
+
+    /* Build the SVM model */
+    algorithm.compute();
+
+    /* Retrieve the algorithm results */
+    return algorithm.getResult();
+}
+
+NumericTablePtr testModel(const svm::training::ResultPtr & trainingResult)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the test data from a .csv file */
+    FileDataSource<CSVFeatureManager> testDataSource(testDatasetFileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for testing data and labels */
+    NumericTablePtr testData   = HomogenNumericTable<>::create(nFeatures, 0, NumericTable::doNotAllocate);
+    testGroundTruth            = HomogenNumericTable<>::create(1, 0, NumericTable::doNotAllocate);
+    NumericTablePtr mergedData = MergedNumericTable::create(testData, testGroundTruth);
+
+    /* Retrieve the data from input file */
+    testDataSource.loadDataBlock(mergedData.get());
+
+    /* Create an algorithm object to predict SVM values */
+    svm::prediction::Batch<> algorithm;
+
+    algorithm.parameter.kernel = kernel;
+
+    /* Pass a testing data set and the trained model to the algorithm */
+    algorithm.input.set(classifier::prediction::data, testData);
+    algorithm.input.set(classifier::prediction::model, trainingResult->get(classifier::training::model));
+
+    /* Predict SVM values */
+    algorithm.compute();
+
+    /* Retrieve the algorithm results */
+    return algorithm.getResult()->get(classifier::prediction::prediction);
+}
+
+bool equalLabels(const NumericTablePtr & a, const NumericTablePtr & b)
+{
+    BlockDescriptor<float> blockA, blockB;
+    a->getBlockOfRows(0, a->getNumberOfRows(), readOnly, blockA);
+    b->getBlockOfRows(0, b->getNumberOfRows(), readOnly, blockB);
+
+    bool equal = (a->getNumberOfRows() == b->getNumberOfRows());
+    for (size_t i = 0; equal && i < a->getNumberOfRows(); i++)
+    {
+        equal = ((blockA.getBlockPtr()[i] > 0.0f) == (blockB.getBlockPtr()[i] > 0.0f));
+    }
+
+    a->releaseBlockOfRows(blockA);
+    b->releaseBlockOfRows(blockB);
+    return equal;
+}